@@ -54,6 +54,12 @@
  * Local Variables
  *****************************************************************************/
 
+/** Is the time frozen? */
+static bool             gIsTimeFrozen   = false;
+
+/** Frozen timestamp in ms */
+static unsigned long    gFrozenTime     = 0UL;
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -72,9 +78,31 @@
 
 extern unsigned long millis()
 {
-    clock_t now = clock();
+    unsigned long timestamp = gFrozenTime;
+
+    if (false == gIsTimeFrozen)
+    {
+        clock_t now = clock();
+
+        timestamp = (now * 1000UL) / CLOCKS_PER_SEC;
+    }
+
+    return timestamp;
+}
+
+extern void freezeMillis(unsigned long timestamp)
+{
+    gFrozenTime     = timestamp;
+    gIsTimeFrozen   = true;
+
+    return;
+}
+
+extern void unfreezeMillis()
+{
+    gIsTimeFrozen = false;
 
-    return (now * 1000UL) / CLOCKS_PER_SEC;
+    return;
 }
 
 extern uint32_t esp_log_timestamp(void)
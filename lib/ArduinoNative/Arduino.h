@@ -78,6 +78,19 @@ typedef bool boolean;
  */
 extern unsigned long millis();
 
+/**
+ * Freeze the time for test purposes. Until the time is unfrozen, millis()
+ * returns the given timestamp.
+ * 
+ * @param[in] timestamp Timestamp in ms
+ */
+extern void freezeMillis(unsigned long timestamp);
+
+/**
+ * Unfreeze the time, millis() returns the running time again.
+ */
+extern void unfreezeMillis();
+
 /**
  * Get timestamp for log output in ms.
  * 
@@ -47,6 +47,7 @@
 #include <stdio.h>
 #include <Arduino.h>
 #include <time.h>
+#include <sys/stat.h>
 #include <memory>
 
 /******************************************************************************
@@ -70,6 +71,11 @@ enum SeekMode {
 class File
 {
 public:
+    File() :
+        m_fd(nullptr)
+    {
+    }
+
     File(FILE* fd) :
         m_fd(fd)
     {
@@ -79,8 +85,16 @@ public:
     {
     }
 
-    size_t write(uint8_t data);
-    size_t write(const uint8_t *buf, size_t size);
+    size_t write(uint8_t data)
+    {
+        return write(&data, 1);
+    }
+
+    size_t write(const uint8_t *buf, size_t size)
+    {
+        return fwrite(buf, 1, size, m_fd);
+    }
+
     int available();
     
     int read()
@@ -128,8 +142,11 @@ public:
 
     void close()
     {
-        fclose(m_fd);
-        m_fd = nullptr;
+        if (nullptr != m_fd)
+        {
+            fclose(m_fd);
+            m_fd = nullptr;
+        }
     }
 
     operator bool() const
@@ -137,7 +154,19 @@ public:
         return (nullptr != m_fd);
     }
 
-    time_t getLastWrite();
+    time_t getLastWrite()
+    {
+        time_t      lastWrite   = 0;
+        struct stat fileStat;
+
+        if ((nullptr != m_fd) &&
+            (0 == fstat(fileno(m_fd), &fileStat)))
+        {
+            lastWrite = fileStat.st_mtime;
+        }
+
+        return lastWrite;
+    }
     const char* name() const;
 
     boolean isDirectory(void);
@@ -147,8 +176,6 @@ public:
 private:
 
     FILE*   m_fd;
-
-    File();
 };
 
 class FS
@@ -193,8 +220,15 @@ public:
         return exists(path.c_str());
     }
 
-    bool remove(const char* path);
-    bool remove(const String& path);
+    bool remove(const char* path)
+    {
+        return (0 == ::remove(path));
+    }
+
+    bool remove(const String& path)
+    {
+        return remove(path.c_str());
+    }
 
     bool rename(const char* pathFrom, const char* pathTo);
     bool rename(const String& pathFrom, const String& pathTo);
@@ -436,6 +436,25 @@ public:
         return 0 == strncmp(&m_buffer[offset], s2.m_buffer, s2.length());
     }
 
+    /**
+     * Ends string with given pattern?
+     *
+     * @param[in] s2    Pattern
+     *
+     * @return If string ends with pattern, it will return true otherwise false.
+     */
+    unsigned char endsWith(const String &s2) const
+    {
+        if((length() < s2.length()) ||
+           (nullptr == m_buffer) ||
+           (nullptr == s2.m_buffer))
+        {
+            return 0;
+        }
+
+        return 0 == strcmp(&m_buffer[length() - s2.length()], s2.m_buffer);
+    }
+
     /**
      * Clear string.
      */
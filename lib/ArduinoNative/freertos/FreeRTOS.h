@@ -0,0 +1,171 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  FreeRTOS stuff for test
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * The native tests run in a single thread, therefore the semaphores
+ * are always available.
+ *
+ * @addtogroup test
+ *
+ * @{
+ */
+
+#ifndef __FREERTOS_H__
+#define __FREERTOS_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/** Function result: Successful */
+#define pdTRUE          (1)
+
+/** Function result: Failed */
+#define pdFALSE         (0)
+
+/** Wait infinite. */
+#define portMAX_DELAY   (0xFFFFFFFFU)
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** Tick type */
+typedef uint32_t TickType_t;
+
+/** Base type */
+typedef int BaseType_t;
+
+/** Semaphore handle */
+typedef void* SemaphoreHandle_t;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Create mutex.
+ *
+ * @return Mutex handle
+ */
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    static uint8_t dummy = 0U;
+
+    return &dummy;
+}
+
+/**
+ * Create recursive mutex.
+ *
+ * @return Mutex handle
+ */
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+    return xSemaphoreCreateMutex();
+}
+
+/**
+ * Delete semaphore.
+ *
+ * @param[in] handle    Semaphore handle
+ */
+inline void vSemaphoreDelete(SemaphoreHandle_t handle)
+{
+    (void)handle;
+}
+
+/**
+ * Take semaphore.
+ *
+ * @param[in] handle    Semaphore handle
+ * @param[in] blockTime Max. time to wait in ticks
+ *
+ * @return pdTRUE
+ */
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t blockTime)
+{
+    (void)handle;
+    (void)blockTime;
+
+    return pdTRUE;
+}
+
+/**
+ * Give semaphore.
+ *
+ * @param[in] handle    Semaphore handle
+ *
+ * @return pdTRUE
+ */
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t handle)
+{
+    (void)handle;
+
+    return pdTRUE;
+}
+
+/**
+ * Take recursive mutex.
+ *
+ * @param[in] handle    Mutex handle
+ * @param[in] blockTime Max. time to wait in ticks
+ *
+ * @return pdTRUE
+ */
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t handle, TickType_t blockTime)
+{
+    return xSemaphoreTake(handle, blockTime);
+}
+
+/**
+ * Give recursive mutex.
+ *
+ * @param[in] handle    Mutex handle
+ *
+ * @return pdTRUE
+ */
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t handle)
+{
+    return xSemaphoreGive(handle);
+}
+
+#endif  /* __FREERTOS_H__ */
+
+/** @} */
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "BaseGfx.hpp"
 #include "gfxfont.h"
+#include "UnicodeFont.h"
 
 /******************************************************************************
  * Macros
@@ -57,6 +58,10 @@
 
 /**
  * A graphical font, providing simple single character drawing functionality.
+ *
+ * Two font formats are supported:
+ * - Adafruit GFXfont, which covers a single contiguous ASCII range.
+ * - UnicodeFont, which covers sparse code point ranges.
  */
 template < typename TColor >
 class BaseFont
@@ -68,7 +73,8 @@ public:
      * Note, until no GFXfont is assigned, it can not draw any character.
      */
     BaseFont() :
-        m_gfxFont(nullptr)
+        m_gfxFont(nullptr),
+        m_unicodeFont(nullptr)
     {
     }
 
@@ -78,7 +84,8 @@ public:
      * @param[in] font  Font, which to copy.
      */
     BaseFont(const BaseFont& font) :
-        m_gfxFont(font.m_gfxFont)
+        m_gfxFont(font.m_gfxFont),
+        m_unicodeFont(font.m_unicodeFont)
     {
     }
 
@@ -88,7 +95,19 @@ public:
      * @param[in] gfxFont   GFXfont
      */
     BaseFont(const GFXfont* gfxFont) :
-        m_gfxFont(gfxFont)
+        m_gfxFont(gfxFont),
+        m_unicodeFont(nullptr)
+    {
+    }
+
+    /**
+     * Constructs a font with the given unicode font.
+     * 
+     * @param[in] unicodeFont   Unicode font
+     */
+    BaseFont(const UnicodeFont* unicodeFont) :
+        m_gfxFont(nullptr),
+        m_unicodeFont(unicodeFont)
     {
     }
 
@@ -99,6 +118,34 @@ public:
     {
     }
 
+    /**
+     * Assigns a font.
+     * 
+     * @param[in] font  Font, which to assign.
+     * 
+     * @return Font
+     */
+    BaseFont& operator=(const BaseFont& font)
+    {
+        if (&font != this)
+        {
+            m_gfxFont       = font.m_gfxFont;
+            m_unicodeFont   = font.m_unicodeFont;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Is a graphical font representation available?
+     * 
+     * @return If a font is set, it will return true otherwise false.
+     */
+    bool isAvailable() const
+    {
+        return ((nullptr != m_gfxFont) || (nullptr != m_unicodeFont));
+    }
+
     /**
      * Get GFXfont.
      *
@@ -111,17 +158,41 @@ public:
 
     /**
      * Set GFXfont.
+     * A previous set unicode font will be removed.
      *
      * @param[in] gfxFont   GFXfont
      */
     void setGfxFont(const GFXfont* gfxFont)
     {
-        m_gfxFont = gfxFont;
+        m_gfxFont       = gfxFont;
+        m_unicodeFont   = nullptr;
+    }
+
+    /**
+     * Get unicode font.
+     *
+     * @return Unicode font
+     */
+    const UnicodeFont* getUnicodeFont() const
+    {
+        return m_unicodeFont;
+    }
+
+    /**
+     * Set unicode font.
+     * A previous set GFXfont will be removed.
+     *
+     * @param[in] unicodeFont   Unicode font
+     */
+    void setUnicodeFont(const UnicodeFont* unicodeFont)
+    {
+        m_gfxFont       = nullptr;
+        m_unicodeFont   = unicodeFont;
     }
 
     /**
      * Get font character height.
-     * If no GFXfont is set, it will return 0.
+     * If no font is set, it will return 0.
      * 
      * @return Height in pixels
      */
@@ -133,6 +204,14 @@ public:
         {
             height = m_gfxFont->yAdvance;
         }
+        else if (nullptr != m_unicodeFont)
+        {
+            height = m_unicodeFont->yAdvance;
+        }
+        else
+        {
+            ;
+        }
 
         return height;
     }
@@ -148,20 +227,33 @@ public:
      */
     bool getCharBoundingBox(char singleChar, uint16_t& width, uint16_t& height) const
     {
-        bool    status  = false;
-        uint8_t uChar   = static_cast<uint8_t>(singleChar);
-
-        if ((nullptr != m_gfxFont) &&
-            (m_gfxFont->first <= uChar) &&
-            (m_gfxFont->last >= uChar) &&
-            ('\n' != singleChar) &&
-            ('\r' != singleChar))
+        return getCodePointBoundingBox(static_cast<uint8_t>(singleChar), width, height);
+    }
+
+    /**
+     * Get bounding box of single unicode code point.
+     *
+     * @param[in]   codePoint   Unicode code point
+     * @param[out]  width       Width in pixel
+     * @param[out]  height      Height in pixel
+     *
+     * @return If code point is available in the font, it will return true otherwise false.
+     */
+    bool getCodePointBoundingBox(uint32_t codePoint, uint16_t& width, uint16_t& height) const
+    {
+        bool            status  = false;
+        const GFXglyph* glyph   = nullptr;
+
+        if (('\n' != codePoint) &&
+            ('\r' != codePoint))
         {
-            uint8_t         glyphIndex  = uChar - m_gfxFont->first;
-            const GFXglyph* glyph       = &(m_gfxFont->glyph[glyphIndex]);
+            glyph = getGlyph(codePoint);
+        }
 
+        if (nullptr != glyph)
+        {
             width   = glyph->xAdvance;
-            height  = m_gfxFont->yAdvance;
+            height  = getHeight();
             status  = true;
         }
 
@@ -185,57 +277,58 @@ public:
      */
     void drawChar(BaseGfx<TColor>& gfx, int16_t& cursorX, int16_t& cursorY, char singleChar, const TColor& color)
     {
-        uint8_t uChar = static_cast<uint8_t>(singleChar);
+        drawCodePoint(gfx, cursorX, cursorY, static_cast<uint8_t>(singleChar), color);
+    }
 
-        if (nullptr == m_gfxFont)
+    /**
+     * Draw single unicode code point at current cursor position. The cursor is
+     * automatically moved to the new position.
+     * 
+     * A newline will place the cursor on the begin of the next line.
+     * 
+     * If text wrap around handling is necessary, this must be done in a
+     * higher layer.
+     *
+     * @param[in]       gfx         Graphics interface
+     * @param[in,out]   cursorX     The cursor position x-coordinate.
+     * @param[in,out]   cursorY     The cursor position y-coordinate.
+     * @param[in]       codePoint   Unicode code point which to draw
+     * @param[in]       color       Text color
+     */
+    void drawCodePoint(BaseGfx<TColor>& gfx, int16_t& cursorX, int16_t& cursorY, uint32_t codePoint, const TColor& color)
+    {
+        const GFXglyph* glyph = getGlyph(codePoint);
+
+        if (false == isAvailable())
         {
             return;
         }
 
         /* Set cursor to next line? */
-        if ('\n' == singleChar)
+        if ('\n' == codePoint)
         {
             /* Move cursor to begin and one row down. */
             cursorX = 0;
-            cursorY += m_gfxFont->yAdvance;
+            cursorY += getHeight();
         }
         /* Is character available in the font? Note, carriage return is skipped. */
-        else if (('\r' != singleChar) &&
-                 (m_gfxFont->first <= uChar) &&
-                 (m_gfxFont->last >= uChar))
+        else if (('\r' != codePoint) &&
+                 (nullptr != glyph))
         {
-            uint8_t         glyphIndex  = uChar - m_gfxFont->first;
-            const GFXglyph* glyph       = &(m_gfxFont->glyph[glyphIndex]);
-
             /* Handle character only, if it is really drawn on the screen. */
             if (0 <= (cursorX + glyph->xAdvance))
             {
-                int16_t     x               = 0;
-                int16_t     y               = 0;
-                uint16_t    bitmapOffset    = glyph->bitmapOffset;
-                uint8_t     bitmapRowBits   = 0U;
-                uint8_t     bitCnt          = 0U;
+                int16_t x0 = cursorX + glyph->xOffset;
+                int16_t y0 = cursorY + glyph->yOffset;
 
-                for(y = 0U; y < glyph->height; ++y)
+                if ((nullptr != m_unicodeFont) &&
+                    (UNICODE_FONT_ENCODING_RLE == m_unicodeFont->encoding))
                 {
-                    for(x = 0U; x < glyph->width; ++x)
-                    {
-                        /* Every 8 bit, the bitmap offset must be increased. */
-                        if (0U == (bitCnt & 0x07))
-                        {
-                            bitmapRowBits = m_gfxFont->bitmap[bitmapOffset];
-                            ++bitmapOffset;
-                        }
-                        ++bitCnt;
-
-                        /* A 1b in the bitmap row bits must be drawn as single pixel. */
-                        if (0U != (bitmapRowBits & 0x80U))
-                        {
-                            gfx.drawPixel(cursorX + x + glyph->xOffset, cursorY + y + glyph->yOffset, color);
-                        }
-
-                        bitmapRowBits <<= 1U;
-                    }
+                    drawGlyphRle(gfx, x0, y0, *glyph, color);
+                }
+                else
+                {
+                    drawGlyphBitmap(gfx, x0, y0, *glyph, color);
                 }
             }
 
@@ -250,8 +343,214 @@ public:
 
 private:
 
-    const GFXfont*  m_gfxFont;  /**< Current selected graphics font, based on Adafruit GFXfont format. */
+    const GFXfont*      m_gfxFont;      /**< Current selected graphics font, based on Adafruit GFXfont format. */
+    const UnicodeFont*  m_unicodeFont;  /**< Current selected unicode font, with sparse code point ranges. */
 
+    /**
+     * Get the concatenated glyph bitmaps of the current font.
+     *
+     * @return Glyph bitmaps. If no font is set, it will return nullptr.
+     */
+    const uint8_t* getBitmap() const
+    {
+        const uint8_t* bitmap = nullptr;
+
+        if (nullptr != m_gfxFont)
+        {
+            bitmap = m_gfxFont->bitmap;
+        }
+        else if (nullptr != m_unicodeFont)
+        {
+            bitmap = m_unicodeFont->bitmap;
+        }
+        else
+        {
+            ;
+        }
+
+        return bitmap;
+    }
+
+    /**
+     * Draw a 1 bit per pixel glyph bitmap. Consecutive set pixels in a row
+     * are drawn as one horizontal line, which is much cheaper than drawing
+     * them pixel by pixel.
+     *
+     * @param[in] gfx   Graphics interface
+     * @param[in] x0    x-coordinate of the glyph upper left corner
+     * @param[in] y0    y-coordinate of the glyph upper left corner
+     * @param[in] glyph Glyph which to draw
+     * @param[in] color Text color
+     */
+    void drawGlyphBitmap(BaseGfx<TColor>& gfx, int16_t x0, int16_t y0, const GFXglyph& glyph, const TColor& color) const
+    {
+        uint16_t        x               = 0U;
+        uint16_t        y               = 0U;
+        uint16_t        bitmapOffset    = glyph.bitmapOffset;
+        uint8_t         bitmapRowBits   = 0U;
+        uint8_t         bitCnt          = 0U;
+        const uint8_t*  bitmap          = getBitmap();
+
+        for(y = 0U; y < glyph.height; ++y)
+        {
+            uint16_t spanBegin  = 0U;
+            uint16_t spanLen    = 0U;
+
+            for(x = 0U; x < glyph.width; ++x)
+            {
+                /* Every 8 bit, the bitmap offset must be increased. */
+                if (0U == (bitCnt & 0x07))
+                {
+                    bitmapRowBits = bitmap[bitmapOffset];
+                    ++bitmapOffset;
+                }
+                ++bitCnt;
+
+                /* A 1b in the bitmap row bits extends the current span. */
+                if (0U != (bitmapRowBits & 0x80U))
+                {
+                    if (0U == spanLen)
+                    {
+                        spanBegin = x;
+                    }
+
+                    ++spanLen;
+                }
+                else if (0U < spanLen)
+                {
+                    gfx.drawHLine(x0 + spanBegin, y0 + y, spanLen, color);
+                    spanLen = 0U;
+                }
+                else
+                {
+                    ;
+                }
+
+                bitmapRowBits <<= 1U;
+            }
+
+            if (0U < spanLen)
+            {
+                gfx.drawHLine(x0 + spanBegin, y0 + y, spanLen, color);
+            }
+        }
+    }
+
+    /**
+     * Draw a run length encoded glyph, see UNICODE_FONT_ENCODING_RLE.
+     * Every foreground run is drawn as horizontal line, split at the row ends.
+     *
+     * @param[in] gfx   Graphics interface
+     * @param[in] x0    x-coordinate of the glyph upper left corner
+     * @param[in] y0    y-coordinate of the glyph upper left corner
+     * @param[in] glyph Glyph which to draw
+     * @param[in] color Text color
+     */
+    void drawGlyphRle(BaseGfx<TColor>& gfx, int16_t x0, int16_t y0, const GFXglyph& glyph, const TColor& color) const
+    {
+        const uint8_t*  bitmap          = getBitmap();
+        uint16_t        bitmapOffset    = glyph.bitmapOffset;
+        uint16_t        pixelCnt        = glyph.width * glyph.height;
+        uint16_t        pixelIdx        = 0U;
+        bool            isHighNibble    = true;
+        bool            isForeground    = false;
+
+        while(pixelCnt > pixelIdx)
+        {
+            uint16_t runLen = 0U;
+
+            if (true == isHighNibble)
+            {
+                runLen = (bitmap[bitmapOffset] >> 4U) & 0x0FU;
+            }
+            else
+            {
+                runLen = bitmap[bitmapOffset] & 0x0FU;
+                ++bitmapOffset;
+            }
+            isHighNibble = !isHighNibble;
+
+            if (true == isForeground)
+            {
+                /* Split the run at the row ends. A corrupt run must not exceed the glyph. */
+                while((0U < runLen) && (pixelCnt > pixelIdx))
+                {
+                    uint16_t x      = pixelIdx % glyph.width;
+                    uint16_t y      = pixelIdx / glyph.width;
+                    uint16_t len    = glyph.width - x;
+
+                    if (runLen < len)
+                    {
+                        len = runLen;
+                    }
+
+                    gfx.drawHLine(x0 + x, y0 + y, len, color);
+
+                    pixelIdx    += len;
+                    runLen      -= len;
+                }
+            }
+            else
+            {
+                pixelIdx += runLen;
+            }
+
+            isForeground = !isForeground;
+        }
+    }
+
+    /**
+     * Get the glyph of a code point.
+     * The ranges of a unicode font are binary searched.
+     *
+     * @param[in] codePoint Unicode code point
+     *
+     * @return If the code point is available in the font, it will return its glyph otherwise nullptr.
+     */
+    const GFXglyph* getGlyph(uint32_t codePoint) const
+    {
+        const GFXglyph* glyph = nullptr;
+
+        if (nullptr != m_gfxFont)
+        {
+            if ((m_gfxFont->first <= codePoint) &&
+                (m_gfxFont->last >= codePoint))
+            {
+                glyph = &(m_gfxFont->glyph[codePoint - m_gfxFont->first]);
+            }
+        }
+        else if (nullptr != m_unicodeFont)
+        {
+            uint16_t low    = 0U;
+            uint16_t high   = m_unicodeFont->rangeCnt;
+
+            while(low < high)
+            {
+                uint16_t            mid     = low + (high - low) / 2U;
+                const UnicodeRange& range   = m_unicodeFont->ranges[mid];
+
+                if (range.first > codePoint)
+                {
+                    high = mid;
+                }
+                else if (range.last < codePoint)
+                {
+                    low = mid + 1U;
+                }
+                else
+                {
+                    glyph = &(m_unicodeFont->glyph[range.glyphIndex + (codePoint - range.first)]);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            ;
+        }
+
+        return glyph;
+    }
 };
 
 /******************************************************************************
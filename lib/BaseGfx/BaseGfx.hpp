@@ -165,12 +165,15 @@ public:
      * Draw horizontal line.
      * Note, this is faster than using drawLine().
      *
+     * A derived class with direct access to its pixel buffer shall override
+     * it, because text and filled rectangles are drawn span by span.
+     *
      * @param[in] x     x-coordinate of start point
      * @param[in] y     y-coordinate of start point
      * @param[in] width Horizontal line width in pixel
      * @param[in] color Color
      */
-    void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color)
+    virtual void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color)
     {
         uint16_t idx = 0U;
 
@@ -180,6 +183,30 @@ public:
         }
     }
 
+    /**
+     * Draw a row of pixels, e.g. a row of a bitmap.
+     *
+     * A derived class with direct access to its pixel buffer shall override
+     * it, because bitmaps and animation frames are drawn row by row.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row
+     * @param[in] width     Number of pixels in the row
+     */
+    virtual void drawRow(int16_t x, int16_t y, const TColor* pixels, uint16_t width)
+    {
+        uint16_t idx = 0U;
+
+        if (nullptr != pixels)
+        {
+            for(idx = 0U; idx < width; ++idx)
+            {
+                drawPixel(x + idx, y, pixels[idx]);
+            }
+        }
+    }
+
     /**
      * Draw a line.
      *
@@ -253,15 +280,11 @@ public:
      */
     void fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height, const TColor& color)
     {
-        int16_t xIndex = 0;
         int16_t yIndex = 0;
 
         for(yIndex = 0; yIndex < height; ++yIndex)
         {
-            for(xIndex = 0; xIndex < width; ++xIndex)
-            {
-                drawPixel(x + xIndex, y + yIndex, color);
-            }
+            drawHLine(x, y + yIndex, width, color);
         }
     }
 
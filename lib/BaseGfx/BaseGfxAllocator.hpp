@@ -0,0 +1,190 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Basic graphics memory allocator
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __BASE_GFX_ALLOCATOR_HPP__
+#define __BASE_GFX_ALLOCATOR_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <new>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Allocator for the pixel buffers of dynamic bitmaps. By default the
+ * pixel buffers are allocated from the heap. The application may replace
+ * the allocation functions, e.g. to serve the pixel buffers from memory
+ * pools.
+ *
+ * The allocation functions shall be replaced once during startup, before
+ * any pixel buffer is allocated. Otherwise the deallocation function must
+ * be able to release memory, which was allocated with ::operator new.
+ */
+class BaseGfxAllocator
+{
+public:
+
+    /**
+     * Function to allocate memory.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    typedef void* (*AllocateFunc)(size_t size);
+
+    /**
+     * Function to deallocate memory. A nullptr shall be ignored.
+     *
+     * @param[in] ptr   Memory, which to deallocate.
+     */
+    typedef void (*DeallocateFunc)(void* ptr);
+
+    /**
+     * Replace the allocation functions.
+     * A nullptr restores the corresponding heap function.
+     *
+     * @param[in] allocateFunc      Function to allocate memory
+     * @param[in] deallocateFunc    Function to deallocate memory
+     */
+    static void setFunctions(AllocateFunc allocateFunc, DeallocateFunc deallocateFunc)
+    {
+        Functions& functions = getFunctions();
+
+        functions.allocate      = (nullptr != allocateFunc) ? allocateFunc : heapAllocate;
+        functions.deallocate    = (nullptr != deallocateFunc) ? deallocateFunc : heapDeallocate;
+
+        return;
+    }
+
+    /**
+     * Allocate memory.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* allocate(size_t size)
+    {
+        return getFunctions().allocate(size);
+    }
+
+    /**
+     * Deallocate memory, which was allocated with allocate().
+     * A nullptr is ignored.
+     *
+     * @param[in] ptr   Memory, which to deallocate.
+     */
+    static void deallocate(void* ptr)
+    {
+        if (nullptr != ptr)
+        {
+            getFunctions().deallocate(ptr);
+        }
+
+        return;
+    }
+
+private:
+
+    /**
+     * The currently used allocation functions.
+     */
+    struct Functions
+    {
+        AllocateFunc    allocate;   /**< Function to allocate memory */
+        DeallocateFunc  deallocate; /**< Function to deallocate memory */
+    };
+
+    /**
+     * Get the currently used allocation functions.
+     *
+     * @return Allocation functions
+     */
+    static Functions& getFunctions()
+    {
+        static Functions functions = { heapAllocate, heapDeallocate }; /* Function local to keep the library header-only. */
+
+        return functions;
+    }
+
+    /**
+     * Allocate memory from the heap.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* heapAllocate(size_t size)
+    {
+        return ::operator new(size, std::nothrow);
+    }
+
+    /**
+     * Deallocate memory from the heap.
+     *
+     * @param[in] ptr   Memory, which to deallocate.
+     */
+    static void heapDeallocate(void* ptr)
+    {
+        ::operator delete(ptr);
+
+        return;
+    }
+
+    BaseGfxAllocator();
+    BaseGfxAllocator(const BaseGfxAllocator& allocator);
+    BaseGfxAllocator& operator=(const BaseGfxAllocator& allocator);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BASE_GFX_ALLOCATOR_HPP__ */
+
+/** @} */
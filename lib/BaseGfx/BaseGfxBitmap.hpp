@@ -46,7 +46,10 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <BaseGfx.hpp>
+#include <BaseGfxAllocator.hpp>
+#include <PackedImg.h>
 #include <new>
 
 /******************************************************************************
@@ -248,6 +251,83 @@ public:
         }
     }
 
+    /**
+     * Draw horizontal line.
+     * The line is clipped once and written directly into the pixel buffer.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] lineWidth Horizontal line width in pixel
+     * @param[in] color     Color
+     */
+    virtual void drawHLine(int16_t x, int16_t y, uint16_t lineWidth, const TColor& color)
+    {
+        int32_t xBegin  = x;
+        int32_t xEnd    = static_cast<int32_t>(x) + lineWidth;
+
+        if (0 > xBegin)
+        {
+            xBegin = 0;
+        }
+
+        if (static_cast<int32_t>(width) < xEnd)
+        {
+            xEnd = width;
+        }
+
+        if ((0 <= y) &&
+            (height > y))
+        {
+            TColor* pixel = &m_pixels[pixelMap(0U, y)];
+
+            while(xBegin < xEnd)
+            {
+                pixel[xBegin] = color;
+                ++xBegin;
+            }
+        }
+    }
+
+    /**
+     * Draw a row of pixels.
+     * The row is clipped once and copied directly into the pixel buffer.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row
+     * @param[in] rowWidth  Number of pixels in the row
+     */
+    virtual void drawRow(int16_t x, int16_t y, const TColor* pixels, uint16_t rowWidth)
+    {
+        int32_t xBegin  = x;
+        int32_t xEnd    = static_cast<int32_t>(x) + rowWidth;
+
+        if (0 > xBegin)
+        {
+            xBegin = 0;
+        }
+
+        if (static_cast<int32_t>(width) < xEnd)
+        {
+            xEnd = width;
+        }
+
+        if ((nullptr != pixels) &&
+            (0 <= y) &&
+            (height > y))
+        {
+            TColor*         pixel   = &m_pixels[pixelMap(0U, y)];
+            const TColor*   src     = &pixels[xBegin - x];
+
+            while(xBegin < xEnd)
+            {
+                pixel[xBegin] = *src;
+                ++src;
+                ++xBegin;
+            }
+        }
+    }
+
 private:
 
     /** Number of pixels in the pixel buffer. */
@@ -362,7 +442,11 @@ public:
                     m_height    = 0U;
                 }
 
-                m_pixels = allocatePixels(bitmap.m_width, bitmap.m_height);
+                /* A pixel buffer with the same size is reused. */
+                if (nullptr == m_pixels)
+                {
+                    m_pixels = allocatePixels(bitmap.m_width, bitmap.m_height);
+                }
 
                 if (nullptr != m_pixels)
                 {
@@ -514,6 +598,108 @@ public:
         }
     }
 
+    /**
+     * Draw horizontal line.
+     * The line is clipped once and written directly into the pixel buffer.
+     *
+     * @param[in] x     x-coordinate of start point
+     * @param[in] y     y-coordinate of start point
+     * @param[in] width Horizontal line width in pixel
+     * @param[in] color Color
+     */
+    void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color)
+    {
+        int32_t xBegin  = x;
+        int32_t xEnd    = static_cast<int32_t>(x) + width;
+
+        if (0 > xBegin)
+        {
+            xBegin = 0;
+        }
+
+        if (m_width < xEnd)
+        {
+            xEnd = m_width;
+        }
+
+        if ((nullptr != m_pixels) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            TColor* pixel = &m_pixels[pixelMap(0U, y)];
+
+            while(xBegin < xEnd)
+            {
+                pixel[xBegin] = color;
+                ++xBegin;
+            }
+        }
+    }
+
+    /**
+     * Draw a row of pixels.
+     * The row is clipped once and copied directly into the pixel buffer.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row
+     * @param[in] width     Number of pixels in the row
+     */
+    void drawRow(int16_t x, int16_t y, const TColor* pixels, uint16_t width)
+    {
+        int32_t xBegin  = x;
+        int32_t xEnd    = static_cast<int32_t>(x) + width;
+
+        if (0 > xBegin)
+        {
+            xBegin = 0;
+        }
+
+        if (m_width < xEnd)
+        {
+            xEnd = m_width;
+        }
+
+        if ((nullptr != m_pixels) &&
+            (nullptr != pixels) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            TColor*         pixel   = &m_pixels[pixelMap(0U, y)];
+            const TColor*   src     = &pixels[xBegin - x];
+
+            while(xBegin < xEnd)
+            {
+                pixel[xBegin] = *src;
+                ++src;
+                ++xBegin;
+            }
+        }
+    }
+
+    /**
+     * Get read access to a single row of the pixel buffer.
+     * The pixels of a row are stored consecutive, which allows to copy
+     * a part of the bitmap row by row.
+     *
+     * @param[in] y y-coordinate of the row
+     *
+     * @return If the row is available, it will return the pointer to its first pixel otherwise nullptr.
+     */
+    const TColor* getRow(int16_t y) const
+    {
+        const TColor* row = nullptr;
+
+        if ((nullptr != m_pixels) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            row = &m_pixels[pixelMap(0U, y)];
+        }
+
+        return row;
+    }
+
     /**
      * Use this function to determine whether a internal bitmap buffer is allocated or not.
      * 
@@ -546,6 +732,7 @@ private:
 
     /**
      * Release pixel buffer if allocated.
+     * The pixel buffer must have the current bitmap size.
      * 
      * @param[inout] pixels     Pixel buffer which to release.
      */
@@ -553,7 +740,17 @@ private:
     {
         if (nullptr != pixels)
         {
-            delete[] pixels;
+            const size_t    PIXEL_BUFFER_SIZE   = m_width * m_height;
+            size_t          idx                 = 0U;
+
+            while(PIXEL_BUFFER_SIZE > idx)
+            {
+                pixels[idx].~TColor();
+
+                ++idx;
+            }
+
+            BaseGfxAllocator::deallocate(pixels);
             pixels = nullptr;
         }
     }
@@ -573,7 +770,27 @@ private:
         if ((0U < width) &&
             (0U < height))
         {
-            buffer = new(std::nothrow) TColor[width * height];
+            const size_t    PIXEL_BUFFER_SIZE   = width * height;
+            void*           memory              = nullptr;
+
+            /* Pixel buffers are allocated and released again and again,
+             * e.g. for icons. The application decides where they come from.
+             */
+            memory = BaseGfxAllocator::allocate(PIXEL_BUFFER_SIZE * sizeof(TColor));
+
+            if (nullptr != memory)
+            {
+                size_t idx = 0U;
+
+                buffer = static_cast<TColor*>(memory);
+
+                while(PIXEL_BUFFER_SIZE > idx)
+                {
+                    new(&buffer[idx]) TColor();
+
+                    ++idx;
+                }
+            }
         }
 
         return buffer;
@@ -697,6 +914,32 @@ public:
         m_gfx.drawPixel(x, y, color);
     }
 
+    /**
+     * Draw horizontal line.
+     *
+     * @param[in] x     x-coordinate of start point
+     * @param[in] y     y-coordinate of start point
+     * @param[in] width Horizontal line width in pixel
+     * @param[in] color Color
+     */
+    virtual void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color)
+    {
+        m_gfx.drawHLine(x, y, width, color);
+    }
+
+    /**
+     * Draw a row of pixels.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row
+     * @param[in] width     Number of pixels in the row
+     */
+    virtual void drawRow(int16_t x, int16_t y, const TColor* pixels, uint16_t width)
+    {
+        m_gfx.drawRow(x, y, pixels, width);
+    }
+
 private:
 
     BaseGfx<TColor>&    m_gfx;  /**< Graphic operations, hidden behind bitmap facade. */
@@ -705,6 +948,283 @@ private:
     BaseGfxOverlayBitmap();
 };
 
+/**
+ * This class provides a read-only bitmap, which shows a packed image (see
+ * PackedImg.h) directly from memory, e.g. a constant array or a flash region
+ * which is mapped into the address space. The pixels are not copied, every
+ * pixel is converted on access.
+ *
+ * Only uncompressed packed images can be mapped, because run length encoded
+ * pixel data can't be accessed randomly.
+ *
+ * @tparam TColor   The color representation.
+ */
+template < typename TColor >
+class BaseGfxMappedBitmap : public BaseGfxBitmap<TColor>
+{
+public:
+
+    /**
+     * Constructs a bitmap, which is not mapped yet.
+     */
+    BaseGfxMappedBitmap() :
+        BaseGfxBitmap<TColor>(),
+        m_width(0U),
+        m_height(0U),
+        m_format(PACKED_IMG_FORMAT_RGB565),
+        m_paletteSize(0U),
+        m_palette(nullptr),
+        m_pixels(nullptr),
+        m_pixel()
+    {
+    }
+
+    /**
+     * Constructs the bitmap by copy.
+     * The mapped memory is shared.
+     *
+     * @param[in] bitmap    Source bitmap, which to copy.
+     */
+    BaseGfxMappedBitmap(const BaseGfxMappedBitmap& bitmap) :
+        BaseGfxBitmap<TColor>(bitmap),
+        m_width(bitmap.m_width),
+        m_height(bitmap.m_height),
+        m_format(bitmap.m_format),
+        m_paletteSize(bitmap.m_paletteSize),
+        m_palette(bitmap.m_palette),
+        m_pixels(bitmap.m_pixels),
+        m_pixel()
+    {
+    }
+
+    /**
+     * Destroys the bitmap. The mapped memory is not touched.
+     */
+    virtual ~BaseGfxMappedBitmap()
+    {
+    }
+
+    /**
+     * Assigns a bitmap.
+     * The mapped memory is shared.
+     *
+     * @param[in] bitmap    Source bitmap
+     *
+     * @return Bitmap
+     */
+    BaseGfxMappedBitmap& operator=(const BaseGfxMappedBitmap& bitmap)
+    {
+        if (&bitmap != this)
+        {
+            BaseGfxBitmap<TColor>::operator=(bitmap);
+
+            m_width         = bitmap.m_width;
+            m_height        = bitmap.m_height;
+            m_format        = bitmap.m_format;
+            m_paletteSize   = bitmap.m_paletteSize;
+            m_palette       = bitmap.m_palette;
+            m_pixels        = bitmap.m_pixels;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Map a packed image. The memory must stay valid, as long as it is mapped.
+     *
+     * @param[in] data  Packed image, starting with its header.
+     * @param[in] size  Size of the packed image in byte.
+     *
+     * @return If the packed image is valid and uncompressed, it will return true otherwise false.
+     */
+    bool map(const uint8_t* data, size_t size)
+    {
+        bool            isSuccessful    = false;
+        PackedImgHeader header;
+
+        unmap();
+
+        if ((nullptr != data) &&
+            (sizeof(header) <= size))
+        {
+            size_t  paletteBytes    = 0U;
+            size_t  pixelBytes      = 0U;
+
+            /* The memory may be unaligned. */
+            memcpy(&header, data, sizeof(header));
+
+            paletteBytes    = header.paletteSize * 3U;
+            pixelBytes      = static_cast<size_t>(header.width) * header.height;
+
+            if (PACKED_IMG_FORMAT_RGB565 == header.format)
+            {
+                pixelBytes *= 2U;
+            }
+
+            if ((PACKED_IMG_SIGNATURE == header.signature) &&
+                (0U == (header.flags & PACKED_IMG_FLAG_RLE)) &&
+                ((PACKED_IMG_FORMAT_RGB565 == header.format) || (PACKED_IMG_FORMAT_PALETTE8 == header.format)) &&
+                (pixelBytes == header.dataSize) &&
+                ((sizeof(header) + paletteBytes + pixelBytes) <= size))
+            {
+                m_width         = header.width;
+                m_height        = header.height;
+                m_format        = header.format;
+                m_paletteSize   = header.paletteSize;
+                m_palette       = &data[sizeof(header)];
+                m_pixels        = &data[sizeof(header) + paletteBytes];
+                isSuccessful    = true;
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Unmap the packed image.
+     */
+    void unmap()
+    {
+        m_width         = 0U;
+        m_height        = 0U;
+        m_paletteSize   = 0U;
+        m_palette       = nullptr;
+        m_pixels        = nullptr;
+    }
+
+    /**
+     * Is a packed image mapped?
+     *
+     * @return If mapped, it will return true otherwise false.
+     */
+    bool isMapped() const
+    {
+        return (nullptr != m_pixels);
+    }
+
+    /**
+     * Get the width of the bitmap in pixels.
+     *
+     * @return Width in pixels
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get the height of the bitmap in pixels.
+     *
+     * @return Height in pixels
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * Get pixel color at given position.
+     * The bitmap is read-only, therefore changing the returned color has
+     * no effect on the bitmap.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    TColor& getColor(int16_t x, int16_t y)
+    {
+        m_pixel = readPixel(x, y);
+
+        return m_pixel;
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const TColor& getColor(int16_t x, int16_t y) const
+    {
+        m_pixel = readPixel(x, y);
+
+        return m_pixel;
+    }
+
+    /**
+     * Draw a single pixel at given position.
+     * The bitmap is read-only, therefore it has no effect.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const TColor& color)
+    {
+        (void)x;
+        (void)y;
+        (void)color;
+    }
+
+private:
+
+    uint16_t        m_width;        /**< Bitmap width in pixels */
+    uint16_t        m_height;       /**< Bitmap height in pixels */
+    uint8_t         m_format;       /**< Pixel format, see PackedImgFormat */
+    uint16_t        m_paletteSize;  /**< Number of color palette entries */
+    const uint8_t*  m_palette;      /**< Color palette in the mapped memory */
+    const uint8_t*  m_pixels;       /**< Pixel data in the mapped memory */
+    mutable TColor  m_pixel;        /**< Last converted pixel color */
+
+    /**
+     * Read and convert a single pixel.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color. Outside of the bitmap, it will be the default color.
+     */
+    TColor readPixel(int16_t x, int16_t y) const
+    {
+        TColor color;
+
+        if ((nullptr != m_pixels) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            size_t index = static_cast<size_t>(x) + static_cast<size_t>(y) * m_width;
+
+            if (PACKED_IMG_FORMAT_RGB565 == m_format)
+            {
+                uint16_t    value   = m_pixels[2U * index] | (static_cast<uint16_t>(m_pixels[2U * index + 1U]) << 8U);
+                uint8_t     red     = (value >> 11U) & 0x1FU;
+                uint8_t     green   = (value >> 5U) & 0x3FU;
+                uint8_t     blue    = value & 0x1FU;
+
+                /* Scale to 8 bit per color, by repeating the upper bits. */
+                color = TColor((red << 3U) | (red >> 2U), (green << 2U) | (green >> 4U), (blue << 3U) | (blue >> 2U));
+            }
+            else if (m_paletteSize > m_pixels[index])
+            {
+                const uint8_t* entry = &m_palette[3U * m_pixels[index]];
+
+                color = TColor(entry[0], entry[1], entry[2]);
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        return color;
+    }
+};
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
@@ -303,6 +303,73 @@ public:
         }
     }
 
+    /**
+     * Draw horizontal line.
+     * The line is clipped once to the map canvas and forwarded as a whole.
+     *
+     * @param[in] x     x-coordinate of start point
+     * @param[in] y     y-coordinate of start point
+     * @param[in] width Horizontal line width in pixel
+     * @param[in] color Color
+     */
+    void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color) final
+    {
+        int32_t xBegin  = x;
+        int32_t xEnd    = static_cast<int32_t>(x) + width;
+
+        if (0 > xBegin)
+        {
+            xBegin = 0;
+        }
+
+        if (m_width < xEnd)
+        {
+            xEnd = m_width;
+        }
+
+        if ((nullptr != m_gfx) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (xBegin < xEnd))
+        {
+            m_gfx->drawHLine(xBegin + m_offsX, y + m_offsY, xEnd - xBegin, color);
+        }
+    }
+
+    /**
+     * Draw a row of pixels.
+     * The row is clipped once to the map canvas and forwarded as a whole.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row
+     * @param[in] width     Number of pixels in the row
+     */
+    void drawRow(int16_t x, int16_t y, const TColor* pixels, uint16_t width) final
+    {
+        int32_t xBegin  = x;
+        int32_t xEnd    = static_cast<int32_t>(x) + width;
+
+        if (0 > xBegin)
+        {
+            xBegin = 0;
+        }
+
+        if (m_width < xEnd)
+        {
+            xEnd = m_width;
+        }
+
+        if ((nullptr != m_gfx) &&
+            (nullptr != pixels) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (xBegin < xEnd))
+        {
+            m_gfx->drawRow(xBegin + m_offsX, y + m_offsY, &pixels[xBegin - x], xEnd - xBegin);
+        }
+    }
+
 private:
 
     BaseGfx<TColor>*    m_gfx;      /**< The underlying graphic operations. */
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "BaseGfx.hpp"
 #include "BaseFont.hpp"
+#include "Utf8Decoder.hpp"
 
 /******************************************************************************
  * Macros
@@ -62,6 +63,7 @@
  * Features:
  * - Provides a text cursor
  * - Text wrap around
+ * - UTF-8 encoded text
  */
 template < typename TColor >
 class BaseGfxText
@@ -77,7 +79,8 @@ public:
         m_cursorY(0),
         m_textColor(0U),
         m_isTextWrapEnabled(false),
-        m_font()
+        m_font(),
+        m_utf8Decoder()
     {
     }
 
@@ -91,7 +94,8 @@ public:
         m_cursorY(text.m_cursorY),
         m_textColor(text.m_textColor),
         m_isTextWrapEnabled(text.m_isTextWrapEnabled),
-        m_font(text.m_font)
+        m_font(text.m_font),
+        m_utf8Decoder(text.m_utf8Decoder)
     {
     }
 
@@ -106,7 +110,24 @@ public:
         m_cursorY(0),
         m_textColor(color),
         m_isTextWrapEnabled(false),
-        m_font(gfxFont)
+        m_font(gfxFont),
+        m_utf8Decoder()
+    {
+    }
+
+    /**
+     * Constructs a base text with the given font.
+     * 
+     * @param[in] font      Font
+     * @param[in] color     Text color
+     */
+    BaseGfxText(const BaseFont<TColor>& font, const TColor& color = 0U) :
+        m_cursorX(0),
+        m_cursorY(0),
+        m_textColor(color),
+        m_isTextWrapEnabled(false),
+        m_font(font),
+        m_utf8Decoder()
     {
     }
 
@@ -117,6 +138,28 @@ public:
     {
     }
 
+    /**
+     * Assigns a base text.
+     * 
+     * @param[in] text  Base text, which to assign.
+     * 
+     * @return Base text
+     */
+    BaseGfxText& operator=(const BaseGfxText& text)
+    {
+        if (&text != this)
+        {
+            m_cursorX           = text.m_cursorX;
+            m_cursorY           = text.m_cursorY;
+            m_textColor         = text.m_textColor;
+            m_isTextWrapEnabled = text.m_isTextWrapEnabled;
+            m_font              = text.m_font;
+            m_utf8Decoder       = text.m_utf8Decoder;
+        }
+
+        return *this;
+    }
+
     /**
      * Get cursor position.
      *
@@ -212,9 +255,19 @@ public:
     }
 
     /**
-     * Set GFXfont.
+     * Get font.
      *
-     * @param[in] gfxFont   GFXfont
+     * @return font
+     */
+    const BaseFont<TColor>& getFont() const
+    {
+        return m_font;
+    }
+
+    /**
+     * Set font.
+     *
+     * @param[in] font  Font
      */
     void setFont(const BaseFont<TColor>& font)
     {
@@ -223,6 +276,7 @@ public:
 
     /**
      * Get bounding box of text.
+     * The text is expected in UTF-8 encoding.
      *
      * @param[out]  width       Width in pixel
      * @param[out]  height      Height in pixel
@@ -237,58 +291,71 @@ public:
         bool status = false;
 
         if ((nullptr != text) &&
-            (nullptr != m_font.getGfxFont()))
+            (true == m_font.isAvailable()))
         {
             size_t      idx         = 0U;
+            size_t      charCnt     = 0U;
             uint16_t    lineWidth   = 0U;
+            Utf8Decoder utf8Decoder;
 
             boxWidth   = 0U;
             boxHeight  = 0U;
 
             while('\0' != text[idx])
             {
-                uint16_t charWidth  = 0U;
-                uint16_t charHeight = 0U;
+                uint32_t    codePoint   = 0U;
+                bool        isAvailable = utf8Decoder.decode(text[idx], codePoint);
 
-                if ('\n' == text[idx])
+                /* Several code points are available, if a UTF-8 sequence was interrupted. */
+                while(true == isAvailable)
                 {
-                    if (boxWidth < lineWidth)
-                    {
-                        boxWidth = lineWidth;
-                    }
+                    uint16_t charWidth  = 0U;
+                    uint16_t charHeight = 0U;
 
-                    lineWidth = 0U;
-                    boxHeight += m_font.getHeight();
-                }
-                else if (true == m_font.getCharBoundingBox(text[idx], charWidth, charHeight))
-                {
-                    if (0U == idx)
+                    if ('\n' == codePoint)
                     {
-                        boxHeight += charHeight;
-                    }
+                        if (boxWidth < lineWidth)
+                        {
+                            boxWidth = lineWidth;
+                        }
 
-                    /* If text wrap around is enabled and the character is clipping,
-                     * jump to the next line.
-                     */
-                    if (true == m_isTextWrapEnabled)
+                        lineWidth = 0U;
+                        boxHeight += m_font.getHeight();
+                        ++charCnt;
+                    }
+                    else if (true == m_font.getCodePointBoundingBox(codePoint, charWidth, charHeight))
                     {
-                        if (width < (lineWidth + charWidth))
+                        if (0U == charCnt)
+                        {
+                            boxHeight += charHeight;
+                        }
+
+                        /* If text wrap around is enabled and the character is clipping,
+                         * jump to the next line.
+                         */
+                        if (true == m_isTextWrapEnabled)
                         {
-                            if (boxWidth < lineWidth)
+                            if (width < (lineWidth + charWidth))
                             {
-                                boxWidth = lineWidth;
-                            }
+                                if (boxWidth < lineWidth)
+                                {
+                                    boxWidth = lineWidth;
+                                }
 
-                            lineWidth = 0U;
-                            boxHeight += charHeight;
+                                lineWidth = 0U;
+                                boxHeight += charHeight;
+                            }
                         }
+
+                        lineWidth += charWidth;
+                        ++charCnt;
+                    }
+                    else
+                    {
+                        ++charCnt;
                     }
 
-                    lineWidth += charWidth;
-                }
-                else
-                {
-                    ;
+                    isAvailable = utf8Decoder.next(codePoint);
                 }
 
                 ++idx;
@@ -310,6 +377,9 @@ public:
      * automatically moved to the new position. Wrap around handling is
      * performed if configured.
      * 
+     * The character is handled as part of a UTF-8 encoded text. A multi-byte
+     * sequence is drawn, after its last byte is given.
+     * 
      * A newline will place the cursor on the begin of the next line.
      *
      * @param[in] gfx           Graphics interface
@@ -317,7 +387,30 @@ public:
      */
     void drawChar(BaseGfx<TColor>& gfx, char singleChar)
     {
-        if (nullptr == m_font.getGfxFont())
+        uint32_t    codePoint   = 0U;
+        bool        isAvailable = m_utf8Decoder.decode(singleChar, codePoint);
+
+        /* A interrupted UTF-8 sequence completes several code points at once. */
+        while(true == isAvailable)
+        {
+            drawCodePoint(gfx, codePoint);
+            isAvailable = m_utf8Decoder.next(codePoint);
+        }
+    }
+
+    /**
+     * Draw single unicode code point at current cursor position. The cursor is
+     * automatically moved to the new position. Wrap around handling is
+     * performed if configured.
+     * 
+     * A newline will place the cursor on the begin of the next line.
+     *
+     * @param[in] gfx       Graphics interface
+     * @param[in] codePoint Unicode code point which to draw
+     */
+    void drawCodePoint(BaseGfx<TColor>& gfx, uint32_t codePoint)
+    {
+        if (false == m_font.isAvailable())
         {
             return;
         }
@@ -330,7 +423,7 @@ public:
             uint16_t charBoxWidth   = 0U;
             uint16_t charBoxHeight  = 0U;
 
-            if (true == m_font.getCharBoundingBox(singleChar, charBoxWidth, charBoxHeight))
+            if (true == m_font.getCodePointBoundingBox(codePoint, charBoxWidth, charBoxHeight))
             {
                 if (gfx.getWidth() < (m_cursorX + charBoxWidth))
                 {
@@ -340,11 +433,11 @@ public:
             }
         }
 
-        m_font.drawChar(gfx, m_cursorX, m_cursorY, singleChar, m_textColor);
+        m_font.drawCodePoint(gfx, m_cursorX, m_cursorY, codePoint, m_textColor);
     }
 
     /**
-     * Draw a text at given cursor position.
+     * Draw a UTF-8 encoded text at given cursor position.
      *
      * @param[in] gfx   Graphics interface
      * @param[in] text  Text which to draw
@@ -353,7 +446,8 @@ public:
     {
         size_t idx = 0U;
 
-        if (nullptr == m_font)
+        if ((nullptr == text) ||
+            (false == m_font.isAvailable()))
         {
             return;
         }
@@ -372,6 +466,7 @@ private:
     TColor              m_textColor;            /**< Text color */
     bool                m_isTextWrapEnabled;    /**< Is text wrap around enabled or not? */
     BaseFont<TColor>    m_font;                 /**< The graphical font, which to use. */
+    Utf8Decoder         m_utf8Decoder;          /**< Decodes the UTF-8 encoded characters, which are drawn. */
 
 };
 
@@ -0,0 +1,317 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Graphic operations with dirty region tracking
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __BASE_GFX_TRACKER_HPP__
+#define __BASE_GFX_TRACKER_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "BaseGfx.hpp"
+#include "GfxRect.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The tracker forwards all graphic operations to the underlying canvas and
+ * keeps the bounding box of all modified pixels. This allows to transfer
+ * only the modified region of a framebuffer to the display.
+ *
+ * Note, the non-constant getColor() is considered as modification, because
+ * the color may be changed via the returned reference.
+ *
+ * @tparam TColor The color representation.
+ */
+template < typename TColor >
+class BaseGfxTracker : public BaseGfx<TColor>
+{
+public:
+
+    /**
+     * Constructs a tracker without underlying canvas.
+     */
+    BaseGfxTracker() :
+        BaseGfx<TColor>(),
+        m_gfx(nullptr),
+        m_dirtyRect()
+    {
+    }
+
+    /**
+     * Constructs a tracker. The whole underlying canvas is considered as
+     * modified.
+     *
+     * @param[in] gfx   The graphic operations of the underlying canvas.
+     */
+    BaseGfxTracker(BaseGfx<TColor>& gfx) :
+        BaseGfx<TColor>(),
+        m_gfx(&gfx),
+        m_dirtyRect(0, 0, gfx.getWidth(), gfx.getHeight())
+    {
+    }
+
+    /**
+     * Destroys the tracker.
+     */
+    virtual ~BaseGfxTracker()
+    {
+    }
+
+    /**
+     * Set the underlying canvas. The whole canvas is considered as modified.
+     *
+     * @param[in] gfx   The graphic operations of the underlying canvas.
+     */
+    void setGfx(BaseGfx<TColor>& gfx)
+    {
+        m_gfx = &gfx;
+        invalidate();
+    }
+
+    /**
+     * Get the region, which was modified since the last clearDirtyRect().
+     *
+     * @return Modified region
+     */
+    const GfxRect& getDirtyRect() const
+    {
+        return m_dirtyRect;
+    }
+
+    /**
+     * Is anything modified since the last clearDirtyRect()?
+     *
+     * @return If anything is modified, it will return true otherwise false.
+     */
+    bool isDirty() const
+    {
+        return (false == m_dirtyRect.isEmpty());
+    }
+
+    /**
+     * Consider the whole underlying canvas as modified.
+     */
+    void invalidate()
+    {
+        if (nullptr == m_gfx)
+        {
+            m_dirtyRect.clear();
+        }
+        else
+        {
+            m_dirtyRect = GfxRect(0, 0, m_gfx->getWidth(), m_gfx->getHeight());
+        }
+    }
+
+    /**
+     * Forget the modified region, e.g. after it was transferred.
+     */
+    void clearDirtyRect()
+    {
+        m_dirtyRect.clear();
+    }
+
+    /**
+     * Get canvas width in pixel.
+     *
+     * @return Canvas width in pixel
+     */
+    uint16_t getWidth() const final
+    {
+        uint16_t width = 0U;
+
+        if (nullptr != m_gfx)
+        {
+            width = m_gfx->getWidth();
+        }
+
+        return width;
+    }
+
+    /**
+     * Get canvas height in pixel.
+     *
+     * @return Canvas height in pixel
+     */
+    uint16_t getHeight() const final
+    {
+        uint16_t height = 0U;
+
+        if (nullptr != m_gfx)
+        {
+            height = m_gfx->getHeight();
+        }
+
+        return height;
+    }
+
+    /**
+     * Get pixel color at given position.
+     * The pixel is considered as modified.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    TColor& getColor(int16_t x, int16_t y) final
+    {
+        static TColor   trash;
+        TColor*         pixel   = &trash;
+
+        if (nullptr != m_gfx)
+        {
+            pixel = &m_gfx->getColor(x, y);
+            markDirty(x, y, 1U);
+        }
+
+        return *pixel;
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const TColor& getColor(int16_t x, int16_t y) const final
+    {
+        static TColor   trash;
+        const TColor*   pixel   = &trash;
+
+        if (nullptr != m_gfx)
+        {
+            pixel = &static_cast<const BaseGfx<TColor>*>(m_gfx)->getColor(x, y);
+        }
+
+        return *pixel;
+    }
+
+    /**
+     * Draw a single pixel at given position.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const TColor& color) final
+    {
+        if (nullptr != m_gfx)
+        {
+            m_gfx->drawPixel(x, y, color);
+            markDirty(x, y, 1U);
+        }
+    }
+
+    /**
+     * Draw horizontal line.
+     *
+     * @param[in] x     x-coordinate of start point
+     * @param[in] y     y-coordinate of start point
+     * @param[in] width Horizontal line width in pixel
+     * @param[in] color Color
+     */
+    void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color) final
+    {
+        if (nullptr != m_gfx)
+        {
+            m_gfx->drawHLine(x, y, width, color);
+            markDirty(x, y, width);
+        }
+    }
+
+    /**
+     * Draw a row of pixels.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row
+     * @param[in] width     Number of pixels in the row
+     */
+    void drawRow(int16_t x, int16_t y, const TColor* pixels, uint16_t width) final
+    {
+        if (nullptr != m_gfx)
+        {
+            m_gfx->drawRow(x, y, pixels, width);
+            markDirty(x, y, width);
+        }
+    }
+
+private:
+
+    BaseGfx<TColor>*    m_gfx;          /**< Graphic operations of the underlying canvas */
+    GfxRect             m_dirtyRect;    /**< Modified region in the underlying canvas */
+
+    /* Copying is not supported, because it is bound to one canvas. */
+    BaseGfxTracker(const BaseGfxTracker& tracker);
+    BaseGfxTracker& operator=(const BaseGfxTracker& tracker);
+
+    /**
+     * Add a horizontal span to the modified region. It is clipped to the
+     * underlying canvas.
+     *
+     * @param[in] x     x-coordinate of start point
+     * @param[in] y     y-coordinate of start point
+     * @param[in] width Span width in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width)
+    {
+        GfxRect span(x, y, width, 1U);
+
+        span.intersect(GfxRect(0, 0, m_gfx->getWidth(), m_gfx->getHeight()));
+        m_dirtyRect.unite(span);
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BASE_GFX_TRACKER_HPP__ */
+
+/** @} */
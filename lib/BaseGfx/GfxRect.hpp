@@ -0,0 +1,318 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Rectangle
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __GFX_RECT_HPP__
+#define __GFX_RECT_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Axis aligned rectangle in a canvas, e.g. used to track the region which
+ * needs to be repainted. A rectangle with a width or height of 0 is empty.
+ */
+class GfxRect
+{
+public:
+
+    /**
+     * Constructs a empty rectangle.
+     */
+    GfxRect() :
+        m_x(0),
+        m_y(0),
+        m_width(0U),
+        m_height(0U)
+    {
+    }
+
+    /**
+     * Constructs a rectangle.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    GfxRect(int16_t x, int16_t y, uint16_t width, uint16_t height) :
+        m_x(x),
+        m_y(y),
+        m_width(width),
+        m_height(height)
+    {
+    }
+
+    /**
+     * Constructs a rectangle by copy.
+     *
+     * @param[in] rect  Rectangle, which to copy.
+     */
+    GfxRect(const GfxRect& rect) :
+        m_x(rect.m_x),
+        m_y(rect.m_y),
+        m_width(rect.m_width),
+        m_height(rect.m_height)
+    {
+    }
+
+    /**
+     * Destroys the rectangle.
+     */
+    ~GfxRect()
+    {
+    }
+
+    /**
+     * Assigns a rectangle.
+     *
+     * @param[in] rect  Rectangle, which to assign.
+     *
+     * @return Rectangle
+     */
+    GfxRect& operator=(const GfxRect& rect)
+    {
+        if (&rect != this)
+        {
+            m_x         = rect.m_x;
+            m_y         = rect.m_y;
+            m_width     = rect.m_width;
+            m_height    = rect.m_height;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Get x-coordinate of upper left point.
+     *
+     * @return x-coordinate
+     */
+    int16_t getX() const
+    {
+        return m_x;
+    }
+
+    /**
+     * Get y-coordinate of upper left point.
+     *
+     * @return y-coordinate
+     */
+    int16_t getY() const
+    {
+        return m_y;
+    }
+
+    /**
+     * Get width in pixel.
+     *
+     * @return Width in pixel
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get height in pixel.
+     *
+     * @return Height in pixel
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * Is the rectangle empty?
+     *
+     * @return If the rectangle is empty, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return ((0U == m_width) || (0U == m_height));
+    }
+
+    /**
+     * Make the rectangle empty.
+     */
+    void clear()
+    {
+        m_x         = 0;
+        m_y         = 0;
+        m_width     = 0U;
+        m_height    = 0U;
+    }
+
+    /**
+     * Does the rectangle contain the given point?
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return If the point is inside, it will return true otherwise false.
+     */
+    bool contains(int16_t x, int16_t y) const
+    {
+        return ((m_x <= x) &&
+                (m_y <= y) &&
+                (getRight() > x) &&
+                (getBottom() > y));
+    }
+
+    /**
+     * Does the rectangle overlap with the given rectangle?
+     *
+     * @param[in] rect  Rectangle
+     *
+     * @return If both overlap, it will return true otherwise false.
+     */
+    bool isIntersecting(const GfxRect& rect) const
+    {
+        bool isIntersecting = false;
+
+        if ((false == isEmpty()) &&
+            (false == rect.isEmpty()))
+        {
+            isIntersecting = ((m_x < rect.getRight()) &&
+                              (rect.m_x < getRight()) &&
+                              (m_y < rect.getBottom()) &&
+                              (rect.m_y < getBottom()));
+        }
+
+        return isIntersecting;
+    }
+
+    /**
+     * Extend the rectangle, so it contains the given rectangle too.
+     * A empty rectangle doesn't extend it.
+     *
+     * @param[in] rect  Rectangle
+     */
+    void unite(const GfxRect& rect)
+    {
+        if (true == isEmpty())
+        {
+            *this = rect;
+        }
+        else if (false == rect.isEmpty())
+        {
+            int32_t right   = (getRight() > rect.getRight()) ? getRight() : rect.getRight();
+            int32_t bottom  = (getBottom() > rect.getBottom()) ? getBottom() : rect.getBottom();
+
+            m_x         = (m_x < rect.m_x) ? m_x : rect.m_x;
+            m_y         = (m_y < rect.m_y) ? m_y : rect.m_y;
+            m_width     = static_cast<uint16_t>(right - m_x);
+            m_height    = static_cast<uint16_t>(bottom - m_y);
+        }
+        else
+        {
+            /* Nothing to do. */
+            ;
+        }
+    }
+
+    /**
+     * Reduce the rectangle to the region, which overlaps with the given
+     * rectangle. If they don't overlap, the rectangle will be empty.
+     *
+     * @param[in] rect  Rectangle
+     */
+    void intersect(const GfxRect& rect)
+    {
+        if (false == isIntersecting(rect))
+        {
+            clear();
+        }
+        else
+        {
+            int32_t right   = (getRight() < rect.getRight()) ? getRight() : rect.getRight();
+            int32_t bottom  = (getBottom() < rect.getBottom()) ? getBottom() : rect.getBottom();
+
+            m_x         = (m_x > rect.m_x) ? m_x : rect.m_x;
+            m_y         = (m_y > rect.m_y) ? m_y : rect.m_y;
+            m_width     = static_cast<uint16_t>(right - m_x);
+            m_height    = static_cast<uint16_t>(bottom - m_y);
+        }
+    }
+
+private:
+
+    int16_t     m_x;        /**< x-coordinate of upper left point */
+    int16_t     m_y;        /**< y-coordinate of upper left point */
+    uint16_t    m_width;    /**< Width in pixel */
+    uint16_t    m_height;   /**< Height in pixel */
+
+    /**
+     * Get the x-coordinate right of the rectangle.
+     *
+     * @return x-coordinate
+     */
+    int32_t getRight() const
+    {
+        return static_cast<int32_t>(m_x) + m_width;
+    }
+
+    /**
+     * Get the y-coordinate below the rectangle.
+     *
+     * @return y-coordinate
+     */
+    int32_t getBottom() const
+    {
+        return static_cast<int32_t>(m_y) + m_height;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __GFX_RECT_HPP__ */
+
+/** @} */
@@ -0,0 +1,107 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Packed image format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __PACKED_IMG_H__
+#define __PACKED_IMG_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/** Packed image signature "PIMG" (little endian). */
+#define PACKED_IMG_SIGNATURE    (0x474D4950U)
+
+/** Packed image pixel data is run length encoded. */
+#define PACKED_IMG_FLAG_RLE     (0x01U)
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Pixel format of a packed image.
+ */
+typedef enum
+{
+    /**
+     * 16 bit per pixel in 5-6-5 RGB format, little endian.
+     */
+    PACKED_IMG_FORMAT_RGB565 = 0,
+
+    /**
+     * 8 bit per pixel, which is a index in the color palette.
+     */
+    PACKED_IMG_FORMAT_PALETTE8
+} PackedImgFormat;
+
+/**
+ * A packed image is a pre-converted image, which can be shown without any
+ * decoding effort, except the color conversion. It starts with this header,
+ * followed by the color palette (3 byte per entry: red, green, blue) and the
+ * pixel data, row by row from top to bottom.
+ *
+ * If the PACKED_IMG_FLAG_RLE flag is set, the pixel data consists of runs.
+ * Every run starts with a count (1 - 255), followed by a single pixel value,
+ * which is repeated count times. A run may continue in the next row.
+ *
+ * All values are little endian.
+ */
+typedef struct
+{
+    uint32_t    signature;      /**< Signature, see PACKED_IMG_SIGNATURE */
+    uint16_t    width;          /**< Image width in pixel */
+    uint16_t    height;         /**< Image height in pixel */
+    uint8_t     format;         /**< Pixel format, see PackedImgFormat */
+    uint8_t     flags;          /**< Flags, see PACKED_IMG_FLAG_xxx */
+    uint16_t    paletteSize;    /**< Number of color palette entries */
+    uint32_t    dataSize;       /**< Pixel data size in byte */
+} PackedImgHeader;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __PACKED_IMG_H__ */
+
+/** @} */
@@ -0,0 +1,114 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Unicode font format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __UNICODE_FONT_H__
+#define __UNICODE_FONT_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "gfxfont.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Encoding of the glyph bitmaps in a unicode font.
+ */
+typedef enum
+{
+    /**
+     * 1 bit per pixel, row by row, like the Adafruit GFXfont.
+     * Each glyph starts byte aligned.
+     */
+    UNICODE_FONT_ENCODING_BITMAP = 0,
+
+    /**
+     * Run length encoded. The glyph pixels are taken row by row and encoded as
+     * alternating runs of background and foreground pixels, starting with a
+     * background run. Each run length is stored in a nibble (0 - 15), the high
+     * nibble first. A longer run is split by a zero length run of the other
+     * kind. Each glyph starts byte aligned.
+     */
+    UNICODE_FONT_ENCODING_RLE
+} UnicodeFontEncoding;
+
+/**
+ * A range of consecutive code points, which are covered by a unicode font.
+ * Only the basic multilingual plane (U+0000 - U+FFFF) is supported, which
+ * keeps the range table compact.
+ */
+typedef struct
+{
+    uint16_t    first;      /**< First code point in the range */
+    uint16_t    last;       /**< Last code point in the range */
+    uint16_t    glyphIndex; /**< Index in the glyph array of the first code point */
+} UnicodeRange;
+
+/**
+ * A unicode font is like a Adafruit GFXfont, but instead of a single
+ * contiguous ASCII range, it covers a sorted list of sparse code point ranges.
+ * The glyphs of all ranges are stored in one array, in the order of the ranges.
+ *
+ * The ranges must be sorted ascending and must not overlap, because the glyph
+ * lookup is done by binary search.
+ */
+typedef struct
+{
+    const uint8_t*      bitmap;     /**< Glyph bitmaps, concatenated */
+    const GFXglyph*     glyph;      /**< Glyph array */
+    const UnicodeRange* ranges;     /**< Code point ranges, sorted ascending */
+    uint16_t            rangeCnt;   /**< Number of code point ranges */
+    uint8_t             yAdvance;   /**< Newline distance (y axis) */
+    uint8_t             encoding;   /**< Glyph bitmap encoding, see UnicodeFontEncoding */
+} UnicodeFont;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __UNICODE_FONT_H__ */
+
+/** @} */
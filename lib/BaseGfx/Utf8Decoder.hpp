@@ -0,0 +1,312 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  UTF-8 decoder
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __UTF8_DECODER_HPP__
+#define __UTF8_DECODER_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Incremental UTF-8 decoder, which is fed byte by byte and provides the
+ * unicode code point as soon as a sequence is complete.
+ *
+ * Robustness:
+ * - A single byte, which is not part of a valid UTF-8 sequence, is taken
+ *   as ISO 8859-1 character. This keeps legacy text working.
+ * - A sequence which is interrupted by a non-continuation byte is taken as
+ *   ISO 8859-1 characters too, e.g. "\xDF" followed by "e". Therefore a
+ *   single byte may complete several code points. After decode() returned
+ *   the first one, the others are retrieved with next().
+ */
+class Utf8Decoder
+{
+public:
+
+    /**
+     * Constructs the decoder.
+     */
+    Utf8Decoder() :
+        m_codePoint(0U),
+        m_remaining(0U),
+        m_seq(),
+        m_seqLen(0U),
+        m_queue(),
+        m_queueLen(0U),
+        m_queueIdx(0U)
+    {
+    }
+
+    /**
+     * Constructs the decoder by copy.
+     *
+     * @param[in] decoder   Decoder, which to copy.
+     */
+    Utf8Decoder(const Utf8Decoder& decoder) :
+        m_codePoint(decoder.m_codePoint),
+        m_remaining(decoder.m_remaining),
+        m_seq(),
+        m_seqLen(decoder.m_seqLen),
+        m_queue(),
+        m_queueLen(decoder.m_queueLen),
+        m_queueIdx(decoder.m_queueIdx)
+    {
+        memcpy(m_seq, decoder.m_seq, sizeof(m_seq));
+        memcpy(m_queue, decoder.m_queue, sizeof(m_queue));
+    }
+
+    /**
+     * Destroys the decoder.
+     */
+    ~Utf8Decoder()
+    {
+    }
+
+    /**
+     * Assigns a decoder.
+     *
+     * @param[in] decoder   Decoder, which to assign.
+     *
+     * @return Decoder
+     */
+    Utf8Decoder& operator=(const Utf8Decoder& decoder)
+    {
+        if (&decoder != this)
+        {
+            m_codePoint = decoder.m_codePoint;
+            m_remaining = decoder.m_remaining;
+            m_seqLen    = decoder.m_seqLen;
+            m_queueLen  = decoder.m_queueLen;
+            m_queueIdx  = decoder.m_queueIdx;
+
+            memcpy(m_seq, decoder.m_seq, sizeof(m_seq));
+            memcpy(m_queue, decoder.m_queue, sizeof(m_queue));
+        }
+
+        return *this;
+    }
+
+    /**
+     * Reset the decoder and drop a incomplete sequence.
+     */
+    void reset()
+    {
+        m_codePoint = 0U;
+        m_remaining = 0U;
+        m_seqLen    = 0U;
+        m_queueLen  = 0U;
+        m_queueIdx  = 0U;
+    }
+
+    /**
+     * Feed the next byte into the decoder.
+     * Code points, which were not retrieved by next() yet, are dropped.
+     *
+     * @param[in]   data        Next byte of the text
+     * @param[out]  codePoint   Decoded unicode code point, only valid if true is returned.
+     *
+     * @return If a complete code point is available, it will return true otherwise false.
+     */
+    bool decode(char data, uint32_t& codePoint)
+    {
+        bool    isComplete  = false;
+        uint8_t byte        = static_cast<uint8_t>(data);
+
+        m_queueLen  = 0U;
+        m_queueIdx  = 0U;
+
+        /* Continuation byte of a pending sequence? */
+        if ((0U < m_remaining) &&
+            (0x80U == (byte & 0xC0U)))
+        {
+            m_codePoint = (m_codePoint << 6U) | (byte & 0x3FU);
+            --m_remaining;
+
+            if (0U == m_remaining)
+            {
+                m_seqLen    = 0U;
+                codePoint   = m_codePoint;
+                isComplete  = true;
+            }
+            else
+            {
+                m_seq[m_seqLen] = byte;
+                ++m_seqLen;
+            }
+        }
+        else
+        {
+            uint8_t idx = 0U;
+
+            /* The bytes of a interrupted sequence are taken as ISO 8859-1 characters. */
+            for(idx = 0U; idx < m_seqLen; ++idx)
+            {
+                m_queue[m_queueLen] = m_seq[idx];
+                ++m_queueLen;
+            }
+
+            m_seqLen    = 0U;
+            m_remaining = 0U;
+
+            /* ASCII */
+            if (0x80U > byte)
+            {
+                m_queue[m_queueLen] = byte;
+                ++m_queueLen;
+            }
+            /* Lead byte of 2 byte sequence. Note, 0xC0 and 0xC1 are overlong. */
+            else if ((0xC2U <= byte) && (0xDFU >= byte))
+            {
+                startSequence(byte, byte & 0x1FU, 1U);
+            }
+            /* Lead byte of 3 byte sequence. */
+            else if (0xE0U == (byte & 0xF0U))
+            {
+                startSequence(byte, byte & 0x0FU, 2U);
+            }
+            /* Lead byte of 4 byte sequence. */
+            else if ((0xF0U <= byte) && (0xF4U >= byte))
+            {
+                startSequence(byte, byte & 0x07U, 3U);
+            }
+            /* Not part of a valid UTF-8 sequence, use it as ISO 8859-1 character. */
+            else
+            {
+                m_queue[m_queueLen] = byte;
+                ++m_queueLen;
+            }
+
+            isComplete = next(codePoint);
+        }
+
+        return isComplete;
+    }
+
+    /**
+     * Get the next code point, which was completed by the last byte fed
+     * into the decoder.
+     *
+     * @param[out]  codePoint   Decoded unicode code point, only valid if true is returned.
+     *
+     * @return If a further code point is available, it will return true otherwise false.
+     */
+    bool next(uint32_t& codePoint)
+    {
+        bool isAvailable = false;
+
+        if (m_queueLen > m_queueIdx)
+        {
+            codePoint   = m_queue[m_queueIdx];
+            isAvailable = true;
+            ++m_queueIdx;
+        }
+
+        return isAvailable;
+    }
+
+    /**
+     * Is the decoder waiting for further bytes of a sequence?
+     *
+     * @return If a sequence is pending, it will return true otherwise false.
+     */
+    bool isPending() const
+    {
+        return (0U < m_seqLen);
+    }
+
+    /**
+     * Get the number of bytes of the pending sequence.
+     *
+     * @return Number of bytes, which are not decoded yet.
+     */
+    uint8_t getPendingCnt() const
+    {
+        return m_seqLen;
+    }
+
+private:
+
+    /** Max. number of bytes of a sequence, which are kept until it is complete. */
+    static const uint8_t    MAX_SEQ_LEN     = 3U;
+
+    /** Max. number of code points, which a single byte can complete. */
+    static const uint8_t    MAX_QUEUE_LEN   = MAX_SEQ_LEN + 1U;
+
+    uint32_t    m_codePoint;                /**< Code point, which is currently decoded. */
+    uint8_t     m_remaining;                /**< Number of remaining continuation bytes. */
+    uint8_t     m_seq[MAX_SEQ_LEN];         /**< Bytes of the pending sequence. */
+    uint8_t     m_seqLen;                   /**< Number of bytes of the pending sequence. */
+    uint8_t     m_queue[MAX_QUEUE_LEN];     /**< Completed ISO 8859-1 code points. */
+    uint8_t     m_queueLen;                 /**< Number of completed code points. */
+    uint8_t     m_queueIdx;                 /**< Index of the next completed code point. */
+
+    /**
+     * Start a new sequence with its lead byte.
+     *
+     * @param[in] byte          Lead byte
+     * @param[in] codePoint     Code point bits of the lead byte
+     * @param[in] remaining     Number of continuation bytes
+     */
+    void startSequence(uint8_t byte, uint32_t codePoint, uint8_t remaining)
+    {
+        m_codePoint = codePoint;
+        m_remaining = remaining;
+        m_seq[0U]   = byte;
+        m_seqLen    = 1U;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __UTF8_DECODER_HPP__ */
+
+/** @} */
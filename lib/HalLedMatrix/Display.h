@@ -238,6 +238,19 @@ private:
     {
         m_ledMatrix.drawPixel(x, y, color);
     }
+
+    /**
+     * Draw a row of pixels on the display.
+     *
+     * @param[in] x         x-coordinate of start point
+     * @param[in] y         y-coordinate of start point
+     * @param[in] pixels    Pixels of the row in RGB888 format
+     * @param[in] width     Number of pixels in the row
+     */
+    void drawRow(int16_t x, int16_t y, const Color* pixels, uint16_t width) final
+    {
+        m_ledMatrix.drawRow(x, y, pixels, width);
+    }
 };
 
 /******************************************************************************
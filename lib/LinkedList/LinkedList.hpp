@@ -45,6 +45,7 @@
  *****************************************************************************/
 #include <stddef.h>
 #include <new>
+#include "ListAllocator.hpp"
 
 /******************************************************************************
  * Macros
@@ -85,6 +86,40 @@ public:
     {
     }
 
+    /**
+     * Allocate a list element with the list allocator.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* operator new(size_t size) noexcept
+    {
+        return ListAllocator::allocate(size);
+    }
+
+    /**
+     * Allocate a list element with the list allocator.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* operator new(size_t size, const std::nothrow_t&) noexcept
+    {
+        return ListAllocator::allocate(size);
+    }
+
+    /**
+     * Release a list element with the list allocator.
+     *
+     * @param[in] ptr   Memory of the list element
+     */
+    static void operator delete(void* ptr)
+    {
+        ListAllocator::deallocate(ptr);
+    }
+
     /**
      * Get element.
      *
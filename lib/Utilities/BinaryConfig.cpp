@@ -0,0 +1,381 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Binary configuration
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "BinaryConfig.h"
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint16_t calcCrc16(const uint8_t* data, size_t len);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize magic number. */
+const uint8_t BinaryConfig::MAGIC[2] = { 'P', 'C' };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void BinaryConfig::beginWrite(uint8_t schemaVersion)
+{
+    m_size          = 0U;
+    m_pos           = HEADER_SIZE;
+    m_schemaVersion = schemaVersion;
+    m_isError       = ((nullptr == m_buffer) || (HEADER_SIZE > m_capacity));
+
+    return;
+}
+
+void BinaryConfig::writeUInt8(uint8_t value)
+{
+    write(value, 1U);
+    return;
+}
+
+void BinaryConfig::writeUInt16(uint16_t value)
+{
+    write(value, 2U);
+    return;
+}
+
+void BinaryConfig::writeUInt32(uint32_t value)
+{
+    write(value, 4U);
+    return;
+}
+
+void BinaryConfig::writeInt32(int32_t value)
+{
+    write(static_cast<uint32_t>(value), 4U);
+    return;
+}
+
+void BinaryConfig::writeBool(bool value)
+{
+    write((false == value) ? 0U : 1U, 1U);
+    return;
+}
+
+void BinaryConfig::writeString(const char* str)
+{
+    size_t len = (nullptr == str) ? 0U : strlen(str);
+
+    if (MAX_STRING_LEN < len)
+    {
+        m_isError = true;
+    }
+    else
+    {
+        write(len, 1U);
+
+        if ((false == m_isError) &&
+            (0U < len))
+        {
+            if (m_capacity < (m_pos + len))
+            {
+                m_isError = true;
+            }
+            else
+            {
+                memcpy(&m_buffer[m_pos], str, len);
+                m_pos += len;
+            }
+        }
+    }
+
+    return;
+}
+
+bool BinaryConfig::endWrite()
+{
+    if (false == m_isError)
+    {
+        size_t payloadSize = m_pos - HEADER_SIZE;
+
+        if (UINT16_MAX < payloadSize)
+        {
+            m_isError = true;
+        }
+        else
+        {
+            uint16_t crc = calcCrc16(&m_buffer[HEADER_SIZE], payloadSize);
+
+            m_buffer[0U] = MAGIC[0U];
+            m_buffer[1U] = MAGIC[1U];
+            m_buffer[2U] = FORMAT_VERSION;
+            m_buffer[3U] = m_schemaVersion;
+            m_buffer[4U] = static_cast<uint8_t>(payloadSize & 0xFFU);
+            m_buffer[5U] = static_cast<uint8_t>((payloadSize >> 8U) & 0xFFU);
+            m_buffer[6U] = static_cast<uint8_t>(crc & 0xFFU);
+            m_buffer[7U] = static_cast<uint8_t>((crc >> 8U) & 0xFFU);
+
+            m_size = m_pos;
+        }
+    }
+
+    return (false == m_isError);
+}
+
+bool BinaryConfig::beginRead(size_t size)
+{
+    m_size          = 0U;
+    m_pos           = HEADER_SIZE;
+    m_schemaVersion = 0U;
+    m_isError       = true;
+
+    if ((nullptr != m_buffer) &&
+        (HEADER_SIZE <= size) &&
+        (m_capacity >= size) &&
+        (MAGIC[0U] == m_buffer[0U]) &&
+        (MAGIC[1U] == m_buffer[1U]) &&
+        (FORMAT_VERSION == m_buffer[2U]))
+    {
+        size_t      payloadSize = static_cast<size_t>(m_buffer[4U]) | (static_cast<size_t>(m_buffer[5U]) << 8U);
+        uint16_t    crc         = static_cast<uint16_t>(m_buffer[6U]) | static_cast<uint16_t>(static_cast<uint16_t>(m_buffer[7U]) << 8U);
+
+        if (((HEADER_SIZE + payloadSize) == size) &&
+            (crc == calcCrc16(&m_buffer[HEADER_SIZE], payloadSize)))
+        {
+            m_size          = size;
+            m_schemaVersion = m_buffer[3U];
+            m_isError       = false;
+        }
+    }
+
+    return (false == m_isError);
+}
+
+bool BinaryConfig::readUInt8(uint8_t& value)
+{
+    uint32_t    raw             = 0U;
+    bool        isSuccessful    = read(raw, 1U);
+
+    if (true == isSuccessful)
+    {
+        value = static_cast<uint8_t>(raw);
+    }
+
+    return isSuccessful;
+}
+
+bool BinaryConfig::readUInt16(uint16_t& value)
+{
+    uint32_t    raw             = 0U;
+    bool        isSuccessful    = read(raw, 2U);
+
+    if (true == isSuccessful)
+    {
+        value = static_cast<uint16_t>(raw);
+    }
+
+    return isSuccessful;
+}
+
+bool BinaryConfig::readUInt32(uint32_t& value)
+{
+    return read(value, 4U);
+}
+
+bool BinaryConfig::readInt32(int32_t& value)
+{
+    uint32_t    raw             = 0U;
+    bool        isSuccessful    = read(raw, 4U);
+
+    if (true == isSuccessful)
+    {
+        value = static_cast<int32_t>(raw);
+    }
+
+    return isSuccessful;
+}
+
+bool BinaryConfig::readBool(bool& value)
+{
+    uint32_t    raw             = 0U;
+    bool        isSuccessful    = read(raw, 1U);
+
+    if (true == isSuccessful)
+    {
+        value = (0U != raw);
+    }
+
+    return isSuccessful;
+}
+
+bool BinaryConfig::readString(char* str, size_t size)
+{
+    bool        isSuccessful    = false;
+    size_t      pos             = m_pos;
+    uint32_t    len             = 0U;
+
+    if ((nullptr != str) &&
+        (0U < size) &&
+        (true == read(len, 1U)))
+    {
+        if ((size > len) &&
+            (m_size >= (m_pos + len)))
+        {
+            memcpy(str, &m_buffer[m_pos], len);
+            str[len] = '\0';
+            m_pos += len;
+
+            isSuccessful = true;
+        }
+        else
+        {
+            /* Rewind, the string may be read again with a larger buffer. */
+            m_pos = pos;
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void BinaryConfig::write(uint32_t value, uint8_t len)
+{
+    if (false == m_isError)
+    {
+        if (m_capacity < (m_pos + len))
+        {
+            m_isError = true;
+        }
+        else
+        {
+            uint8_t idx = 0U;
+
+            for(idx = 0U; idx < len; ++idx)
+            {
+                m_buffer[m_pos] = static_cast<uint8_t>((value >> (8U * idx)) & 0xFFU);
+                ++m_pos;
+            }
+        }
+    }
+
+    return;
+}
+
+bool BinaryConfig::read(uint32_t& value, uint8_t len)
+{
+    bool isSuccessful = false;
+
+    /* Reading beyond the payload is no error, it happens for fields which
+     * were appended by a newer schema.
+     */
+    if ((false == m_isError) &&
+        (m_size >= (m_pos + len)))
+    {
+        uint8_t idx = 0U;
+
+        value = 0U;
+
+        for(idx = 0U; idx < len; ++idx)
+        {
+            value |= static_cast<uint32_t>(m_buffer[m_pos]) << (8U * idx);
+            ++m_pos;
+        }
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Calculate the CRC-16 (CCITT, polynom 0x1021, start value 0xFFFF).
+ *
+ * @param[in] data  Data
+ * @param[in] len   Data length in byte
+ *
+ * @return CRC-16
+ */
+static uint16_t calcCrc16(const uint8_t* data, size_t len)
+{
+    uint16_t    crc = 0xFFFFU;
+    size_t      idx = 0U;
+
+    for(idx = 0U; idx < len; ++idx)
+    {
+        uint8_t bit = 0U;
+
+        crc ^= static_cast<uint16_t>(static_cast<uint16_t>(data[idx]) << 8U);
+
+        for(bit = 0U; bit < 8U; ++bit)
+        {
+            if (0U != (crc & 0x8000U))
+            {
+                crc = static_cast<uint16_t>((crc << 1U) ^ 0x1021U);
+            }
+            else
+            {
+                crc = static_cast<uint16_t>(crc << 1U);
+            }
+        }
+    }
+
+    return crc;
+}
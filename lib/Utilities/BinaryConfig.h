@@ -0,0 +1,339 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Binary configuration
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __BINARY_CONFIG_H__
+#define __BINARY_CONFIG_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Compact binary encoding of a configuration, which is read into typed
+ * fields without a DOM.
+ *
+ * The fields are written and read in a fixed order, which is defined by
+ * the user together with a schema version. A newer schema shall only
+ * append fields. Reading a field beyond the end of a older configuration
+ * fails and leaves the value untouched, therefore the default is kept.
+ *
+ * Layout (little endian):
+ * - Magic "PC" (2 byte)
+ * - Format version (1 byte)
+ * - Schema version (1 byte)
+ * - Payload size in byte (2 byte)
+ * - CRC-16 of the payload (2 byte)
+ * - Payload, a string is prefixed by its length (1 byte).
+ *
+ * The class works on a buffer, which is provided by the user.
+ */
+class BinaryConfig
+{
+public:
+
+    /** Header size in byte. */
+    static const size_t     HEADER_SIZE     = 8U;
+
+    /** Format version of the header and the field encoding. */
+    static const uint8_t    FORMAT_VERSION  = 1U;
+
+    /** Max. length of a string in byte, without string termination. */
+    static const size_t     MAX_STRING_LEN  = UINT8_MAX;
+
+    /**
+     * Constructs a binary configuration, which works on the given buffer.
+     *
+     * @param[in] buffer    Buffer
+     * @param[in] size      Buffer size in byte
+     */
+    BinaryConfig(uint8_t* buffer, size_t size) :
+        m_buffer(buffer),
+        m_capacity(size),
+        m_size(0U),
+        m_pos(0U),
+        m_schemaVersion(0U),
+        m_isError(false)
+    {
+    }
+
+    /**
+     * Destroys the binary configuration.
+     */
+    ~BinaryConfig()
+    {
+    }
+
+    /**
+     * Get the buffer.
+     *
+     * @return Buffer
+     */
+    uint8_t* getBuffer()
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Get the buffer.
+     *
+     * @return Buffer
+     */
+    const uint8_t* getBuffer() const
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Get the buffer size in byte.
+     *
+     * @return Buffer size in byte
+     */
+    size_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Get the size of the encoded configuration (header and payload) in byte.
+     * It is only valid after endWrite() or beginRead() was successful.
+     *
+     * @return Size in byte
+     */
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Get the schema version of the configuration.
+     *
+     * @return Schema version
+     */
+    uint8_t getSchemaVersion() const
+    {
+        return m_schemaVersion;
+    }
+
+    /**
+     * Is the configuration valid, which means no error happened while
+     * writing or reading it?
+     *
+     * @return If valid, it will return true otherwise false.
+     */
+    bool isValid() const
+    {
+        return (false == m_isError);
+    }
+
+    /**
+     * Begin to write a configuration. Any content in the buffer is discarded.
+     *
+     * @param[in] schemaVersion Schema version of the fields
+     */
+    void beginWrite(uint8_t schemaVersion);
+
+    /**
+     * Write a unsigned 8-bit value.
+     *
+     * @param[in] value Value
+     */
+    void writeUInt8(uint8_t value);
+
+    /**
+     * Write a unsigned 16-bit value.
+     *
+     * @param[in] value Value
+     */
+    void writeUInt16(uint16_t value);
+
+    /**
+     * Write a unsigned 32-bit value.
+     *
+     * @param[in] value Value
+     */
+    void writeUInt32(uint32_t value);
+
+    /**
+     * Write a signed 32-bit value.
+     *
+     * @param[in] value Value
+     */
+    void writeInt32(int32_t value);
+
+    /**
+     * Write a boolean value.
+     *
+     * @param[in] value Value
+     */
+    void writeBool(bool value);
+
+    /**
+     * Write a string. A string longer than MAX_STRING_LEN is an error.
+     *
+     * @param[in] str   String
+     */
+    void writeString(const char* str);
+
+    /**
+     * Finish writing the configuration. The header will be completed.
+     * Afterwards getBuffer() and getSize() provide the encoded configuration.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool endWrite();
+
+    /**
+     * Begin to read a configuration, which is in the buffer.
+     * The header and the payload are verified.
+     *
+     * @param[in] size  Number of bytes in the buffer
+     *
+     * @return If the configuration is valid, it will return true otherwise false.
+     */
+    bool beginRead(size_t size);
+
+    /**
+     * Read a unsigned 8-bit value.
+     *
+     * @param[out] value    Value
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readUInt8(uint8_t& value);
+
+    /**
+     * Read a unsigned 16-bit value.
+     *
+     * @param[out] value    Value
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readUInt16(uint16_t& value);
+
+    /**
+     * Read a unsigned 32-bit value.
+     *
+     * @param[out] value    Value
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readUInt32(uint32_t& value);
+
+    /**
+     * Read a signed 32-bit value.
+     *
+     * @param[out] value    Value
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readInt32(int32_t& value);
+
+    /**
+     * Read a boolean value.
+     *
+     * @param[out] value    Value
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readBool(bool& value);
+
+    /**
+     * Read a string. It will always be terminated.
+     *
+     * @param[out] str  String buffer
+     * @param[in]  size String buffer size in byte, including string termination.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readString(char* str, size_t size);
+
+private:
+
+    /** Magic number of the header. */
+    static const uint8_t    MAGIC[2];
+
+    uint8_t*    m_buffer;           /**< Buffer */
+    size_t      m_capacity;         /**< Buffer size in byte */
+    size_t      m_size;             /**< Size of the encoded configuration in byte */
+    size_t      m_pos;              /**< Current write/read position in the buffer */
+    uint8_t     m_schemaVersion;    /**< Schema version */
+    bool        m_isError;          /**< Error happened while writing or reading */
+
+    /* Prevent copying */
+    BinaryConfig();
+    BinaryConfig(const BinaryConfig& config);
+    BinaryConfig& operator=(const BinaryConfig& config);
+
+    /**
+     * Write little endian value with the given number of bytes.
+     *
+     * @param[in] value Value
+     * @param[in] len   Number of bytes
+     */
+    void write(uint32_t value, uint8_t len);
+
+    /**
+     * Read little endian value with the given number of bytes.
+     *
+     * @param[out] value    Value
+     * @param[in]  len      Number of bytes
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool read(uint32_t& value, uint8_t len);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BINARY_CONFIG_H__ */
+
+/** @} */
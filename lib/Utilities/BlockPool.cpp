@@ -0,0 +1,188 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Fixed-block memory pool
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "BlockPool.h"
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool BlockPool::create(size_t blockSize, uint16_t blockCount)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    if ((0U < blockSize) &&
+        (0U < blockCount))
+    {
+        /* A free block must be able to hold the link to the next one. */
+        if (sizeof(FreeBlock) > blockSize)
+        {
+            blockSize = sizeof(FreeBlock);
+        }
+
+        blockSize = ((blockSize + ALIGNMENT - 1U) / ALIGNMENT) * ALIGNMENT;
+
+        /* The memory of uint64_t is aligned to ALIGNMENT. */
+        m_memory = reinterpret_cast<uint8_t*>(new(std::nothrow) uint64_t[(blockSize * blockCount) / sizeof(uint64_t)]);
+
+        if (nullptr != m_memory)
+        {
+            uint16_t idx = 0U;
+
+            m_blockSize     = blockSize;
+            m_blockCount    = blockCount;
+
+            /* Chain all blocks in address order. */
+            for(idx = blockCount; idx > 0U; --idx)
+            {
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(&m_memory[(idx - 1U) * blockSize]);
+
+                block->next = m_freeList;
+                m_freeList  = block;
+            }
+
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void BlockPool::release()
+{
+    if (nullptr != m_memory)
+    {
+        delete[] reinterpret_cast<uint64_t*>(m_memory);
+        m_memory = nullptr;
+    }
+
+    m_freeList      = nullptr;
+    m_blockSize     = 0U;
+    m_blockCount    = 0U;
+    m_usedCount     = 0U;
+    m_peakCount     = 0U;
+    m_failCount     = 0U;
+}
+
+void* BlockPool::allocate()
+{
+    void* block = nullptr;
+
+    if (nullptr == m_freeList)
+    {
+        ++m_failCount;
+    }
+    else
+    {
+        block       = m_freeList;
+        m_freeList  = m_freeList->next;
+
+        ++m_usedCount;
+
+        if (m_peakCount < m_usedCount)
+        {
+            m_peakCount = m_usedCount;
+        }
+    }
+
+    return block;
+}
+
+void BlockPool::deallocate(void* block)
+{
+    if (true == isOwner(block))
+    {
+        FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(block);
+
+        freeBlock->next = m_freeList;
+        m_freeList      = freeBlock;
+
+        --m_usedCount;
+    }
+}
+
+bool BlockPool::isOwner(const void* block) const
+{
+    bool            isInPool    = false;
+    const uint8_t*  addr        = reinterpret_cast<const uint8_t*>(block);
+
+    if ((nullptr != m_memory) &&
+        (nullptr != addr) &&
+        (m_memory <= addr) &&
+        (&m_memory[m_blockSize * m_blockCount] > addr))
+    {
+        isInPool = true;
+    }
+
+    return isInPool;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
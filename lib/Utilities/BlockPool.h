@@ -0,0 +1,213 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Fixed-block memory pool
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __BLOCK_POOL_H__
+#define __BLOCK_POOL_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A memory pool of blocks with the same size. The blocks are allocated at
+ * once in a single chunk, therefore allocating and releasing a block doesn't
+ * fragment the heap. The free blocks are chained in a free list, which is
+ * stored in the blocks itself. Allocating and releasing a block costs O(1).
+ *
+ * The pool is not thread-safe.
+ */
+class BlockPool
+{
+public:
+
+    /**
+     * Constructs a empty block pool without blocks.
+     */
+    BlockPool() :
+        m_memory(nullptr),
+        m_freeList(nullptr),
+        m_blockSize(0U),
+        m_blockCount(0U),
+        m_usedCount(0U),
+        m_peakCount(0U),
+        m_failCount(0U)
+    {
+    }
+
+    /**
+     * Destroys the block pool.
+     */
+    ~BlockPool()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the pool with the given number of blocks. The block size is
+     * rounded up to keep every block aligned.
+     * A previous allocated pool is released.
+     *
+     * @param[in] blockSize     Block size in byte
+     * @param[in] blockCount    Number of blocks
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(size_t blockSize, uint16_t blockCount);
+
+    /**
+     * Release the pool. All blocks must be deallocated before.
+     */
+    void release();
+
+    /**
+     * Allocate a block.
+     *
+     * @return If successful, it will return the block otherwise nullptr.
+     */
+    void* allocate();
+
+    /**
+     * Deallocate a block, which was allocated from this pool.
+     * A nullptr or a block of another pool is ignored.
+     *
+     * @param[in] block Block, which to deallocate.
+     */
+    void deallocate(void* block);
+
+    /**
+     * Is the given memory a block of this pool?
+     *
+     * @param[in] block Block
+     *
+     * @return If the block belongs to this pool, it will return true otherwise false.
+     */
+    bool isOwner(const void* block) const;
+
+    /**
+     * Get the block size.
+     *
+     * @return Block size in byte
+     */
+    size_t getBlockSize() const
+    {
+        return m_blockSize;
+    }
+
+    /**
+     * Get the number of blocks.
+     *
+     * @return Number of blocks
+     */
+    uint16_t getBlockCount() const
+    {
+        return m_blockCount;
+    }
+
+    /**
+     * Get the number of allocated blocks.
+     *
+     * @return Number of allocated blocks
+     */
+    uint16_t getUsedCount() const
+    {
+        return m_usedCount;
+    }
+
+    /**
+     * Get the max. number of blocks, which were allocated at the same time.
+     *
+     * @return Peak number of allocated blocks
+     */
+    uint16_t getPeakCount() const
+    {
+        return m_peakCount;
+    }
+
+    /**
+     * Get the number of failed allocations, because the pool was exhausted.
+     *
+     * @return Number of failed allocations
+     */
+    uint32_t getFailCount() const
+    {
+        return m_failCount;
+    }
+
+    /** Alignment of the blocks in byte, which is sufficient for every fundamental type. */
+    static const size_t ALIGNMENT = 8U;
+
+private:
+
+    /**
+     * A free block contains the link to the next free block.
+     */
+    struct FreeBlock
+    {
+        FreeBlock*  next;   /**< Next free block */
+    };
+
+    uint8_t*    m_memory;       /**< Memory of all blocks */
+    FreeBlock*  m_freeList;     /**< Free blocks */
+    size_t      m_blockSize;    /**< Block size in byte */
+    uint16_t    m_blockCount;   /**< Number of blocks */
+    uint16_t    m_usedCount;    /**< Number of allocated blocks */
+    uint16_t    m_peakCount;    /**< Peak number of allocated blocks */
+    uint32_t    m_failCount;    /**< Number of failed allocations */
+
+    BlockPool(const BlockPool& pool);
+    BlockPool& operator=(const BlockPool& pool);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BLOCK_POOL_H__ */
+
+/** @} */
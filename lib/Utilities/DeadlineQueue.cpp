@@ -0,0 +1,291 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Deadline queue
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "DeadlineQueue.h"
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool DeadlineQueue::create(uint8_t capacity)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    /* The capacity is limited, because INVALID_POS marks a not scheduled id. */
+    if ((0U < capacity) &&
+        (INVALID_POS > capacity))
+    {
+        m_heap      = new(std::nothrow) uint8_t[capacity];
+        m_pos       = new(std::nothrow) uint8_t[capacity];
+        m_deadlines = new(std::nothrow) uint32_t[capacity];
+
+        if ((nullptr == m_heap) ||
+            (nullptr == m_pos) ||
+            (nullptr == m_deadlines))
+        {
+            release();
+        }
+        else
+        {
+            uint8_t id = 0U;
+
+            for(id = 0U; id < capacity; ++id)
+            {
+                m_pos[id]       = INVALID_POS;
+                m_deadlines[id] = 0U;
+            }
+
+            m_capacity      = capacity;
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void DeadlineQueue::release()
+{
+    if (nullptr != m_heap)
+    {
+        delete[] m_heap;
+        m_heap = nullptr;
+    }
+
+    if (nullptr != m_pos)
+    {
+        delete[] m_pos;
+        m_pos = nullptr;
+    }
+
+    if (nullptr != m_deadlines)
+    {
+        delete[] m_deadlines;
+        m_deadlines = nullptr;
+    }
+
+    m_capacity  = 0U;
+    m_count     = 0U;
+}
+
+bool DeadlineQueue::schedule(uint8_t id, uint32_t deadline)
+{
+    bool isSuccessful = false;
+
+    if (m_capacity > id)
+    {
+        uint8_t pos = m_pos[id];
+
+        /* Not scheduled yet? Append it at the end of the heap. */
+        if (INVALID_POS == pos)
+        {
+            pos             = m_count;
+            m_heap[pos]     = id;
+            m_pos[id]       = pos;
+            m_deadlines[id] = deadline;
+            ++m_count;
+
+            siftUp(pos);
+        }
+        else
+        {
+            uint32_t oldDeadline = m_deadlines[id];
+
+            m_deadlines[id] = deadline;
+
+            /* Earlier than before? */
+            if (0 > static_cast<int32_t>(deadline - oldDeadline))
+            {
+                siftUp(pos);
+            }
+            else
+            {
+                siftDown(pos);
+            }
+        }
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void DeadlineQueue::remove(uint8_t id)
+{
+    if (true == isScheduled(id))
+    {
+        uint8_t pos     = m_pos[id];
+        uint8_t lastPos = m_count - 1U;
+
+        /* Replace it with the last entry and restore the heap order. */
+        swap(pos, lastPos);
+        m_pos[id] = INVALID_POS;
+        --m_count;
+
+        if (m_count > pos)
+        {
+            siftUp(pos);
+            siftDown(pos);
+        }
+    }
+}
+
+bool DeadlineQueue::getDeadline(uint8_t id, uint32_t& deadline) const
+{
+    bool isScheduled = this->isScheduled(id);
+
+    if (true == isScheduled)
+    {
+        deadline = m_deadlines[id];
+    }
+
+    return isScheduled;
+}
+
+bool DeadlineQueue::peek(uint8_t& id, uint32_t& deadline) const
+{
+    bool isAvailable = false;
+
+    if (0U < m_count)
+    {
+        id          = m_heap[0U];
+        deadline    = m_deadlines[id];
+        isAvailable = true;
+    }
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void DeadlineQueue::swap(uint8_t posA, uint8_t posB)
+{
+    uint8_t idA = m_heap[posA];
+    uint8_t idB = m_heap[posB];
+
+    m_heap[posA]    = idB;
+    m_heap[posB]    = idA;
+    m_pos[idA]      = posB;
+    m_pos[idB]      = posA;
+}
+
+void DeadlineQueue::siftUp(uint8_t pos)
+{
+    bool isDone = false;
+
+    while((0U < pos) && (false == isDone))
+    {
+        uint8_t parent = (pos - 1U) / 2U;
+
+        if (false == isBefore(m_heap[pos], m_heap[parent]))
+        {
+            isDone = true;
+        }
+        else
+        {
+            swap(pos, parent);
+            pos = parent;
+        }
+    }
+}
+
+void DeadlineQueue::siftDown(uint8_t pos)
+{
+    bool isDone = false;
+
+    while(false == isDone)
+    {
+        uint16_t    left        = 2U * pos + 1U;
+        uint16_t    right       = left + 1U;
+        uint8_t     earliest    = pos;
+
+        if ((m_count > left) &&
+            (true == isBefore(m_heap[left], m_heap[earliest])))
+        {
+            earliest = left;
+        }
+
+        if ((m_count > right) &&
+            (true == isBefore(m_heap[right], m_heap[earliest])))
+        {
+            earliest = right;
+        }
+
+        if (pos == earliest)
+        {
+            isDone = true;
+        }
+        else
+        {
+            swap(pos, earliest);
+            pos = earliest;
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,232 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Deadline queue
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __DEADLINE_QUEUE_H__
+#define __DEADLINE_QUEUE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A priority queue of deadlines, realized as binary min-heap. Every entry
+ * is identified by a id in the range [0; capacity), e.g. a slot id, which
+ * has at most one deadline.
+ *
+ * The earliest deadline is available in O(1), scheduling and removing
+ * a entry costs O(log n). The deadlines are timestamps in ms, which are
+ * compared robust against a timestamp overflow.
+ */
+class DeadlineQueue
+{
+public:
+
+    /**
+     * Constructs a empty deadline queue without capacity.
+     */
+    DeadlineQueue() :
+        m_heap(nullptr),
+        m_pos(nullptr),
+        m_deadlines(nullptr),
+        m_capacity(0U),
+        m_count(0U)
+    {
+    }
+
+    /**
+     * Destroys the deadline queue.
+     */
+    ~DeadlineQueue()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the queue for the given number of ids.
+     * A previous allocated queue is released.
+     *
+     * @param[in] capacity  Max. number of ids
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint8_t capacity);
+
+    /**
+     * Release the queue.
+     */
+    void release();
+
+    /**
+     * Get the capacity, which is the max. number of ids.
+     *
+     * @return Capacity
+     */
+    uint8_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Get number of scheduled ids.
+     *
+     * @return Number of scheduled ids
+     */
+    uint8_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Schedule a deadline for the given id. If the id is already scheduled,
+     * its deadline will be replaced.
+     *
+     * @param[in] id        Id [0; capacity)
+     * @param[in] deadline  Deadline timestamp in ms
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool schedule(uint8_t id, uint32_t deadline);
+
+    /**
+     * Remove the deadline of the given id.
+     *
+     * @param[in] id    Id [0; capacity)
+     */
+    void remove(uint8_t id);
+
+    /**
+     * Is the given id scheduled?
+     *
+     * @param[in] id    Id
+     *
+     * @return If scheduled, it will return true otherwise false.
+     */
+    bool isScheduled(uint8_t id) const
+    {
+        return (m_capacity > id) && (INVALID_POS != m_pos[id]);
+    }
+
+    /**
+     * Get the deadline of the given id.
+     *
+     * @param[in]   id          Id
+     * @param[out]  deadline    Deadline timestamp in ms
+     *
+     * @return If the id is scheduled, it will return true otherwise false.
+     */
+    bool getDeadline(uint8_t id, uint32_t& deadline) const;
+
+    /**
+     * Get the id with the earliest deadline.
+     *
+     * @param[out]  id          Id
+     * @param[out]  deadline    Deadline timestamp in ms
+     *
+     * @return If the queue is empty, it will return false otherwise true.
+     */
+    bool peek(uint8_t& id, uint32_t& deadline) const;
+
+private:
+
+    /** Heap position of a id, which is not scheduled. */
+    static const uint8_t    INVALID_POS = UINT8_MAX;
+
+    uint8_t*    m_heap;         /**< Ids in heap order, the earliest deadline first. */
+    uint8_t*    m_pos;          /**< Heap position per id */
+    uint32_t*   m_deadlines;    /**< Deadline per id */
+    uint8_t     m_capacity;     /**< Max. number of ids */
+    uint8_t     m_count;        /**< Number of scheduled ids */
+
+    /* Prevent copying */
+    DeadlineQueue(const DeadlineQueue& queue);
+    DeadlineQueue& operator=(const DeadlineQueue& queue);
+
+    /**
+     * Is the deadline of the first id before the one of the second id?
+     *
+     * @param[in] idA   First id
+     * @param[in] idB   Second id
+     *
+     * @return If the first deadline is earlier, it will return true otherwise false.
+     */
+    bool isBefore(uint8_t idA, uint8_t idB) const
+    {
+        /* Signed difference to be robust against timestamp overflow. */
+        return (0 > static_cast<int32_t>(m_deadlines[idA] - m_deadlines[idB]));
+    }
+
+    /**
+     * Swap two heap entries.
+     *
+     * @param[in] posA  Heap position of first entry
+     * @param[in] posB  Heap position of second entry
+     */
+    void swap(uint8_t posA, uint8_t posB);
+
+    /**
+     * Move a entry up in the heap, until the heap order is restored.
+     *
+     * @param[in] pos   Heap position
+     */
+    void siftUp(uint8_t pos);
+
+    /**
+     * Move a entry down in the heap, until the heap order is restored.
+     *
+     * @param[in] pos   Heap position
+     */
+    void siftDown(uint8_t pos);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __DEADLINE_QUEUE_H__ */
+
+/** @} */
@@ -0,0 +1,582 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Hash table with open addressing
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __HASH_TABLE_HPP__
+#define __HASH_TABLE_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <new>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Hash table with open addressing and linear probing. The entries are stored
+ * directly in the table, which costs no allocation per entry. A removed entry
+ * doesn't leave a tombstone, the following entries of the probe sequence are
+ * shifted back instead. At least one slot is always empty, therefore every
+ * search ends.
+ *
+ * The table doesn't decide about its load factor. Its user either creates it
+ * with a fixed number of slots or grows it via reserve() before adding.
+ *
+ * The entry type must be default constructible, which results in a empty
+ * entry. The traits type provides:
+ * - static bool isEmpty(const TEntry& entry)
+ * - static uint32_t getHash(const TEntry& entry)
+ * - static bool isMatch(const TEntry& entry, const TKey& key), for every key
+ *   type, which is used to search.
+ *
+ * The table position is derived from the lower bits of the hash.
+ *
+ * @tparam TEntry   Entry type
+ * @tparam TTraits  Entry traits
+ */
+template < typename TEntry, typename TTraits >
+class HashTable
+{
+public:
+
+    /** Number of slots, which are allocated at least. Must be a power of 2. */
+    static const uint16_t   MIN_SLOTS   = 8U;
+
+    /** Max. number of slots. It is a power of 2. */
+    static const uint16_t   MAX_SLOTS   = 0x8000U;
+
+    /**
+     * Constructs a empty hash table without slots.
+     */
+    HashTable() :
+        m_slots(nullptr),
+        m_slotCnt(0U),
+        m_count(0U)
+    {
+    }
+
+    /**
+     * Constructs a hash table by copy.
+     *
+     * @param[in] table Hash table, which to copy.
+     */
+    HashTable(const HashTable& table) :
+        m_slots(nullptr),
+        m_slotCnt(0U),
+        m_count(0U)
+    {
+        copy(table);
+    }
+
+    /**
+     * Destroys the hash table.
+     */
+    ~HashTable()
+    {
+        release();
+    }
+
+    /**
+     * Assigns a hash table.
+     *
+     * @param[in] table Hash table, which to assign.
+     *
+     * @return Hash table
+     */
+    HashTable& operator=(const HashTable& table)
+    {
+        if (&table != this)
+        {
+            release();
+            copy(table);
+        }
+
+        return *this;
+    }
+
+    /**
+     * Allocate the given number of slots, rounded up to the next power of 2.
+     * All entries are removed.
+     *
+     * @param[in] slotCnt   Number of slots
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t slotCnt)
+    {
+        bool isSuccessful = false;
+
+        release();
+
+        if ((0U < slotCnt) &&
+            (MAX_SLOTS >= slotCnt))
+        {
+            TEntry* slots = new(std::nothrow) TEntry[roundUp(slotCnt)];
+
+            if (nullptr != slots)
+            {
+                m_slots         = slots;
+                m_slotCnt       = roundUp(slotCnt);
+                isSuccessful    = true;
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Release all slots.
+     */
+    void release()
+    {
+        if (nullptr != m_slots)
+        {
+            delete[] m_slots;
+            m_slots = nullptr;
+        }
+
+        m_slotCnt   = 0U;
+        m_count     = 0U;
+
+        return;
+    }
+
+    /**
+     * Remove all entries, but keep the slots.
+     */
+    void clear()
+    {
+        uint16_t idx = 0U;
+
+        for(idx = 0U; idx < m_slotCnt; ++idx)
+        {
+            m_slots[idx] = TEntry();
+        }
+
+        m_count = 0U;
+
+        return;
+    }
+
+    /**
+     * Grow the table, so that the given number of entries keep the load
+     * factor at or below 3/4. The slots are doubled as often as necessary
+     * and all entries are rehashed.
+     *
+     * @param[in] count Number of entries
+     *
+     * @return If enough slots are available, it will return true otherwise false.
+     */
+    bool reserve(uint16_t count)
+    {
+        bool        isSuccessful    = true;
+        uint32_t    slotCnt         = (0U == m_slotCnt) ? MIN_SLOTS : m_slotCnt;
+
+        while((4U * static_cast<uint32_t>(count)) > (3U * slotCnt))
+        {
+            slotCnt *= 2U;
+        }
+
+        if (m_slotCnt < slotCnt)
+        {
+            isSuccessful = rehash(slotCnt);
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Get number of entries.
+     *
+     * @return Number of entries
+     */
+    uint16_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Get number of slots. Together with getSlot() it can be used to walk
+     * through all entries.
+     *
+     * @return Number of slots
+     */
+    uint16_t getSlotCount() const
+    {
+        return m_slotCnt;
+    }
+
+    /**
+     * Get the entry in a slot.
+     *
+     * @param[in] idx   Slot index
+     *
+     * @return Entry or nullptr, if the slot is empty.
+     */
+    const TEntry* getSlot(uint16_t idx) const
+    {
+        const TEntry* entry = nullptr;
+
+        if ((m_slotCnt > idx) &&
+            (false == TTraits::isEmpty(m_slots[idx])))
+        {
+            entry = &m_slots[idx];
+        }
+
+        return entry;
+    }
+
+    /**
+     * Find the first entry, which matches the key.
+     *
+     * @tparam TKey     Key type
+     *
+     * @param[in] hash  Hash of the key, which is the same as of the matching entry.
+     * @param[in] key   Key
+     *
+     * @return Entry or nullptr, if not found.
+     */
+    template < typename TKey >
+    TEntry* find(uint32_t hash, const TKey& key)
+    {
+        TEntry* entry = nullptr;
+
+        if (0U < m_count)
+        {
+            uint16_t idx = probe(hash, key);
+
+            if (false == TTraits::isEmpty(m_slots[idx]))
+            {
+                entry = &m_slots[idx];
+            }
+        }
+
+        return entry;
+    }
+
+    /**
+     * Find the first entry, which matches the key.
+     *
+     * @tparam TKey     Key type
+     *
+     * @param[in] hash  Hash of the key, which is the same as of the matching entry.
+     * @param[in] key   Key
+     *
+     * @return Entry or nullptr, if not found.
+     */
+    template < typename TKey >
+    const TEntry* find(uint32_t hash, const TKey& key) const
+    {
+        return const_cast<HashTable*>(this)->find(hash, key);
+    }
+
+    /**
+     * Put a entry. If a entry matches the key, it will be replaced otherwise
+     * the entry is added.
+     *
+     * @tparam TKey     Key type
+     *
+     * @param[in] key   Key of the entry
+     * @param[in] entry Entry, which must not be empty.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    template < typename TKey >
+    bool put(const TKey& key, const TEntry& entry)
+    {
+        bool isSuccessful = false;
+
+        if (0U < m_slotCnt)
+        {
+            uint16_t idx = probe(TTraits::getHash(entry), key);
+
+            if (false == TTraits::isEmpty(m_slots[idx]))
+            {
+                m_slots[idx]    = entry;
+                isSuccessful    = true;
+            }
+            /* Keep one slot empty. */
+            else if ((m_count + 1U) < m_slotCnt)
+            {
+                m_slots[idx]    = entry;
+                ++m_count;
+                isSuccessful    = true;
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Add a entry, even if there are already entries with the same key.
+     *
+     * @param[in] entry Entry, which must not be empty.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool add(const TEntry& entry)
+    {
+        bool isSuccessful = false;
+
+        /* Keep one slot empty. */
+        if ((m_count + 1U) < m_slotCnt)
+        {
+            m_slots[probeEmpty(TTraits::getHash(entry))] = entry;
+            ++m_count;
+            isSuccessful = true;
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Remove the first entry, which matches the key.
+     *
+     * @tparam TKey     Key type
+     *
+     * @param[in] hash  Hash of the key, which is the same as of the matching entry.
+     * @param[in] key   Key
+     *
+     * @return If a entry was removed, it will return true otherwise false.
+     */
+    template < typename TKey >
+    bool remove(uint32_t hash, const TKey& key)
+    {
+        bool isRemoved = false;
+
+        if (0U < m_count)
+        {
+            uint16_t hole = probe(hash, key);
+
+            if (false == TTraits::isEmpty(m_slots[hole]))
+            {
+                uint16_t    mask    = m_slotCnt - 1U;
+                uint16_t    next    = (hole + 1U) & mask;
+
+                /* Shift the following entries of the probe sequence back,
+                 * so a search never stops early at the removed entry.
+                 */
+                while(false == TTraits::isEmpty(m_slots[next]))
+                {
+                    uint16_t home = TTraits::getHash(m_slots[next]) & mask;
+
+                    /* Can the entry be moved to the hole, without moving it
+                     * before its home position?
+                     */
+                    if (((next - home) & mask) >= ((next - hole) & mask))
+                    {
+                        m_slots[hole]   = m_slots[next];
+                        hole            = next;
+                    }
+
+                    next = (next + 1U) & mask;
+                }
+
+                m_slots[hole] = TEntry();
+                --m_count;
+
+                isRemoved = true;
+            }
+        }
+
+        return isRemoved;
+    }
+
+private:
+
+    TEntry*     m_slots;    /**< Slots */
+    uint16_t    m_slotCnt;  /**< Number of slots, always a power of 2. */
+    uint16_t    m_count;    /**< Number of entries */
+
+    /**
+     * Round up to the next power of 2.
+     *
+     * @param[in] value Value, at most MAX_SLOTS.
+     *
+     * @return Power of 2
+     */
+    static uint16_t roundUp(uint16_t value)
+    {
+        uint16_t result = 1U;
+
+        while(value > result)
+        {
+            result <<= 1U;
+        }
+
+        return result;
+    }
+
+    /**
+     * Get the slot of the first entry, which matches the key. If there is
+     * none, the empty slot where the search stopped is returned.
+     *
+     * @tparam TKey     Key type
+     *
+     * @param[in] hash  Hash of the key
+     * @param[in] key   Key
+     *
+     * @return Slot index
+     */
+    template < typename TKey >
+    uint16_t probe(uint32_t hash, const TKey& key) const
+    {
+        uint16_t mask   = m_slotCnt - 1U;
+        uint16_t idx    = hash & mask;
+
+        /* The hash is compared first, because it is cheaper than the key. */
+        while((false == TTraits::isEmpty(m_slots[idx])) &&
+              ((hash != TTraits::getHash(m_slots[idx])) ||
+               (false == TTraits::isMatch(m_slots[idx], key))))
+        {
+            idx = (idx + 1U) & mask;
+        }
+
+        return idx;
+    }
+
+    /**
+     * Get the first empty slot of the probe sequence.
+     *
+     * @param[in] hash  Hash
+     *
+     * @return Slot index
+     */
+    uint16_t probeEmpty(uint32_t hash) const
+    {
+        uint16_t mask   = m_slotCnt - 1U;
+        uint16_t idx    = hash & mask;
+
+        while(false == TTraits::isEmpty(m_slots[idx]))
+        {
+            idx = (idx + 1U) & mask;
+        }
+
+        return idx;
+    }
+
+    /**
+     * Move all entries to a new table with the given number of slots.
+     * If no memory is available, the table is kept.
+     *
+     * @param[in] slotCnt   Number of slots, a power of 2.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool rehash(uint32_t slotCnt)
+    {
+        bool isSuccessful = false;
+
+        if (MAX_SLOTS >= slotCnt)
+        {
+            TEntry* slots = new(std::nothrow) TEntry[slotCnt];
+
+            if (nullptr != slots)
+            {
+                TEntry*     oldSlots    = m_slots;
+                uint16_t    oldSlotCnt  = m_slotCnt;
+                uint16_t    idx         = 0U;
+
+                m_slots     = slots;
+                m_slotCnt   = slotCnt;
+
+                for(idx = 0U; idx < oldSlotCnt; ++idx)
+                {
+                    if (false == TTraits::isEmpty(oldSlots[idx]))
+                    {
+                        m_slots[probeEmpty(TTraits::getHash(oldSlots[idx]))] = oldSlots[idx];
+                    }
+                }
+
+                delete[] oldSlots;
+
+                isSuccessful = true;
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Copy all slots of another hash table. If no memory is available, the
+     * table stays empty.
+     *
+     * @param[in] table Hash table, which to copy.
+     */
+    void copy(const HashTable& table)
+    {
+        if (0U < table.m_slotCnt)
+        {
+            m_slots = new(std::nothrow) TEntry[table.m_slotCnt];
+
+            if (nullptr != m_slots)
+            {
+                uint16_t idx = 0U;
+
+                for(idx = 0U; idx < table.m_slotCnt; ++idx)
+                {
+                    m_slots[idx] = table.m_slots[idx];
+                }
+
+                m_slotCnt   = table.m_slotCnt;
+                m_count     = table.m_count;
+            }
+        }
+
+        return;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __HASH_TABLE_HPP__ */
+
+/** @} */
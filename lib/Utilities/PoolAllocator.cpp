@@ -0,0 +1,266 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Size class pool allocator
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PoolAllocator.h"
+#include "Util.h"
+
+#include <Mutex.hpp>
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Size class, which defines a pool.
+ */
+typedef struct
+{
+    size_t      blockSize;  /**< Block size in byte */
+    uint16_t    blockCount; /**< Number of blocks */
+
+} SizeClass;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Size classes in ascending block size order, about 13.5 kB in total.
+ * The block counts are derived from the object sizes on the target
+ * and the default of 8 display slots plus the system message plugin:
+ * -   32 byte: List elements, two per plugin instance and one per widget
+ *              in a widget group.
+ * -   64 byte: Small plugins without widgets, e.g. the effect plugins.
+ * -  128 byte: Network plugins, whose widgets are released in hibernation.
+ * -  256 byte: Pixel buffers of 8x8 icons, up to three per plugin.
+ * -  512 byte: Plugins with a text widget, e.g. the just text plugin.
+ * - 1024 byte: Plugins with an icon and a text widget, e.g. the date and
+ *              time plugin and the two framebuffers of a 32x8 display.
+ *
+ * Larger requests, e.g. sprite sheet textures, are rare and served by the heap.
+ */
+static const SizeClass  SIZE_CLASSES[] =
+{
+    {   32U, 32U },
+    {   64U,  8U },
+    {  128U,  8U },
+    {  256U, 12U },
+    {  512U,  4U },
+    { 1024U,  6U }
+};
+
+/** Mutex to protect the pools against concurrent access. */
+static MutexRecursive   gMutex;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool PoolAllocator::begin()
+{
+    bool isSuccessful = false;
+
+    if (nullptr != m_pools)
+    {
+        isSuccessful = true;
+    }
+    else if (true == gMutex.create())
+    {
+        BlockPool*  pools   = new(std::nothrow) BlockPool[UTIL_ARRAY_NUM(SIZE_CLASSES)];
+
+        if (nullptr != pools)
+        {
+            uint8_t idx = 0U;
+
+            isSuccessful = true;
+
+            while((UTIL_ARRAY_NUM(SIZE_CLASSES) > idx) && (true == isSuccessful))
+            {
+                isSuccessful = pools[idx].create(SIZE_CLASSES[idx].blockSize, SIZE_CLASSES[idx].blockCount);
+
+                ++idx;
+            }
+
+            if (false == isSuccessful)
+            {
+                delete[] pools;
+            }
+            else
+            {
+                MutexGuard<MutexRecursive> guard(gMutex);
+
+                m_pools     = pools;
+                m_poolCount = UTIL_ARRAY_NUM(SIZE_CLASSES);
+            }
+        }
+
+        if (false == isSuccessful)
+        {
+            gMutex.destroy();
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    return isSuccessful;
+}
+
+void* PoolAllocator::allocate(size_t size)
+{
+    void*   ptr     = nullptr;
+    bool    isFound = false;
+
+    if (0U == size)
+    {
+        size = 1U;
+    }
+
+    {
+        MutexGuard<MutexRecursive>  guard(gMutex);
+        uint8_t                     idx     = 0U;
+
+        /* Smallest size class, which fits. */
+        while((m_poolCount > idx) && (false == isFound))
+        {
+            if (m_pools[idx].getBlockSize() >= size)
+            {
+                ptr     = m_pools[idx].allocate();
+                isFound = true;
+            }
+            else
+            {
+                ++idx;
+            }
+        }
+
+        /* Not created yet or larger than the largest size class? */
+        if ((false == isFound) &&
+            (0U < m_poolCount))
+        {
+            ++m_oversizeCount;
+        }
+    }
+
+    /* Pool exhausted or no pool fits, fall back to the heap. */
+    if (nullptr == ptr)
+    {
+        ptr = ::operator new(size, std::nothrow);
+    }
+
+    return ptr;
+}
+
+void PoolAllocator::deallocate(void* ptr)
+{
+    if (nullptr != ptr)
+    {
+        bool isFound = false;
+
+        {
+            MutexGuard<MutexRecursive>  guard(gMutex);
+            uint8_t                     idx     = 0U;
+
+            while((m_poolCount > idx) && (false == isFound))
+            {
+                if (true == m_pools[idx].isOwner(ptr))
+                {
+                    m_pools[idx].deallocate(ptr);
+                    isFound = true;
+                }
+                else
+                {
+                    ++idx;
+                }
+            }
+        }
+
+        /* Not part of a pool, therefore it was allocated from the heap. */
+        if (false == isFound)
+        {
+            ::operator delete(ptr);
+        }
+    }
+
+    return;
+}
+
+bool PoolAllocator::getStatistics(uint8_t index, Statistics& stats) const
+{
+    bool                        isSuccessful    = false;
+    MutexGuard<MutexRecursive>  guard(gMutex);
+
+    if (m_poolCount > index)
+    {
+        stats.blockSize     = m_pools[index].getBlockSize();
+        stats.blockCount    = m_pools[index].getBlockCount();
+        stats.usedCount     = m_pools[index].getUsedCount();
+        stats.peakCount     = m_pools[index].getPeakCount();
+        stats.failCount     = m_pools[index].getFailCount();
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,191 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Size class pool allocator
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __POOL_ALLOCATOR_H__
+#define __POOL_ALLOCATOR_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include "BlockPool.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Allocator for long living objects like plugins, list elements and bitmap
+ * buffers, which are allocated and released again and again by installing
+ * and uninstalling plugins. Every allocation is served by the fixed-block
+ * pool of the smallest size class, which fits. This avoids the heap
+ * fragmentation over time.
+ *
+ * Requests which are larger than the largest size class or which can't be
+ * served, because the pool is exhausted, fall back to the heap. Before the
+ * pools are created with begin(), every request is served by the heap.
+ *
+ * The allocator is thread-safe.
+ */
+class PoolAllocator
+{
+public:
+
+    /**
+     * Statistics of a single pool.
+     */
+    struct Statistics
+    {
+        size_t      blockSize;  /**< Block size in byte */
+        uint16_t    blockCount; /**< Number of blocks */
+        uint16_t    usedCount;  /**< Number of allocated blocks */
+        uint16_t    peakCount;  /**< Peak number of allocated blocks */
+        uint32_t    failCount;  /**< Number of requests, which fall back to the heap, because the pool was exhausted. */
+    };
+
+    /**
+     * Get the pool allocator instance.
+     *
+     * @return Pool allocator
+     */
+    static PoolAllocator& getInstance()
+    {
+        static PoolAllocator instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Create the pools of all size classes.
+     * This shall be called once during startup, before the plugins are created.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Allocate memory.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    void* allocate(size_t size);
+
+    /**
+     * Deallocate memory, which was allocated with allocate().
+     * A nullptr is ignored.
+     *
+     * @param[in] ptr   Memory, which to deallocate.
+     */
+    void deallocate(void* ptr);
+
+    /**
+     * Get the number of pools, one per size class.
+     *
+     * @return Number of pools
+     */
+    uint8_t getPoolCount() const
+    {
+        return m_poolCount;
+    }
+
+    /**
+     * Get the statistics of a pool.
+     *
+     * @param[in]   index   Pool index in the range [0; getPoolCount())
+     * @param[out]  stats   Pool statistics
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getStatistics(uint8_t index, Statistics& stats) const;
+
+    /**
+     * Get the number of requests, which were served by the heap, because
+     * they are larger than the largest size class.
+     *
+     * @return Number of oversized requests
+     */
+    uint32_t getOversizeCount() const
+    {
+        return m_oversizeCount;
+    }
+
+private:
+
+    BlockPool*  m_pools;            /**< One pool per size class, in ascending block size order. */
+    uint8_t     m_poolCount;        /**< Number of pools */
+    uint32_t    m_oversizeCount;    /**< Number of oversized requests */
+
+    /**
+     * Constructs the pool allocator.
+     */
+    PoolAllocator() :
+        m_pools(nullptr),
+        m_poolCount(0U),
+        m_oversizeCount(0U)
+    {
+    }
+
+    /**
+     * Destroys the pool allocator.
+     */
+    ~PoolAllocator()
+    {
+        /* Will never be called. The pools are kept, because objects may be
+         * released after the allocator.
+         */
+    }
+
+    PoolAllocator(const PoolAllocator& allocator);
+    PoolAllocator& operator=(const PoolAllocator& allocator);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __POOL_ALLOCATOR_H__ */
+
+/** @} */
@@ -0,0 +1,151 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  State blob
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "StateBlob.h"
+#include <new>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+uint8_t* StateBlob::allocate(size_t size)
+{
+    release();
+
+    if (0U < size)
+    {
+        m_data = new(std::nothrow) uint8_t[size];
+
+        if (nullptr != m_data)
+        {
+            m_size = size;
+        }
+    }
+
+    return m_data;
+}
+
+bool StateBlob::store(const BinaryConfig& config)
+{
+    bool isSuccessful = false;
+
+    if (0U == config.getSize())
+    {
+        release();
+    }
+    else if (nullptr != allocate(config.getSize()))
+    {
+        memcpy(m_data, config.getBuffer(), m_size);
+        isSuccessful = true;
+    }
+    else
+    {
+        ;
+    }
+
+    return isSuccessful;
+}
+
+bool StateBlob::storeString(const char* str)
+{
+    bool isSuccessful = false;
+
+    if (nullptr == str)
+    {
+        release();
+    }
+    else
+    {
+        size_t size = strlen(str) + 1U;
+
+        if (nullptr != allocate(size))
+        {
+            memcpy(m_data, str, size);
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void StateBlob::release()
+{
+    if (nullptr != m_data)
+    {
+        delete[] m_data;
+        m_data = nullptr;
+    }
+
+    m_size = 0U;
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
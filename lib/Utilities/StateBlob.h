@@ -0,0 +1,179 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  State blob
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __STATE_BLOB_H__
+#define __STATE_BLOB_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include "BinaryConfig.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A compact blob in the heap, which keeps a state while the objects it
+ * belongs to are released, e.g. the state of a hibernated plugin.
+ *
+ * The blob is allocated with the exact size. The state is usually written
+ * with a BinaryConfig to a temporary buffer and stored afterwards. To read
+ * it back, a BinaryConfig works on the blob data directly. A single string,
+ * e.g. a shown text, can be stored without any header.
+ */
+class StateBlob
+{
+public:
+
+    /**
+     * Constructs a empty blob.
+     */
+    StateBlob() :
+        m_data(nullptr),
+        m_size(0U)
+    {
+    }
+
+    /**
+     * Destroys the blob.
+     */
+    ~StateBlob()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the blob with the given size. A previous blob is released.
+     * The content is undefined and shall be written by the caller.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the blob data otherwise nullptr.
+     */
+    uint8_t* allocate(size_t size);
+
+    /**
+     * Store the written binary configuration in the blob.
+     * A previous blob is released.
+     *
+     * @param[in] config    Binary configuration, which was successful written.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool store(const BinaryConfig& config);
+
+    /**
+     * Store a string incl. its termination in the blob.
+     * A previous blob is released.
+     *
+     * @param[in] str   String
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool storeString(const char* str);
+
+    /**
+     * Get the stored string.
+     *
+     * @return String or nullptr, if empty.
+     */
+    const char* getString() const
+    {
+        return reinterpret_cast<const char*>(m_data);
+    }
+
+    /**
+     * Release the blob.
+     */
+    void release();
+
+    /**
+     * Is the blob empty?
+     *
+     * @return If empty, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (nullptr == m_data);
+    }
+
+    /**
+     * Get the blob data.
+     *
+     * @return Blob data or nullptr, if empty.
+     */
+    uint8_t* getData()
+    {
+        return m_data;
+    }
+
+    /**
+     * Get the blob size.
+     *
+     * @return Size in byte
+     */
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+private:
+
+    uint8_t*    m_data; /**< Blob data */
+    size_t      m_size; /**< Blob size in byte */
+
+    StateBlob(const StateBlob& blob);
+    StateBlob& operator=(const StateBlob& blob);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __STATE_BLOB_H__ */
+
+/** @} */
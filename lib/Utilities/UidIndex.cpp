@@ -0,0 +1,164 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Unique id index
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "UidIndex.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool UidIndex::create(uint8_t capacity)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    if ((0U < capacity) &&
+        (INVALID_INDEX > capacity))
+    {
+        /* At most half filled keeps the probe sequences short. */
+        if (true == m_table.create(2U * capacity))
+        {
+            m_capacity      = capacity;
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void UidIndex::release()
+{
+    m_table.release();
+    m_capacity = 0U;
+
+    return;
+}
+
+void UidIndex::clear()
+{
+    m_table.clear();
+
+    return;
+}
+
+bool UidIndex::insert(uint16_t uid, uint8_t index)
+{
+    bool isSuccessful = false;
+
+    if (INVALID_INDEX != index)
+    {
+        Entry* entry = m_table.find(hash(uid), uid);
+
+        /* Replace the index of a existing unique id? */
+        if (nullptr != entry)
+        {
+            entry->index = index;
+            isSuccessful = true;
+        }
+        else if (m_capacity > m_table.getCount())
+        {
+            Entry newEntry;
+
+            newEntry.uid    = uid;
+            newEntry.index  = index;
+
+            isSuccessful = m_table.add(newEntry);
+        }
+        else
+        {
+            /* Full */
+            ;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void UidIndex::remove(uint16_t uid)
+{
+    (void)m_table.remove(hash(uid), uid);
+
+    return;
+}
+
+uint8_t UidIndex::find(uint16_t uid) const
+{
+    uint8_t         index = INVALID_INDEX;
+    const Entry*    entry = m_table.find(hash(uid), uid);
+
+    if (nullptr != entry)
+    {
+        index = entry->index;
+    }
+
+    return index;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
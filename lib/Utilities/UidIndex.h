@@ -0,0 +1,247 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Unique id index
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __UID_INDEX_H__
+#define __UID_INDEX_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <HashTable.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Maps 16-bit unique ids, e.g. plugin UIDs, to a index, e.g. a slot id.
+ *
+ * It is a hash table with open addressing and linear probing, which is
+ * at most half filled. Therefore insert, find and remove cost O(1) on
+ * average.
+ */
+class UidIndex
+{
+public:
+
+    /** Index, which is returned if a unique id is not found. */
+    static const uint8_t    INVALID_INDEX   = UINT8_MAX;
+
+    /**
+     * Constructs a empty index without capacity.
+     */
+    UidIndex() :
+        m_table(),
+        m_capacity(0U)
+    {
+    }
+
+    /**
+     * Destroys the index.
+     */
+    ~UidIndex()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the index for the given number of unique ids.
+     * A previous allocated index is released.
+     *
+     * @param[in] capacity  Max. number of unique ids
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint8_t capacity);
+
+    /**
+     * Release the index.
+     */
+    void release();
+
+    /**
+     * Remove all unique ids.
+     */
+    void clear();
+
+    /**
+     * Get the capacity, which is the max. number of unique ids.
+     *
+     * @return Capacity
+     */
+    uint8_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Get number of unique ids in the index.
+     *
+     * @return Number of unique ids
+     */
+    uint8_t getCount() const
+    {
+        return static_cast<uint8_t>(m_table.getCount());
+    }
+
+    /**
+     * Add a unique id with its index. If the unique id already exists,
+     * its index will be replaced.
+     *
+     * @param[in] uid   Unique id
+     * @param[in] index Index, which must not be INVALID_INDEX.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool insert(uint16_t uid, uint8_t index);
+
+    /**
+     * Remove a unique id.
+     *
+     * @param[in] uid   Unique id
+     */
+    void remove(uint16_t uid);
+
+    /**
+     * Find the index of a unique id.
+     *
+     * @param[in] uid   Unique id
+     *
+     * @return Index or INVALID_INDEX if not found.
+     */
+    uint8_t find(uint16_t uid) const;
+
+private:
+
+    /**
+     * Hash table entry.
+     */
+    struct Entry
+    {
+        uint16_t    uid;    /**< Unique id */
+        uint8_t     index;  /**< Index, INVALID_INDEX marks a empty entry. */
+
+        /**
+         * Initializes a empty entry.
+         */
+        Entry() :
+            uid(0U),
+            index(INVALID_INDEX)
+        {
+        }
+    };
+
+    /**
+     * Hash table entry traits.
+     */
+    struct EntryTraits
+    {
+        /**
+         * Is the entry empty?
+         *
+         * @param[in] entry Entry
+         *
+         * @return If empty, it will return true otherwise false.
+         */
+        static bool isEmpty(const Entry& entry)
+        {
+            return (INVALID_INDEX == entry.index);
+        }
+
+        /**
+         * Get the hash of the entry.
+         *
+         * @param[in] entry Entry
+         *
+         * @return Hash
+         */
+        static uint32_t getHash(const Entry& entry)
+        {
+            return hash(entry.uid);
+        }
+
+        /**
+         * Does the entry belong to the unique id?
+         *
+         * @param[in] entry Entry
+         * @param[in] uid   Unique id
+         *
+         * @return If it matches, it will return true otherwise false.
+         */
+        static bool isMatch(const Entry& entry, uint16_t uid)
+        {
+            return (uid == entry.uid);
+        }
+    };
+
+    HashTable<Entry, EntryTraits>   m_table;    /**< Hash table */
+    uint8_t                         m_capacity; /**< Max. number of unique ids */
+
+    /* Prevent copying */
+    UidIndex(const UidIndex& index);
+    UidIndex& operator=(const UidIndex& index);
+
+    /**
+     * Get the hash of a unique id. It uses fibonacci hashing, the upper half
+     * of the product depends on all bits of the unique id. Therefore
+     * consecutive ids are spread too.
+     *
+     * @param[in] uid   Unique id
+     *
+     * @return Hash
+     */
+    static uint32_t hash(uint16_t uid)
+    {
+        return static_cast<uint32_t>(static_cast<uint32_t>(uid) * 2654435769UL) >> 16U;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __UID_INDEX_H__ */
+
+/** @} */
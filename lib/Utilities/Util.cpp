@@ -211,6 +211,42 @@ extern uint32_t Util::hexToUInt32(const String& str)
     return value;
 }
 
+extern uint32_t Util::hashFnv1a(const void* data, size_t size, uint32_t hash)
+{
+    const uint32_t  FNV1A_PRIME = 16777619U;
+    const uint8_t*  bytes       = static_cast<const uint8_t*>(data);
+    size_t          idx         = 0U;
+
+    if (nullptr != bytes)
+    {
+        for(idx = 0U; idx < size; ++idx)
+        {
+            hash ^= bytes[idx];
+            hash *= FNV1A_PRIME;
+        }
+    }
+
+    return hash;
+}
+
+extern uint32_t Util::hashFnv1aStr(const char* str, uint32_t hash)
+{
+    const uint32_t  FNV1A_PRIME = 16777619U;
+    size_t          idx         = 0U;
+
+    if (nullptr != str)
+    {
+        while('\0' != str[idx])
+        {
+            hash ^= static_cast<uint8_t>(str[idx]);
+            hash *= FNV1A_PRIME;
+            ++idx;
+        }
+    }
+
+    return hash;
+}
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
\ No newline at end of file
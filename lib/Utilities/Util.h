@@ -43,6 +43,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
+#include <stddef.h>
 #include <stdint.h>
 #include <WString.h>
 #include <cerrno>
@@ -136,6 +137,33 @@ extern String uint32ToHex(uint32_t value);
  */
 extern uint32_t hexToUInt32(const String& str);
 
+/** Initial value (offset basis) of the 32-bit FNV-1a hash. */
+static const uint32_t HASH_FNV1A_INIT = 2166136261U;
+
+/**
+ * Calculate the 32-bit FNV-1a hash over a block of data.
+ * The hash over several blocks can be calculated by passing the hash of the
+ * previous block in.
+ *
+ * @param[in] data  Data
+ * @param[in] size  Data size in byte
+ * @param[in] hash  Hash of the previous data or the initial value.
+ *
+ * @return Hash
+ */
+extern uint32_t hashFnv1a(const void* data, size_t size, uint32_t hash = HASH_FNV1A_INIT);
+
+/**
+ * Calculate the 32-bit FNV-1a hash over a null terminated string.
+ * The terminating null character is not part of the hash.
+ *
+ * @param[in] str   String
+ * @param[in] hash  Hash of the previous data or the initial value.
+ *
+ * @return Hash
+ */
+extern uint32_t hashFnv1aStr(const char* str, uint32_t hash = HASH_FNV1A_INIT);
+
 }
 
 #endif  /* __UTILITY_H__ */
@@ -0,0 +1,218 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Weighted round robin
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WeightedRoundRobin.h"
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool WeightedRoundRobin::create(uint8_t count)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    /* The count is limited, because INVALID_INDEX marks no selection. */
+    if ((0U < count) &&
+        (INVALID_INDEX > count))
+    {
+        m_weights = new(std::nothrow) uint8_t[count];
+        m_credits = new(std::nothrow) int32_t[count];
+
+        if ((nullptr == m_weights) ||
+            (nullptr == m_credits))
+        {
+            release();
+        }
+        else
+        {
+            uint8_t index = 0U;
+
+            for(index = 0U; index < count; ++index)
+            {
+                m_weights[index] = 0U;
+                m_credits[index] = 0;
+            }
+
+            m_count         = count;
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void WeightedRoundRobin::release()
+{
+    if (nullptr != m_weights)
+    {
+        delete[] m_weights;
+        m_weights = nullptr;
+    }
+
+    if (nullptr != m_credits)
+    {
+        delete[] m_credits;
+        m_credits = nullptr;
+    }
+
+    m_count = 0U;
+
+    return;
+}
+
+void WeightedRoundRobin::setWeight(uint8_t index, uint8_t weight)
+{
+    if (m_count > index)
+    {
+        m_weights[index] = weight;
+
+        if (0U == weight)
+        {
+            m_credits[index] = 0;
+        }
+    }
+
+    return;
+}
+
+void WeightedRoundRobin::reset(uint8_t index)
+{
+    if (m_count > index)
+    {
+        m_credits[index] = 0;
+    }
+
+    return;
+}
+
+uint8_t WeightedRoundRobin::peek(uint8_t current) const
+{
+    uint8_t selected    = INVALID_INDEX;
+    int32_t maxCredit   = 0;
+    uint8_t index       = 0U;
+    uint8_t step        = 0U;
+
+    if (m_count <= current)
+    {
+        index = 0U;
+    }
+    else
+    {
+        index = (current + 1U) % m_count;
+    }
+
+    /* Start after the current index, so equal credits result in the index order. */
+    for(step = 0U; step < m_count; ++step)
+    {
+        if (0U < m_weights[index])
+        {
+            int32_t credit = m_credits[index] + m_weights[index];
+
+            if ((INVALID_INDEX == selected) ||
+                (maxCredit < credit))
+            {
+                selected    = index;
+                maxCredit   = credit;
+            }
+        }
+
+        ++index;
+        index %= m_count;
+    }
+
+    return selected;
+}
+
+void WeightedRoundRobin::commit(uint8_t index)
+{
+    if ((m_count > index) &&
+        (0U < m_weights[index]))
+    {
+        int32_t total   = 0;
+        uint8_t idx     = 0U;
+
+        for(idx = 0U; idx < m_count; ++idx)
+        {
+            if (0U < m_weights[idx])
+            {
+                m_credits[idx] += m_weights[idx];
+                total += m_weights[idx];
+            }
+        }
+
+        m_credits[index] -= total;
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,190 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Weighted round robin
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __WEIGHTED_ROUND_ROBIN_H__
+#define __WEIGHTED_ROUND_ROBIN_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Smooth weighted round robin over the indices [0; count), e.g. slot ids.
+ * A index with weight n is selected n times as often as a index with
+ * weight 1, but the selections are spread over the rotation instead of
+ * being consecutive. A index with weight 0 is skipped.
+ *
+ * With equal weights, it is a plain round robin in index order.
+ *
+ * The selection is separated in peek() and commit(), so the next index
+ * can be determined in advance without changing the rotation.
+ */
+class WeightedRoundRobin
+{
+public:
+
+    /** Index, which is returned if no index has a weight. */
+    static const uint8_t    INVALID_INDEX   = UINT8_MAX;
+
+    /**
+     * Constructs a empty rotation without indices.
+     */
+    WeightedRoundRobin() :
+        m_weights(nullptr),
+        m_credits(nullptr),
+        m_count(0U)
+    {
+    }
+
+    /**
+     * Destroys the rotation.
+     */
+    ~WeightedRoundRobin()
+    {
+        release();
+    }
+
+    /**
+     * Allocate the rotation for the given number of indices.
+     * All weights are 0 afterwards.
+     * A previous allocated rotation is released.
+     *
+     * @param[in] count Number of indices
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint8_t count);
+
+    /**
+     * Release the rotation.
+     */
+    void release();
+
+    /**
+     * Get the number of indices.
+     *
+     * @return Number of indices
+     */
+    uint8_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Set the weight of a index. A weight of 0 excludes it from the rotation
+     * and resets its credit, so it restarts fair if it takes part again.
+     *
+     * @param[in] index     Index [0; count)
+     * @param[in] weight    Weight
+     */
+    void setWeight(uint8_t index, uint8_t weight);
+
+    /**
+     * Get the weight of a index.
+     *
+     * @param[in] index Index [0; count)
+     *
+     * @return Weight
+     */
+    uint8_t getWeight(uint8_t index) const
+    {
+        uint8_t weight = 0U;
+
+        if (m_count > index)
+        {
+            weight = m_weights[index];
+        }
+
+        return weight;
+    }
+
+    /**
+     * Reset the credit of a index, e.g. if its content changed.
+     *
+     * @param[in] index Index [0; count)
+     */
+    void reset(uint8_t index);
+
+    /**
+     * Determine the next index, without changing the rotation.
+     * On equal credits, the index which follows the current one first wins.
+     *
+     * @param[in] current   Current index, may be INVALID_INDEX.
+     *
+     * @return Next index or INVALID_INDEX if no index has a weight.
+     */
+    uint8_t peek(uint8_t current) const;
+
+    /**
+     * Commit the selection of a index, which advances the rotation.
+     * It shall be called with the index determined by peek() with the
+     * same weights.
+     *
+     * @param[in] index Selected index [0; count)
+     */
+    void commit(uint8_t index);
+
+private:
+
+    uint8_t*    m_weights;  /**< Weight per index */
+    int32_t*    m_credits;  /**< Current credit per index */
+    uint8_t     m_count;    /**< Number of indices */
+
+    /* Prevent copying */
+    WeightedRoundRobin(const WeightedRoundRobin& rr);
+    WeightedRoundRobin& operator=(const WeightedRoundRobin& rr);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __WEIGHTED_ROUND_ROBIN_H__ */
+
+/** @} */
@@ -0,0 +1,235 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Effect widget base
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __EFFECT_WIDGET_HPP__
+#define __EFFECT_WIDGET_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Widget.hpp>
+#include <YAColor.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Base of the procedural effect widgets. An effect covers a rectangular
+ * region and is animated frame by frame, which makes it suitable as
+ * background of a widget group, e.g. behind a text widget.
+ *
+ * The animation is driven by a phase, which is advanced by the speed after
+ * every painted frame. The derived effect maps the phase to its animation.
+ */
+class EffectWidget : public Widget
+{
+public:
+
+    /** Default speed, the phase is advanced by it per frame. */
+    static const uint8_t    DEFAULT_SPEED       = 16U;
+
+    /** Default brightness */
+    static const uint8_t    DEFAULT_BRIGHTNESS  = 255U;
+
+    /**
+     * Destroys the effect widget.
+     */
+    virtual ~EffectWidget()
+    {
+    }
+
+    /**
+     * Assigns a effect widget.
+     *
+     * @param[in] widget    Effect widget, which to assign.
+     *
+     * @return Effect widget
+     */
+    EffectWidget& operator=(const EffectWidget& widget)
+    {
+        if (&widget != this)
+        {
+            Widget::operator=(widget);
+
+            m_width         = widget.m_width;
+            m_height        = widget.m_height;
+            m_speed         = widget.m_speed;
+            m_brightness    = widget.m_brightness;
+            m_phase         = widget.m_phase;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the widget size.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    void setSize(uint16_t width, uint16_t height)
+    {
+        m_width     = width;
+        m_height    = height;
+        invalidate();
+    }
+
+    /**
+     * Set the animation speed. A speed of 0 freezes the effect.
+     *
+     * @param[in] speed Phase increment per frame
+     */
+    void setSpeed(uint8_t speed)
+    {
+        m_speed = speed;
+    }
+
+    /**
+     * Set the brightness. Effects used as background are typically dimmed,
+     * so the text in front of them stays readable.
+     *
+     * @param[in] brightness Brightness [0; 255]
+     */
+    void setBrightness(uint8_t brightness)
+    {
+        m_brightness = brightness;
+        invalidate();
+    }
+
+    /**
+     * Is the widget dirty and needs to be repainted?
+     * A enabled effect is animated and needs to be repainted continuously.
+     *
+     * @return If the widget needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const override
+    {
+        return ((true == Widget::isDirty()) ||
+                (true == m_isEnabled));
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the widget.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a effect is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, m_width, m_height);
+
+        return true;
+    }
+
+protected:
+
+    uint16_t    m_width;        /**< Width in pixel */
+    uint16_t    m_height;       /**< Height in pixel */
+    uint8_t     m_speed;        /**< Phase increment per frame */
+    uint8_t     m_brightness;   /**< Brightness [0; 255] */
+    uint32_t    m_phase;        /**< Animation phase */
+
+    /**
+     * Constructs a effect widget.
+     *
+     * @param[in] type      Widget type name
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    EffectWidget(const char* type, uint16_t width, uint16_t height) :
+        Widget(type),
+        m_width(width),
+        m_height(height),
+        m_speed(DEFAULT_SPEED),
+        m_brightness(DEFAULT_BRIGHTNESS),
+        m_phase(0U)
+    {
+    }
+
+    /**
+     * Constructs a effect widget by copy.
+     *
+     * @param[in] widget    Effect widget, which to copy.
+     */
+    EffectWidget(const EffectWidget& widget) :
+        Widget(widget),
+        m_width(widget.m_width),
+        m_height(widget.m_height),
+        m_speed(widget.m_speed),
+        m_brightness(widget.m_brightness),
+        m_phase(widget.m_phase)
+    {
+    }
+
+    /**
+     * Paint the current frame of the effect.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    virtual void paintEffect(YAGfx& gfx) = 0;
+
+private:
+
+    /**
+     * Paint the widget with the given graphics interface and advance
+     * the animation.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paint(YAGfx& gfx) final
+    {
+        paintEffect(gfx);
+        m_phase += m_speed;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __EFFECT_WIDGET_HPP__ */
+
+/** @} */
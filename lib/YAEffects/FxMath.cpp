@@ -0,0 +1,157 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Fixed-point math for procedural effects
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "FxMath.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Number of quarter wave table segments. */
+static const uint8_t    QUARTER_SEGMENTS    = 64U;
+
+/**
+ * Quarter sine wave round(127 * sin(pi / 2 * i / 64)), i = [0; 64].
+ */
+static const uint8_t    SIN8_QUARTER[QUARTER_SEGMENTS + 1U] =
+{
+      0,   3,   6,   9,  12,  16,  19,  22,
+     25,  28,  31,  34,  37,  40,  43,  46,
+     49,  51,  54,  57,  60,  63,  65,  68,
+     71,  73,  76,  78,  81,  83,  85,  88,
+     90,  92,  94,  96,  98, 100, 102, 104,
+    106, 107, 109, 111, 112, 113, 115, 116,
+    117, 118, 120, 121, 122, 122, 123, 124,
+    125, 125, 126, 126, 126, 127, 127, 127,
+    127
+};
+
+/**
+ * Quarter sine wave round(32767 * sin(pi / 2 * i / 64)), i = [0; 64].
+ */
+static const int16_t    SIN16_QUARTER[QUARTER_SEGMENTS + 1U] =
+{
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+extern uint8_t FxMath::sin8(uint8_t theta)
+{
+    uint8_t quadrant    = theta >> 6U;
+    uint8_t pos         = theta & (QUARTER_SEGMENTS - 1U);
+    uint8_t value       = 0U;
+
+    /* The 2nd and 4th quadrant run the quarter wave backwards. */
+    if (0U != (quadrant & 1U))
+    {
+        pos = QUARTER_SEGMENTS - pos;
+    }
+
+    value = SIN8_QUARTER[pos];
+
+    /* The 3rd and 4th quadrant are negative. */
+    return (2U > quadrant) ? (128U + value) : (128U - value);
+}
+
+extern int16_t FxMath::sin16(uint16_t theta)
+{
+    const uint16_t  QUARTER     = 16384U;
+    uint8_t         quadrant    = theta >> 14U;
+    uint16_t        pos         = theta & (QUARTER - 1U);
+    uint8_t         idx         = 0U;
+    uint8_t         frac        = 0U;
+    int32_t         value       = 0;
+
+    /* The 2nd and 4th quadrant run the quarter wave backwards. */
+    if (0U != (quadrant & 1U))
+    {
+        pos = QUARTER - pos;
+    }
+
+    /* Each table segment covers 256 angle steps. */
+    idx     = pos >> 8U;
+    frac    = pos & 0xFFU;
+    value   = SIN16_QUARTER[idx];
+
+    if (QUARTER_SEGMENTS > idx)
+    {
+        value += ((SIN16_QUARTER[idx + 1U] - value) * frac) >> 8;
+    }
+
+    /* The 3rd and 4th quadrant are negative. */
+    return static_cast<int16_t>((2U > quadrant) ? value : -value);
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,160 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Fixed-point math for procedural effects
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __FX_MATH_H__
+#define __FX_MATH_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Integer only math, used by the procedural effects. Angles are given in
+ * binary units, which means a full circle is 256 for the 8-bit and 65536
+ * for the 16-bit variants. The sine values are derived from a quarter wave
+ * lookup table, no floating point operation is involved.
+ */
+namespace FxMath
+{
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Calculate the sine of an 8-bit angle.
+ *
+ * @param[in] theta Angle [0; 255], which corresponds to [0; 2 pi).
+ *
+ * @return Sine, scaled to [1; 255] with 128 as zero crossing.
+ */
+extern uint8_t sin8(uint8_t theta);
+
+/**
+ * Calculate the cosine of an 8-bit angle.
+ *
+ * @param[in] theta Angle [0; 255], which corresponds to [0; 2 pi).
+ *
+ * @return Cosine, scaled to [1; 255] with 128 as zero crossing.
+ */
+inline uint8_t cos8(uint8_t theta)
+{
+    return sin8(theta + 64U);
+}
+
+/**
+ * Calculate the sine of a 16-bit angle. Between the entries of the lookup
+ * table the value is linear interpolated.
+ *
+ * @param[in] theta Angle [0; 65535], which corresponds to [0; 2 pi).
+ *
+ * @return Sine in Q15 format [-32767; 32767]
+ */
+extern int16_t sin16(uint16_t theta);
+
+/**
+ * Calculate the cosine of a 16-bit angle.
+ *
+ * @param[in] theta Angle [0; 65535], which corresponds to [0; 2 pi).
+ *
+ * @return Cosine in Q15 format [-32767; 32767]
+ */
+inline int16_t cos16(uint16_t theta)
+{
+    return sin16(theta + 16384U);
+}
+
+/**
+ * Scale a value by a factor, which is interpreted as fraction of 256.
+ *
+ * @param[in] value Value
+ * @param[in] scale Scale factor [0; 255] which corresponds to [0; 1).
+ *
+ * @return Scaled value
+ */
+inline uint8_t scale8(uint8_t value, uint8_t scale)
+{
+    return static_cast<uint8_t>((static_cast<uint16_t>(value) * scale) >> 8U);
+}
+
+/**
+ * Linear interpolation between two values.
+ *
+ * @param[in] a     Value at fraction 0
+ * @param[in] b     Value at fraction 256
+ * @param[in] frac  Fraction [0; 255]
+ *
+ * @return Interpolated value
+ */
+inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t frac)
+{
+    int16_t delta = static_cast<int16_t>(b) - static_cast<int16_t>(a);
+
+    return static_cast<uint8_t>(a + ((delta * static_cast<int16_t>(frac)) >> 8));
+}
+
+/**
+ * Ease a fraction with the smoothstep curve 3t^2 - 2t^3. It is used to avoid
+ * visible edges at the lattice points of the value noise.
+ *
+ * @param[in] t Fraction [0; 255]
+ *
+ * @return Eased fraction [0; 255]
+ */
+inline uint8_t ease8(uint8_t t)
+{
+    uint32_t t2 = (static_cast<uint32_t>(t) * t) >> 8U;
+
+    return static_cast<uint8_t>((t2 * (768U - 2U * t)) >> 8U);
+}
+
+}
+
+#endif  /* __FX_MATH_H__ */
+
+/** @} */
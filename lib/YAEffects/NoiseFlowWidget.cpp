@@ -0,0 +1,107 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Noise flow effect widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "NoiseFlowWidget.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize noise flow widget type. */
+const char* NoiseFlowWidget::WIDGET_TYPE = "noiseFlow";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void NoiseFlowWidget::paintEffect(YAGfx& gfx)
+{
+    uint32_t    z       = m_phase;          /* Time axis */
+    uint32_t    drift   = m_phase >> 1U;    /* Horizontal drift */
+    uint8_t     hueBase = static_cast<uint8_t>(m_phase >> 6U);
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+    Color       color;
+
+    color.setIntensity(m_brightness);
+
+    for(y = 0U; y < m_height; ++y)
+    {
+        uint32_t ny = static_cast<uint32_t>(y) * m_scale;
+
+        for(x = 0U; x < m_width; ++x)
+        {
+            uint32_t    nx      = static_cast<uint32_t>(x) * m_scale + drift;
+            uint8_t     value   = m_noise.noise3(nx, ny, z);
+
+            /* The noise values cluster around the middle, doubling spreads
+             * them over the whole color wheel, which wraps around seamless.
+             */
+            color.turnColorWheel(static_cast<uint8_t>(value << 1U) + hueBase);
+            gfx.drawPixel(m_posX + x, m_posY + y, color);
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,170 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Noise flow effect widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __NOISE_FLOW_WIDGET_H__
+#define __NOISE_FLOW_WIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "EffectWidget.hpp"
+#include "ValueNoise.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Noise flow effect, which slices a three dimensional value noise field
+ * along the time axis and drifts it horizontally. The noise value is
+ * mapped to the color wheel.
+ */
+class NoiseFlowWidget : public EffectWidget
+{
+public:
+
+    /**
+     * Default scale, which is the noise coordinate step per pixel in
+     * 8.8 fixed-point format. A step of 32 results in features of
+     * about 8 pixel.
+     */
+    static const uint8_t    DEFAULT_SCALE   = 32U;
+
+    /**
+     * Constructs a noise flow widget.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    NoiseFlowWidget(uint16_t width = 0U, uint16_t height = 0U) :
+        EffectWidget(WIDGET_TYPE, width, height),
+        m_scale(DEFAULT_SCALE),
+        m_noise()
+    {
+    }
+
+    /**
+     * Constructs a noise flow widget by copy.
+     *
+     * @param[in] widget    Noise flow widget, which to copy.
+     */
+    NoiseFlowWidget(const NoiseFlowWidget& widget) :
+        EffectWidget(widget),
+        m_scale(widget.m_scale),
+        m_noise(widget.m_noise)
+    {
+    }
+
+    /**
+     * Destroys the noise flow widget.
+     */
+    ~NoiseFlowWidget()
+    {
+    }
+
+    /**
+     * Assigns a noise flow widget.
+     *
+     * @param[in] widget    Noise flow widget, which to assign.
+     *
+     * @return Noise flow widget
+     */
+    NoiseFlowWidget& operator=(const NoiseFlowWidget& widget)
+    {
+        if (&widget != this)
+        {
+            EffectWidget::operator=(widget);
+
+            m_scale = widget.m_scale;
+            m_noise = widget.m_noise;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the scale, which is the noise coordinate step per pixel.
+     *
+     * @param[in] scale Noise coordinate step per pixel in 8.8 fixed-point format
+     */
+    void setScale(uint8_t scale)
+    {
+        m_scale = scale;
+        invalidate();
+    }
+
+    /**
+     * Set the seed, which selects the noise field.
+     *
+     * @param[in] seed  Seed
+     */
+    void setSeed(uint32_t seed)
+    {
+        m_noise.setSeed(seed);
+        invalidate();
+    }
+
+    /** Widget type string */
+    static const char*  WIDGET_TYPE;
+
+private:
+
+    uint8_t     m_scale;    /**< Noise coordinate step per pixel */
+    ValueNoise  m_noise;    /**< Noise field */
+
+    /**
+     * Paint the current frame of the effect.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paintEffect(YAGfx& gfx) override;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __NOISE_FLOW_WIDGET_H__ */
+
+/** @} */
@@ -0,0 +1,113 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Plasma effect widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PlasmaWidget.h"
+#include "FxMath.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize plasma widget type. */
+const char* PlasmaWidget::WIDGET_TYPE = "plasma";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void PlasmaWidget::paintEffect(YAGfx& gfx)
+{
+    uint8_t     t1      = static_cast<uint8_t>(m_phase >> 4U);
+    uint8_t     t2      = static_cast<uint8_t>(m_phase >> 5U);
+    uint8_t     hueBase = static_cast<uint8_t>(m_phase >> 6U);
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+    Color       color;
+
+    color.setIntensity(m_brightness);
+
+    for(y = 0U; y < m_height; ++y)
+    {
+        /* The row waves don't depend on x, therefore they are calculated once per row. */
+        uint8_t rowPos  = static_cast<uint8_t>(y * m_scale);
+        uint8_t rowWave = FxMath::sin8(rowPos - t2);
+        uint8_t rowWarp = FxMath::sin8(rowPos + t1);
+
+        for(x = 0U; x < m_width; ++x)
+        {
+            uint8_t     colPos  = static_cast<uint8_t>(x * m_scale);
+            uint16_t    sum     = 0U;
+
+            sum += FxMath::sin8(colPos + t1);
+            sum += rowWave;
+            sum += FxMath::sin8(static_cast<uint8_t>((x + y) * m_scale / 2U) + t2);
+            sum += FxMath::sin8(colPos / 2U + rowWarp);
+
+            color.turnColorWheel(static_cast<uint8_t>(sum >> 2U) + hueBase);
+            gfx.drawPixel(m_posX + x, m_posY + y, color);
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
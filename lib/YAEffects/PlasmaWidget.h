@@ -0,0 +1,150 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Plasma effect widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __PLASMA_WIDGET_H__
+#define __PLASMA_WIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "EffectWidget.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Plasma effect, which overlays several sine waves and maps their sum
+ * to the color wheel. The sine waves are taken from a lookup table.
+ */
+class PlasmaWidget : public EffectWidget
+{
+public:
+
+    /** Default scale, which is the angle step per pixel. */
+    static const uint8_t    DEFAULT_SCALE   = 16U;
+
+    /**
+     * Constructs a plasma widget.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    PlasmaWidget(uint16_t width = 0U, uint16_t height = 0U) :
+        EffectWidget(WIDGET_TYPE, width, height),
+        m_scale(DEFAULT_SCALE)
+    {
+    }
+
+    /**
+     * Constructs a plasma widget by copy.
+     *
+     * @param[in] widget    Plasma widget, which to copy.
+     */
+    PlasmaWidget(const PlasmaWidget& widget) :
+        EffectWidget(widget),
+        m_scale(widget.m_scale)
+    {
+    }
+
+    /**
+     * Destroys the plasma widget.
+     */
+    ~PlasmaWidget()
+    {
+    }
+
+    /**
+     * Assigns a plasma widget.
+     *
+     * @param[in] widget    Plasma widget, which to assign.
+     *
+     * @return Plasma widget
+     */
+    PlasmaWidget& operator=(const PlasmaWidget& widget)
+    {
+        if (&widget != this)
+        {
+            EffectWidget::operator=(widget);
+
+            m_scale = widget.m_scale;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the scale, which is the angle step per pixel. A full sine wave
+     * spans 256 / scale pixel.
+     *
+     * @param[in] scale Angle step per pixel
+     */
+    void setScale(uint8_t scale)
+    {
+        m_scale = scale;
+        invalidate();
+    }
+
+    /** Widget type string */
+    static const char*  WIDGET_TYPE;
+
+private:
+
+    uint8_t m_scale;    /**< Angle step per pixel */
+
+    /**
+     * Paint the current frame of the effect.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paintEffect(YAGfx& gfx) override;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __PLASMA_WIDGET_H__ */
+
+/** @} */
@@ -0,0 +1,155 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Starfield effect widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "StarfieldWidget.h"
+#include "FxMath.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize starfield widget type. */
+const char* StarfieldWidget::WIDGET_TYPE = "starfield";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void StarfieldWidget::spawn(Star& star, bool isFar)
+{
+    /* At max. depth the space of [-4 * width; 4 * width) is projected
+     * to about the widget width. Same for the height.
+     */
+    int32_t spanX = 8 * static_cast<int32_t>(m_width);
+    int32_t spanY = 8 * static_cast<int32_t>(m_height);
+
+    star.x = static_cast<int16_t>(static_cast<int32_t>(m_rng.nextRange(spanX)) - spanX / 2);
+    star.y = static_cast<int16_t>(static_cast<int32_t>(m_rng.nextRange(spanY)) - spanY / 2);
+
+    if (true == isFar)
+    {
+        star.z = static_cast<uint16_t>(MAX_DEPTH) << 8U;
+    }
+    else
+    {
+        star.z = static_cast<uint16_t>(m_rng.nextRange(1U, MAX_DEPTH + 1U)) << 8U;
+    }
+}
+
+void StarfieldWidget::paintEffect(YAGfx& gfx)
+{
+    int16_t     centerX = m_width / 2U;
+    int16_t     centerY = m_height / 2U;
+    uint16_t    step    = static_cast<uint16_t>(m_speed) << 4U;
+    uint8_t     idx     = 0U;
+    Color       color   = m_color;
+
+    gfx.fillRect(m_posX, m_posY, m_width, m_height, ColorDef::BLACK);
+
+    for(idx = 0U; idx < m_starCount; ++idx)
+    {
+        Star&   star    = m_stars[idx];
+        int32_t depth   = 0;
+        int16_t x       = 0;
+        int16_t y       = 0;
+
+        if (0U == star.z)
+        {
+            spawn(star, false);
+        }
+        else if (step >= star.z)
+        {
+            spawn(star, true);
+        }
+        else
+        {
+            star.z -= step;
+        }
+
+        /* A depth below one pixel is rounded up, which avoids the division by zero. */
+        depth = star.z >> 8U;
+
+        if (0 == depth)
+        {
+            depth = 1;
+        }
+
+        x = centerX + static_cast<int16_t>((star.x * FOCAL) / depth);
+        y = centerY + static_cast<int16_t>((star.y * FOCAL) / depth);
+
+        if ((0 > x) || (m_width <= x) ||
+            (0 > y) || (m_height <= y))
+        {
+            /* Star left the area, it will reappear in the distance. */
+            spawn(star, true);
+        }
+        else
+        {
+            color.setIntensity(FxMath::scale8(MAX_DEPTH - depth, m_brightness));
+            gfx.drawPixel(m_posX + x, m_posY + y, color);
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,264 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Starfield effect widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __STARFIELD_WIDGET_H__
+#define __STARFIELD_WIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <ColorDef.hpp>
+#include "EffectWidget.hpp"
+#include "XorShift.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Starfield effect, which lets the stars fly towards the viewer.
+ * Every star has a position in space, which is projected to the widget
+ * area by an integer division through its depth. The closer a star is, the
+ * brighter it is. Stars, which leave the area or pass the viewer, are
+ * spawned again in the distance.
+ */
+class StarfieldWidget : public EffectWidget
+{
+public:
+
+    /** Max. number of stars */
+    static const uint8_t    MAX_STARS       = 64U;
+
+    /** Default number of stars */
+    static const uint8_t    DEFAULT_STARS   = 32U;
+
+    /** Default star color */
+    static const uint32_t   DEFAULT_COLOR   = ColorDef::WHITE;
+
+    /**
+     * Constructs a starfield widget.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    StarfieldWidget(uint16_t width = 0U, uint16_t height = 0U) :
+        EffectWidget(WIDGET_TYPE, width, height),
+        m_rng(),
+        m_stars(),
+        m_starCount(DEFAULT_STARS),
+        m_color(DEFAULT_COLOR)
+    {
+        clearStars();
+    }
+
+    /**
+     * Constructs a starfield widget by copy.
+     *
+     * @param[in] widget    Starfield widget, which to copy.
+     */
+    StarfieldWidget(const StarfieldWidget& widget) :
+        EffectWidget(widget),
+        m_rng(widget.m_rng),
+        m_stars(),
+        m_starCount(widget.m_starCount),
+        m_color(widget.m_color)
+    {
+        copyStars(widget);
+    }
+
+    /**
+     * Destroys the starfield widget.
+     */
+    ~StarfieldWidget()
+    {
+    }
+
+    /**
+     * Assigns a starfield widget.
+     *
+     * @param[in] widget    Starfield widget, which to assign.
+     *
+     * @return Starfield widget
+     */
+    StarfieldWidget& operator=(const StarfieldWidget& widget)
+    {
+        if (&widget != this)
+        {
+            EffectWidget::operator=(widget);
+
+            m_rng       = widget.m_rng;
+            m_starCount = widget.m_starCount;
+            m_color     = widget.m_color;
+            copyStars(widget);
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the number of stars.
+     *
+     * @param[in] count Number of stars, limited to MAX_STARS.
+     */
+    void setStarCount(uint8_t count)
+    {
+        m_starCount = (MAX_STARS < count) ? MAX_STARS : count;
+        clearStars();
+        invalidate();
+    }
+
+    /**
+     * Get the number of stars.
+     *
+     * @return Number of stars
+     */
+    uint8_t getStarCount() const
+    {
+        return m_starCount;
+    }
+
+    /**
+     * Set the star color.
+     *
+     * @param[in] color Star color
+     */
+    void setColor(const Color& color)
+    {
+        m_color = color;
+        invalidate();
+    }
+
+    /**
+     * Seed the random number generator, which places the stars.
+     *
+     * @param[in] seed  Seed
+     */
+    void setSeed(uint32_t seed)
+    {
+        m_rng.seed(seed);
+        clearStars();
+        invalidate();
+    }
+
+    /** Widget type string */
+    static const char*  WIDGET_TYPE;
+
+private:
+
+    /**
+     * A single star in space. The x- and y-coordinate are centered around
+     * the view axis. The depth is in 8.8 fixed-point format, a depth of
+     * zero marks a star, which must be spawned.
+     */
+    struct Star
+    {
+        int16_t     x;  /**< x-coordinate in space */
+        int16_t     y;  /**< y-coordinate in space */
+        uint16_t    z;  /**< Depth in 8.8 fixed-point format */
+    };
+
+    /** Max. depth (integer part), where the stars are spawned. */
+    static const uint8_t    MAX_DEPTH   = 255U;
+
+    /** Focal length of the projection. */
+    static const int32_t    FOCAL       = 32;
+
+    XorShift32  m_rng;                  /**< Random number generator to place the stars */
+    Star        m_stars[MAX_STARS];     /**< Stars */
+    uint8_t     m_starCount;            /**< Number of used stars */
+    Color       m_color;                /**< Star color */
+
+    /**
+     * Mark all stars to be spawned on the next frame.
+     */
+    void clearStars()
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < MAX_STARS; ++idx)
+        {
+            m_stars[idx].x = 0;
+            m_stars[idx].y = 0;
+            m_stars[idx].z = 0U;
+        }
+    }
+
+    /**
+     * Copy the stars of another starfield.
+     *
+     * @param[in] widget    Starfield widget, which stars to copy.
+     */
+    void copyStars(const StarfieldWidget& widget)
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < MAX_STARS; ++idx)
+        {
+            m_stars[idx] = widget.m_stars[idx];
+        }
+    }
+
+    /**
+     * Spawn a star at a random position.
+     *
+     * @param[out]  star    Star
+     * @param[in]   isFar   If true, it will be spawned at max. depth, otherwise at a random depth.
+     */
+    void spawn(Star& star, bool isFar);
+
+    /**
+     * Paint the current frame of the effect.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paintEffect(YAGfx& gfx) override;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __STARFIELD_WIDGET_H__ */
+
+/** @} */
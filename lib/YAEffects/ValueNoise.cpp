@@ -0,0 +1,125 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Value noise
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ValueNoise.h"
+#include "FxMath.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+uint8_t ValueNoise::noise2(uint32_t x, uint32_t y) const
+{
+    uint32_t    ix  = x >> 8U;
+    uint32_t    iy  = y >> 8U;
+    uint8_t     fx  = FxMath::ease8(x & 0xFFU);
+    uint8_t     fy  = FxMath::ease8(y & 0xFFU);
+    uint8_t     v0  = FxMath::lerp8(lattice(ix, iy, 0U), lattice(ix + 1U, iy, 0U), fx);
+    uint8_t     v1  = FxMath::lerp8(lattice(ix, iy + 1U, 0U), lattice(ix + 1U, iy + 1U, 0U), fx);
+
+    return FxMath::lerp8(v0, v1, fy);
+}
+
+uint8_t ValueNoise::noise3(uint32_t x, uint32_t y, uint32_t z) const
+{
+    uint32_t    ix  = x >> 8U;
+    uint32_t    iy  = y >> 8U;
+    uint32_t    iz  = z >> 8U;
+    uint8_t     fx  = FxMath::ease8(x & 0xFFU);
+    uint8_t     fy  = FxMath::ease8(y & 0xFFU);
+    uint8_t     fz  = FxMath::ease8(z & 0xFFU);
+    uint8_t     v00 = FxMath::lerp8(lattice(ix, iy, iz), lattice(ix + 1U, iy, iz), fx);
+    uint8_t     v10 = FxMath::lerp8(lattice(ix, iy + 1U, iz), lattice(ix + 1U, iy + 1U, iz), fx);
+    uint8_t     v01 = FxMath::lerp8(lattice(ix, iy, iz + 1U), lattice(ix + 1U, iy, iz + 1U), fx);
+    uint8_t     v11 = FxMath::lerp8(lattice(ix, iy + 1U, iz + 1U), lattice(ix + 1U, iy + 1U, iz + 1U), fx);
+    uint8_t     v0  = FxMath::lerp8(v00, v10, fy);
+    uint8_t     v1  = FxMath::lerp8(v01, v11, fy);
+
+    return FxMath::lerp8(v0, v1, fz);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+uint8_t ValueNoise::lattice(uint32_t ix, uint32_t iy, uint32_t iz) const
+{
+    /* Each axis is multiplied with a different large odd constant, the
+     * result is mixed to spread every input bit over the upper byte.
+     */
+    uint32_t hash = m_seed;
+
+    hash ^= ix * 0x27D4EB2DUL;
+    hash ^= iy * 0x165667B1UL;
+    hash ^= iz * 0x9E3779B1UL;
+    hash ^= hash >> 15U;
+    hash *= 0x2C1B3C6DUL;
+    hash ^= hash >> 12U;
+    hash *= 0x297A2D39UL;
+    hash ^= hash >> 15U;
+
+    return static_cast<uint8_t>(hash >> 24U);
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,170 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Value noise
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __VALUE_NOISE_H__
+#define __VALUE_NOISE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Integer value noise in two and three dimensions.
+ *
+ * Every integer lattice point gets a pseudo random value by hashing its
+ * coordinates. Between the lattice points the values are interpolated with
+ * an eased fraction, which results in a smooth noise field.
+ *
+ * Coordinates are fixed-point numbers with 8 fractional bits, e.g. 0x180
+ * is the position 1.5. Moving one pixel with a step of 32 along an axis
+ * results in a feature size of 8 pixel.
+ */
+class ValueNoise
+{
+public:
+
+    /**
+     * Constructs the noise generator.
+     *
+     * @param[in] seed  Seed, which selects the noise field.
+     */
+    ValueNoise(uint32_t seed = 0U) :
+        m_seed(seed)
+    {
+    }
+
+    /**
+     * Constructs the noise generator by copy.
+     *
+     * @param[in] noise Noise generator, which to copy.
+     */
+    ValueNoise(const ValueNoise& noise) :
+        m_seed(noise.m_seed)
+    {
+    }
+
+    /**
+     * Destroys the noise generator.
+     */
+    ~ValueNoise()
+    {
+    }
+
+    /**
+     * Assigns a noise generator.
+     *
+     * @param[in] noise Noise generator, which to assign.
+     *
+     * @return Noise generator
+     */
+    ValueNoise& operator=(const ValueNoise& noise)
+    {
+        if (&noise != this)
+        {
+            m_seed = noise.m_seed;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the seed, which selects the noise field.
+     *
+     * @param[in] seed  Seed
+     */
+    void setSeed(uint32_t seed)
+    {
+        m_seed = seed;
+    }
+
+    /**
+     * Get the two dimensional noise value at the given position.
+     *
+     * @param[in] x x-coordinate in 24.8 fixed-point format
+     * @param[in] y y-coordinate in 24.8 fixed-point format
+     *
+     * @return Noise value [0; 255]
+     */
+    uint8_t noise2(uint32_t x, uint32_t y) const;
+
+    /**
+     * Get the three dimensional noise value at the given position.
+     * The third dimension is typically the time, which lets the two
+     * dimensional field flow smoothly.
+     *
+     * @param[in] x x-coordinate in 24.8 fixed-point format
+     * @param[in] y y-coordinate in 24.8 fixed-point format
+     * @param[in] z z-coordinate in 24.8 fixed-point format
+     *
+     * @return Noise value [0; 255]
+     */
+    uint8_t noise3(uint32_t x, uint32_t y, uint32_t z) const;
+
+private:
+
+    uint32_t    m_seed; /**< Seed, which selects the noise field. */
+
+    /**
+     * Get the pseudo random value of a lattice point.
+     *
+     * @param[in] ix    Integer x-coordinate
+     * @param[in] iy    Integer y-coordinate
+     * @param[in] iz    Integer z-coordinate
+     *
+     * @return Lattice value [0; 255]
+     */
+    uint8_t lattice(uint32_t ix, uint32_t iy, uint32_t iz) const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __VALUE_NOISE_H__ */
+
+/** @} */
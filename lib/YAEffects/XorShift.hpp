@@ -0,0 +1,194 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Xorshift pseudo random number generator
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __XOR_SHIFT_HPP__
+#define __XOR_SHIFT_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Marsaglia's 32-bit xorshift pseudo random number generator.
+ * It needs only three shifts and xors per number, which makes it cheap
+ * enough to be used per pixel and frame. It is not suitable for
+ * cryptographic purposes.
+ */
+class XorShift32
+{
+public:
+
+    /** Default seed, used if no other seed is given. */
+    static const uint32_t   DEFAULT_SEED    = 2463534242UL;
+
+    /**
+     * Constructs the generator.
+     *
+     * @param[in] seed  Seed, zero is replaced by the default seed.
+     */
+    XorShift32(uint32_t seed = DEFAULT_SEED) :
+        m_state((0U == seed) ? DEFAULT_SEED : seed)
+    {
+    }
+
+    /**
+     * Constructs the generator by copy.
+     *
+     * @param[in] rng   Generator, which to copy.
+     */
+    XorShift32(const XorShift32& rng) :
+        m_state(rng.m_state)
+    {
+    }
+
+    /**
+     * Destroys the generator.
+     */
+    ~XorShift32()
+    {
+    }
+
+    /**
+     * Assigns a generator.
+     *
+     * @param[in] rng   Generator, which to assign.
+     *
+     * @return Generator
+     */
+    XorShift32& operator=(const XorShift32& rng)
+    {
+        if (&rng != this)
+        {
+            m_state = rng.m_state;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Seed the generator. The state must never be zero, therefore zero is
+     * replaced by the default seed.
+     *
+     * @param[in] seed  Seed
+     */
+    void seed(uint32_t seed)
+    {
+        m_state = (0U == seed) ? DEFAULT_SEED : seed;
+    }
+
+    /**
+     * Get the next 32-bit random number.
+     *
+     * @return Random number [1; 2^32 - 1]
+     */
+    uint32_t next()
+    {
+        m_state ^= m_state << 13U;
+        m_state ^= m_state >> 17U;
+        m_state ^= m_state << 5U;
+
+        return m_state;
+    }
+
+    /**
+     * Get the next 8-bit random number.
+     * The upper bits are used, because they have the better quality.
+     *
+     * @return Random number [0; 255]
+     */
+    uint8_t next8()
+    {
+        return static_cast<uint8_t>(next() >> 24U);
+    }
+
+    /**
+     * Get the next random number in the range [0; range).
+     * It uses a multiply and shift instead of a modulo division.
+     *
+     * @param[in] range Upper limit, which is excluded.
+     *
+     * @return Random number [0; range)
+     */
+    uint16_t nextRange(uint16_t range)
+    {
+        return static_cast<uint16_t>(((next() >> 16U) * range) >> 16U);
+    }
+
+    /**
+     * Get the next random number in the range [min; max).
+     *
+     * @param[in] min   Lower limit, which is included.
+     * @param[in] max   Upper limit, which is excluded.
+     *
+     * @return Random number [min; max), if max is not greater than min, it will return min.
+     */
+    uint16_t nextRange(uint16_t min, uint16_t max)
+    {
+        uint16_t value = min;
+
+        if (max > min)
+        {
+            value += nextRange(max - min);
+        }
+
+        return value;
+    }
+
+private:
+
+    uint32_t    m_state;    /**< Generator state, never zero. */
+
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __XOR_SHIFT_HPP__ */
+
+/** @} */
@@ -71,6 +71,9 @@ using YAGfxDynamicBitmap = BaseGfxDynamicBitmap<Color>;
 /** GFX overlay bitmap with concrete color. */
 using YAGfxOverlayBitmap = BaseGfxOverlayBitmap<Color>;
 
+/** GFX read-only bitmap with concrete color, which maps a packed image. */
+using YAGfxMappedBitmap = BaseGfxMappedBitmap<Color>;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
@@ -36,7 +36,6 @@
 
 #include <YAColor.h>
 #include <Logging.h>
-#include <BmpImgLoader.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -72,9 +71,9 @@ BitmapWidget& BitmapWidget::operator=(const BitmapWidget& widget)
         Widget::operator=(widget);
         
         m_bitmap        = widget.m_bitmap;
+        m_sharedBitmap  = widget.m_sharedBitmap;
+        m_mappedBitmap  = widget.m_mappedBitmap;
         m_spriteSheet   = widget.m_spriteSheet;
-        m_timer         = widget.m_timer;
-        m_duration      = widget.m_duration;
     }
 
     return *this;
@@ -90,24 +89,23 @@ bool BitmapWidget::load(FS& fs, const String& filename)
     }
     else
     {
-        BmpImgLoader        loader;
-        BmpImgLoader::Ret   ret = loader.load(fs, filename, m_bitmap);
+        ImageCache::Ret ret = ImageCache::getInstance().load(fs, filename, m_sharedBitmap);
 
-        if (BmpImgLoader::RET_OK != ret)
+        if (ImageCache::RET_OK != ret)
         {
-            if (BmpImgLoader::RET_FILE_NOT_FOUND == ret)
+            if (ImageCache::RET_FILE_NOT_FOUND == ret)
             {
                 LOG_ERROR("Failed to open file %s.", filename.c_str());
             }
-            else if (BmpImgLoader::RET_FILE_FORMAT_INVALID == ret)
+            else if (ImageCache::RET_FILE_FORMAT_INVALID == ret)
             {
                 LOG_ERROR("File %s has invalid format.", filename.c_str());
             }
-            else if (BmpImgLoader::RET_FILE_FORMAT_UNSUPPORTED == ret)
+            else if (ImageCache::RET_FILE_FORMAT_UNSUPPORTED == ret)
             {
                 LOG_ERROR("File %s has unsupported format.", filename.c_str());
             }
-            else if (BmpImgLoader::RET_IMG_TOO_BIG == ret)
+            else if (ImageCache::RET_IMG_TOO_BIG == ret)
             {
                 LOG_ERROR("File %s is too big.", filename.c_str());
             }
@@ -121,8 +119,10 @@ bool BitmapWidget::load(FS& fs, const String& filename)
             /* Avoid wasting memory. Additional this is important to detect whether the sprite sheet
              * shall be shown or the single bitmap image.
              */
+            m_bitmap.release();
+            m_mappedBitmap.unmap();
             m_spriteSheet.release();
-            m_timer.stop();
+            invalidate();
 
             isSuccessful = true;
         }
@@ -131,6 +131,26 @@ bool BitmapWidget::load(FS& fs, const String& filename)
     return isSuccessful;
 }
 
+bool BitmapWidget::map(const uint8_t* data, size_t size)
+{
+    bool isSuccessful = m_mappedBitmap.map(data, size);
+
+    if (false == isSuccessful)
+    {
+        LOG_ERROR("Packed image can't be mapped.");
+    }
+    else
+    {
+        /* The mapped image is shown, the others are not needed anymore. */
+        m_bitmap.release();
+        m_sharedBitmap.release();
+        m_spriteSheet.release();
+        invalidate();
+    }
+
+    return isSuccessful;
+}
+
 bool BitmapWidget::loadSpriteSheet(FS& fs, const String& spriteSheetFileName, const String& textureFileName)
 {
     bool isSuccessful = false;
@@ -145,13 +165,13 @@ bool BitmapWidget::loadSpriteSheet(FS& fs, const String& spriteSheetFileName, co
     }
     else if (true == m_spriteSheet.load(fs, spriteSheetFileName, textureFileName))
     {
-        /* Calculate duration per frame. */
-        m_duration = 1000U / m_spriteSheet.getFPS();
-
         /* Avoid wasting memory. Additional this is important to detect whether the sprite sheet
          * shall be shown or the single bitmap image.
          */
-        m_bitmap.release();        
+        m_bitmap.release();
+        m_sharedBitmap.release();
+        m_mappedBitmap.unmap();
+        invalidate();
 
         isSuccessful = true;
     }
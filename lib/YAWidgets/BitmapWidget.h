@@ -45,10 +45,11 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <FS.h>
-#include <SimpleTimer.hpp>
+#include <Arduino.h>
 
 #include "Widget.hpp"
 #include "SpriteSheet.h"
+#include "ImageCache.h"
 
 /******************************************************************************
  * Macros
@@ -71,9 +72,9 @@ public:
     BitmapWidget() :
         Widget(WIDGET_TYPE),
         m_bitmap(),
-        m_spriteSheet(),
-        m_timer(),
-        m_duration(0U)
+        m_sharedBitmap(),
+        m_mappedBitmap(),
+        m_spriteSheet()
     {
     }
 
@@ -85,9 +86,9 @@ public:
     BitmapWidget(const BitmapWidget& widget) :
         Widget(WIDGET_TYPE),
         m_bitmap(widget.m_bitmap),
-        m_spriteSheet(widget.m_spriteSheet),
-        m_timer(widget.m_timer),
-        m_duration(widget.m_duration)
+        m_sharedBitmap(widget.m_sharedBitmap),
+        m_mappedBitmap(widget.m_mappedBitmap),
+        m_spriteSheet(widget.m_spriteSheet)
     {
     }
 
@@ -117,10 +118,13 @@ public:
             m_bitmap.copy(bitmap);
         }
 
-        /* Release sprite sheet to avoid wasting memory. The widget can
-         * only show one of them.
+        /* Release sprite sheet and shared bitmap to avoid wasting memory.
+         * The widget can only show one of them.
          */
         m_spriteSheet.release();
+        m_sharedBitmap.release();
+        m_mappedBitmap.unmap();
+        invalidate();
     }
 
     /**
@@ -130,11 +134,62 @@ public:
      */
     const YAGfxBitmap& get() const
     {
-        return m_bitmap;
+        const YAGfxBitmap* bitmap = &m_bitmap;
+
+        if (true == m_mappedBitmap.isMapped())
+        {
+            bitmap = &m_mappedBitmap;
+        }
+        else if (false == m_sharedBitmap.isEmpty())
+        {
+            bitmap = &m_sharedBitmap.get();
+        }
+        else
+        {
+            ;
+        }
+
+        return *bitmap;
     }
 
     /**
-     * Load bitmap image from filesystem.
+     * Is the widget dirty and needs to be repainted?
+     * A sprite sheet is animated and needs to be repainted continuously.
+     *
+     * @return If the widget needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const override
+    {
+        return ((true == Widget::isDirty()) ||
+                ((true == m_isEnabled) && (false == m_spriteSheet.isEmpty())));
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the bitmap or the
+     * sprite sheet frame.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a bitmap widget is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        if (true == m_spriteSheet.isEmpty())
+        {
+            box = GfxRect(m_posX, m_posY, get().getWidth(), get().getHeight());
+        }
+        else
+        {
+            box = GfxRect(m_posX, m_posY, m_spriteSheet.getFrameWidth(), m_spriteSheet.getFrameHeight());
+        }
+
+        return true;
+    }
+
+    /**
+     * Load bitmap image (.bmp) or packed image (.pim) from filesystem.
+     * The image is shared via the image cache with all other widgets,
+     * which load the same image file.
      * If a sprite sheet is active, it will be disabled.
      *
      * @param[in] fs        Filesystem
@@ -144,6 +199,19 @@ public:
      */
     bool load(FS& fs, const String& filename);
 
+    /**
+     * Show a uncompressed packed image directly from memory, e.g. from a
+     * flash partition, which is mapped into the address space. The pixels
+     * are not copied, therefore no heap memory is necessary.
+     * If a sprite sheet is active, it will be disabled.
+     *
+     * @param[in] data  Packed image, which must stay valid as long as it is shown.
+     * @param[in] size  Size of the packed image in byte
+     *
+     * @return If successful mapped it will return true otherwise false.
+     */
+    bool map(const uint8_t* data, size_t size);
+
     /**
      * Load sprite sheet file (.sprite) from filesystem.
      *
@@ -173,9 +241,9 @@ public:
 private:
 
     YAGfxDynamicBitmap  m_bitmap;       /**< Bitmap image which is shown if no sprite sheet is loaded. */
+    SharedBitmap        m_sharedBitmap; /**< Shared bitmap image from the image cache, which is preferred to the bitmap image. */
+    YAGfxMappedBitmap   m_mappedBitmap; /**< Mapped bitmap image, which is preferred to all other bitmap images. */
     SpriteSheet         m_spriteSheet;  /**< Sprite sheet for animation with texture. */
-    SimpleTimer         m_timer;        /**< Timer used for sprite sheet. */
-    uint32_t            m_duration;     /**< Duration of one frame in ms. */
 
     /**
      * Paint the widget with the given graphics interface.
@@ -186,28 +254,15 @@ private:
     {
         if (true == m_spriteSheet.isEmpty())
         {
-            gfx.drawBitmap(m_posX, m_posY, m_bitmap);
+            gfx.drawBitmap(m_posX, m_posY, get());
         }
         else
         {
-            gfx.drawBitmap(m_posX, m_posY, m_spriteSheet.getFrame());
-
-            /* If timer is not running, start it. */
-            if (false == m_timer.isTimerRunning())
-            {
-                m_timer.start(m_duration);
-            }
-            /* If the timer has a timeout, select next sprite and restart timer. */
-            else if (true == m_timer.isTimeout())
-            {
-                m_spriteSheet.next();
-                m_timer.start(m_duration);
-            }
-            else
-            {
-                /* Nothing to do. */
-                ;
-            }
+            /* The animation advances by the elapsed time, independent of
+             * how often the widget is painted.
+             */
+            m_spriteSheet.update(millis());
+            m_spriteSheet.drawFrame(gfx, m_posX, m_posY);
         }
 
         return;
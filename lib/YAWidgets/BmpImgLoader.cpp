@@ -33,6 +33,9 @@
  * Includes
  *****************************************************************************/
 #include "BmpImgLoader.h"
+#include "BufferedFileReader.hpp"
+
+#include <new>
 
 /******************************************************************************
  * Compiler Switches
@@ -97,10 +100,36 @@ typedef enum
 
 } CompressionMethod;
 
+/** Position of the DIB header in the file. */
+static const uint32_t BMP_DIB_HEADER_POS    = sizeof(BmpFileHeader);
+
+/** Position of the bit field masks in the file, which is right after the BITMAPINFOHEADER. */
+static const uint32_t BMP_BITFIELDS_POS     = sizeof(BmpFileHeader) + sizeof(BmpV5Header);
+
+/**
+ * Describes how to derive the color of a pixel.
+ */
+typedef struct _BmpPixelFormat
+{
+    uint16_t    bpp;            /**< Bits per pixel */
+    uint32_t    compression;    /**< The compression method being used. */
+    Color*      palette;        /**< Color palette, only for up to 8 bits per pixel. */
+    uint16_t    paletteSize;    /**< Number of colors in the palette. */
+    uint32_t    masks[3];       /**< Red, green and blue bit masks, only for 16 and 32 bits per pixel. */
+    uint8_t     shifts[3];      /**< Red, green and blue bit position of the masks. */
+    uint8_t     bits[3];        /**< Red, green and blue number of bits of the masks. */
+
+} BmpPixelFormat;
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
 
+static bool isFormatSupported(const BmpV5Header& header);
+static void initColorMask(BmpPixelFormat& pixelFormat, uint8_t idx, uint32_t mask);
+static Color getPaletteColor(const BmpPixelFormat& pixelFormat, uint8_t index);
+static Color getPixelColor(const BmpPixelFormat& pixelFormat, const uint8_t* row, uint16_t x);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -122,6 +151,7 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
     {
         BmpFileHeader   bmpFileHeader;
         BmpV5Header     dibHeader;
+        BmpPixelFormat  pixelFormat;
 
         if (false == loadBmpFileHeader(fd, bmpFileHeader))
         {
@@ -136,96 +166,55 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
         {
             ret = RET_FILE_FORMAT_INVALID;
         }
-        /* Contains the bitmap file the supported DIB header?
+        /* Contains the bitmap file a supported DIB header?
+         * The header may be a newer version, which extends the supported one.
          * Planes must be 1.
-         * Compression is not supported.
-         * Palette colors are not supported.
-         * 24 and 32 bits per pixel are supported.
          */
-        else if ((sizeof(dibHeader) != dibHeader.headerSize) ||
+        else if ((sizeof(dibHeader) > dibHeader.headerSize) ||
                  (1 != dibHeader.planes) ||
-                 (COMPRESSION_METHOD_RGB != dibHeader.compression) ||
-                 (0 < dibHeader.paletteColors) ||
-                 ((24 != dibHeader.bpp) && (32 != dibHeader.bpp)))
+                 (false == isFormatSupported(dibHeader)))
         {
             ret = RET_FILE_FORMAT_UNSUPPORTED;
         }
         /* Supported image size is limited. */
         else if ((UINT16_MAX < dibHeader.imageWidth) ||
-                 (UINT16_MAX < dibHeader.imageHeight))
+                 (UINT16_MAX < dibHeader.imageHeight) ||
+                 (-UINT16_MAX > dibHeader.imageHeight))
         {
             ret = RET_IMG_TOO_BIG;
         }
         else
         {
-            uint16_t width  = abs(dibHeader.imageWidth);
-            uint16_t height = abs(dibHeader.imageHeight);
+            ret = loadPixelFormat(fd, dibHeader, pixelFormat);
 
-            bitmap.release();
-
-            if (false == bitmap.create(width, height))
+            if (RET_OK == ret)
             {
-                ret = RET_IMG_TOO_BIG;
-            }
-            else
-            {
-                uint32_t    pos             = 0;
-                uint32_t    rowSize         = 0;
-                int16_t    x                = 0;
-                int16_t    y                = 0;
-                bool        isTopToBottom   = false;
-                uint16_t    bytePerPixel    = dibHeader.bpp / 8;
-
-                /* The bits representing the bitmap pixels are packed in rows.
-                 * The size of each row is rounded up to a multiple of 4 bytes
-                 * (a 32-bit DWORD) by padding.
-                 */
-                rowSize     =  (dibHeader.bpp * bitmap.getWidth() + 31) / 32 * 4;
-
-                /* ImageHeight is expressed as a negative number for top-down images. */
-                if (0 > dibHeader.imageHeight)
+                uint16_t width  = abs(dibHeader.imageWidth);
+                uint16_t height = abs(dibHeader.imageHeight);
+
+                bitmap.release();
+
+                if (false == bitmap.create(width, height))
                 {
-                    isTopToBottom = true;
+                    ret = RET_IMG_TOO_BIG;
                 }
-
-                while((bitmap.getHeight() > y) && (RET_OK == ret))
+                else if (false == fd.seek(bmpFileHeader.offset, SeekSet))
                 {
-                    x = 0;
-
-                    while((bitmap.getWidth() > x) && (RET_OK == ret))
-                    {
-                        uint8_t lineBuffer[bytePerPixel];
-
-                        if (false == isTopToBottom)
-                        {
-                            pos = x * bytePerPixel + (bitmap.getHeight() - y - 1) * rowSize;
-                        }
-                        else
-                        {
-                            pos = x * bytePerPixel + y * rowSize;
-                        }
-
-                        if (false == fd.seek(bmpFileHeader.offset + pos, SeekSet))
-                        {
-                            ret = RET_FILE_FORMAT_INVALID;
-                        }
-                        else if (sizeof(lineBuffer) != fd.read(lineBuffer, sizeof(lineBuffer)))
-                        {
-                            ret = RET_FILE_FORMAT_INVALID;
-                        }
-                        else
-                        {
-                            Color color(lineBuffer[2], lineBuffer[1], lineBuffer[0]);
-
-                            bitmap.drawPixel(x, y, color);
-                        }
-
-                        ++x;
-                    }
-
-                    ++y;
+                    ret = RET_FILE_FORMAT_INVALID;
+                }
+                else if ((COMPRESSION_METHOD_RLE8 == dibHeader.compression) ||
+                         (COMPRESSION_METHOD_RLE4 == dibHeader.compression))
+                {
+                    ret = loadRlePixels(fd, pixelFormat, bitmap);
+                }
+                else
+                {
+                    /* ImageHeight is expressed as a negative number for top-down images. */
+                    ret = loadPixelRows(fd, pixelFormat, 0 > dibHeader.imageHeight, bitmap);
                 }
             }
+
+            delete[] pixelFormat.palette;
         }
 
         fd.close();
@@ -271,6 +260,279 @@ bool BmpImgLoader::loadDibHeader(File& fd, BmpV5Header& header)
     return isSuccessful;
 }
 
+BmpImgLoader::Ret BmpImgLoader::loadPixelFormat(File& fd, const BmpV5Header& header, BmpPixelFormat& pixelFormat)
+{
+    Ret ret = RET_OK;
+
+    pixelFormat.bpp         = header.bpp;
+    pixelFormat.compression = header.compression;
+    pixelFormat.palette     = nullptr;
+    pixelFormat.paletteSize = 0U;
+
+    /* Palette indexed? */
+    if (8U >= header.bpp)
+    {
+        uint16_t maxPaletteSize = 1U << header.bpp;
+
+        pixelFormat.paletteSize = maxPaletteSize;
+
+        if ((0U < header.paletteColors) &&
+            (maxPaletteSize > header.paletteColors))
+        {
+            pixelFormat.paletteSize = header.paletteColors;
+        }
+
+        pixelFormat.palette = new(std::nothrow) Color[pixelFormat.paletteSize];
+
+        if (nullptr == pixelFormat.palette)
+        {
+            ret = RET_IMG_TOO_BIG;
+        }
+        /* The palette follows the DIB header. */
+        else if (false == fd.seek(BMP_DIB_HEADER_POS + header.headerSize, SeekSet))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else
+        {
+            BufferedFileReader  stream(fd);
+            uint16_t            idx     = 0U;
+
+            while((pixelFormat.paletteSize > idx) && (RET_OK == ret))
+            {
+                uint8_t entry[4U]; /* Blue, green, red, reserved */
+                uint8_t byteIdx = 0U;
+
+                while((sizeof(entry) > byteIdx) && (RET_OK == ret))
+                {
+                    if (false == stream.read(entry[byteIdx]))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+
+                    ++byteIdx;
+                }
+
+                pixelFormat.palette[idx].set(entry[2], entry[1], entry[0]);
+                ++idx;
+            }
+        }
+    }
+    else
+    {
+        uint32_t masks[3U];
+        uint8_t  idx = 0U;
+
+        /* Default masks: 16 bpp are 5-5-5, 32 bpp are 8-8-8 with unused upper byte. */
+        if (16U == header.bpp)
+        {
+            masks[0] = 0x00007C00U;
+            masks[1] = 0x000003E0U;
+            masks[2] = 0x0000001FU;
+        }
+        else
+        {
+            masks[0] = 0x00FF0000U;
+            masks[1] = 0x0000FF00U;
+            masks[2] = 0x000000FFU;
+        }
+
+        /* The masks follow the BITMAPINFOHEADER. In newer header versions
+         * they are part of the header at the same position.
+         */
+        if ((COMPRESSION_METHOD_BITFIELDS == header.compression) ||
+            (COMPRESSION_METHOD_ALPHA == header.compression))
+        {
+            if (false == fd.seek(BMP_BITFIELDS_POS, SeekSet))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else if (sizeof(masks) != fd.read(reinterpret_cast<uint8_t*>(masks), sizeof(masks)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        for(idx = 0U; idx < 3U; ++idx)
+        {
+            initColorMask(pixelFormat, idx, masks[idx]);
+        }
+    }
+
+    return ret;
+}
+
+BmpImgLoader::Ret BmpImgLoader::loadPixelRows(File& fd, const BmpPixelFormat& pixelFormat, bool isTopToBottom, YAGfxDynamicBitmap& bitmap)
+{
+    Ret         ret         = RET_OK;
+    uint16_t    width       = bitmap.getWidth();
+    uint16_t    height      = bitmap.getHeight();
+
+    /* The bits representing the bitmap pixels are packed in rows.
+     * The size of each row is rounded up to a multiple of 4 bytes
+     * (a 32-bit DWORD) by padding.
+     */
+    uint32_t    rowSize     = (static_cast<uint32_t>(pixelFormat.bpp) * width + 31U) / 32U * 4U;
+    uint8_t*    rowBuffer   = new(std::nothrow) uint8_t[rowSize];
+
+    if (nullptr == rowBuffer)
+    {
+        ret = RET_IMG_TOO_BIG;
+    }
+    else
+    {
+        uint16_t row = 0U;
+
+        /* The rows are read in file order. A bottom-up image is written in reverse row order. */
+        while((height > row) && (RET_OK == ret))
+        {
+            if (rowSize != fd.read(rowBuffer, rowSize))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                uint16_t x = 0U;
+                uint16_t y = (true == isTopToBottom) ? row : (height - row - 1U);
+
+                for(x = 0U; x < width; ++x)
+                {
+                    bitmap.drawPixel(x, y, getPixelColor(pixelFormat, rowBuffer, x));
+                }
+            }
+
+            ++row;
+        }
+
+        delete[] rowBuffer;
+    }
+
+    return ret;
+}
+
+BmpImgLoader::Ret BmpImgLoader::loadRlePixels(File& fd, const BmpPixelFormat& pixelFormat, YAGfxDynamicBitmap& bitmap)
+{
+    Ret                 ret     = RET_OK;
+    BufferedFileReader  stream(fd);
+    bool                isRle8  = (COMPRESSION_METHOD_RLE8 == pixelFormat.compression);
+    bool                isEnd   = false;
+    int32_t             x       = 0;
+    int32_t             y       = bitmap.getHeight() - 1; /* Compressed images are always bottom-up. */
+    uint8_t             count   = 0U;
+    uint8_t             value   = 0U;
+
+    /* Pixels which are skipped by a delta or end of line are black. */
+    bitmap.fillScreen(ColorDef::BLACK);
+
+    while((false == isEnd) && (RET_OK == ret))
+    {
+        if ((false == stream.read(count)) ||
+            (false == stream.read(value)))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        /* Encoded mode: Repeat the color index (RLE8) or the two color indices (RLE4). */
+        else if (0U < count)
+        {
+            uint8_t idx = 0U;
+
+            for(idx = 0U; idx < count; ++idx)
+            {
+                uint8_t index = value;
+
+                if (false == isRle8)
+                {
+                    index = (0U == (idx & 1U)) ? (value >> 4U) : (value & 0x0FU);
+                }
+
+                bitmap.drawPixel(x, y, getPaletteColor(pixelFormat, index));
+                ++x;
+            }
+        }
+        /* End of line */
+        else if (0U == value)
+        {
+            x = 0;
+            --y;
+        }
+        /* End of bitmap */
+        else if (1U == value)
+        {
+            isEnd = true;
+        }
+        /* Delta: Move the position right and up. */
+        else if (2U == value)
+        {
+            uint8_t dX = 0U;
+            uint8_t dY = 0U;
+
+            if ((false == stream.read(dX)) ||
+                (false == stream.read(dY)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                x += dX;
+                y -= dY;
+            }
+        }
+        /* Absolute mode: Number of color indices, which follow uncompressed. */
+        else
+        {
+            uint8_t idx         = 0U;
+            uint8_t data        = 0U;
+            uint8_t byteCnt     = (true == isRle8) ? value : ((value + 1U) / 2U);
+
+            for(idx = 0U; (idx < value) && (RET_OK == ret); ++idx)
+            {
+                uint8_t index = 0U;
+
+                if ((true == isRle8) ||
+                    (0U == (idx & 1U)))
+                {
+                    if (false == stream.read(data))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+                }
+
+                if (true == isRle8)
+                {
+                    index = data;
+                }
+                else
+                {
+                    index = (0U == (idx & 1U)) ? (data >> 4U) : (data & 0x0FU);
+                }
+
+                bitmap.drawPixel(x, y, getPaletteColor(pixelFormat, index));
+                ++x;
+            }
+
+            /* The absolute run is padded to a 16-bit boundary. */
+            if ((RET_OK == ret) &&
+                (0U != (byteCnt & 1U)) &&
+                (false == stream.read(data)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+        }
+
+        /* All rows are done? */
+        if (0 > y)
+        {
+            isEnd = true;
+        }
+    }
+
+    return ret;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -278,3 +540,193 @@ bool BmpImgLoader::loadDibHeader(File& fd, BmpV5Header& header)
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Is the pixel format of the bitmap supported?
+ * - 1/4/8 bits per pixel with color palette, 8 bit RLE8 and 4 bit RLE4 compressed.
+ * - 16/24/32 bits per pixel, 16/32 bits per pixel with bit fields.
+ *
+ * @param[in] header    DIB header
+ *
+ * @return If supported, it will return true otherwise false.
+ */
+static bool isFormatSupported(const BmpV5Header& header)
+{
+    bool isSupported = false;
+
+    switch(header.compression)
+    {
+    case COMPRESSION_METHOD_RGB:
+        if ((1U == header.bpp) ||
+            (4U == header.bpp) ||
+            (8U == header.bpp) ||
+            (16U == header.bpp) ||
+            (24U == header.bpp) ||
+            (32U == header.bpp))
+        {
+            isSupported = true;
+        }
+        break;
+
+    /* Compressed bitmaps can't be top-down. */
+    case COMPRESSION_METHOD_RLE8:
+        if ((8U == header.bpp) &&
+            (0 < header.imageHeight))
+        {
+            isSupported = true;
+        }
+        break;
+
+    case COMPRESSION_METHOD_RLE4:
+        if ((4U == header.bpp) &&
+            (0 < header.imageHeight))
+        {
+            isSupported = true;
+        }
+        break;
+
+    case COMPRESSION_METHOD_BITFIELDS:
+        /* fallthrough */
+    case COMPRESSION_METHOD_ALPHA:
+        if ((16U == header.bpp) ||
+            (32U == header.bpp))
+        {
+            isSupported = true;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return isSupported;
+}
+
+/**
+ * Initialize a color component mask and derive its position and width.
+ *
+ * @param[in,out]   pixelFormat Pixel format
+ * @param[in]       idx         Color component index (0: red, 1: green, 2: blue)
+ * @param[in]       mask        Bit mask
+ */
+static void initColorMask(BmpPixelFormat& pixelFormat, uint8_t idx, uint32_t mask)
+{
+    uint8_t shift   = 0U;
+    uint8_t bits    = 0U;
+
+    if (0U != mask)
+    {
+        while(0U == ((mask >> shift) & 1U))
+        {
+            ++shift;
+        }
+
+        while((32U > (shift + bits)) &&
+              (0U != ((mask >> (shift + bits)) & 1U)))
+        {
+            ++bits;
+        }
+    }
+
+    pixelFormat.masks[idx]  = mask;
+    pixelFormat.shifts[idx] = shift;
+    pixelFormat.bits[idx]   = bits;
+}
+
+/**
+ * Get color from the palette.
+ *
+ * @param[in] pixelFormat   Pixel format
+ * @param[in] index         Palette index
+ *
+ * @return Color. A index outside the palette results in black.
+ */
+static Color getPaletteColor(const BmpPixelFormat& pixelFormat, uint8_t index)
+{
+    Color color;
+
+    if (pixelFormat.paletteSize > index)
+    {
+        color = pixelFormat.palette[index];
+    }
+
+    return color;
+}
+
+/**
+ * Get color of a pixel in a uncompressed row.
+ *
+ * @param[in] pixelFormat   Pixel format
+ * @param[in] row           Row buffer
+ * @param[in] x             x-coordinate of the pixel
+ *
+ * @return Color
+ */
+static Color getPixelColor(const BmpPixelFormat& pixelFormat, const uint8_t* row, uint16_t x)
+{
+    Color color;
+
+    switch(pixelFormat.bpp)
+    {
+    case 1U:
+        color = getPaletteColor(pixelFormat, (row[x / 8U] >> (7U - (x % 8U))) & 0x01U);
+        break;
+
+    case 4U:
+        color = getPaletteColor(pixelFormat, (row[x / 2U] >> ((0U == (x % 2U)) ? 4U : 0U)) & 0x0FU);
+        break;
+
+    case 8U:
+        color = getPaletteColor(pixelFormat, row[x]);
+        break;
+
+    case 24U:
+        color.set(row[x * 3U + 2U], row[x * 3U + 1U], row[x * 3U]);
+        break;
+
+    case 16U:
+        /* fallthrough */
+    case 32U:
+        {
+            uint8_t         bytePerPixel    = pixelFormat.bpp / 8U;
+            const uint8_t*  pixel           = &row[x * bytePerPixel];
+            uint32_t        value           = 0U;
+            uint8_t         component[3U];
+            uint8_t         idx             = 0U;
+
+            /* Little endian */
+            for(idx = 0U; idx < bytePerPixel; ++idx)
+            {
+                value |= static_cast<uint32_t>(pixel[idx]) << (idx * 8U);
+            }
+
+            for(idx = 0U; idx < 3U; ++idx)
+            {
+                uint32_t    part    = (value & pixelFormat.masks[idx]) >> pixelFormat.shifts[idx];
+                uint8_t     bits    = pixelFormat.bits[idx];
+
+                /* Scale to 8 bit. */
+                if (0U == bits)
+                {
+                    component[idx] = 0U;
+                }
+                else if (8U <= bits)
+                {
+                    component[idx] = part >> (bits - 8U);
+                }
+                else
+                {
+                    component[idx] = (part * 255U) / ((1U << bits) - 1U);
+                }
+            }
+
+            color.set(component[0], component[1], component[2]);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return color;
+}
@@ -58,13 +58,16 @@
 /* Forward declarations */
 typedef struct _BmpFileHeader BmpFileHeader;
 typedef struct _BmpV5Header BmpV5Header;
+typedef struct _BmpPixelFormat BmpPixelFormat;
 
 /**
  * Bitmap image loader, which supports images that have
- * - 24/32 bit per pixel
- * - No compression
- * - No palette colors
+ * - 1/4/8 bit per pixel with color palette, uncompressed or RLE8/RLE4 compressed
+ * - 16/24/32 bit per pixel, uncompressed or with bit fields
  * - Resolution of max. 65535 x 65535 pixels
+ *
+ * The pixel data is streamed row by row through a buffer, instead of reading
+ * it pixel by pixel.
  */
 class BmpImgLoader
 {
@@ -128,6 +131,41 @@ private:
      * @return If successful, it will return true otherwise false.
      */
     bool loadDibHeader(File& fd, BmpV5Header& header);
+
+    /**
+     * Load the pixel format: color palette or the color bit masks.
+     * A allocated palette must be released by the caller.
+     *
+     * @param[in]   fd          File descriptor
+     * @param[in]   header      DIB header
+     * @param[out]  pixelFormat Pixel format
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadPixelFormat(File& fd, const BmpV5Header& header, BmpPixelFormat& pixelFormat);
+
+    /**
+     * Load uncompressed pixel data, row by row, beginning at the current file position.
+     *
+     * @param[in]   fd              File descriptor
+     * @param[in]   pixelFormat     Pixel format
+     * @param[in]   isTopToBottom   Are the rows stored top-down?
+     * @param[out]  bitmap          Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadPixelRows(File& fd, const BmpPixelFormat& pixelFormat, bool isTopToBottom, YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Load RLE8 or RLE4 compressed pixel data, beginning at the current file position.
+     *
+     * @param[in]   fd          File descriptor
+     * @param[in]   pixelFormat Pixel format
+     * @param[out]  bitmap      Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadRlePixels(File& fd, const BmpPixelFormat& pixelFormat, YAGfxDynamicBitmap& bitmap);
 };
 
 /******************************************************************************
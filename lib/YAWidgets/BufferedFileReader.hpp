@@ -0,0 +1,169 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Buffered file reader
+ * @author Andreas Merkle <web@blue-andi.de>
+ * 
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __BUFFERED_FILE_READER_HPP__
+#define __BUFFERED_FILE_READER_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <FS.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Buffered sequential file reader.
+ * Used for compressed image data, which must be read byte by byte. It
+ * reduces the number of file system calls.
+ */
+class BufferedFileReader
+{
+public:
+
+    /**
+     * Constructs the reader, which starts at the current file position.
+     *
+     * @param[in] fd    File descriptor
+     */
+    BufferedFileReader(File& fd) :
+        m_fd(fd),
+        m_buffer(),
+        m_size(0U),
+        m_index(0U)
+    {
+    }
+
+    /**
+     * Destroys the reader.
+     */
+    ~BufferedFileReader()
+    {
+    }
+
+    /**
+     * Discard the buffered data. Call it after the file position was changed.
+     */
+    void reset()
+    {
+        m_size  = 0U;
+        m_index = 0U;
+    }
+
+    /**
+     * Read the next byte.
+     *
+     * @param[out] value    Byte
+     *
+     * @return If successful, it will return true otherwise false (end of file).
+     */
+    bool read(uint8_t& value)
+    {
+        bool isSuccessful = true;
+
+        if (m_size <= m_index)
+        {
+            m_size  = m_fd.read(m_buffer, sizeof(m_buffer));
+            m_index = 0U;
+        }
+
+        if (m_size <= m_index)
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            value = m_buffer[m_index];
+            ++m_index;
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Read a 16-bit little endian value.
+     *
+     * @param[out] value    Value
+     *
+     * @return If successful, it will return true otherwise false (end of file).
+     */
+    bool read(uint16_t& value)
+    {
+        bool    isSuccessful    = false;
+        uint8_t low             = 0U;
+        uint8_t high            = 0U;
+
+        if ((true == read(low)) &&
+            (true == read(high)))
+        {
+            value           = (static_cast<uint16_t>(high) << 8U) | low;
+            isSuccessful    = true;
+        }
+
+        return isSuccessful;
+    }
+
+private:
+
+    /** Read buffer size in byte. */
+    static const uint8_t    BUFFER_SIZE = 64U;
+
+    File&   m_fd;                   /**< File descriptor */
+    uint8_t m_buffer[BUFFER_SIZE];  /**< Read buffer */
+    size_t  m_size;                 /**< Number of valid bytes in the buffer */
+    size_t  m_index;                /**< Index of the next byte in the buffer */
+
+    BufferedFileReader();
+    BufferedFileReader(const BufferedFileReader& reader);
+    BufferedFileReader& operator=(const BufferedFileReader& reader);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BUFFERED_FILE_READER_HPP__ */
+
+/** @} */
@@ -0,0 +1,178 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Chart widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ChartWidget.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize chart widget type. */
+const char* ChartWidget::WIDGET_TYPE = "chart";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool ChartWidget::setSize(uint16_t width, uint16_t height)
+{
+    bool isSuccessful = true;
+
+    if (0U == width)
+    {
+        m_samples.release();
+    }
+    else
+    {
+        isSuccessful = m_samples.create(width);
+    }
+
+    if (true == isSuccessful)
+    {
+        m_width     = width;
+        m_height    = height;
+    }
+    else
+    {
+        m_width     = 0U;
+        m_height    = 0U;
+    }
+
+    invalidate();
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void ChartWidget::paint(YAGfx& gfx)
+{
+    uint16_t count = m_samples.getCount();
+
+    if ((0U < count) &&
+        (0U < m_height))
+    {
+        float       min     = m_rangeMin;
+        float       max     = m_rangeMax;
+        int16_t     bottom  = m_posY + m_height - 1;
+        int16_t     x       = m_posX + m_width - count; /* Latest sample is on the right side. */
+        int16_t     prevY   = 0;
+        uint16_t    idx     = 0U;
+
+        if (true == m_isAutoRange)
+        {
+            min = m_samples.getMin();
+            max = m_samples.getMax();
+        }
+
+        for(idx = 0U; idx < count; ++idx)
+        {
+            int16_t y = m_posY + calcY(m_samples.get(idx), min, max);
+
+            if (STYLE_LINE == m_style)
+            {
+                if (0U == idx)
+                {
+                    gfx.drawPixel(x, y, m_color);
+                }
+                else
+                {
+                    gfx.drawLine(x - 1, prevY, x, y, m_color);
+                }
+
+                prevY = y;
+            }
+            else
+            {
+                gfx.drawVLine(x, y, bottom - y + 1, m_color);
+            }
+
+            ++x;
+        }
+    }
+}
+
+int16_t ChartWidget::calcY(float value, float min, float max) const
+{
+    int16_t y = m_height - 1;
+
+    /* If all values are equal, they are shown at the bottom. */
+    if (min < max)
+    {
+        float level = (value - min) / (max - min);
+
+        if (0.0F > level)
+        {
+            level = 0.0F;
+        }
+        else if (1.0F < level)
+        {
+            level = 1.0F;
+        }
+
+        y -= static_cast<int16_t>(level * (m_height - 1) + 0.5F);
+    }
+
+    return y;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
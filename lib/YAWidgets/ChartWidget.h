@@ -0,0 +1,296 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Chart widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __CHART_WIDGET_H__
+#define __CHART_WIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Widget.hpp>
+#include <YAColor.h>
+#include <ColorDef.hpp>
+#include "SampleBuffer.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A chart widget, which shows the history of samples either as bar chart
+ * or as line (sparkline). Every column shows one sample, the latest one is
+ * on the right side.
+ *
+ * The samples are kept in a ring buffer, which is allocated once with the
+ * widget size. Adding a sample and painting never allocate memory.
+ */
+class ChartWidget : public Widget
+{
+public:
+
+    /**
+     * Chart styles.
+     */
+    enum Style
+    {
+        STYLE_BAR = 0,  /**< Every sample is shown as vertical bar. */
+        STYLE_LINE,     /**< The samples are connected by a line. */
+        STYLE_MAX       /**< Number of styles */
+    };
+
+    /** Default chart color */
+    static const uint32_t   DEFAULT_COLOR   = ColorDef::GREEN;
+
+    /**
+     * Constructs a chart widget without size. Set the size first,
+     * otherwise no samples can be added.
+     */
+    ChartWidget() :
+        Widget(WIDGET_TYPE),
+        m_width(0U),
+        m_height(0U),
+        m_samples(),
+        m_style(STYLE_BAR),
+        m_color(DEFAULT_COLOR),
+        m_isAutoRange(true),
+        m_rangeMin(0.0F),
+        m_rangeMax(0.0F)
+    {
+    }
+
+    /**
+     * Constructs a chart widget by copy.
+     *
+     * @param[in] widget    Chart widget, which to copy.
+     */
+    ChartWidget(const ChartWidget& widget) :
+        Widget(widget),
+        m_width(widget.m_width),
+        m_height(widget.m_height),
+        m_samples(widget.m_samples),
+        m_style(widget.m_style),
+        m_color(widget.m_color),
+        m_isAutoRange(widget.m_isAutoRange),
+        m_rangeMin(widget.m_rangeMin),
+        m_rangeMax(widget.m_rangeMax)
+    {
+    }
+
+    /**
+     * Destroys the chart widget.
+     */
+    ~ChartWidget()
+    {
+    }
+
+    /**
+     * Assigns a chart widget.
+     *
+     * @param[in] widget    Chart widget, which to assign.
+     *
+     * @return Chart widget
+     */
+    ChartWidget& operator=(const ChartWidget& widget)
+    {
+        if (&widget != this)
+        {
+            Widget::operator=(widget);
+
+            m_width         = widget.m_width;
+            m_height        = widget.m_height;
+            m_samples       = widget.m_samples;
+            m_style         = widget.m_style;
+            m_color         = widget.m_color;
+            m_isAutoRange   = widget.m_isAutoRange;
+            m_rangeMin      = widget.m_rangeMin;
+            m_rangeMax      = widget.m_rangeMax;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the widget size. The sample buffer is allocated for one sample
+     * per column and all samples are discarded.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool setSize(uint16_t width, uint16_t height);
+
+    /**
+     * Add a sample. If the chart is full, the oldest sample is discarded.
+     *
+     * @param[in] value Sample value
+     */
+    void addSample(float value)
+    {
+        m_samples.add(value);
+        invalidate();
+    }
+
+    /**
+     * Discard all samples.
+     */
+    void clear()
+    {
+        m_samples.clear();
+        invalidate();
+    }
+
+    /**
+     * Get the samples.
+     *
+     * @return Samples
+     */
+    const SampleBuffer& getSamples() const
+    {
+        return m_samples;
+    }
+
+    /**
+     * Set the chart style.
+     *
+     * @param[in] style Chart style
+     */
+    void setStyle(Style style)
+    {
+        if (STYLE_MAX > style)
+        {
+            m_style = style;
+            invalidate();
+        }
+    }
+
+    /**
+     * Set the chart color.
+     *
+     * @param[in] color Chart color
+     */
+    void setColor(const Color& color)
+    {
+        m_color = color;
+        invalidate();
+    }
+
+    /**
+     * Show the samples in a fixed range. Values outside are limited.
+     *
+     * @param[in] min   Value, shown at the bottom.
+     * @param[in] max   Value, shown at the top.
+     */
+    void setRange(float min, float max)
+    {
+        m_isAutoRange   = false;
+        m_rangeMin      = min;
+        m_rangeMax      = max;
+        invalidate();
+    }
+
+    /**
+     * Show the samples in the range of the min. and max. sample value.
+     * This is the default.
+     */
+    void setAutoRange()
+    {
+        m_isAutoRange = true;
+        invalidate();
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the widget.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a chart is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, m_width, m_height);
+
+        return true;
+    }
+
+    /** Widget type string */
+    static const char*  WIDGET_TYPE;
+
+private:
+
+    uint16_t        m_width;        /**< Width in pixel */
+    uint16_t        m_height;       /**< Height in pixel */
+    SampleBuffer    m_samples;      /**< Samples, one per column. */
+    Style           m_style;        /**< Chart style */
+    Color           m_color;        /**< Chart color */
+    bool            m_isAutoRange;  /**< Range is determined by the min. and max. sample value. */
+    float           m_rangeMin;     /**< Value at the bottom, if the range is fixed. */
+    float           m_rangeMax;     /**< Value at the top, if the range is fixed. */
+
+    /**
+     * Paint the widget with the given graphics interface.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paint(YAGfx& gfx) override;
+
+    /**
+     * Calculate the y-coordinate of a sample value.
+     *
+     * @param[in] value Sample value
+     * @param[in] min   Value at the bottom
+     * @param[in] max   Value at the top
+     *
+     * @return y-coordinate relative to the widget
+     */
+    int16_t calcY(float value, float min, float max) const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __CHART_WIDGET_H__ */
+
+/** @} */
@@ -0,0 +1,112 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gauge widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GaugeWidget.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize gauge widget type. */
+const char* GaugeWidget::WIDGET_TYPE = "gauge";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void GaugeWidget::paint(YAGfx& gfx)
+{
+    bool        isHorizontal    = (m_width >= m_height);
+    uint16_t    length          = (true == isHorizontal) ? m_width : m_height;
+    uint16_t    filled          = 0U;
+
+    if (m_rangeMin < m_rangeMax)
+    {
+        float level = (m_value - m_rangeMin) / (m_rangeMax - m_rangeMin);
+
+        if (0.0F > level)
+        {
+            level = 0.0F;
+        }
+        else if (1.0F < level)
+        {
+            level = 1.0F;
+        }
+
+        filled = static_cast<uint16_t>(level * length + 0.5F);
+    }
+
+    if (true == isHorizontal)
+    {
+        gfx.fillRect(m_posX, m_posY, filled, m_height, m_color);
+        gfx.fillRect(m_posX + filled, m_posY, m_width - filled, m_height, m_backgroundColor);
+    }
+    else
+    {
+        gfx.fillRect(m_posX, m_posY, m_width, m_height - filled, m_backgroundColor);
+        gfx.fillRect(m_posX, m_posY + m_height - filled, m_width, filled, m_color);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
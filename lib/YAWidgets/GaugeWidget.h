@@ -0,0 +1,254 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gauge widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __GAUGE_WIDGET_H__
+#define __GAUGE_WIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Widget.hpp>
+#include <YAColor.h>
+#include <ColorDef.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A gauge widget, which shows a value relative to its range as filled bar.
+ * The bar is filled along the longer dimension, horizontal from left to
+ * right or vertical from bottom to top.
+ */
+class GaugeWidget : public Widget
+{
+public:
+
+    /** Default gauge color */
+    static const uint32_t   DEFAULT_COLOR               = ColorDef::GREEN;
+
+    /** Default background color of the unfilled part */
+    static const uint32_t   DEFAULT_BACKGROUND_COLOR    = ColorDef::BLACK;
+
+    /**
+     * Constructs a gauge widget with the range 0 - 100.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    GaugeWidget(uint16_t width = 0U, uint16_t height = 0U) :
+        Widget(WIDGET_TYPE),
+        m_width(width),
+        m_height(height),
+        m_value(0.0F),
+        m_rangeMin(0.0F),
+        m_rangeMax(100.0F),
+        m_color(DEFAULT_COLOR),
+        m_backgroundColor(DEFAULT_BACKGROUND_COLOR)
+    {
+    }
+
+    /**
+     * Constructs a gauge widget by copy.
+     *
+     * @param[in] widget    Gauge widget, which to copy.
+     */
+    GaugeWidget(const GaugeWidget& widget) :
+        Widget(widget),
+        m_width(widget.m_width),
+        m_height(widget.m_height),
+        m_value(widget.m_value),
+        m_rangeMin(widget.m_rangeMin),
+        m_rangeMax(widget.m_rangeMax),
+        m_color(widget.m_color),
+        m_backgroundColor(widget.m_backgroundColor)
+    {
+    }
+
+    /**
+     * Destroys the gauge widget.
+     */
+    ~GaugeWidget()
+    {
+    }
+
+    /**
+     * Assigns a gauge widget.
+     *
+     * @param[in] widget    Gauge widget, which to assign.
+     *
+     * @return Gauge widget
+     */
+    GaugeWidget& operator=(const GaugeWidget& widget)
+    {
+        if (&widget != this)
+        {
+            Widget::operator=(widget);
+
+            m_width             = widget.m_width;
+            m_height            = widget.m_height;
+            m_value             = widget.m_value;
+            m_rangeMin          = widget.m_rangeMin;
+            m_rangeMax          = widget.m_rangeMax;
+            m_color             = widget.m_color;
+            m_backgroundColor   = widget.m_backgroundColor;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Set the widget size.
+     *
+     * @param[in] width     Width in pixel
+     * @param[in] height    Height in pixel
+     */
+    void setSize(uint16_t width, uint16_t height)
+    {
+        m_width     = width;
+        m_height    = height;
+        invalidate();
+    }
+
+    /**
+     * Set the value.
+     *
+     * @param[in] value Value, which is limited to the range.
+     */
+    void setValue(float value)
+    {
+        if (value != m_value)
+        {
+            m_value = value;
+            invalidate();
+        }
+    }
+
+    /**
+     * Get the value.
+     *
+     * @return Value
+     */
+    float getValue() const
+    {
+        return m_value;
+    }
+
+    /**
+     * Set the range.
+     *
+     * @param[in] min   Value, which is shown as empty gauge.
+     * @param[in] max   Value, which is shown as full gauge.
+     */
+    void setRange(float min, float max)
+    {
+        m_rangeMin = min;
+        m_rangeMax = max;
+        invalidate();
+    }
+
+    /**
+     * Set the gauge color.
+     *
+     * @param[in] color Gauge color
+     */
+    void setColor(const Color& color)
+    {
+        m_color = color;
+        invalidate();
+    }
+
+    /**
+     * Set the background color of the unfilled part.
+     *
+     * @param[in] color Background color
+     */
+    void setBackgroundColor(const Color& color)
+    {
+        m_backgroundColor = color;
+        invalidate();
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the widget.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a gauge is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, m_width, m_height);
+
+        return true;
+    }
+
+    /** Widget type string */
+    static const char*  WIDGET_TYPE;
+
+private:
+
+    uint16_t    m_width;            /**< Width in pixel */
+    uint16_t    m_height;           /**< Height in pixel */
+    float       m_value;            /**< Value */
+    float       m_rangeMin;         /**< Value of the empty gauge */
+    float       m_rangeMax;         /**< Value of the full gauge */
+    Color       m_color;            /**< Gauge color */
+    Color       m_backgroundColor;  /**< Color of the unfilled part */
+
+    /**
+     * Paint the widget with the given graphics interface.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paint(YAGfx& gfx) override;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __GAUGE_WIDGET_H__ */
+
+/** @} */
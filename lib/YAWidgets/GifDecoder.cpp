@@ -0,0 +1,735 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  GIF decoder
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GifDecoder.h"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint16_t getInterlacedRow(uint16_t row, uint16_t height);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize file extension. */
+const char* GifDecoder::FILE_EXT    = ".gif";
+
+/** GIF header size in byte (signature and version). */
+static const uint8_t    GIF_HEADER_SIZE             = 6U;
+
+/** Logical screen descriptor size in byte. */
+static const uint8_t    GIF_SCREEN_DESCRIPTOR_SIZE  = 7U;
+
+/** Block introducer of a extension. */
+static const uint8_t    GIF_EXTENSION_INTRODUCER    = 0x21U;
+
+/** Block introducer of a image descriptor. */
+static const uint8_t    GIF_IMAGE_SEPARATOR         = 0x2CU;
+
+/** Trailer, which marks the end of the file. */
+static const uint8_t    GIF_TRAILER                 = 0x3BU;
+
+/** Extension label of the graphic control extension. */
+static const uint8_t    GIF_GRAPHIC_CONTROL_LABEL   = 0xF9U;
+
+/** Flag: Color table available. */
+static const uint8_t    GIF_FLAG_COLOR_TABLE        = 0x80U;
+
+/** Flag: Image rows are interlaced. */
+static const uint8_t    GIF_FLAG_INTERLACED         = 0x40U;
+
+/** Flag: Transparent color index available. */
+static const uint8_t    GIF_FLAG_TRANSPARENT        = 0x01U;
+
+/** Invalid LZW code, used to mark that no previous code is available. */
+static const uint16_t   LZW_NO_CODE                 = 0xFFFFU;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+GifDecoder::Ret GifDecoder::open(FS& fs, const String& fileName)
+{
+    Ret ret = RET_OK;
+
+    close();
+
+    m_fd = fs.open(fileName);
+
+    if (false == m_fd)
+    {
+        ret = RET_FILE_NOT_FOUND;
+    }
+    else
+    {
+        uint8_t header[GIF_HEADER_SIZE];
+        uint8_t screenDescriptor[GIF_SCREEN_DESCRIPTOR_SIZE];
+
+        m_reader.reset();
+
+        if ((sizeof(header) != m_fd.read(header, sizeof(header))) ||
+            (sizeof(screenDescriptor) != m_fd.read(screenDescriptor, sizeof(screenDescriptor))))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if (('G' != header[0]) || ('I' != header[1]) || ('F' != header[2]) ||
+                 ('8' != header[3]) || ('a' != header[5]) ||
+                 (('7' != header[4]) && ('9' != header[4])))
+        {
+            ret = RET_FILE_FORMAT_UNSUPPORTED;
+        }
+        else
+        {
+            uint16_t    width   = static_cast<uint16_t>(screenDescriptor[0]) | (static_cast<uint16_t>(screenDescriptor[1]) << 8U);
+            uint16_t    height  = static_cast<uint16_t>(screenDescriptor[2]) | (static_cast<uint16_t>(screenDescriptor[3]) << 8U);
+            uint8_t     flags   = screenDescriptor[4];
+
+            m_globalPaletteSize = (0U != (flags & GIF_FLAG_COLOR_TABLE)) ? (1U << ((flags & 0x07U) + 1U)) : 0U;
+            m_firstFramePos     = GIF_HEADER_SIZE + GIF_SCREEN_DESCRIPTOR_SIZE + 3U * m_globalPaletteSize;
+
+            m_globalPalette = new(std::nothrow) Color[MAX_PALETTE_SIZE];
+            m_localPalette  = new(std::nothrow) Color[MAX_PALETTE_SIZE];
+            m_prefix        = new(std::nothrow) uint16_t[LZW_TABLE_SIZE];
+            m_suffix        = new(std::nothrow) uint8_t[LZW_TABLE_SIZE];
+            m_stack         = new(std::nothrow) uint8_t[LZW_TABLE_SIZE];
+
+            if ((0U == width) ||
+                (0U == height))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else if ((nullptr == m_globalPalette) ||
+                     (nullptr == m_localPalette) ||
+                     (nullptr == m_prefix) ||
+                     (nullptr == m_suffix) ||
+                     (nullptr == m_stack) ||
+                     (false == m_canvas.create(width, height)))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            else if (false == readPalette(m_globalPalette, m_globalPaletteSize))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                rewind();
+            }
+        }
+
+        if (RET_OK != ret)
+        {
+            close();
+        }
+    }
+
+    return ret;
+}
+
+void GifDecoder::close()
+{
+    if (true == m_fd)
+    {
+        m_fd.close();
+    }
+
+    m_reader.reset();
+    m_canvas.release();
+    m_prevCanvas.release();
+
+    delete[] m_globalPalette;
+    m_globalPalette = nullptr;
+    m_globalPaletteSize = 0U;
+
+    delete[] m_localPalette;
+    m_localPalette = nullptr;
+
+    delete[] m_prefix;
+    m_prefix = nullptr;
+
+    delete[] m_suffix;
+    m_suffix = nullptr;
+
+    delete[] m_stack;
+    m_stack = nullptr;
+
+    return;
+}
+
+GifDecoder::Ret GifDecoder::nextFrame(uint32_t& delay)
+{
+    Ret     ret         = RET_OK;
+    bool    isFinished  = false;
+    bool    isRewound   = false;
+
+    if (false == isOpen())
+    {
+        ret         = RET_FILE_NOT_FOUND;
+        isFinished  = true;
+    }
+
+    while(false == isFinished)
+    {
+        uint8_t introducer = 0U;
+
+        /* A missing trailer is tolerated, like most viewers do. */
+        if (false == m_reader.read(introducer))
+        {
+            introducer = GIF_TRAILER;
+        }
+
+        if (GIF_EXTENSION_INTRODUCER == introducer)
+        {
+            if (false == readExtension())
+            {
+                introducer = GIF_TRAILER;
+            }
+        }
+        else if (GIF_IMAGE_SEPARATOR == introducer)
+        {
+            /* The delay belongs to the graphic control extension, which is only valid for this frame. */
+            delay = m_delay;
+
+            disposePrevFrame();
+
+            ret = readImage();
+
+            if (RET_OK == ret)
+            {
+                ++m_frameCnt;
+            }
+
+            isFinished = true;
+        }
+        else
+        {
+            /* Trailer or unknown block. */
+            introducer = GIF_TRAILER;
+        }
+
+        if ((GIF_TRAILER == introducer) &&
+            (false == isFinished))
+        {
+            /* Without any frame the image is invalid. Stop here to avoid a endless loop. */
+            if ((0U == m_frameCnt) ||
+                (true == isRewound))
+            {
+                ret         = RET_FILE_FORMAT_INVALID;
+                isFinished  = true;
+            }
+            else
+            {
+                rewind();
+                isRewound = true;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool GifDecoder::readPalette(Color* palette, uint16_t paletteSize)
+{
+    bool        isSuccessful    = true;
+    uint16_t    idx             = 0U;
+
+    while((paletteSize > idx) && (true == isSuccessful))
+    {
+        uint8_t red     = 0U;
+        uint8_t green   = 0U;
+        uint8_t blue    = 0U;
+
+        if ((false == m_reader.read(red)) ||
+            (false == m_reader.read(green)) ||
+            (false == m_reader.read(blue)))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            palette[idx].set(red, green, blue);
+        }
+
+        ++idx;
+    }
+
+    return isSuccessful;
+}
+
+bool GifDecoder::readExtension()
+{
+    bool    isSuccessful    = true;
+    uint8_t label           = 0U;
+    uint8_t blockSize       = 0U;
+
+    if (false == m_reader.read(label))
+    {
+        isSuccessful = false;
+    }
+    else if (GIF_GRAPHIC_CONTROL_LABEL != label)
+    {
+        isSuccessful = skipSubBlocks();
+    }
+    else if ((false == m_reader.read(blockSize)) ||
+             (4U != blockSize))
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        uint8_t     flags           = 0U;
+        uint16_t    delay           = 0U;
+        uint8_t     transparentIdx  = 0U;
+
+        if ((false == m_reader.read(flags)) ||
+            (false == m_reader.read(delay)) ||
+            (false == m_reader.read(transparentIdx)))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            uint8_t disposal = (flags >> 2U) & 0x07U;
+
+            m_disposal          = (DISPOSAL_PREVIOUS < disposal) ? DISPOSAL_NONE : static_cast<Disposal>(disposal);
+            m_isTransparent     = (0U != (flags & GIF_FLAG_TRANSPARENT));
+            m_transparentIdx    = transparentIdx;
+
+            /* The delay is given in 1/100 s. Very short delays are
+             * interpreted like web browsers do.
+             */
+            m_delay = (1U >= delay) ? DEFAULT_DELAY : (static_cast<uint32_t>(delay) * 10U);
+
+            isSuccessful = skipSubBlocks();
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool GifDecoder::skipSubBlocks()
+{
+    bool    isSuccessful    = true;
+    uint8_t blockSize       = 0U;
+
+    do
+    {
+        if (false == m_reader.read(blockSize))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            uint8_t idx     = 0U;
+            uint8_t data    = 0U;
+
+            for(idx = 0U; (idx < blockSize) && (true == isSuccessful); ++idx)
+            {
+                isSuccessful = m_reader.read(data);
+            }
+        }
+    }
+    while((true == isSuccessful) && (0U < blockSize));
+
+    return isSuccessful;
+}
+
+void GifDecoder::disposePrevFrame()
+{
+    if (DISPOSAL_BACKGROUND == m_prevDisposal)
+    {
+        m_canvas.fillRect(m_prevX, m_prevY, m_prevWidth, m_prevHeight, Color());
+    }
+    else if ((DISPOSAL_PREVIOUS == m_prevDisposal) &&
+             (true == m_prevCanvas.isAllocated()))
+    {
+        uint16_t x = 0U;
+        uint16_t y = 0U;
+
+        for(y = m_prevY; y < (m_prevY + m_prevHeight); ++y)
+        {
+            for(x = m_prevX; x < (m_prevX + m_prevWidth); ++x)
+            {
+                m_canvas.drawPixel(x, y, m_prevCanvas.getColor(x, y));
+            }
+        }
+    }
+    else
+    {
+        /* Keep the frame. */
+        ;
+    }
+
+    m_prevDisposal = DISPOSAL_NONE;
+
+    return;
+}
+
+GifDecoder::Ret GifDecoder::readImage()
+{
+    Ret         ret     = RET_OK;
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+    uint16_t    width   = 0U;
+    uint16_t    height  = 0U;
+    uint8_t     flags   = 0U;
+
+    if ((false == m_reader.read(x)) ||
+        (false == m_reader.read(y)) ||
+        (false == m_reader.read(width)) ||
+        (false == m_reader.read(height)) ||
+        (false == m_reader.read(flags)))
+    {
+        ret = RET_FILE_FORMAT_INVALID;
+    }
+    else
+    {
+        const Color*    palette     = m_globalPalette;
+        uint16_t        paletteSize = m_globalPaletteSize;
+
+        if (0U != (flags & GIF_FLAG_COLOR_TABLE))
+        {
+            palette     = m_localPalette;
+            paletteSize = 1U << ((flags & 0x07U) + 1U);
+
+            if (false == readPalette(m_localPalette, paletteSize))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+        }
+
+        if (RET_OK == ret)
+        {
+            /* Backup the canvas, if the frame shall be undone later. */
+            if (DISPOSAL_PREVIOUS == m_disposal)
+            {
+                if (true == m_prevCanvas.create(m_canvas.getWidth(), m_canvas.getHeight()))
+                {
+                    m_prevCanvas.copy(m_canvas);
+                }
+            }
+
+            ret = decodeImageData(x, y, width, height, (0U != (flags & GIF_FLAG_INTERLACED)), palette, paletteSize);
+
+            m_prevDisposal  = m_disposal;
+            m_prevX         = x;
+            m_prevY         = y;
+            m_prevWidth     = width;
+            m_prevHeight    = height;
+        }
+    }
+
+    /* The graphic control extension is only valid for one frame. */
+    m_disposal      = DISPOSAL_NONE;
+    m_isTransparent = false;
+    m_delay         = DEFAULT_DELAY;
+
+    return ret;
+}
+
+GifDecoder::Ret GifDecoder::decodeImageData(uint16_t x, uint16_t y, uint16_t width, uint16_t height, bool isInterlaced, const Color* palette, uint16_t paletteSize)
+{
+    Ret         ret             = RET_OK;
+    uint8_t     minCodeSize     = 0U;
+    uint8_t     blockSize       = 0U;
+    uint32_t    bitBuffer       = 0U;
+    uint8_t     bitCnt          = 0U;
+    uint8_t     codeSize        = 0U;
+    uint16_t    clearCode       = 0U;
+    uint16_t    endCode         = 0U;
+    uint16_t    nextCode        = 0U;
+    uint16_t    prevCode        = LZW_NO_CODE;
+    uint8_t     firstPixel      = 0U;
+    uint32_t    pixelIdx        = 0U;
+    uint32_t    pixelCnt        = static_cast<uint32_t>(width) * height;
+    bool        isEnd           = false;
+
+    if ((false == m_reader.read(minCodeSize)) ||
+        (2U > minCodeSize) ||
+        (8U < minCodeSize))
+    {
+        ret = RET_FILE_FORMAT_INVALID;
+    }
+    else
+    {
+        clearCode   = 1U << minCodeSize;
+        endCode     = clearCode + 1U;
+        codeSize    = minCodeSize + 1U;
+        nextCode    = endCode + 1U;
+    }
+
+    while((RET_OK == ret) && (false == isEnd))
+    {
+        uint16_t code = 0U;
+
+        /* Fill the bit buffer from the data sub-blocks. */
+        while((RET_OK == ret) && (false == isEnd) && (codeSize > bitCnt))
+        {
+            uint8_t data = 0U;
+
+            if (0U == blockSize)
+            {
+                if (false == m_reader.read(blockSize))
+                {
+                    ret = RET_FILE_FORMAT_INVALID;
+                }
+                /* Block terminator before the end code. */
+                else if (0U == blockSize)
+                {
+                    isEnd = true;
+                }
+                else
+                {
+                    ;
+                }
+            }
+
+            if ((RET_OK == ret) &&
+                (false == isEnd))
+            {
+                if (false == m_reader.read(data))
+                {
+                    ret = RET_FILE_FORMAT_INVALID;
+                }
+                else
+                {
+                    bitBuffer |= static_cast<uint32_t>(data) << bitCnt;
+                    bitCnt += 8U;
+                    --blockSize;
+                }
+            }
+        }
+
+        if ((RET_OK == ret) &&
+            (false == isEnd))
+        {
+            code        = bitBuffer & ((1U << codeSize) - 1U);
+            bitBuffer >>= codeSize;
+            bitCnt      -= codeSize;
+        }
+
+        if ((RET_OK != ret) ||
+            (true == isEnd))
+        {
+            /* Nothing to decode anymore. */
+            ;
+        }
+        else if (clearCode == code)
+        {
+            codeSize    = minCodeSize + 1U;
+            nextCode    = endCode + 1U;
+            prevCode    = LZW_NO_CODE;
+        }
+        else if (endCode == code)
+        {
+            uint8_t data = 0U;
+
+            /* Skip the rest of the current and all following sub-blocks. */
+            while((0U < blockSize) && (true == m_reader.read(data)))
+            {
+                --blockSize;
+            }
+
+            if (false == skipSubBlocks())
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+
+            isEnd = true;
+        }
+        else if ((code > nextCode) ||
+                 ((LZW_NO_CODE == prevCode) && (code >= clearCode)))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else
+        {
+            uint16_t    current = code;
+            uint16_t    sp      = 0U;
+
+            /* Special case: The code is not in the table yet. */
+            if (nextCode == code)
+            {
+                m_stack[sp] = firstPixel;
+                ++sp;
+                current = prevCode;
+            }
+
+            while((clearCode <= current) && (LZW_TABLE_SIZE > sp))
+            {
+                m_stack[sp] = m_suffix[current];
+                ++sp;
+                current = m_prefix[current];
+            }
+
+            if (LZW_TABLE_SIZE <= sp)
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                m_stack[sp] = static_cast<uint8_t>(current);
+                ++sp;
+                firstPixel = static_cast<uint8_t>(current);
+
+                /* Add new table entry. */
+                if ((LZW_NO_CODE != prevCode) &&
+                    (LZW_TABLE_SIZE > nextCode))
+                {
+                    m_prefix[nextCode] = prevCode;
+                    m_suffix[nextCode] = firstPixel;
+                    ++nextCode;
+
+                    if (((1U << codeSize) == nextCode) &&
+                        (LZW_MAX_CODE_SIZE > codeSize))
+                    {
+                        ++codeSize;
+                    }
+                }
+
+                prevCode = code;
+
+                /* Write pixels in the right order. */
+                while((0U < sp) && (pixelCnt > pixelIdx))
+                {
+                    uint8_t colorIdx = m_stack[sp - 1U];
+
+                    if (((false == m_isTransparent) || (m_transparentIdx != colorIdx)) &&
+                        (paletteSize > colorIdx))
+                    {
+                        uint16_t row = pixelIdx / width;
+
+                        if (true == isInterlaced)
+                        {
+                            row = getInterlacedRow(row, height);
+                        }
+
+                        m_canvas.drawPixel(x + (pixelIdx % width), y + row, palette[colorIdx]);
+                    }
+
+                    --sp;
+                    ++pixelIdx;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+void GifDecoder::rewind()
+{
+    (void)m_fd.seek(m_firstFramePos);
+    m_reader.reset();
+
+    m_canvas.fillScreen(Color());
+    m_frameCnt      = 0U;
+    m_disposal      = DISPOSAL_NONE;
+    m_isTransparent = false;
+    m_delay         = DEFAULT_DELAY;
+    m_prevDisposal  = DISPOSAL_NONE;
+
+    return;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the canvas row of a interlaced frame row.
+ * Interlaced rows are stored in 4 passes: every 8th row starting with row 0,
+ * every 8th row starting with row 4, every 4th row starting with row 2 and
+ * every 2nd row starting with row 1.
+ *
+ * @param[in] row       Row in the order of the image data
+ * @param[in] height    Frame height
+ *
+ * @return Row in the frame
+ */
+static uint16_t getInterlacedRow(uint16_t row, uint16_t height)
+{
+    uint16_t    pass1Rows   = (height + 7U) / 8U;
+    uint16_t    pass2Rows   = (height + 3U) / 8U;
+    uint16_t    pass3Rows   = (height + 1U) / 4U;
+    uint16_t    frameRow    = 0U;
+
+    if (pass1Rows > row)
+    {
+        frameRow = row * 8U;
+    }
+    else if ((pass1Rows + pass2Rows) > row)
+    {
+        frameRow = 4U + (row - pass1Rows) * 8U;
+    }
+    else if ((pass1Rows + pass2Rows + pass3Rows) > row)
+    {
+        frameRow = 2U + (row - pass1Rows - pass2Rows) * 4U;
+    }
+    else
+    {
+        frameRow = 1U + (row - pass1Rows - pass2Rows - pass3Rows) * 2U;
+    }
+
+    return frameRow;
+}
@@ -0,0 +1,282 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  GIF decoder
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __GIF_DECODER_H__
+#define __GIF_DECODER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+#include <FS.h>
+
+#include "BufferedFileReader.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Streaming GIF decoder.
+ *
+ * The file stays open and the frames are decoded one by one into a canvas
+ * with the logical screen size. Only the LZW tables, the color palettes and
+ * the canvas are kept in memory, independent of the number of frames.
+ * After the last frame, the animation starts again with the first one.
+ */
+class GifDecoder
+{
+public:
+
+    /**
+     * Constructs a decoder without a opened file.
+     */
+    GifDecoder() :
+        m_fd(),
+        m_reader(m_fd),
+        m_canvas(),
+        m_prevCanvas(),
+        m_globalPalette(nullptr),
+        m_globalPaletteSize(0U),
+        m_localPalette(nullptr),
+        m_prefix(nullptr),
+        m_suffix(nullptr),
+        m_stack(nullptr),
+        m_firstFramePos(0U),
+        m_frameCnt(0U),
+        m_disposal(DISPOSAL_NONE),
+        m_isTransparent(false),
+        m_transparentIdx(0U),
+        m_delay(0U),
+        m_prevDisposal(DISPOSAL_NONE),
+        m_prevX(0U),
+        m_prevY(0U),
+        m_prevWidth(0U),
+        m_prevHeight(0U)
+    {
+    }
+
+    /**
+     * Destroys the decoder and closes the file.
+     */
+    ~GifDecoder()
+    {
+        close();
+    }
+
+    /**
+     * Possible return values with more information.
+     */
+    enum Ret
+    {
+        RET_OK = 0,                     /**< Successful */
+        RET_FILE_NOT_FOUND,             /**< File not found. */
+        RET_FILE_FORMAT_INVALID,        /**< Invalid file format. */
+        RET_FILE_FORMAT_UNSUPPORTED,    /**< File format is not supported. */
+        RET_IMG_TOO_BIG                 /**< Image size is too big. */
+    };
+
+    /** File extension of a GIF image. */
+    static const char*  FILE_EXT;
+
+    /** Frame delay in ms, which is used if the image specifies none. */
+    static const uint32_t   DEFAULT_DELAY   = 100U;
+
+    /**
+     * Open a GIF image. The first frame is not decoded yet.
+     *
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret open(FS& fs, const String& fileName);
+
+    /**
+     * Close the GIF image and release all resources.
+     */
+    void close();
+
+    /**
+     * Is a GIF image opened?
+     *
+     * @return If opened, it will return true otherwise false.
+     */
+    bool isOpen() const
+    {
+        return (nullptr != m_prefix);
+    }
+
+    /**
+     * Decode the next frame into the canvas.
+     * After the last frame, it continues with the first one.
+     *
+     * @param[out] delay    Time in ms, how long the frame shall be shown.
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret nextFrame(uint32_t& delay);
+
+    /**
+     * Get the canvas with the current frame.
+     *
+     * @return Canvas
+     */
+    const YAGfxBitmap& getCanvas() const
+    {
+        return m_canvas;
+    }
+
+private:
+
+    /**
+     * Disposal methods, which define what happens with a frame after it was shown.
+     */
+    enum Disposal
+    {
+        DISPOSAL_NONE = 0,      /**< No disposal specified. */
+        DISPOSAL_KEEP,          /**< Keep the frame. */
+        DISPOSAL_BACKGROUND,    /**< Restore the frame area to the background. */
+        DISPOSAL_PREVIOUS       /**< Restore the frame area to the previous content. */
+    };
+
+    /** Max. number of colors in a palette. */
+    static const uint16_t   MAX_PALETTE_SIZE    = 256U;
+
+    /** Max. LZW code size in bit. */
+    static const uint8_t    LZW_MAX_CODE_SIZE   = 12U;
+
+    /** Max. number of LZW table entries. */
+    static const uint16_t   LZW_TABLE_SIZE      = 1U << LZW_MAX_CODE_SIZE;
+
+    File                m_fd;                   /**< File descriptor */
+    BufferedFileReader  m_reader;               /**< Buffered reader of the file */
+    YAGfxDynamicBitmap  m_canvas;               /**< Canvas with the logical screen size, contains the current frame. */
+    YAGfxDynamicBitmap  m_prevCanvas;           /**< Canvas backup, only used by frames with disposal method "restore previous". */
+    Color*              m_globalPalette;        /**< Global color palette */
+    uint16_t            m_globalPaletteSize;    /**< Number of global color palette entries */
+    Color*              m_localPalette;         /**< Local color palette of the current frame */
+    uint16_t*           m_prefix;               /**< LZW table: prefix code of every entry */
+    uint8_t*            m_suffix;               /**< LZW table: last pixel of every entry */
+    uint8_t*            m_stack;                /**< LZW output stack, used to reverse a decoded entry */
+    uint32_t            m_firstFramePos;        /**< File position of the first block after the global color palette */
+    uint32_t            m_frameCnt;             /**< Number of frames, decoded since the first frame */
+    Disposal            m_disposal;             /**< Disposal method of the next frame */
+    bool                m_isTransparent;        /**< Has the next frame a transparent color? */
+    uint8_t             m_transparentIdx;       /**< Transparent color index of the next frame */
+    uint32_t            m_delay;                /**< Delay in ms of the next frame */
+    Disposal            m_prevDisposal;         /**< Disposal method of the previous frame */
+    uint16_t            m_prevX;                /**< x-coordinate of the previous frame */
+    uint16_t            m_prevY;                /**< y-coordinate of the previous frame */
+    uint16_t            m_prevWidth;            /**< Width of the previous frame */
+    uint16_t            m_prevHeight;           /**< Height of the previous frame */
+
+    GifDecoder(const GifDecoder& decoder);
+    GifDecoder& operator=(const GifDecoder& decoder);
+
+    /**
+     * Read the color palette.
+     *
+     * @param[out] palette      Color palette
+     * @param[in]  paletteSize  Number of color palette entries
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readPalette(Color* palette, uint16_t paletteSize);
+
+    /**
+     * Read a extension block. Only the graphic control extension is
+     * evaluated, all others are skipped.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool readExtension();
+
+    /**
+     * Skip data sub-blocks until the block terminator.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool skipSubBlocks();
+
+    /**
+     * Restore the area of the previous frame according to its disposal method.
+     */
+    void disposePrevFrame();
+
+    /**
+     * Read the image descriptor and decode the image data into the canvas.
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret readImage();
+
+    /**
+     * Decode the LZW compressed image data into the canvas.
+     *
+     * @param[in] x             x-coordinate of the frame in the canvas
+     * @param[in] y             y-coordinate of the frame in the canvas
+     * @param[in] width         Frame width
+     * @param[in] height        Frame height
+     * @param[in] isInterlaced  Are the frame rows interlaced?
+     * @param[in] palette       Color palette
+     * @param[in] paletteSize   Number of color palette entries
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret decodeImageData(uint16_t x, uint16_t y, uint16_t width, uint16_t height, bool isInterlaced, const Color* palette, uint16_t paletteSize);
+
+    /**
+     * Restart with the first frame.
+     */
+    void rewind();
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __GIF_DECODER_H__ */
+
+/** @} */
@@ -0,0 +1,157 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  GIF Widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GifWidget.h"
+
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize GIF widget type. */
+const char* GifWidget::WIDGET_TYPE = "gif";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool GifWidget::load(FS& fs, const String& filename)
+{
+    bool            isSuccessful    = false;
+    GifDecoder::Ret ret             = m_decoder.open(fs, filename);
+
+    m_timer.stop();
+
+    if (GifDecoder::RET_OK == ret)
+    {
+        ret = m_decoder.nextFrame(m_delay);
+    }
+
+    if (GifDecoder::RET_OK != ret)
+    {
+        if (GifDecoder::RET_FILE_NOT_FOUND == ret)
+        {
+            LOG_ERROR("Failed to open file %s.", filename.c_str());
+        }
+        else if (GifDecoder::RET_FILE_FORMAT_INVALID == ret)
+        {
+            LOG_ERROR("File %s has invalid format.", filename.c_str());
+        }
+        else if (GifDecoder::RET_FILE_FORMAT_UNSUPPORTED == ret)
+        {
+            LOG_ERROR("File %s has unsupported format.", filename.c_str());
+        }
+        else if (GifDecoder::RET_IMG_TOO_BIG == ret)
+        {
+            LOG_ERROR("File %s is too big.", filename.c_str());
+        }
+        else
+        {
+            LOG_ERROR("Failed to load %s because of internal error.", filename.c_str());
+        }
+
+        m_decoder.close();
+    }
+    else
+    {
+        m_timer.start(m_delay);
+        invalidate();
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void GifWidget::paint(YAGfx& gfx)
+{
+    if (true == m_decoder.isOpen())
+    {
+        /* If the current frame was shown long enough, decode the next one. */
+        if ((true == m_timer.isTimerRunning()) &&
+            (true == m_timer.isTimeout()))
+        {
+            if (GifDecoder::RET_OK != m_decoder.nextFrame(m_delay))
+            {
+                LOG_ERROR("Failed to decode GIF frame.");
+                clear();
+            }
+            else
+            {
+                m_timer.start(m_delay);
+            }
+        }
+
+        if (true == m_decoder.isOpen())
+        {
+            gfx.drawBitmap(m_posX, m_posY, m_decoder.getCanvas());
+        }
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  GIF Widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __GIFWIDGET_H__
+#define __GIFWIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <FS.h>
+#include <SimpleTimer.hpp>
+
+#include "Widget.hpp"
+#include "GifDecoder.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * GIF widget, which plays a animated GIF image.
+ * The frames are decoded one by one from the filesystem, therefore only
+ * the current frame is kept in memory.
+ */
+class GifWidget : public Widget
+{
+public:
+
+    /**
+     * Constructs a GIF widget, which is empty.
+     */
+    GifWidget() :
+        Widget(WIDGET_TYPE),
+        m_decoder(),
+        m_timer(),
+        m_delay(0U)
+    {
+    }
+
+    /**
+     * Destroys the GIF widget.
+     */
+    ~GifWidget()
+    {
+    }
+
+    /**
+     * Load GIF image from filesystem. The first frame is shown immediately.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] filename  Filename with full path
+     *
+     * @return If successful loaded it will return true otherwise false.
+     */
+    bool load(FS& fs, const String& filename);
+
+    /**
+     * Close the GIF image and release all resources.
+     */
+    void clear()
+    {
+        m_decoder.close();
+        m_timer.stop();
+        invalidate();
+    }
+
+    /**
+     * Is a GIF image loaded?
+     *
+     * @return If no image is loaded, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (false == m_decoder.isOpen());
+    }
+
+    /**
+     * Get the current frame.
+     *
+     * @return Frame bitmap
+     */
+    const YAGfxBitmap& getFrame() const
+    {
+        return m_decoder.getCanvas();
+    }
+
+    /**
+     * Is the widget dirty and needs to be repainted?
+     * A loaded GIF image is animated and needs to be repainted continuously.
+     *
+     * @return If the widget needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const override
+    {
+        return ((true == Widget::isDirty()) ||
+                ((true == m_isEnabled) && (true == m_decoder.isOpen())));
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the current frame.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a GIF widget is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, getFrame().getWidth(), getFrame().getHeight());
+
+        return true;
+    }
+
+    /** Widget type string */
+    static const char* WIDGET_TYPE;
+
+private:
+
+    GifDecoder  m_decoder;  /**< GIF decoder, which provides the current frame. */
+    SimpleTimer m_timer;    /**< Timer used to show a frame for its delay. */
+    uint32_t    m_delay;    /**< Delay in ms of the current frame. */
+
+    /* The decoder owns a opened file, therefore it can not be copied. */
+    GifWidget(const GifWidget& widget);
+    GifWidget& operator=(const GifWidget& widget);
+
+    /**
+     * Paint the widget with the given graphics interface.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paint(YAGfx& gfx) override;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __GIFWIDGET_H__ */
+
+/** @} */
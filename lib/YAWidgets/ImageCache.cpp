@@ -0,0 +1,507 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Image cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ImageCache.h"
+#include "BmpImgLoader.h"
+#include "PackedImgLoader.h"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Image cache entry.
+ */
+struct ImageCacheEntry
+{
+    String              fileName;   /**< Name of the image file */
+    time_t              lastWrite;  /**< Time of last modification of the image file */
+    YAGfxDynamicBitmap  bitmap;     /**< Image */
+    uint32_t            refCnt;     /**< Number of references */
+    uint32_t            lastUse;    /**< Use counter value of the last access */
+    bool                isValid;    /**< If the file was changed, the entry is not valid anymore. */
+
+    /**
+     * Constructs a empty entry.
+     */
+    ImageCacheEntry() :
+        fileName(),
+        lastWrite(0),
+        bitmap(),
+        refCnt(0U),
+        lastUse(0U),
+        isValid(true)
+    {
+    }
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static size_t getBitmapSize(const YAGfxBitmap& bitmap);
+static ImageCache::Ret toRet(BmpImgLoader::Ret ret);
+static ImageCache::Ret toRet(PackedImgLoader::Ret ret);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Empty bitmap, returned by a empty shared bitmap. */
+static const YAGfxDynamicBitmap gEmptyBitmap;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+SharedBitmap::SharedBitmap(const SharedBitmap& bitmap) :
+    m_entry(bitmap.m_entry)
+{
+    if (nullptr != m_entry)
+    {
+        ImageCache::getInstance().addRef(m_entry);
+    }
+}
+
+SharedBitmap& SharedBitmap::operator=(const SharedBitmap& bitmap)
+{
+    if ((&bitmap != this) &&
+        (bitmap.m_entry != m_entry))
+    {
+        release();
+
+        m_entry = bitmap.m_entry;
+
+        if (nullptr != m_entry)
+        {
+            ImageCache::getInstance().addRef(m_entry);
+        }
+    }
+
+    return *this;
+}
+
+const YAGfxBitmap& SharedBitmap::get() const
+{
+    const YAGfxBitmap* bitmap = &gEmptyBitmap;
+
+    if (nullptr != m_entry)
+    {
+        bitmap = &m_entry->bitmap;
+    }
+
+    return *bitmap;
+}
+
+void SharedBitmap::release()
+{
+    if (nullptr != m_entry)
+    {
+        ImageCache::getInstance().releaseRef(m_entry);
+        m_entry = nullptr;
+    }
+}
+
+ImageCache::Ret ImageCache::load(FS& fs, const String& fileName, SharedBitmap& bitmap)
+{
+    Ret                 ret         = RET_OK;
+    File                fd          = fs.open(fileName);
+    time_t              lastWrite   = 0;
+    ImageCacheEntry*    entry       = nullptr;
+
+    if (false == fd)
+    {
+        ret = RET_FILE_NOT_FOUND;
+    }
+    else
+    {
+        lastWrite = fd.getLastWrite();
+        fd.close();
+
+        {
+            MutexGuard<Mutex> guard(m_mutex);
+
+            entry = find(fileName, lastWrite);
+
+            if (nullptr != entry)
+            {
+                ++entry->refCnt;
+            }
+        }
+
+        /* Not cached yet? The file is loaded without holding the mutex,
+         * because it takes some time.
+         */
+        if (nullptr == entry)
+        {
+            ImageCacheEntry* newEntry = new(std::nothrow) ImageCacheEntry();
+
+            if (nullptr == newEntry)
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            else
+            {
+                if (0U != fileName.endsWith(PackedImgLoader::FILE_EXT))
+                {
+                    PackedImgLoader loader;
+
+                    ret = toRet(loader.load(fs, fileName, newEntry->bitmap));
+                }
+                else
+                {
+                    BmpImgLoader loader;
+
+                    ret = toRet(loader.load(fs, fileName, newEntry->bitmap));
+                }
+
+                if (RET_OK != ret)
+                {
+                    delete newEntry;
+                }
+                else
+                {
+                    MutexGuard<Mutex> guard(m_mutex);
+
+                    /* Maybe it was loaded in the meantime by someone else. */
+                    entry = find(fileName, lastWrite);
+
+                    if (nullptr != entry)
+                    {
+                        delete newEntry;
+                    }
+                    else if (false == m_entries.append(newEntry))
+                    {
+                        delete newEntry;
+                        ret = RET_IMG_TOO_BIG;
+                    }
+                    else
+                    {
+                        entry               = newEntry;
+                        entry->fileName     = fileName;
+                        entry->lastWrite    = lastWrite;
+                        m_size             += getBitmapSize(entry->bitmap);
+                    }
+
+                    if (nullptr != entry)
+                    {
+                        ++entry->refCnt;
+                    }
+
+                    /* Keep the memory budget. */
+                    evict();
+                }
+            }
+        }
+    }
+
+    if (nullptr != entry)
+    {
+        /* The reference count was already increased. */
+        bitmap.release();
+        bitmap.m_entry = entry;
+    }
+
+    return ret;
+}
+
+void ImageCache::invalidate(const String& fileName)
+{
+    MutexGuard<Mutex>                       guard(m_mutex);
+    DLinkedListIterator<ImageCacheEntry*>   it(m_entries);
+
+    if (true == it.first())
+    {
+        do
+        {
+            ImageCacheEntry* entry = *it.current();
+
+            if (fileName == entry->fileName)
+            {
+                entry->isValid = false;
+            }
+        }
+        while(true == it.next());
+    }
+
+    evict();
+
+    return;
+}
+
+void ImageCache::setBudget(size_t budget)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    m_budget = budget;
+    evict();
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void ImageCache::addRef(ImageCacheEntry* entry)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    ++entry->refCnt;
+
+    return;
+}
+
+void ImageCache::releaseRef(ImageCacheEntry* entry)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    if (0U < entry->refCnt)
+    {
+        --entry->refCnt;
+    }
+
+    if (0U == entry->refCnt)
+    {
+        evict();
+    }
+
+    return;
+}
+
+ImageCacheEntry* ImageCache::find(const String& fileName, time_t lastWrite)
+{
+    ImageCacheEntry*                        entry   = nullptr;
+    DLinkedListIterator<ImageCacheEntry*>   it(m_entries);
+
+    if (true == it.first())
+    {
+        do
+        {
+            ImageCacheEntry* current = *it.current();
+
+            if ((true == current->isValid) &&
+                (lastWrite == current->lastWrite) &&
+                (fileName == current->fileName))
+            {
+                entry = current;
+            }
+        }
+        while((nullptr == entry) && (true == it.next()));
+    }
+
+    if (nullptr != entry)
+    {
+        ++m_useCounter;
+        entry->lastUse = m_useCounter;
+    }
+
+    return entry;
+}
+
+void ImageCache::evict()
+{
+    ImageCacheEntry* candidate = nullptr;
+
+    do
+    {
+        DLinkedListIterator<ImageCacheEntry*> it(m_entries);
+
+        candidate = nullptr;
+
+        if (true == it.first())
+        {
+            do
+            {
+                ImageCacheEntry* entry = *it.current();
+
+                if (0U == entry->refCnt)
+                {
+                    /* Invalid entries are removed first. */
+                    if (false == entry->isValid)
+                    {
+                        candidate = entry;
+                    }
+                    /* Least recently used one, only if the budget is exceeded. */
+                    else if ((m_budget < m_size) &&
+                             ((nullptr == candidate) || (entry->lastUse < candidate->lastUse)))
+                    {
+                        candidate = entry;
+                    }
+                    else
+                    {
+                        ;
+                    }
+                }
+            }
+            while(((nullptr == candidate) || (true == candidate->isValid)) && (true == it.next()));
+        }
+
+        if (nullptr != candidate)
+        {
+            remove(candidate);
+        }
+    }
+    while(nullptr != candidate);
+
+    return;
+}
+
+void ImageCache::remove(ImageCacheEntry* entry)
+{
+    DLinkedListIterator<ImageCacheEntry*> it(m_entries);
+
+    if (true == it.find(entry))
+    {
+        it.remove();
+    }
+
+    m_size -= getBitmapSize(entry->bitmap);
+    delete entry;
+
+    return;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the memory size of a bitmap.
+ *
+ * @param[in] bitmap    Bitmap
+ *
+ * @return Memory size in byte
+ */
+static size_t getBitmapSize(const YAGfxBitmap& bitmap)
+{
+    return static_cast<size_t>(bitmap.getWidth()) * bitmap.getHeight() * sizeof(Color);
+}
+
+/**
+ * Convert the bitmap image loader result to the image cache result.
+ *
+ * @param[in] ret   Bitmap image loader result
+ *
+ * @return Image cache result
+ */
+static ImageCache::Ret toRet(BmpImgLoader::Ret ret)
+{
+    ImageCache::Ret cacheRet = ImageCache::RET_FILE_FORMAT_INVALID;
+
+    switch(ret)
+    {
+    case BmpImgLoader::RET_OK:
+        cacheRet = ImageCache::RET_OK;
+        break;
+
+    case BmpImgLoader::RET_FILE_NOT_FOUND:
+        cacheRet = ImageCache::RET_FILE_NOT_FOUND;
+        break;
+
+    case BmpImgLoader::RET_FILE_FORMAT_UNSUPPORTED:
+        cacheRet = ImageCache::RET_FILE_FORMAT_UNSUPPORTED;
+        break;
+
+    case BmpImgLoader::RET_IMG_TOO_BIG:
+        cacheRet = ImageCache::RET_IMG_TOO_BIG;
+        break;
+
+    case BmpImgLoader::RET_FILE_FORMAT_INVALID:
+        /* fallthrough */
+    default:
+        cacheRet = ImageCache::RET_FILE_FORMAT_INVALID;
+        break;
+    }
+
+    return cacheRet;
+}
+
+/**
+ * Convert the packed image loader result to the image cache result.
+ *
+ * @param[in] ret   Packed image loader result
+ *
+ * @return Image cache result
+ */
+static ImageCache::Ret toRet(PackedImgLoader::Ret ret)
+{
+    ImageCache::Ret cacheRet = ImageCache::RET_FILE_FORMAT_INVALID;
+
+    switch(ret)
+    {
+    case PackedImgLoader::RET_OK:
+        cacheRet = ImageCache::RET_OK;
+        break;
+
+    case PackedImgLoader::RET_FILE_NOT_FOUND:
+        cacheRet = ImageCache::RET_FILE_NOT_FOUND;
+        break;
+
+    case PackedImgLoader::RET_FILE_FORMAT_UNSUPPORTED:
+        cacheRet = ImageCache::RET_FILE_FORMAT_UNSUPPORTED;
+        break;
+
+    case PackedImgLoader::RET_IMG_TOO_BIG:
+        cacheRet = ImageCache::RET_IMG_TOO_BIG;
+        break;
+
+    case PackedImgLoader::RET_FILE_FORMAT_INVALID:
+        /* fallthrough */
+    default:
+        cacheRet = ImageCache::RET_FILE_FORMAT_INVALID;
+        break;
+    }
+
+    return cacheRet;
+}
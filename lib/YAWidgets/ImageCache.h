@@ -0,0 +1,311 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Image cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __IMAGE_CACHE_H__
+#define __IMAGE_CACHE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <time.h>
+#include <FS.h>
+#include <YAGfxBitmap.h>
+#include <LinkedList.hpp>
+#include <Mutex.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+struct ImageCacheEntry;
+
+/**
+ * Shared immutable bitmap, handed out by the image cache.
+ * Every copy references the same bitmap. The bitmap stays in memory,
+ * as long as it is referenced.
+ */
+class SharedBitmap
+{
+public:
+
+    /**
+     * Constructs a empty shared bitmap.
+     */
+    SharedBitmap() :
+        m_entry(nullptr)
+    {
+    }
+
+    /**
+     * Constructs a shared bitmap, which references the same bitmap.
+     *
+     * @param[in] bitmap    Shared bitmap, which to copy.
+     */
+    SharedBitmap(const SharedBitmap& bitmap);
+
+    /**
+     * Destroys the shared bitmap and releases the reference.
+     */
+    ~SharedBitmap()
+    {
+        release();
+    }
+
+    /**
+     * Assigns a shared bitmap, which references the same bitmap.
+     *
+     * @param[in] bitmap    Shared bitmap, which to assign.
+     *
+     * @return Shared bitmap
+     */
+    SharedBitmap& operator=(const SharedBitmap& bitmap);
+
+    /**
+     * Is the shared bitmap empty?
+     *
+     * @return If no bitmap is referenced, it will return true otherwise false.
+     */
+    bool isEmpty() const
+    {
+        return (nullptr == m_entry);
+    }
+
+    /**
+     * Get the bitmap. If empty, a bitmap with size 0 is returned.
+     *
+     * @return Bitmap
+     */
+    const YAGfxBitmap& get() const;
+
+    /**
+     * Release the reference.
+     */
+    void release();
+
+private:
+
+    friend class ImageCache;
+
+    ImageCacheEntry*    m_entry;    /**< Referenced cache entry */
+};
+
+/**
+ * Image cache, which shares loaded images between all users.
+ *
+ * The images are identified by filename and time of last modification.
+ * Images, which are not referenced anymore, stay in the cache until the
+ * memory budget is exceeded. Then the least recently used ones are
+ * removed first.
+ */
+class ImageCache
+{
+public:
+
+    /**
+     * Get image cache instance.
+     *
+     * @return Image cache instance
+     */
+    static ImageCache& getInstance()
+    {
+        static ImageCache instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Possible return values with more information.
+     */
+    enum Ret
+    {
+        RET_OK = 0,                     /**< Successful */
+        RET_FILE_NOT_FOUND,             /**< File not found. */
+        RET_FILE_FORMAT_INVALID,        /**< Invalid file format. */
+        RET_FILE_FORMAT_UNSUPPORTED,    /**< File format is not supported. */
+        RET_IMG_TOO_BIG                 /**< Image size is too big. */
+    };
+
+    /** Default memory budget in byte. */
+    static const size_t DEFAULT_BUDGET  = 8U * 1024U;
+
+    /**
+     * Load a image from the cache or if not cached, from the filesystem.
+     * Supported are bitmap (.bmp) and packed (.pim) images.
+     *
+     * @param[in]   fs          Filesystem
+     * @param[in]   fileName    Name of the file
+     * @param[out]  bitmap      Shared bitmap
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret load(FS& fs, const String& fileName, SharedBitmap& bitmap);
+
+    /**
+     * Invalidate a cached image, e.g. after the file was overwritten.
+     * If it is still referenced, the users keep the old image until
+     * they release it.
+     *
+     * @param[in] fileName  Name of the file
+     */
+    void invalidate(const String& fileName);
+
+    /**
+     * Set the memory budget. Unreferenced images are removed until the
+     * budget is kept.
+     *
+     * @param[in] budget    Memory budget in byte
+     */
+    void setBudget(size_t budget);
+
+    /**
+     * Get the memory budget.
+     *
+     * @return Memory budget in byte
+     */
+    size_t getBudget() const
+    {
+        return m_budget;
+    }
+
+    /**
+     * Get the memory used by the cached images.
+     *
+     * @return Used memory in byte
+     */
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Get the number of cached images.
+     *
+     * @return Number of cached images
+     */
+    uint32_t getCount() const
+    {
+        return m_entries.getNumOfElements();
+    }
+
+private:
+
+    friend class SharedBitmap;
+
+    DLinkedList<ImageCacheEntry*>   m_entries;      /**< Cached images */
+    size_t                          m_budget;       /**< Memory budget in byte */
+    size_t                          m_size;         /**< Memory used by the cached images in byte */
+    uint32_t                        m_useCounter;   /**< Incremented by every access, used to find the least recently used image. */
+    mutable Mutex                   m_mutex;        /**< Mutex to protect against concurrent access. */
+
+    /**
+     * Constructs the image cache.
+     */
+    ImageCache() :
+        m_entries(),
+        m_budget(DEFAULT_BUDGET),
+        m_size(0U),
+        m_useCounter(0U),
+        m_mutex()
+    {
+        (void)m_mutex.create();
+    }
+
+    /**
+     * Destroys the image cache.
+     */
+    ~ImageCache()
+    {
+        /* Will never be called. */
+    }
+
+    ImageCache(const ImageCache& cache);
+    ImageCache& operator=(const ImageCache& cache);
+
+    /**
+     * Add a reference to a cache entry.
+     *
+     * @param[in] entry Cache entry
+     */
+    void addRef(ImageCacheEntry* entry);
+
+    /**
+     * Remove a reference from a cache entry.
+     *
+     * @param[in] entry Cache entry
+     */
+    void releaseRef(ImageCacheEntry* entry);
+
+    /**
+     * Find a valid cache entry.
+     *
+     * @param[in] fileName  Name of the file
+     * @param[in] lastWrite Time of last modification of the file
+     *
+     * @return If found, it will return the cache entry otherwise nullptr.
+     */
+    ImageCacheEntry* find(const String& fileName, time_t lastWrite);
+
+    /**
+     * Remove unreferenced and invalid cache entries. Further the least
+     * recently used unreferenced entries are removed until the memory
+     * budget is kept.
+     */
+    void evict();
+
+    /**
+     * Remove a cache entry and destroy it.
+     *
+     * @param[in] entry Cache entry
+     */
+    void remove(ImageCacheEntry* entry);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __IMAGE_CACHE_H__ */
+
+/** @} */
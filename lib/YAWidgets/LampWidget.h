@@ -139,7 +139,11 @@ public:
      */
     void setOnState(bool state)
     {
-        m_isOn = state;
+        if (state != m_isOn)
+        {
+            m_isOn = state;
+            invalidate();
+        }
 
         return;
     }
@@ -162,6 +166,7 @@ public:
     void setColorOff(const Color& color)
     {
         m_colorOff = color;
+        invalidate();
 
         return;
     }
@@ -184,6 +189,7 @@ public:
     void setColorOn(const Color& color)
     {
         m_colorOn = color;
+        invalidate();
 
         return;
     }
@@ -206,6 +212,7 @@ public:
     void setWidth(uint16_t width)
     {
         m_width = width;
+        invalidate();
 
         return;
     }
@@ -220,6 +227,20 @@ public:
         return m_width;
     }
 
+    /**
+     * Get the region in the canvas, which is covered by the lamp.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a lamp is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, m_width, HEIGHT);
+
+        return true;
+    }
+
     /** Widget type string */
     static const char*      WIDGET_TYPE;
 
@@ -0,0 +1,492 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Packed image loader
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PackedImgLoader.h"
+#include "BmpImgLoader.h"
+#include "BufferedFileReader.hpp"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static Color colorFrom565(uint16_t value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize file extension. */
+const char* PackedImgLoader::FILE_EXT   = ".pim";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+PackedImgLoader::Ret PackedImgLoader::load(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap)
+{
+    Ret     ret = RET_OK;
+    File    fd  = fs.open(fileName);
+
+    if (false == fd)
+    {
+        ret = RET_FILE_NOT_FOUND;
+    }
+    else
+    {
+        PackedImgHeader header;
+        Color*          palette = nullptr;
+
+        if (sizeof(header) != fd.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if (PACKED_IMG_SIGNATURE != header.signature)
+        {
+            ret = RET_FILE_FORMAT_UNSUPPORTED;
+        }
+        else if (((PACKED_IMG_FORMAT_RGB565 != header.format) && (PACKED_IMG_FORMAT_PALETTE8 != header.format)) ||
+                 (MAX_PALETTE_SIZE < header.paletteSize))
+        {
+            ret = RET_FILE_FORMAT_UNSUPPORTED;
+        }
+        else
+        {
+            bitmap.release();
+
+            if (0U < header.paletteSize)
+            {
+                palette = new(std::nothrow) Color[header.paletteSize];
+            }
+
+            if ((0U < header.paletteSize) &&
+                (nullptr == palette))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            else if (false == bitmap.create(header.width, header.height))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            else
+            {
+                BufferedFileReader  reader(fd);
+                uint16_t            idx         = 0U;
+                uint32_t            pixelIdx    = 0U;
+                uint32_t            pixelCnt    = static_cast<uint32_t>(header.width) * header.height;
+                bool                isRle       = (0U != (header.flags & PACKED_IMG_FLAG_RLE));
+
+                /* Color palette */
+                while((header.paletteSize > idx) && (RET_OK == ret))
+                {
+                    uint8_t red     = 0U;
+                    uint8_t green   = 0U;
+                    uint8_t blue    = 0U;
+
+                    if ((false == reader.read(red)) ||
+                        (false == reader.read(green)) ||
+                        (false == reader.read(blue)))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+                    else
+                    {
+                        palette[idx].set(red, green, blue);
+                    }
+
+                    ++idx;
+                }
+
+                /* Pixel data */
+                while((pixelCnt > pixelIdx) && (RET_OK == ret))
+                {
+                    uint8_t     count           = 1U;
+                    uint16_t    value           = 0U;
+                    uint8_t     index           = 0U;
+                    bool        isSuccessful    = true;
+
+                    if (true == isRle)
+                    {
+                        isSuccessful = reader.read(count);
+                    }
+
+                    if (true == isSuccessful)
+                    {
+                        if (PACKED_IMG_FORMAT_RGB565 == header.format)
+                        {
+                            isSuccessful = reader.read(value);
+                        }
+                        else
+                        {
+                            isSuccessful    = reader.read(index);
+                            value           = index;
+                        }
+                    }
+
+                    if ((false == isSuccessful) ||
+                        (0U == count))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+                    else
+                    {
+                        Color color;
+
+                        if (PACKED_IMG_FORMAT_RGB565 == header.format)
+                        {
+                            color = colorFrom565(value);
+                        }
+                        else if (header.paletteSize > value)
+                        {
+                            color = palette[value];
+                        }
+                        else
+                        {
+                            ;
+                        }
+
+                        while((0U < count) && (pixelCnt > pixelIdx))
+                        {
+                            bitmap.drawPixel(pixelIdx % header.width, pixelIdx / header.width, color);
+
+                            ++pixelIdx;
+                            --count;
+                        }
+                    }
+                }
+            }
+
+            delete[] palette;
+        }
+
+        fd.close();
+    }
+
+    if (RET_OK != ret)
+    {
+        bitmap.release();
+    }
+
+    return ret;
+}
+
+PackedImgLoader::Ret PackedImgLoader::save(FS& fs, const String& fileName, const YAGfxBitmap& bitmap, bool isRleAllowed)
+{
+    Ret     ret     = RET_OK;
+    Color*  palette = new(std::nothrow) Color[MAX_PALETTE_SIZE];
+
+    if (nullptr == palette)
+    {
+        ret = RET_IMG_TOO_BIG;
+    }
+    else
+    {
+        PackedImgHeader header;
+        uint16_t        paletteSize = 0U;
+        const Color*    usedPalette = nullptr;
+        uint32_t        rawSize     = 0U;
+        uint32_t        rleSize     = 0U;
+        bool            isRle       = false;
+
+        if (true == createPalette(bitmap, palette, paletteSize))
+        {
+            usedPalette = palette;
+        }
+        else
+        {
+            paletteSize = 0U;
+        }
+
+        /* Determine the pixel data size with and without run length encoding. */
+        (void)writePixels(nullptr, bitmap, usedPalette, paletteSize, false, rawSize);
+
+        if (true == isRleAllowed)
+        {
+            (void)writePixels(nullptr, bitmap, usedPalette, paletteSize, true, rleSize);
+
+            if (rawSize > rleSize)
+            {
+                isRle = true;
+            }
+        }
+
+        header.signature    = PACKED_IMG_SIGNATURE;
+        header.width        = bitmap.getWidth();
+        header.height       = bitmap.getHeight();
+        header.format       = (nullptr != usedPalette) ? PACKED_IMG_FORMAT_PALETTE8 : PACKED_IMG_FORMAT_RGB565;
+        header.flags        = (true == isRle) ? PACKED_IMG_FLAG_RLE : 0U;
+        header.paletteSize  = paletteSize;
+        header.dataSize     = (true == isRle) ? rleSize : rawSize;
+
+        File fd = fs.open(fileName, FILE_WRITE);
+
+        if (false == fd)
+        {
+            ret = RET_FILE_WRITE_ERROR;
+        }
+        else
+        {
+            uint16_t    idx         = 0U;
+            uint32_t    dataSize    = 0U;
+
+            if (sizeof(header) != fd.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)))
+            {
+                ret = RET_FILE_WRITE_ERROR;
+            }
+
+            while((paletteSize > idx) && (RET_OK == ret))
+            {
+                uint8_t entry[3U] = { palette[idx].getRed(), palette[idx].getGreen(), palette[idx].getBlue() };
+
+                if (sizeof(entry) != fd.write(entry, sizeof(entry)))
+                {
+                    ret = RET_FILE_WRITE_ERROR;
+                }
+
+                ++idx;
+            }
+
+            if ((RET_OK == ret) &&
+                (false == writePixels(&fd, bitmap, usedPalette, paletteSize, isRle, dataSize)))
+            {
+                ret = RET_FILE_WRITE_ERROR;
+            }
+
+            fd.close();
+
+            if (RET_OK != ret)
+            {
+                (void)fs.remove(fileName);
+            }
+        }
+
+        delete[] palette;
+    }
+
+    return ret;
+}
+
+PackedImgLoader::Ret PackedImgLoader::convert(FS& fs, const String& srcFileName, const String& dstFileName, bool isRleAllowed)
+{
+    Ret                 ret = RET_OK;
+    YAGfxDynamicBitmap  bitmap;
+    BmpImgLoader        bmpLoader;
+
+    switch(bmpLoader.load(fs, srcFileName, bitmap))
+    {
+    case BmpImgLoader::RET_OK:
+        ret = save(fs, dstFileName, bitmap, isRleAllowed);
+        break;
+
+    case BmpImgLoader::RET_FILE_NOT_FOUND:
+        ret = RET_FILE_NOT_FOUND;
+        break;
+
+    case BmpImgLoader::RET_FILE_FORMAT_INVALID:
+        ret = RET_FILE_FORMAT_INVALID;
+        break;
+
+    case BmpImgLoader::RET_IMG_TOO_BIG:
+        ret = RET_IMG_TOO_BIG;
+        break;
+
+    case BmpImgLoader::RET_FILE_FORMAT_UNSUPPORTED:
+        /* fallthrough */
+    default:
+        ret = RET_FILE_FORMAT_UNSUPPORTED;
+        break;
+    }
+
+    return ret;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool PackedImgLoader::createPalette(const YAGfxBitmap& bitmap, Color* palette, uint16_t& paletteSize) const
+{
+    bool    isSuccessful    = true;
+    int16_t x               = 0;
+    int16_t y               = 0;
+
+    paletteSize = 0U;
+
+    for(y = 0; (y < bitmap.getHeight()) && (true == isSuccessful); ++y)
+    {
+        for(x = 0; (x < bitmap.getWidth()) && (true == isSuccessful); ++x)
+        {
+            const Color&    color   = bitmap.getColor(x, y);
+            uint16_t        idx     = 0U;
+
+            while((paletteSize > idx) &&
+                  (static_cast<uint32_t>(palette[idx]) != static_cast<uint32_t>(color)))
+            {
+                ++idx;
+            }
+
+            /* New color? */
+            if (paletteSize == idx)
+            {
+                if (MAX_PALETTE_SIZE <= paletteSize)
+                {
+                    isSuccessful = false;
+                }
+                else
+                {
+                    palette[paletteSize] = color;
+                    ++paletteSize;
+                }
+            }
+        }
+    }
+
+    return isSuccessful;
+}
+
+uint16_t PackedImgLoader::getPixelValue(const Color& color, const Color* palette, uint16_t paletteSize) const
+{
+    uint16_t value = 0U;
+
+    if (nullptr == palette)
+    {
+        value = color.to565();
+    }
+    else
+    {
+        while((paletteSize > value) &&
+              (static_cast<uint32_t>(palette[value]) != static_cast<uint32_t>(color)))
+        {
+            ++value;
+        }
+    }
+
+    return value;
+}
+
+bool PackedImgLoader::writePixels(File* fd, const YAGfxBitmap& bitmap, const Color* palette, uint16_t paletteSize, bool isRle, uint32_t& dataSize) const
+{
+    bool        isSuccessful    = true;
+    uint32_t    pixelCnt        = static_cast<uint32_t>(bitmap.getWidth()) * bitmap.getHeight();
+    uint32_t    pixelIdx        = 0U;
+    uint8_t     valueSize       = (nullptr == palette) ? 2U : 1U;
+
+    dataSize = 0U;
+
+    while((pixelCnt > pixelIdx) && (true == isSuccessful))
+    {
+        uint16_t    width   = bitmap.getWidth();
+        uint16_t    value   = getPixelValue(bitmap.getColor(pixelIdx % width, pixelIdx / width), palette, paletteSize);
+        uint8_t     count   = 1U;
+        uint8_t     data[3U];
+        uint8_t     dataLen = 0U;
+
+        ++pixelIdx;
+
+        if (true == isRle)
+        {
+            while((pixelCnt > pixelIdx) &&
+                  (UINT8_MAX > count) &&
+                  (value == getPixelValue(bitmap.getColor(pixelIdx % width, pixelIdx / width), palette, paletteSize)))
+            {
+                ++count;
+                ++pixelIdx;
+            }
+
+            data[dataLen] = count;
+            ++dataLen;
+        }
+
+        data[dataLen] = value & 0xFFU;
+        ++dataLen;
+
+        if (2U == valueSize)
+        {
+            data[dataLen] = (value >> 8U) & 0xFFU;
+            ++dataLen;
+        }
+
+        if ((nullptr != fd) &&
+            (dataLen != fd->write(data, dataLen)))
+        {
+            isSuccessful = false;
+        }
+
+        dataSize += dataLen;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Convert a RGB565 color value to a color.
+ *
+ * @param[in] value RGB565 color value
+ *
+ * @return Color
+ */
+static Color colorFrom565(uint16_t value)
+{
+    uint8_t red     = (value >> 11U) & 0x1FU;
+    uint8_t green   = (value >> 5U) & 0x3FU;
+    uint8_t blue    = value & 0x1FU;
+
+    /* Scale to 8 bit per color, by repeating the upper bits. */
+    return Color((red << 3U) | (red >> 2U), (green << 2U) | (green >> 4U), (blue << 3U) | (blue >> 2U));
+}
@@ -0,0 +1,188 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Packed image loader
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __PACKED_IMG_LOADER_H__
+#define __PACKED_IMG_LOADER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+#include <PackedImg.h>
+#include <FS.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Packed image loader and writer, see PackedImg.h for the format.
+ *
+ * A packed image is created once, e.g. after a image was uploaded. Loading
+ * it later needs no decoding effort and with a palette it needs only 1 byte
+ * per pixel in the file system.
+ */
+class PackedImgLoader
+{
+public:
+
+    /**
+     * Construct a new packed image loader object.
+     */
+    PackedImgLoader()
+    {
+    }
+
+    /**
+     * Destroy the packed image loader object.
+     */
+    ~PackedImgLoader()
+    {
+    }
+
+    /**
+     * Possible return values with more information.
+     */
+    enum Ret
+    {
+        RET_OK = 0,                     /**< Successful */
+        RET_FILE_NOT_FOUND,             /**< File not found. */
+        RET_FILE_FORMAT_INVALID,        /**< Invalid file format. */
+        RET_FILE_FORMAT_UNSUPPORTED,    /**< File format is not supported. */
+        RET_IMG_TOO_BIG,                /**< Image size is too big. */
+        RET_FILE_WRITE_ERROR            /**< Writing the file failed. */
+    };
+
+    /** File extension of a packed image. */
+    static const char*  FILE_EXT;
+
+    /**
+     * Load packed image from file system to bitmap buffer.
+     *
+     * @param[in]   fs          File system
+     * @param[in]   fileName    Name of the file
+     * @param[out]  bitmap      Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret load(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Save a bitmap as packed image to the file system.
+     * If the bitmap has not more than 256 colors, a color palette is used
+     * otherwise the colors are stored in RGB565 format. The pixel data is
+     * run length encoded, if this is smaller.
+     *
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[in] bitmap    Bitmap
+     * @param[in] isRleAllowed  Is run length encoding allowed? A image, which shall be mapped, must not be encoded.
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret save(FS& fs, const String& fileName, const YAGfxBitmap& bitmap, bool isRleAllowed = true);
+
+    /**
+     * Convert a image file to a packed image file.
+     * Supported source image formats: bitmap (.bmp).
+     *
+     * @param[in] fs            File system
+     * @param[in] srcFileName   Name of the source image file
+     * @param[in] dstFileName   Name of the packed image file
+     * @param[in] isRleAllowed  Is run length encoding allowed? A image, which shall be mapped, must not be encoded.
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret convert(FS& fs, const String& srcFileName, const String& dstFileName, bool isRleAllowed = true);
+
+private:
+
+    /** Max. number of colors in a palette. */
+    static const uint16_t   MAX_PALETTE_SIZE    = 256U;
+
+    /**
+     * Create the color palette of a bitmap.
+     *
+     * @param[in]   bitmap      Bitmap
+     * @param[out]  palette     Color palette with MAX_PALETTE_SIZE entries
+     * @param[out]  paletteSize Number of used palette entries
+     *
+     * @return If the bitmap has not more colors than MAX_PALETTE_SIZE, it will return true otherwise false.
+     */
+    bool createPalette(const YAGfxBitmap& bitmap, Color* palette, uint16_t& paletteSize) const;
+
+    /**
+     * Get the pixel value in the packed image: Either the palette index or the RGB565 color.
+     *
+     * @param[in] color         Pixel color
+     * @param[in] palette       Color palette or nullptr for RGB565.
+     * @param[in] paletteSize   Number of used palette entries
+     *
+     * @return Pixel value
+     */
+    uint16_t getPixelValue(const Color& color, const Color* palette, uint16_t paletteSize) const;
+
+    /**
+     * Write the pixel data. If the file descriptor is nullptr, it will only
+     * determine the size.
+     *
+     * @param[in] fd            File descriptor or nullptr
+     * @param[in] bitmap        Bitmap
+     * @param[in] palette       Color palette or nullptr for RGB565.
+     * @param[in] paletteSize   Number of used palette entries
+     * @param[in] isRle         Shall it be run length encoded?
+     * @param[out] dataSize     Pixel data size in byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool writePixels(File* fd, const YAGfxBitmap& bitmap, const Color* palette, uint16_t paletteSize, bool isRle, uint32_t& dataSize) const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __PACKED_IMG_LOADER_H__ */
+
+/** @} */
@@ -131,11 +131,13 @@ public:
     {
         if (100 < progress)
         {
-            m_progress = 100;
+            progress = 100;
         }
-        else
+
+        if (progress != m_progress)
         {
             m_progress = progress;
+            invalidate();
         }
 
         return;
@@ -149,6 +151,7 @@ public:
     void setColor(const Color& color)
     {
         m_color = color;
+        invalidate();
         return;
     }
 
@@ -162,6 +165,7 @@ public:
         if (ALGORITHM_MAX > algorithm)
         {
             m_algorithm = algorithm;
+            invalidate();
         }
 
         return;
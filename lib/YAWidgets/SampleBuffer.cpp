@@ -0,0 +1,306 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Sample buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "SampleBuffer.h"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+SampleBuffer::SampleBuffer() :
+    m_samples(nullptr),
+    m_capacity(0U),
+    m_count(0U),
+    m_writeIdx(0U),
+    m_minQueue(),
+    m_maxQueue()
+{
+}
+
+SampleBuffer::SampleBuffer(const SampleBuffer& buffer) :
+    m_samples(nullptr),
+    m_capacity(0U),
+    m_count(0U),
+    m_writeIdx(0U),
+    m_minQueue(),
+    m_maxQueue()
+{
+    copy(buffer);
+}
+
+SampleBuffer::~SampleBuffer()
+{
+    release();
+}
+
+SampleBuffer& SampleBuffer::operator=(const SampleBuffer& buffer)
+{
+    if (&buffer != this)
+    {
+        copy(buffer);
+    }
+
+    return *this;
+}
+
+bool SampleBuffer::create(uint16_t capacity)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    if (0U < capacity)
+    {
+        m_samples           = new(std::nothrow) float[capacity];
+        m_minQueue.indices  = new(std::nothrow) uint16_t[capacity];
+        m_maxQueue.indices  = new(std::nothrow) uint16_t[capacity];
+
+        if ((nullptr == m_samples) ||
+            (nullptr == m_minQueue.indices) ||
+            (nullptr == m_maxQueue.indices))
+        {
+            release();
+        }
+        else
+        {
+            m_capacity      = capacity;
+            isSuccessful    = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void SampleBuffer::release()
+{
+    if (nullptr != m_samples)
+    {
+        delete[] m_samples;
+        m_samples = nullptr;
+    }
+
+    if (nullptr != m_minQueue.indices)
+    {
+        delete[] m_minQueue.indices;
+        m_minQueue.indices = nullptr;
+    }
+
+    if (nullptr != m_maxQueue.indices)
+    {
+        delete[] m_maxQueue.indices;
+        m_maxQueue.indices = nullptr;
+    }
+
+    m_capacity = 0U;
+    clear();
+}
+
+void SampleBuffer::clear()
+{
+    m_count             = 0U;
+    m_writeIdx          = 0U;
+    m_minQueue.head     = 0U;
+    m_minQueue.count    = 0U;
+    m_maxQueue.head     = 0U;
+    m_maxQueue.count    = 0U;
+}
+
+void SampleBuffer::add(float value)
+{
+    if (0U < m_capacity)
+    {
+        /* The oldest sample is overwritten, if the buffer is full. */
+        if (m_capacity == m_count)
+        {
+            expire(m_minQueue, m_writeIdx);
+            expire(m_maxQueue, m_writeIdx);
+        }
+        else
+        {
+            ++m_count;
+        }
+
+        m_samples[m_writeIdx] = value;
+
+        push(m_minQueue, m_writeIdx, true);
+        push(m_maxQueue, m_writeIdx, false);
+
+        ++m_writeIdx;
+
+        if (m_capacity <= m_writeIdx)
+        {
+            m_writeIdx = 0U;
+        }
+    }
+}
+
+float SampleBuffer::get(uint16_t idx) const
+{
+    float value = 0.0F;
+
+    if (m_count > idx)
+    {
+        /* The oldest sample is m_count samples before the write index. */
+        uint32_t sampleIdx = static_cast<uint32_t>(m_writeIdx) + m_capacity - m_count + idx;
+
+        value = m_samples[sampleIdx % m_capacity];
+    }
+
+    return value;
+}
+
+float SampleBuffer::getMin() const
+{
+    float value = 0.0F;
+
+    if (0U < m_minQueue.count)
+    {
+        value = m_samples[m_minQueue.indices[m_minQueue.head]];
+    }
+
+    return value;
+}
+
+float SampleBuffer::getMax() const
+{
+    float value = 0.0F;
+
+    if (0U < m_maxQueue.count)
+    {
+        value = m_samples[m_maxQueue.indices[m_maxQueue.head]];
+    }
+
+    return value;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void SampleBuffer::push(Queue& queue, uint16_t idx, bool isMin)
+{
+    const float value = m_samples[idx];
+
+    /* Remove all samples from the end, which are not better than the new one.
+     * They are older and can never become the min./max. value anymore.
+     */
+    while(0U < queue.count)
+    {
+        uint16_t    tail        = (queue.head + queue.count - 1U) % m_capacity;
+        float       tailValue   = m_samples[queue.indices[tail]];
+
+        if (((true == isMin) && (tailValue < value)) ||
+            ((false == isMin) && (tailValue > value)))
+        {
+            break;
+        }
+
+        --queue.count;
+    }
+
+    queue.indices[(queue.head + queue.count) % m_capacity] = idx;
+    ++queue.count;
+}
+
+void SampleBuffer::expire(Queue& queue, uint16_t idx)
+{
+    /* Only the oldest sample can be overwritten, which is always at the head. */
+    if ((0U < queue.count) &&
+        (idx == queue.indices[queue.head]))
+    {
+        ++queue.head;
+
+        if (m_capacity <= queue.head)
+        {
+            queue.head = 0U;
+        }
+
+        --queue.count;
+    }
+}
+
+void SampleBuffer::copy(const SampleBuffer& buffer)
+{
+    uint16_t idx = 0U;
+
+    if (m_capacity != buffer.m_capacity)
+    {
+        (void)create(buffer.m_capacity);
+    }
+
+    clear();
+
+    /* Adding the samples in order rebuilds the queues. */
+    if (m_capacity == buffer.m_capacity)
+    {
+        for(idx = 0U; idx < buffer.m_count; ++idx)
+        {
+            add(buffer.get(idx));
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,226 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Sample buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __SAMPLE_BUFFER_H__
+#define __SAMPLE_BUFFER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Ring buffer of samples with a fixed capacity, which is allocated once.
+ * If the buffer is full, the oldest sample is overwritten.
+ *
+ * The min. and max. value of all samples in the buffer are updated
+ * incrementally. For this two monotonic queues are kept, which contain only
+ * those samples, which can still become the min. or max. value. Adding a
+ * sample has amortized constant time and requesting min./max. constant time.
+ */
+class SampleBuffer
+{
+public:
+
+    /**
+     * Constructs a empty sample buffer without capacity.
+     */
+    SampleBuffer();
+
+    /**
+     * Constructs a sample buffer by copy.
+     *
+     * @param[in] buffer    Sample buffer, which to copy.
+     */
+    SampleBuffer(const SampleBuffer& buffer);
+
+    /**
+     * Destroys the sample buffer.
+     */
+    ~SampleBuffer();
+
+    /**
+     * Assigns a sample buffer.
+     *
+     * @param[in] buffer    Sample buffer, which to assign.
+     *
+     * @return Sample buffer
+     */
+    SampleBuffer& operator=(const SampleBuffer& buffer);
+
+    /**
+     * Allocate the buffer. All samples are discarded.
+     *
+     * @param[in] capacity  Max. number of samples
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t capacity);
+
+    /**
+     * Release the buffer.
+     */
+    void release();
+
+    /**
+     * Discard all samples.
+     */
+    void clear();
+
+    /**
+     * Add a sample. If the buffer is full, the oldest sample is overwritten.
+     *
+     * @param[in] value Sample value
+     */
+    void add(float value);
+
+    /**
+     * Get sample. The oldest sample has index 0.
+     *
+     * @param[in] idx   Sample index
+     *
+     * @return Sample value. If the index is invalid, it will return 0.
+     */
+    float get(uint16_t idx) const;
+
+    /**
+     * Get the latest sample.
+     *
+     * @return Latest sample value. If the buffer is empty, it will return 0.
+     */
+    float getLatest() const
+    {
+        return (0U == m_count) ? 0.0F : get(m_count - 1U);
+    }
+
+    /**
+     * Get min. value of all samples.
+     *
+     * @return Min. value. If the buffer is empty, it will return 0.
+     */
+    float getMin() const;
+
+    /**
+     * Get max. value of all samples.
+     *
+     * @return Max. value. If the buffer is empty, it will return 0.
+     */
+    float getMax() const;
+
+    /**
+     * Get number of samples.
+     *
+     * @return Number of samples
+     */
+    uint16_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Get max. number of samples.
+     *
+     * @return Capacity
+     */
+    uint16_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+
+    /**
+     * Monotonic queue of sample indices. The referenced samples are in
+     * ascending (min. queue) or descending (max. queue) order.
+     */
+    struct Queue
+    {
+        uint16_t*   indices;    /**< Ring buffer of sample indices */
+        uint16_t    head;       /**< Index of the first element */
+        uint16_t    count;      /**< Number of elements */
+    };
+
+    float*      m_samples;  /**< Ring buffer of samples */
+    uint16_t    m_capacity; /**< Max. number of samples */
+    uint16_t    m_count;    /**< Number of samples */
+    uint16_t    m_writeIdx; /**< Index, where the next sample is written to. */
+    Queue       m_minQueue; /**< Candidates for the min. value */
+    Queue       m_maxQueue; /**< Candidates for the max. value */
+
+    /**
+     * Push a new sample to a monotonic queue. All samples, which can never
+     * become the min./max. value anymore, are removed from its end.
+     *
+     * @param[in] queue     Monotonic queue
+     * @param[in] idx       Sample index of the new sample
+     * @param[in] isMin     If true, it is the min. queue otherwise the max. queue.
+     */
+    void push(Queue& queue, uint16_t idx, bool isMin);
+
+    /**
+     * Remove a overwritten sample from the head of a monotonic queue.
+     *
+     * @param[in] queue     Monotonic queue
+     * @param[in] idx       Sample index of the overwritten sample
+     */
+    void expire(Queue& queue, uint16_t idx);
+
+    /**
+     * Copy the content of another sample buffer.
+     *
+     * @param[in] buffer    Sample buffer, which to copy.
+     */
+    void copy(const SampleBuffer& buffer);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __SAMPLE_BUFFER_H__ */
+
+/** @} */
@@ -36,6 +36,8 @@
 
 #include <ArduinoJson.h>
 #include <BmpImgLoader.h>
+#include <PackedImgLoader.h>
+#include <new>
 
 /******************************************************************************
  * Compiler Switches
@@ -65,66 +67,143 @@ SpriteSheet& SpriteSheet::operator=(const SpriteSheet& spriteSheet)
 {
     if (this != (&spriteSheet))
     {
+        release();
+
         m_texture       = spriteSheet.m_texture;
-        m_textureMap    = spriteSheet.m_textureMap;
-        m_frame         = spriteSheet.m_frame;
-        m_frameCnt      = spriteSheet.m_frameCnt;
         m_fps           = spriteSheet.m_fps;
         m_repeat        = spriteSheet.m_repeat;
         m_isForward     = spriteSheet.m_isForward;
-        m_framesX       = spriteSheet.m_framesX;
-        m_framesY       = spriteSheet.m_framesY;
-        m_currentFrameX = spriteSheet.m_currentFrameX;
-        m_currentFrameY = spriteSheet.m_currentFrameY;
+        m_currentFrame  = spriteSheet.m_currentFrame;
+        m_isRunning     = spriteSheet.m_isRunning;
+        m_timestamp     = spriteSheet.m_timestamp;
+        m_elapsed       = spriteSheet.m_elapsed;
+
+        if ((0U < spriteSheet.m_frameCnt) &&
+            (nullptr != spriteSheet.m_frameOffsets))
+        {
+            m_frameOffsets = new(std::nothrow) FrameOffset[spriteSheet.m_frameCnt];
+
+            /* If no memory is available, the sprite sheet stays empty. */
+            if (nullptr == m_frameOffsets)
+            {
+                m_texture.release();
+                m_currentFrame = 0U;
+            }
+            else
+            {
+                uint8_t idx = 0U;
+
+                for(idx = 0U; idx < spriteSheet.m_frameCnt; ++idx)
+                {
+                    m_frameOffsets[idx] = spriteSheet.m_frameOffsets[idx];
+                }
+
+                m_frameWidth    = spriteSheet.m_frameWidth;
+                m_frameHeight   = spriteSheet.m_frameHeight;
+                m_frameCnt      = spriteSheet.m_frameCnt;
+            }
+        }
     }
 
     return *this;
 }
 
+void SpriteSheet::drawFrame(YAGfx& gfx, int16_t x, int16_t y) const
+{
+    if ((nullptr != m_frameOffsets) &&
+        (m_frameCnt > m_currentFrame))
+    {
+        const FrameOffset&  offset  = m_frameOffsets[m_currentFrame];
+        uint16_t            row     = 0U;
+
+        /* Copy the frame row by row directly from the texture pixel buffer. */
+        for(row = 0U; row < m_frameHeight; ++row)
+        {
+            const Color* pixels = m_texture.getRow(offset.y + row);
+
+            if (nullptr != pixels)
+            {
+                gfx.drawRow(x, y + row, &pixels[offset.x], m_frameWidth);
+            }
+        }
+    }
+}
+
 bool SpriteSheet::loadTexture(FS& fs, const String& fileName, uint16_t frameWidth, uint16_t frameHeight, uint8_t frameCnt, uint8_t fps)
 {
     bool isSuccessful = false;
 
+    release();
+
     /* The frame size must be given, otherwise the texture can not be
      * cut to single frames.
      */
     if ((0U < frameWidth) &&
         (0U < frameHeight))
     {
-        BmpImgLoader loader;
+        bool isLoaded = false;
 
-        if (BmpImgLoader::RET_OK == loader.load(fs, fileName, m_texture))
+        if (0U != fileName.endsWith(PackedImgLoader::FILE_EXT))
+        {
+            PackedImgLoader loader;
+
+            isLoaded = (PackedImgLoader::RET_OK == loader.load(fs, fileName, m_texture));
+        }
+        else
+        {
+            BmpImgLoader loader;
+
+            isLoaded = (BmpImgLoader::RET_OK == loader.load(fs, fileName, m_texture));
+        }
+
+        if (true == isLoaded)
         {
             /* The frame size must be lower or equal to the texture size. */
             if ((m_texture.getWidth() >= frameWidth) &&
                 (m_texture.getHeight() >= frameHeight))
             {
-                m_framesX   = m_texture.getWidth() / frameWidth;
-                m_framesY   = m_texture.getHeight() / frameHeight;
+                uint16_t    framesX     = m_texture.getWidth() / frameWidth;
+                uint16_t    framesY     = m_texture.getHeight() / frameHeight;
+                uint32_t    maxFrameCnt = static_cast<uint32_t>(framesX) * framesY;
+
+                if (UINT8_MAX < maxFrameCnt)
+                {
+                    maxFrameCnt = UINT8_MAX;
+                }
 
                 /* A 0 number of frames requests the automatic frame count calculation.
                  * This assumes that there will be no frame gaps in the texture image.
                  */
-                if (0U == frameCnt)
+                if ((0U == frameCnt) ||
+                    (maxFrameCnt < frameCnt))
                 {
-                    m_frameCnt = m_framesX * m_framesY;
+                    frameCnt = static_cast<uint8_t>(maxFrameCnt);
                 }
-                else
-                {
-                    m_frameCnt = frameCnt;
-                }
-
-                m_textureMap.setOffsetX(0);
-                m_textureMap.setOffsetY(0);
-                m_textureMap.setWidth(frameWidth);
-                m_textureMap.setHeight(frameHeight);
 
-                m_fps = fps;
-                reset();
+                m_frameOffsets = new(std::nothrow) FrameOffset[frameCnt];
 
-                isSuccessful = true;
+                if (nullptr != m_frameOffsets)
+                {
+                    uint8_t idx = 0U;
+
+                    /* Calculate the position of every frame only once. */
+                    for(idx = 0U; idx < frameCnt; ++idx)
+                    {
+                        m_frameOffsets[idx].x = (idx % framesX) * frameWidth;
+                        m_frameOffsets[idx].y = (idx / framesX) * frameHeight;
+                    }
+
+                    m_frameWidth    = frameWidth;
+                    m_frameHeight   = frameHeight;
+                    m_frameCnt      = frameCnt;
+                    m_fps           = fps;
+                    reset();
+
+                    isSuccessful = true;
+                }
             }
-            else
+
+            if (false == isSuccessful)
             {
                 m_texture.release();
             }
@@ -205,26 +284,85 @@ void SpriteSheet::next()
     {
         moveForward();
     }
+}
+
+void SpriteSheet::update(uint32_t timestamp)
+{
+    if ((0U < m_frameCnt) &&
+        (0U < m_fps))
+    {
+        if (false == m_isRunning)
+        {
+            m_timestamp = timestamp;
+            m_elapsed   = 0U;
+            m_isRunning = true;
+        }
+        else
+        {
+            uint32_t    duration    = 1000U / m_fps;
+            uint32_t    steps       = 0U;
+
+            m_elapsed   += timestamp - m_timestamp;
+            m_timestamp = timestamp;
+            steps       = m_elapsed / duration;
+            m_elapsed   %= duration;
+
+            /* After a long time without update, avoid to step through
+             * several complete animation cycles.
+             */
+            if (true == m_repeat)
+            {
+                steps %= m_frameCnt;
+            }
+            else if (m_frameCnt < steps)
+            {
+                steps = m_frameCnt;
+            }
+            else
+            {
+                /* Nothing to do. */
+                ;
+            }
 
-    /* Calculate and set the frame offset in the texture image. */
-    m_textureMap.setOffsetX(m_currentFrameX * m_frame.getWidth());
-    m_textureMap.setOffsetY(m_currentFrameY * m_frame.getHeight());
+            while(0U < steps)
+            {
+                next();
+                --steps;
+            }
+        }
+    }
 }
 
 void SpriteSheet::reset()
 {
     if (false == m_isForward)
     {
-        moveToBegin();
+        moveToEnd();
     }
     else
     {
-        moveToEnd();
+        moveToBegin();
     }
 
-    /* Calculate and set the frame offset in the texture image. */
-    m_textureMap.setOffsetX(m_currentFrameX * m_frame.getWidth());
-    m_textureMap.setOffsetY(m_currentFrameY * m_frame.getHeight());
+    m_isRunning = false;
+    m_elapsed   = 0U;
+}
+
+void SpriteSheet::release()
+{
+    m_texture.release();
+
+    if (nullptr != m_frameOffsets)
+    {
+        delete[] m_frameOffsets;
+        m_frameOffsets = nullptr;
+    }
+
+    m_frameWidth    = 0U;
+    m_frameHeight   = 0U;
+    m_frameCnt      = 0U;
+    m_currentFrame  = 0U;
+    m_isRunning     = false;
 }
 
 /******************************************************************************
@@ -237,15 +375,7 @@ void SpriteSheet::reset()
 
 bool SpriteSheet::isBegin() const
 {
-    bool isBegin = false;
-
-    if ((0U == m_currentFrameX) &&
-        (0U == m_currentFrameY))
-    {
-        isBegin = true;
-    }
-
-    return isBegin;
+    return (0U == m_currentFrame);
 }
 
 bool SpriteSheet::isEnd() const
@@ -253,28 +383,18 @@ bool SpriteSheet::isEnd() const
     bool isEnd = false;
 
     /* Not any frame available? */
-    if (0 == m_frameCnt)
+    if (0U == m_frameCnt)
+    {
+        isEnd = true;
+    }
+    else if ((m_frameCnt - 1U) == m_currentFrame)
     {
         isEnd = true;
     }
-    /* The texture may be not complete filled with frames.
-     * This will be considered here.
-     */
     else
     {
-        uint8_t x = m_frameCnt % m_framesX;
-        uint8_t y = m_framesY - 1U;
-
-        if (0U == x)
-        {
-            x = m_framesX - 1U;
-        }
-
-        if ((x == m_currentFrameX) &&
-            (y == m_currentFrameY))
-        {
-            isEnd = true;
-        }
+        /* Nothing to do. */
+        ;
     }
 
     return isEnd;
@@ -282,31 +402,19 @@ bool SpriteSheet::isEnd() const
 
 void SpriteSheet::moveToBegin()
 {
-    m_currentFrameX = 0U;
-    m_currentFrameY = 0U;
+    m_currentFrame = 0U;
 }
 
 void SpriteSheet::moveToEnd()
 {
     /* Not any frame available? */
-    if (0 == m_frameCnt)
+    if (0U == m_frameCnt)
     {
-        m_currentFrameX = 0U;
-        m_currentFrameY = 0U;
+        m_currentFrame = 0U;
     }
-    /* The texture may be not complete filled with frames.
-     * This will be considered here.
-     */
     else
     {
-        m_currentFrameX = m_frameCnt % m_framesX;
-
-        if (0 == m_currentFrameX)
-        {
-            m_currentFrameX = m_framesX - 1U;
-        }
-
-        m_currentFrameY = m_framesY - 1U;
+        m_currentFrame = m_frameCnt - 1U;
     }
 }
 
@@ -324,19 +432,7 @@ void SpriteSheet::moveForward()
     /* Move to the next one. */
     else
     {
-        ++m_currentFrameX;
-
-        if (m_framesX <= m_currentFrameX)
-        {
-            m_currentFrameX = 0U;
-
-            ++m_currentFrameY;
-
-            if (m_framesY <= m_currentFrameY)
-            {
-                m_currentFrameY = 0U;
-            }
-        }
+        ++m_currentFrame;
     }
 }
 
@@ -351,26 +447,10 @@ void SpriteSheet::moveBackward()
             moveToEnd();
         }
     }
-    /* Move to the next one. */
+    /* Move to the previous one. */
     else
     {
-        if (0U == m_currentFrameX)
-        {
-            m_currentFrameX = m_framesX - 1U;
-
-            if (0U == m_currentFrameY)
-            {
-                m_currentFrameY = m_framesY - 1U;
-            }
-            else
-            {
-                --m_currentFrameY;
-            }
-        }
-        else
-        {
-            --m_currentFrameX;
-        }
+        --m_currentFrame;
     }
 }
 
@@ -44,7 +44,7 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
-#include <YAGfxMap.h>
+#include <YAGfx.h>
 #include <YAGfxBitmap.h>
 #include <FS.h>
 
@@ -65,6 +65,10 @@
  * 
  * The order of the sprites shall follow in x-direction from 0 to N and
  * continue in the next y row and so on.
+ * 
+ * The position of every frame in the texture is calculated once during
+ * loading. The current frame is drawn row by row directly from the texture
+ * pixel buffer and the animation advances by the elapsed time.
  */
 class SpriteSheet
 {
@@ -75,16 +79,17 @@ public:
      */
     SpriteSheet() :
         m_texture(),
-        m_textureMap(m_texture),
-        m_frame(m_textureMap),
+        m_frameOffsets(nullptr),
+        m_frameWidth(0U),
+        m_frameHeight(0U),
         m_frameCnt(0U),
         m_fps(DEFAULT_FPS),
         m_repeat(true),
         m_isForward(true),
-        m_framesX(0U),
-        m_framesY(0U),
-        m_currentFrameX(0U),
-        m_currentFrameY(0U)
+        m_currentFrame(0U),
+        m_isRunning(false),
+        m_timestamp(0U),
+        m_elapsed(0U)
     {
     }
 
@@ -94,18 +99,20 @@ public:
      * @param[in] spriteSheet   The sprite sheet, which to copy from.
      */
     SpriteSheet(const SpriteSheet& spriteSheet) :
-        m_texture(spriteSheet.m_texture),
-        m_textureMap(spriteSheet.m_textureMap),
-        m_frame(spriteSheet.m_frame),
-        m_frameCnt(spriteSheet.m_frameCnt),
-        m_fps(spriteSheet.m_fps),
-        m_repeat(spriteSheet.m_repeat),
-        m_isForward(spriteSheet.m_isForward),
-        m_framesX(spriteSheet.m_framesX),
-        m_framesY(spriteSheet.m_framesY),
-        m_currentFrameX(spriteSheet.m_currentFrameX),
-        m_currentFrameY(spriteSheet.m_currentFrameY)
+        m_texture(),
+        m_frameOffsets(nullptr),
+        m_frameWidth(0U),
+        m_frameHeight(0U),
+        m_frameCnt(0U),
+        m_fps(DEFAULT_FPS),
+        m_repeat(true),
+        m_isForward(true),
+        m_currentFrame(0U),
+        m_isRunning(false),
+        m_timestamp(0U),
+        m_elapsed(0U)
     {
+        *this = spriteSheet;
     }
 
     /**
@@ -113,12 +120,12 @@ public:
      */
     ~SpriteSheet()
     {
+        release();
     }
 
     /**
      * Assgins a sprite sheet.
-     * Note, the referenced bitmap image won't be assigned! You have to do this
-     * separately.
+     * The texture image and the frame offsets are copied too.
      * 
      * @param[in] spriteSheet   The sprite sheet, which to copy from.
      * 
@@ -193,7 +200,7 @@ public:
      */
     uint16_t getFrameWidth() const
     {
-        return m_frame.getWidth();
+        return m_frameWidth;
     }
 
     /**
@@ -203,24 +210,43 @@ public:
      */
     uint16_t getFrameHeight() const
     {
-        return m_frame.getHeight();
+        return m_frameHeight;
     }
 
     /**
-     * @brief Get the Frame object
+     * Get number of frames.
      * 
-     * @return YAGfxBitmap& 
+     * @return Number of frames
      */
-    const YAGfxBitmap& getFrame() const
+    uint8_t getFrameCount() const
     {
-        return m_frame;
+        return m_frameCnt;
     }
 
     /**
-     * Load sprite sheet texture image (.bmp) from the filesystem.
+     * Get the index of the current frame.
+     * 
+     * @return Frame index
+     */
+    uint8_t getCurrentFrame() const
+    {
+        return m_currentFrame;
+    }
+
+    /**
+     * Draw the current frame at the given position (upper left point).
+     * 
+     * @param[in] gfx   Graphics interface
+     * @param[in] x     x-coordinate of upper left point
+     * @param[in] y     y-coordinate of upper left point
+     */
+    void drawFrame(YAGfx& gfx, int16_t x, int16_t y) const;
+
+    /**
+     * Load sprite sheet texture image (.bmp or .pim) from the filesystem.
      * 
      * @param[in] fs            File system
-     * @param[in] fileName      Name of the bitmap file in the filesystem
+     * @param[in] fileName      Name of the image file in the filesystem
      * @param[in] frameWidth    Canvas frame width in pixels
      * @param[in] frameHeight   Canvas frame height in pixels
      * @param[in] frameCnt      Number of frames
@@ -254,6 +280,17 @@ public:
      */
     void next();
 
+    /**
+     * Advance the animation by the time elapsed since the last call.
+     * The first call after loading or a reset only takes the timestamp
+     * as reference. If several frame durations elapsed, several frames
+     * are skipped, so the animation speed doesn't depend on how often
+     * it is called.
+     * 
+     * @param[in] timestamp Current timestamp in ms
+     */
+    void update(uint32_t timestamp);
+
     /**
      * Reset animation sequence.
      * 
@@ -265,10 +302,7 @@ public:
     /**
      * Release the internal pixel buffer with texture.
      */
-    void release()
-    {
-        m_texture.release();
-    }
+    void release();
 
     /**
      * Use this function to determine whether a sprite sheet is loaded or not.
@@ -287,17 +321,27 @@ private:
      */
     static const uint8_t    DEFAULT_FPS = 12U;
 
+    /**
+     * Position of a frame in the texture image.
+     */
+    struct FrameOffset
+    {
+        uint16_t    x;  /**< x-coordinate of the upper left frame corner */
+        uint16_t    y;  /**< y-coordinate of the upper left frame corner */
+    };
+
     YAGfxDynamicBitmap  m_texture;          /**< Texture image. */
-    YAGfxMap            m_textureMap;       /**< Map canvas over the texture image. */
-    YAGfxOverlayBitmap  m_frame;            /**< The current frame. */
+    FrameOffset*        m_frameOffsets;     /**< Precalculated position of every frame in the texture. */
+    uint16_t            m_frameWidth;       /**< Frame width in pixels. */
+    uint16_t            m_frameHeight;      /**< Frame height in pixels. */
     uint8_t             m_frameCnt;         /**< Number of frames in the texture. */
     uint8_t             m_fps;              /**< Number of frames per second. */
     bool                m_repeat;           /**< Repeat animation continuously or it runs just once. */
     bool                m_isForward;        /**< The animation (order of sprites) runs forwards and backwards. */
-    uint8_t             m_framesX;          /**< Number of frames on texture x-axis. */
-    uint8_t             m_framesY;          /**< Number of frames on texture y-axis. */
-    uint8_t             m_currentFrameX;    /**< x index of current selected frame. */
-    uint8_t             m_currentFrameY;    /**< y index of current selected frame. */
+    uint8_t             m_currentFrame;     /**< Index of current selected frame. */
+    bool                m_isRunning;        /**< Is the timestamp reference for the animation valid? */
+    uint32_t            m_timestamp;        /**< Timestamp of the last update in ms. */
+    uint32_t            m_elapsed;          /**< Time in ms, the current frame is already shown. */
 
     /**
      * Is the current frame the very first one?
@@ -0,0 +1,429 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Text box widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TextWidget.h"
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TextBoxWidget.h"
+
+#include <Arduino.h>
+#include <TomThumb.h>
+#include <Utf8Decoder.hpp>
+#include <YAGfxMap.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize text box widget type. */
+const char*     TextBoxWidget::WIDGET_TYPE  = "textBox";
+
+/* Initialize default font */
+const YAFont    TextBoxWidget::DEFAULT_FONT = &TomThumb;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+TextBoxWidget::TextBoxWidget(const TextBoxWidget& widget) :
+    Widget(widget),
+    m_width(widget.m_width),
+    m_height(widget.m_height),
+    m_text(widget.m_text),
+    m_gfxText(widget.m_gfxText),
+    m_mode(widget.m_mode),
+    m_pageDuration(widget.m_pageDuration),
+    m_scrollSpeed(widget.m_scrollSpeed),
+    m_isLayoutValid(widget.m_isLayoutValid),
+    m_lines(),
+    m_lineCnt(widget.m_lineCnt),
+    m_offset(widget.m_offset),
+    m_timestamp(widget.m_timestamp),
+    m_isTimestampValid(widget.m_isTimestampValid),
+    m_cycleCnt(widget.m_cycleCnt)
+{
+    uint16_t idx = 0U;
+
+    for(idx = 0U; idx < m_lineCnt; ++idx)
+    {
+        m_lines[idx] = widget.m_lines[idx];
+    }
+}
+
+TextBoxWidget& TextBoxWidget::operator=(const TextBoxWidget& widget)
+{
+    if (&widget != this)
+    {
+        uint16_t idx = 0U;
+
+        Widget::operator=(widget);
+
+        m_width             = widget.m_width;
+        m_height            = widget.m_height;
+        m_text              = widget.m_text;
+        m_gfxText           = widget.m_gfxText;
+        m_mode              = widget.m_mode;
+        m_pageDuration      = widget.m_pageDuration;
+        m_scrollSpeed       = widget.m_scrollSpeed;
+        m_isLayoutValid     = widget.m_isLayoutValid;
+        m_lineCnt           = widget.m_lineCnt;
+        m_offset            = widget.m_offset;
+        m_timestamp         = widget.m_timestamp;
+        m_isTimestampValid  = widget.m_isTimestampValid;
+        m_cycleCnt          = widget.m_cycleCnt;
+
+        for(idx = 0U; idx < m_lineCnt; ++idx)
+        {
+            m_lines[idx] = widget.m_lines[idx];
+        }
+    }
+
+    return *this;
+}
+
+uint16_t TextBoxWidget::getLinesPerPage() const
+{
+    uint16_t fontHeight     = m_gfxText.getFont().getHeight();
+    uint16_t linesPerPage   = 0U;
+
+    if (0U < fontHeight)
+    {
+        linesPerPage = m_height / fontHeight;
+    }
+
+    /* At least one line is shown, even if it is clipped. */
+    if (0U == linesPerPage)
+    {
+        linesPerPage = 1U;
+    }
+
+    return linesPerPage;
+}
+
+uint16_t TextBoxWidget::getPageCount()
+{
+    uint16_t linesPerPage = getLinesPerPage();
+
+    updateLayout();
+
+    return (m_lineCnt + linesPerPage - 1U) / linesPerPage;
+}
+
+uint16_t TextBoxWidget::getPage() const
+{
+    uint16_t page = 0U;
+
+    if (MODE_PAGE == m_mode)
+    {
+        page = m_offset;
+    }
+
+    return page;
+}
+
+bool TextBoxWidget::getLine(uint16_t index, String& line)
+{
+    bool status = false;
+
+    updateLayout();
+
+    if (m_lineCnt > index)
+    {
+        const Line& lineInfo = m_lines[index];
+
+        line    = m_text.substring(lineInfo.begin, lineInfo.begin + lineInfo.length);
+        status  = true;
+    }
+
+    return status;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void TextBoxWidget::paint(YAGfx& gfx)
+{
+    YAGfxMap    canvas(gfx, m_posX, m_posY, m_width, m_height);
+    uint16_t    fontHeight      = m_gfxText.getFont().getHeight();
+    uint16_t    linesPerPage    = getLinesPerPage();
+    uint16_t    idx             = 0U;
+
+    updateLayout();
+    advance();
+
+    if ((0U < fontHeight) &&
+        (0U < m_lineCnt))
+    {
+        if ((MODE_PAGE == m_mode) ||
+            (linesPerPage >= m_lineCnt))
+        {
+            uint16_t firstLine = getPage() * linesPerPage;
+
+            for(idx = 0U; (idx < linesPerPage) && ((firstLine + idx) < m_lineCnt); ++idx)
+            {
+                drawLine(canvas, firstLine + idx, idx * fontHeight);
+            }
+        }
+        else
+        {
+            /* The text is repeated seamless, separated by a empty line. */
+            int32_t cycleHeight = (m_lineCnt + 1U) * fontHeight;
+
+            for(idx = 0U; idx < m_lineCnt; ++idx)
+            {
+                int32_t y = static_cast<int32_t>(idx * fontHeight) - static_cast<int32_t>(m_offset);
+
+                if ((-static_cast<int32_t>(fontHeight) < y) &&
+                    (m_height > y))
+                {
+                    drawLine(canvas, idx, y);
+                }
+
+                /* Line of the repeated text */
+                y += cycleHeight;
+
+                if (m_height > y)
+                {
+                    drawLine(canvas, idx, y);
+                }
+            }
+        }
+    }
+}
+
+void TextBoxWidget::updateLayout()
+{
+    if (false == m_isLayoutValid)
+    {
+        const YAFont&   font                = m_gfxText.getFont();
+        const char*     text                = m_text.c_str();
+        uint16_t        textLength          = m_text.length();
+        Utf8Decoder     decoder;
+        uint16_t        idx                 = 0U;
+        uint16_t        codePointBegin      = 0U;
+        uint16_t        lineBegin           = 0U;
+        uint16_t        lineWidth           = 0U;
+        bool            isBreakAvailable    = false;
+        uint16_t        breakIdx            = 0U;
+        uint16_t        widthAfterBreak     = 0U;
+
+        m_lineCnt = 0U;
+
+        for(idx = 0U; idx < textLength; ++idx)
+        {
+            uint32_t    codePoint   = 0U;
+            bool        isAvailable = decoder.decode(text[idx], codePoint);
+
+            /* A interrupted UTF-8 sequence completes several ISO 8859-1 code
+             * points at once, each with a single byte.
+             */
+            while(true == isAvailable)
+            {
+                if ('\n' == codePoint)
+                {
+                    addLine(lineBegin, codePointBegin);
+
+                    lineBegin           = idx + 1U;
+                    lineWidth           = 0U;
+                    isBreakAvailable    = false;
+                }
+                else
+                {
+                    uint16_t charWidth  = 0U;
+                    uint16_t charHeight = 0U;
+
+                    /* Code points, which are not available in the font, have no width. */
+                    if (false == font.getCodePointBoundingBox(codePoint, charWidth, charHeight))
+                    {
+                        charWidth = 0U;
+                    }
+
+                    /* A space is a possible line break. */
+                    if (' ' == codePoint)
+                    {
+                        lineWidth           += charWidth;
+                        isBreakAvailable    = true;
+                        breakIdx            = codePointBegin;
+                        widthAfterBreak     = lineWidth;
+                    }
+                    /* Line break necessary? A single character per line is always accepted. */
+                    else if ((m_width < (lineWidth + charWidth)) &&
+                             (lineBegin < codePointBegin))
+                    {
+                        /* Break on word boundary. */
+                        if (true == isBreakAvailable)
+                        {
+                            addLine(lineBegin, breakIdx);
+
+                            lineBegin   = breakIdx + 1U;
+                            lineWidth   -= widthAfterBreak;
+                        }
+                        /* The word is wider than the box, break it at the border. */
+                        else
+                        {
+                            addLine(lineBegin, codePointBegin);
+
+                            lineBegin   = codePointBegin;
+                            lineWidth   = 0U;
+                        }
+
+                        isBreakAvailable    = false;
+                        lineWidth           += charWidth;
+                    }
+                    else
+                    {
+                        lineWidth += charWidth;
+                    }
+                }
+
+                ++codePointBegin;
+                isAvailable = decoder.next(codePoint);
+            }
+
+            /* The next code point begins with the pending sequence. */
+            codePointBegin = idx + 1U - decoder.getPendingCnt();
+        }
+
+        if (textLength > lineBegin)
+        {
+            addLine(lineBegin, textLength);
+        }
+
+        m_isLayoutValid = true;
+        restart();
+    }
+}
+
+void TextBoxWidget::addLine(uint16_t begin, uint16_t end)
+{
+    if (MAX_LINES > m_lineCnt)
+    {
+        m_lines[m_lineCnt].begin    = begin;
+        m_lines[m_lineCnt].length   = end - begin;
+        ++m_lineCnt;
+    }
+}
+
+void TextBoxWidget::advance()
+{
+    uint32_t timestamp = millis();
+
+    /* The time starts with the first paint. Nothing to do, as long as the text fits into the box. */
+    if ((false == m_isTimestampValid) ||
+        (getLinesPerPage() >= m_lineCnt))
+    {
+        m_timestamp         = timestamp;
+        m_isTimestampValid  = true;
+    }
+    else if (MODE_PAGE == m_mode)
+    {
+        if (m_pageDuration <= (timestamp - m_timestamp))
+        {
+            m_timestamp = timestamp;
+            ++m_offset;
+
+            if (getPageCount() <= m_offset)
+            {
+                m_offset = 0U;
+                ++m_cycleCnt;
+            }
+        }
+    }
+    else
+    {
+        uint32_t elapsed    = timestamp - m_timestamp;
+        uint32_t steps      = (elapsed * m_scrollSpeed) / 1000U;
+
+        if (0U < steps)
+        {
+            uint32_t cycleHeight = (m_lineCnt + 1U) * m_gfxText.getFont().getHeight();
+
+            /* Keep the remaining time, which was not enough for a whole pixel. */
+            m_timestamp += (steps * 1000U) / m_scrollSpeed;
+            m_offset    += steps;
+
+            while(cycleHeight <= m_offset)
+            {
+                m_offset -= cycleHeight;
+                ++m_cycleCnt;
+            }
+        }
+    }
+}
+
+void TextBoxWidget::drawLine(YAGfx& gfx, uint16_t index, int16_t y)
+{
+    const Line& line    = m_lines[index];
+    const char* text    = m_text.c_str();
+    uint16_t    idx     = 0U;
+
+    /* Set cursor to baseline. */
+    m_gfxText.setTextCursorPos(0, y + m_gfxText.getFont().getHeight() - 1);
+
+    for(idx = 0U; idx < line.length; ++idx)
+    {
+        m_gfxText.drawChar(gfx, text[line.begin + idx]);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,521 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Text box widget
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __TEXT_BOX_WIDGET_H__
+#define __TEXT_BOX_WIDGET_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <WString.h>
+#include <Widget.hpp>
+#include <YAColor.h>
+#include <YAFont.h>
+#include <YAGfxText.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A text box widget, which shows a text over multiple lines.
+ *
+ * The text is broken into lines on word boundaries (spaces). A word, which
+ * is wider than the box, is broken at the box border. A newline ('\n') forces
+ * a line break. The text is UTF-8 encoded and doesn't support format tags.
+ *
+ * The line layout is calculated only once after the text, the font or the
+ * box size changed. Painting just walks over the cached line table.
+ *
+ * If the text needs more lines than fit into the box, it is either shown
+ * page by page or scrolled vertically.
+ */
+class TextBoxWidget : public Widget
+{
+public:
+
+    /**
+     * Mode how a text, which needs more lines than fit into the box, is shown.
+     */
+    enum Mode
+    {
+        MODE_PAGE = 0,  /**< Show page by page, each page for the page duration. */
+        MODE_SCROLL     /**< Scroll vertically with the scroll speed. */
+    };
+
+    /**
+     * Constructs a text box widget with a empty text in default color.
+     *
+     * @param[in] width     Box width in pixel
+     * @param[in] height    Box height in pixel
+     */
+    TextBoxWidget(uint16_t width = 0U, uint16_t height = 0U) :
+        Widget(WIDGET_TYPE),
+        m_width(width),
+        m_height(height),
+        m_text(),
+        m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
+        m_mode(MODE_PAGE),
+        m_pageDuration(DEFAULT_PAGE_DURATION),
+        m_scrollSpeed(DEFAULT_SCROLL_SPEED),
+        m_isLayoutValid(false),
+        m_lines(),
+        m_lineCnt(0U),
+        m_offset(0U),
+        m_timestamp(0U),
+        m_isTimestampValid(false),
+        m_cycleCnt(0U)
+    {
+    }
+
+    /**
+     * Constructs a text box widget by copying another one.
+     *
+     * @param[in] widget Widget, which to copy
+     */
+    TextBoxWidget(const TextBoxWidget& widget);
+
+    /**
+     * Destroys the text box widget.
+     */
+    ~TextBoxWidget()
+    {
+    }
+
+    /**
+     * Assign the content of a text box widget.
+     *
+     * @param[in] widget Widget, which to assign
+     *
+     * @return Text box widget
+     */
+    TextBoxWidget& operator=(const TextBoxWidget& widget);
+
+    /**
+     * Set the box size.
+     *
+     * @param[in] width     Box width in pixel
+     * @param[in] height    Box height in pixel
+     */
+    void setSize(uint16_t width, uint16_t height)
+    {
+        if ((width != m_width) ||
+            (height != m_height))
+        {
+            m_width         = width;
+            m_height        = height;
+            m_isLayoutValid = false;
+            invalidate();
+        }
+    }
+
+    /**
+     * Get box width.
+     *
+     * @return Box width in pixel
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get box height.
+     *
+     * @return Box height in pixel
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * Set the text. It will be shown from the beginning.
+     * Setting the same text again, has no effect.
+     *
+     * @param[in] text  UTF-8 encoded text
+     */
+    void setText(const String& text)
+    {
+        if (text != m_text)
+        {
+            m_text          = text;
+            m_isLayoutValid = false;
+            invalidate();
+        }
+    }
+
+    /**
+     * Get the text.
+     *
+     * @return Text
+     */
+    const String& getText() const
+    {
+        return m_text;
+    }
+
+    /**
+     * Set the text color.
+     *
+     * @param[in] color Text color
+     */
+    void setTextColor(const Color& color)
+    {
+        m_gfxText.setTextColor(color);
+        invalidate();
+    }
+
+    /**
+     * Get the text color.
+     *
+     * @return Text color
+     */
+    Color getTextColor() const
+    {
+        return m_gfxText.getTextColor();
+    }
+
+    /**
+     * Set the font.
+     *
+     * @param[in] font  Font
+     */
+    void setFont(const YAFont& font)
+    {
+        m_gfxText.setFont(font);
+        m_isLayoutValid = false;
+        invalidate();
+    }
+
+    /**
+     * Get the font.
+     *
+     * @return Font
+     */
+    const YAFont& getFont() const
+    {
+        return m_gfxText.getFont();
+    }
+
+    /**
+     * Set the mode, how a text is shown, which doesn't fit into the box.
+     *
+     * @param[in] mode  Mode
+     */
+    void setMode(Mode mode)
+    {
+        m_mode = mode;
+        restart();
+    }
+
+    /**
+     * Get the mode, how a text is shown, which doesn't fit into the box.
+     *
+     * @return Mode
+     */
+    Mode getMode() const
+    {
+        return m_mode;
+    }
+
+    /**
+     * Set the duration, how long a single page is shown in page mode.
+     *
+     * @param[in] duration  Page duration in ms. 0 is not allowed.
+     *
+     * @return If successful set, it will return true otherwise false.
+     */
+    bool setPageDuration(uint32_t duration)
+    {
+        bool status = false;
+
+        if (0U < duration)
+        {
+            m_pageDuration  = duration;
+            status          = true;
+        }
+
+        return status;
+    }
+
+    /**
+     * Get the page duration in page mode.
+     *
+     * @return Page duration in ms
+     */
+    uint32_t getPageDuration() const
+    {
+        return m_pageDuration;
+    }
+
+    /**
+     * Set the vertical scroll speed in scroll mode.
+     *
+     * @param[in] speed Scroll speed in pixel per second. 0 is not allowed.
+     *
+     * @return If successful set, it will return true otherwise false.
+     */
+    bool setScrollSpeed(uint16_t speed)
+    {
+        bool status = false;
+
+        if (0U < speed)
+        {
+            m_scrollSpeed   = speed;
+            status          = true;
+        }
+
+        return status;
+    }
+
+    /**
+     * Get the vertical scroll speed in scroll mode.
+     *
+     * @return Scroll speed in pixel per second
+     */
+    uint16_t getScrollSpeed() const
+    {
+        return m_scrollSpeed;
+    }
+
+    /**
+     * Get the number of lines of the current text.
+     * The layout is calculated on demand, if necessary.
+     *
+     * @return Number of lines
+     */
+    uint16_t getLineCount()
+    {
+        updateLayout();
+        return m_lineCnt;
+    }
+
+    /**
+     * Get the number of lines, which fit into the box.
+     *
+     * @return Number of lines per page
+     */
+    uint16_t getLinesPerPage() const;
+
+    /**
+     * Get the number of pages of the current text.
+     * The layout is calculated on demand, if necessary.
+     *
+     * @return Number of pages
+     */
+    uint16_t getPageCount();
+
+    /**
+     * Get the index of the current shown page in page mode.
+     *
+     * @return Page index
+     */
+    uint16_t getPage() const;
+
+    /**
+     * Get a line of the current text.
+     * The layout is calculated on demand, if necessary.
+     *
+     * @param[in]   index   Line index
+     * @param[out]  line    Line text
+     *
+     * @return If the line is available, it will return true otherwise false.
+     */
+    bool getLine(uint16_t index, String& line);
+
+    /**
+     * How often was the whole text shown completely?
+     * In page mode, it counts the page cycles. In scroll mode, it counts how
+     * often the text was scrolled completely through the box. If the text fits
+     * into the box, it stays 0.
+     *
+     * @return Number of complete cycles
+     */
+    uint32_t getCycleCount() const
+    {
+        return m_cycleCnt;
+    }
+
+    /**
+     * Show the text from the beginning again.
+     */
+    void restart()
+    {
+        m_offset            = 0U;
+        m_isTimestampValid  = false;
+        m_cycleCnt          = 0U;
+        invalidate();
+    }
+
+    /**
+     * Is the widget dirty and needs to be repainted?
+     * A text, which doesn't fit into the box, is paged or scrolled and
+     * needs to be repainted continuously.
+     *
+     * @return If the widget needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const override
+    {
+        bool isDirty = Widget::isDirty();
+
+        if ((false == isDirty) &&
+            (true == m_isEnabled))
+        {
+            isDirty = ((false == m_isLayoutValid) ||
+                       (getLinesPerPage() < m_lineCnt));
+        }
+
+        return isDirty;
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the box.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a text box is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, m_width, m_height);
+
+        return true;
+    }
+
+    /** Widget type string */
+    static const char*      WIDGET_TYPE;
+
+    /** Default text color */
+    static const uint32_t   DEFAULT_TEXT_COLOR      = ColorDef::WHITE;
+
+    /** Default font */
+    static const YAFont     DEFAULT_FONT;
+
+    /** Default page duration in ms */
+    static const uint32_t   DEFAULT_PAGE_DURATION   = 3000U;
+
+    /** Default scroll speed in pixel per second */
+    static const uint16_t   DEFAULT_SCROLL_SPEED    = 8U;
+
+    /** Max. number of lines, which are laid out. Further lines are dropped. */
+    static const uint16_t   MAX_LINES               = 32U;
+
+private:
+
+    /**
+     * A single laid out line.
+     */
+    struct Line
+    {
+        uint16_t    begin;  /**< Index of the first character in the text */
+        uint16_t    length; /**< Number of characters (bytes, not code points) */
+
+        /**
+         * Initializes a empty line.
+         */
+        Line() :
+            begin(0U),
+            length(0U)
+        {
+        }
+    };
+
+    uint16_t    m_width;            /**< Box width in pixel */
+    uint16_t    m_height;           /**< Box height in pixel */
+    String      m_text;             /**< UTF-8 encoded text */
+    YAGfxText   m_gfxText;          /**< Text gfx with font and color */
+    Mode        m_mode;             /**< Mode how a text is shown, which doesn't fit into the box. */
+    uint32_t    m_pageDuration;     /**< Page duration in ms */
+    uint16_t    m_scrollSpeed;      /**< Scroll speed in pixel per second */
+    bool        m_isLayoutValid;    /**< Is the line layout valid? */
+    Line        m_lines[MAX_LINES]; /**< Line layout */
+    uint16_t    m_lineCnt;          /**< Number of laid out lines */
+    uint32_t    m_offset;           /**< Page mode: Page index, scroll mode: Vertical scroll offset in pixel */
+    uint32_t    m_timestamp;        /**< Timestamp in ms of the last page change or scroll movement */
+    bool        m_isTimestampValid; /**< Is the timestamp valid? */
+    uint32_t    m_cycleCnt;         /**< Number of complete shown cycles */
+
+    /**
+     * Paint the widget with the given graphics interface.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void paint(YAGfx& gfx) override;
+
+    /**
+     * Calculate the line layout, if it is not valid anymore.
+     */
+    void updateLayout();
+
+    /**
+     * Append a line to the line table. If the table is full, the line is dropped.
+     *
+     * @param[in] begin     Index of the first character in the text
+     * @param[in] end       Index after the last character in the text
+     */
+    void addLine(uint16_t begin, uint16_t end);
+
+    /**
+     * Advance the page or the scroll offset according to the elapsed time.
+     */
+    void advance();
+
+    /**
+     * Draw a single line.
+     *
+     * @param[in] gfx   Graphics interface
+     * @param[in] index Line index
+     * @param[in] y     y-coordinate of the upper line border
+     */
+    void drawLine(YAGfx& gfx, uint16_t index, int16_t y);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __TEXT_BOX_WIDGET_H__ */
+
+/** @} */
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Text layout cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TextLayoutCache.h"
+
+#include <Util.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+TextLayoutCache::TextLayoutCache() :
+    m_entries(),
+    m_nextEntry(0U)
+{
+}
+
+TextLayoutCache::TextLayoutCache(const TextLayoutCache& cache) :
+    m_entries(),
+    m_nextEntry(cache.m_nextEntry)
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < SIZE; ++idx)
+    {
+        m_entries[idx] = cache.m_entries[idx];
+    }
+}
+
+TextLayoutCache& TextLayoutCache::operator=(const TextLayoutCache& cache)
+{
+    if (&cache != this)
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < SIZE; ++idx)
+        {
+            m_entries[idx] = cache.m_entries[idx];
+        }
+
+        m_nextEntry = cache.m_nextEntry;
+    }
+
+    return *this;
+}
+
+TextLayoutCache::Key TextLayoutCache::calcKey(const YAGfxText& gfxText, uint16_t width, const char* text)
+{
+    const YAFont&   font    = gfxText.getFont();
+    Key             key;
+
+    /* Different texts may have the same hash. Therefore the text length is
+     * compared too, which makes a collision of the short texts on a display
+     * very unlikely.
+     */
+    key.hash        = Util::hashFnv1aStr(text);
+    key.textLength  = strlen(text);
+    key.gfxFont     = font.getGfxFont();
+    key.unicodeFont = font.getUnicodeFont();
+    key.isWrapped   = gfxText.isTextWrapEnabled();
+
+    /* The canvas width has only influence, if the text is wrapped around. */
+    if (true == key.isWrapped)
+    {
+        key.width = width;
+    }
+
+    return key;
+}
+
+bool TextLayoutCache::find(const Key& key, uint16_t& boxWidth, uint16_t& boxHeight) const
+{
+    bool    isFound = false;
+    uint8_t idx     = 0U;
+
+    for(idx = 0U; idx < SIZE; ++idx)
+    {
+        if ((true == m_entries[idx].isValid) &&
+            (true == key.isEqual(m_entries[idx].key)))
+        {
+            boxWidth    = m_entries[idx].boxWidth;
+            boxHeight   = m_entries[idx].boxHeight;
+            isFound     = true;
+            break;
+        }
+    }
+
+    return isFound;
+}
+
+void TextLayoutCache::add(const Key& key, uint16_t boxWidth, uint16_t boxHeight)
+{
+    Entry& entry = m_entries[m_nextEntry];
+
+    entry.key       = key;
+    entry.boxWidth  = boxWidth;
+    entry.boxHeight = boxHeight;
+    entry.isValid   = true;
+
+    ++m_nextEntry;
+    m_nextEntry %= SIZE;
+}
+
+void TextLayoutCache::clear()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < SIZE; ++idx)
+    {
+        m_entries[idx].isValid = false;
+    }
+
+    m_nextEntry = 0U;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
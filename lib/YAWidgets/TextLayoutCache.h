@@ -0,0 +1,216 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Text layout cache
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __TEXT_LAYOUT_CACHE_H__
+#define __TEXT_LAYOUT_CACHE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAFont.h>
+#include <YAGfxText.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A small cache for measured text bounding boxes.
+ *
+ * Measuring a text with a proportional font means to walk over every glyph.
+ * The cache is keyed by a hash over the text, its length, the font and the
+ * layout parameters, which influence the result. Only the text is hashed,
+ * all other parameters are compared exactly. If the cache is full, the
+ * oldest entry is replaced.
+ */
+class TextLayoutCache
+{
+public:
+
+    /** Number of cache entries. */
+    static const uint8_t    SIZE    = 4U;
+
+    /**
+     * Cache key of a text.
+     */
+    struct Key
+    {
+        uint32_t            hash;           /**< Hash over the text */
+        size_t              textLength;     /**< Text length in byte */
+        const GFXfont*      gfxFont;        /**< Font for the basic latin characters */
+        const UnicodeFont*  unicodeFont;    /**< Font for the other unicode characters */
+        bool                isWrapped;      /**< Is the text wrapped around? */
+        uint16_t            width;          /**< Canvas width in pixel, only relevant if the text is wrapped around. */
+
+        /**
+         * Initializes a empty key.
+         */
+        Key() :
+            hash(0U),
+            textLength(0U),
+            gfxFont(nullptr),
+            unicodeFont(nullptr),
+            isWrapped(false),
+            width(0U)
+        {
+        }
+
+        /**
+         * Is the key equal to another key?
+         *
+         * @param[in] key   Other key
+         *
+         * @return If equal, it will return true otherwise false.
+         */
+        bool isEqual(const Key& key) const
+        {
+            return ((key.hash == hash) &&
+                    (key.textLength == textLength) &&
+                    (key.gfxFont == gfxFont) &&
+                    (key.unicodeFont == unicodeFont) &&
+                    (key.isWrapped == isWrapped) &&
+                    (key.width == width));
+        }
+    };
+
+    /**
+     * Constructs a empty cache.
+     */
+    TextLayoutCache();
+
+    /**
+     * Constructs a cache by copy.
+     *
+     * @param[in] cache Cache, which to copy.
+     */
+    TextLayoutCache(const TextLayoutCache& cache);
+
+    /**
+     * Destroys the cache.
+     */
+    ~TextLayoutCache()
+    {
+    }
+
+    /**
+     * Assigns a cache.
+     *
+     * @param[in] cache Cache, which to assign.
+     *
+     * @return Cache
+     */
+    TextLayoutCache& operator=(const TextLayoutCache& cache);
+
+    /**
+     * Calculate the cache key of a text.
+     *
+     * @param[in] gfxText   Text gfx, which provides the font and the text wrap configuration.
+     * @param[in] width     Canvas width in pixel, which is considered for text wrap around.
+     * @param[in] text      The text, which may contain keywords (format tags).
+     *
+     * @return Cache key
+     */
+    static Key calcKey(const YAGfxText& gfxText, uint16_t width, const char* text);
+
+    /**
+     * Find the bounding box of a text in the cache.
+     *
+     * @param[in]   key         Cache key of the text
+     * @param[out]  boxWidth    Bounding box width in pixel
+     * @param[out]  boxHeight   Bounding box height in pixel
+     *
+     * @return If the text is cached, it will return true otherwise false.
+     */
+    bool find(const Key& key, uint16_t& boxWidth, uint16_t& boxHeight) const;
+
+    /**
+     * Add the bounding box of a text to the cache.
+     * If the cache is full, the oldest entry will be replaced.
+     *
+     * @param[in] key       Cache key of the text
+     * @param[in] boxWidth  Bounding box width in pixel
+     * @param[in] boxHeight Bounding box height in pixel
+     */
+    void add(const Key& key, uint16_t boxWidth, uint16_t boxHeight);
+
+    /**
+     * Remove all cache entries.
+     */
+    void clear();
+
+private:
+
+    /**
+     * A single cache entry.
+     */
+    struct Entry
+    {
+        Key         key;        /**< Text, font and layout parameters */
+        uint16_t    boxWidth;   /**< Bounding box width in pixel */
+        uint16_t    boxHeight;  /**< Bounding box height in pixel */
+        bool        isValid;    /**< Is entry valid? */
+
+        /**
+         * Initializes a empty cache entry.
+         */
+        Entry() :
+            key(),
+            boxWidth(0U),
+            boxHeight(0U),
+            isValid(false)
+        {
+        }
+    };
+
+    Entry       m_entries[SIZE];    /**< Cache entries */
+    uint8_t     m_nextEntry;        /**< Index of the entry, which will be replaced next. */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __TEXT_LAYOUT_CACHE_H__ */
+
+/** @} */
@@ -34,6 +34,7 @@
  *****************************************************************************/
 #include "TextWidget.h"
 
+#include <Arduino.h>
 #include <TomThumb.h>
 #include <Util.h>
 
@@ -63,7 +64,7 @@
 const char*                 TextWidget::WIDGET_TYPE         = "text";
 
 /* Initialize default font */
-const GFXfont*              TextWidget::DEFAULT_FONT        = &TomThumb;
+const YAFont                TextWidget::DEFAULT_FONT        = &TomThumb;
 
 /* Initialize keyword list */
 TextWidget::KeywordHandler  TextWidget::m_keywordHandlers[] =
@@ -92,10 +93,9 @@ void TextWidget::prepareNewText(YAGfx& gfx)
     const uint16_t  SCROLL_DISTANCE = gfx.getWidth() / 2U; /* Distance in pixel after a scrolling text starts to repeat. */
     uint16_t        textWidth       = 0U;
     uint16_t        textHeight      = 0U;
-    String          str             = removeFormatTags(m_formatStrNew);
 
     /* Get bounding box of the text, without any format tags. */
-    if (true == m_gfxText.getTextBoundingBox(gfx.getWidth(), gfx.getHeight(), str.c_str(), textWidth, textHeight))
+    if (true == getTextBoundingBox(gfx, m_gfxText, m_formatStrNew.c_str(), textWidth, textHeight))
     {
         m_scrollInfoNew.textWidth   = textWidth;
         m_handleNewText             = true;
@@ -163,8 +163,8 @@ void TextWidget::prepareNewText(YAGfx& gfx)
                     m_scrollInfoNew.offset = gfx.getWidth();
                 }
 
-                /* Because the scroll timer is stopped, it must be enabled again. */
-                m_scrollTimer.start(0U);
+                /* Because scrolling is stopped, it must be started again. */
+                startScrolling();
             }
         }
         /* Current text is scrolling. */
@@ -228,86 +228,153 @@ void TextWidget::paint(YAGfx& gfx)
         show(gfx, m_formatStrNew, m_scrollInfoNew.isEnabled);
     }
 
-    /* Is it time to scroll the text(s) again? */
-    if (true == m_scrollTimer.isTimeout())
+    /* Move the text(s) according to the elapsed time. */
+    if (true == m_scrollInfo.isEnabled)
     {
-        /* Handle scrolling text. */
-        if (m_scrollInfo.offsetDest < m_scrollInfo.offset)
+        uint32_t steps = getScrollSteps();
+
+        while((0U < steps) &&
+              (true == m_scrollInfo.isEnabled))
         {
-            --m_scrollInfo.offset;
+            scroll(gfx);
+            --steps;
         }
-        else if (m_scrollInfo.offsetDest > m_scrollInfo.offset)
+    }
+
+    return;
+}
+
+void TextWidget::startScrolling()
+{
+    m_scrollTimestamp   = millis();
+    m_scrollDistance    = 0U;
+}
+
+uint32_t TextWidget::getScrollSteps()
+{
+    /* The scroll distance is calculated in 1/256 pixel per second and the
+     * elapsed time in ms. Dividing is done just for the whole pixels, so no
+     * rounding error accumulates over time.
+     */
+    const uint32_t  FRACTION_BITS   = 8U;
+    const uint32_t  ONE_PIXEL       = (1U << FRACTION_BITS) * 1000U;
+    const uint32_t  MAX_ELAPSED     = 250U; /* Limit in ms, avoids a jump after the widget wasn't drawn for a while. */
+    uint32_t        timestamp       = millis();
+    uint32_t        elapsed         = timestamp - m_scrollTimestamp;
+    uint32_t        speed           = 0U;   /* [1/256 pixel / s] */
+    uint32_t        steps           = 0U;
+
+    if (MAX_ELAPSED < elapsed)
+    {
+        elapsed = MAX_ELAPSED;
+    }
+
+    if (0U == m_scrollSpeed)
+    {
+        speed = (1000U << FRACTION_BITS) / m_scrollPause;
+    }
+    else
+    {
+        speed = static_cast<uint32_t>(m_scrollSpeed) << FRACTION_BITS;
+    }
+
+    m_scrollTimestamp   = timestamp;
+    m_scrollDistance   += elapsed * speed;
+    steps               = m_scrollDistance / ONE_PIXEL;
+    m_scrollDistance   %= ONE_PIXEL;
+
+    return steps;
+}
+
+void TextWidget::scroll(YAGfx& gfx)
+{
+    /* Handle scrolling text. */
+    if (m_scrollInfo.offsetDest < m_scrollInfo.offset)
+    {
+        --m_scrollInfo.offset;
+    }
+    else if (m_scrollInfo.offsetDest > m_scrollInfo.offset)
+    {
+        ++m_scrollInfo.offset;
+    }
+    else if (false == m_handleNewText)
+    {
+        m_scrollInfo.offset = gfx.getWidth();
+        
+        ++m_scrollingCnt;
+    }
+    else
+    {
+        /* Wait till new text is at destination position. */
+        ;
+    }
+
+    /* Handle scrolling new text. */
+    if (true == m_handleNewText)
+    {
+        if (m_scrollInfoNew.offsetDest < m_scrollInfoNew.offset)
         {
-            ++m_scrollInfo.offset;
+            --m_scrollInfoNew.offset;
         }
-        else if (false == m_handleNewText)
+        else if (m_scrollInfoNew.offsetDest > m_scrollInfoNew.offset)
         {
-            m_scrollInfo.offset = gfx.getWidth();
-            
-            ++m_scrollingCnt;
+            ++m_scrollInfoNew.offset;
         }
         else
         {
-            /* Wait till new text is at destination position. */
-            ;
-        }
+            m_handleNewText = false;
+            m_formatStr     = m_formatStrNew;
+            m_scrollingCnt  = 0U;
 
-        /* Handle scrolling new text. */
-        if (true == m_handleNewText)
-        {
-            if (m_scrollInfoNew.offsetDest < m_scrollInfoNew.offset)
+            /* If the new text can be shown static, it must be stopped scrolling  now. */
+            if (true == m_scrollInfoNew.stopAtDest)
             {
-                --m_scrollInfoNew.offset;
+                m_scrollInfoNew.isEnabled   = false;
+                m_scrollInfoNew.stopAtDest  = false;
             }
-            else if (m_scrollInfoNew.offsetDest > m_scrollInfoNew.offset)
+
+            /* Show new text static? */
+            if (false == m_scrollInfoNew.isEnabled)
             {
-                ++m_scrollInfoNew.offset;
+                m_scrollInfo.isEnabled  = false;
+                m_scrollInfo.stopAtDest = false;
+                m_scrollInfo.offsetDest = 0;
+                m_scrollInfo.offset     = 0;
+                m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
             }
             else
+            /* Continue scrolling with new text. */
             {
-                m_handleNewText = false;
-                m_formatStr     = m_formatStrNew;
-                m_scrollingCnt  = 0U;
-
-                /* If the new text can be shown static, it must be stopped scrolling  now. */
-                if (true == m_scrollInfoNew.stopAtDest)
-                {
-                    m_scrollInfoNew.isEnabled   = false;
-                    m_scrollInfoNew.stopAtDest  = false;
-                }
-
-                /* Show new text static? */
-                if (false == m_scrollInfoNew.isEnabled)
-                {
-                    m_scrollInfo.isEnabled  = false;
-                    m_scrollInfo.stopAtDest = false;
-                    m_scrollInfo.offsetDest = 0;
-                    m_scrollInfo.offset     = 0;
-                    m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
-                }
-                else
-                /* Continue scrolling with new text. */
-                {
-                    m_scrollInfo.isEnabled  = true;
-                    m_scrollInfo.stopAtDest = false;
-                    m_scrollInfo.offsetDest = -m_scrollInfoNew.textWidth;
-                    m_scrollInfo.offset     = m_scrollInfoNew.offset - 1;   /* Because new text is already at most left position, decrease one pixel to avoid a short stumble. */
-                    m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
-                }
+                m_scrollInfo.isEnabled  = true;
+                m_scrollInfo.stopAtDest = false;
+                m_scrollInfo.offsetDest = -m_scrollInfoNew.textWidth;
+                m_scrollInfo.offset     = m_scrollInfoNew.offset - 1;   /* Because new text is already at most left position, decrease one pixel to avoid a short stumble. */
+                m_scrollInfo.textWidth  = m_scrollInfoNew.textWidth;
             }
         }
+    }
 
-        if (false == m_scrollInfo.isEnabled)
-        {
-            m_scrollTimer.stop();
-        }
-        else
+    return;
+}
+
+bool TextWidget::getTextBoundingBox(const YAGfx& gfx, const YAGfxText& gfxText, const char* formatStr, uint16_t& textWidth, uint16_t& textHeight) const
+{
+    bool                    status  = true;
+    TextLayoutCache::Key    key     = TextLayoutCache::calcKey(gfxText, gfx.getWidth(), formatStr);
+
+    if (false == m_layoutCache.find(key, textWidth, textHeight))
+    {
+        String text = removeFormatTags(formatStr);
+
+        status = gfxText.getTextBoundingBox(gfx.getWidth(), gfx.getHeight(), text.c_str(), textWidth, textHeight);
+
+        if (true == status)
         {
-            m_scrollTimer.start(m_scrollPause);
+            m_layoutCache.add(key, textWidth, textHeight);
         }
     }
 
-    return;
+    return status;
 }
 
 String TextWidget::removeFormatTags(const String& formatStr) const
@@ -493,11 +560,10 @@ bool TextWidget::handleAlignment(YAGfx* gfx, YAGfxText* gfxText, bool noAction,
             (nullptr != gfxText) &&
             (false == isScrolling))
         {
-            String      text        = removeFormatTags(formatStr.substring(KEYWORD_LEN));
             uint16_t    textWidth   = 0U;
             uint16_t    textHeight  = 0U;
 
-            if (true == gfxText->getTextBoundingBox(gfx->getWidth(), gfx->getHeight(), text.c_str(), textWidth, textHeight))
+            if (true == getTextBoundingBox(*gfx, *gfxText, formatStr.c_str() + KEYWORD_LEN, textWidth, textHeight))
             {
                 gfxText->setTextCursorPos(gfx->getWidth() - textWidth, gfxText->getTextCursorPosY());
             }
@@ -514,11 +580,10 @@ bool TextWidget::handleAlignment(YAGfx* gfx, YAGfxText* gfxText, bool noAction,
             (nullptr != gfxText) &&
             (false == isScrolling))
         {
-            String      text        = removeFormatTags(formatStr.substring(KEYWORD_LEN));
             uint16_t    textWidth   = 0U;
             uint16_t    textHeight  = 0U;
 
-            if (true == gfxText->getTextBoundingBox(gfx->getWidth(), gfx->getHeight(), text.c_str(), textWidth, textHeight))
+            if (true == getTextBoundingBox(*gfx, *gfxText, formatStr.c_str() + KEYWORD_LEN, textWidth, textHeight))
             {
                 gfxText->setTextCursorPos(gfxText->getTextCursorPosX() + (gfx->getWidth() - gfxText->getTextCursorPosX() - textWidth) / 2, gfxText->getTextCursorPosY());
             }
@@ -49,7 +49,7 @@
 #include <YAColor.h>
 #include <YAFont.h>
 #include <YAGfxText.h>
-#include <SimpleTimer.hpp>
+#include "TextLayoutCache.h"
 
 /******************************************************************************
  * Macros
@@ -63,6 +63,8 @@
  * A text widget, showing a colored string.
  * The text has a given color, which can be changed.
  *
+ * The string is expected in UTF-8 encoding.
+ *
  * Different keywords in the string are supported, e.g. for coloring or alignment.
  * Each keyword starts with a '\\', otherwise its treated as just text.
  * Example: "\\#FF0000H#FFFFFFello!" contains a red "H" and a white "ello!".
@@ -91,7 +93,10 @@ public:
         m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
         m_scrollingCnt(0U),
         m_scrollOffset(0),
-        m_scrollTimer()
+        m_scrollSpeed(0U),
+        m_scrollTimestamp(0U),
+        m_scrollDistance(0U),
+        m_layoutCache()
     {
     }
 
@@ -113,7 +118,10 @@ public:
         m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
         m_scrollingCnt(0U),
         m_scrollOffset(0),
-        m_scrollTimer()
+        m_scrollSpeed(0U),
+        m_scrollTimestamp(0U),
+        m_scrollDistance(0U),
+        m_layoutCache()
     {
     }
 
@@ -133,7 +141,10 @@ public:
         m_gfxText(widget.m_gfxText),
         m_scrollingCnt(widget.m_scrollingCnt),
         m_scrollOffset(widget.m_scrollOffset),
-        m_scrollTimer(widget.m_scrollTimer)
+        m_scrollSpeed(widget.m_scrollSpeed),
+        m_scrollTimestamp(widget.m_scrollTimestamp),
+        m_scrollDistance(widget.m_scrollDistance),
+        m_layoutCache(widget.m_layoutCache)
     {
     }
 
@@ -164,7 +175,10 @@ public:
             m_gfxText               = widget.m_gfxText;
             m_scrollingCnt          = widget.m_scrollingCnt;
             m_scrollOffset          = widget.m_scrollOffset;
-            m_scrollTimer           = widget.m_scrollTimer;
+            m_scrollSpeed           = widget.m_scrollSpeed;
+            m_scrollTimestamp       = widget.m_scrollTimestamp;
+            m_scrollDistance        = widget.m_scrollDistance;
+            m_layoutCache           = widget.m_layoutCache;
         }
 
         return *this;
@@ -174,13 +188,16 @@ public:
      * Set the text string. It can contain format tags like:
      * - "#RRGGBB" Color information in RGB888 format
      * 
+     * If the text is equal to the last one, nothing happens.
+     * 
      * @param[in] formatStr String, which may contain format tags
      */
     void setFormatStr(const String& formatStr)
     {
-        /* Avoid upate if not necessary. */
-        if ((m_formatStr != formatStr) &&
-            (m_formatStrNew != formatStr))
+        /* Avoid upate if not necessary. The last requested text is always
+         * the new text, which is either shown already or pending.
+         */
+        if (m_formatStrNew != formatStr)
         {
             /* If there is already a new text, which is not shown yet,
              * skip this new text.
@@ -223,6 +240,7 @@ public:
     void setTextColor(const Color& color)
     {
         m_gfxText.setTextColor(color);
+        invalidate();
         return;
     }
 
@@ -260,7 +278,8 @@ public:
     }
 
     /**
-     * Change scroll speed of all text widgets by changing the pause between each movement.
+     * Change the default scroll speed of all text widgets by changing the pause between each movement.
+     * It is used by all text widgets, which have no own scroll speed.
      *
      * @param[in] pause Scroll pause in ms
      *
@@ -280,6 +299,50 @@ public:
         return status;
     }
 
+    /**
+     * Set the scroll speed of this text widget.
+     * The text position is derived from the elapsed time, therefore the speed
+     * is independent of the frame rate.
+     *
+     * @param[in] speed Scroll speed in pixel per second. Use 0 for the default scroll speed, derived from the scroll pause.
+     *
+     * @return If successful set, it will return true otherwise false.
+     */
+    bool setScrollSpeed(uint16_t speed)
+    {
+        bool status = false;
+
+        if ((0U == speed) ||
+            ((MIN_SCROLL_SPEED <= speed) &&
+             (MAX_SCROLL_SPEED >= speed)))
+        {
+            m_scrollSpeed   = speed;
+            status          = true;
+        }
+
+        return status;
+    }
+
+    /**
+     * Get the scroll speed of this text widget.
+     *
+     * @return Scroll speed in pixel per second. 0 means default scroll speed, derived from the scroll pause.
+     */
+    uint16_t getScrollSpeed() const
+    {
+        return m_scrollSpeed;
+    }
+
+    /**
+     * Get the current horizontal scroll offset of the shown text.
+     *
+     * @return Scroll offset in pixel
+     */
+    int16_t getScrollOffset() const
+    {
+        return m_scrollInfo.offset;
+    }
+
     /**
      * Get scrolling informations.
      *
@@ -303,6 +366,27 @@ public:
         return status;
     }
 
+    /**
+     * Is the widget dirty and needs to be repainted?
+     * A new text or a scrolling text needs to be repainted continuously.
+     *
+     * @return If the widget needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const override
+    {
+        bool isDirty = Widget::isDirty();
+
+        if ((false == isDirty) &&
+            (true == m_isEnabled))
+        {
+            isDirty = ((true == m_isNewTextAvailable) ||
+                       (true == m_handleNewText) ||
+                       (true == m_scrollInfo.isEnabled));
+        }
+
+        return isDirty;
+    }
+
     /** Default text color */
     static const uint32_t   DEFAULT_TEXT_COLOR      = ColorDef::WHITE;
 
@@ -310,7 +394,7 @@ public:
     static const char*      WIDGET_TYPE;
 
     /** Default font */
-    static const GFXfont*   DEFAULT_FONT;
+    static const YAFont     DEFAULT_FONT;
 
     /** Default pause between character scrolling in ms */
     static const uint32_t   DEFAULT_SCROLL_PAUSE    = 80U;
@@ -321,6 +405,12 @@ public:
     /** Maximal scroll pause in ms */
     static const uint32_t   MAX_SCROLL_PAUSE        = 500U;
 
+    /** Minimal scroll speed in pixel per second */
+    static const uint16_t   MIN_SCROLL_SPEED        = 1U;
+
+    /** Maximal scroll speed in pixel per second */
+    static const uint16_t   MAX_SCROLL_SPEED        = 500U;
+
 private:
 
     /** Keyword handler method. */
@@ -359,7 +449,10 @@ private:
     YAGfxText       m_gfxText;              /**< Current gfx for text */
     uint32_t        m_scrollingCnt;         /**< Counts how often a text was complete scrolled. */
     int16_t         m_scrollOffset;         /**< Pixel offset of cursor x position, used for scrolling. */
-    SimpleTimer     m_scrollTimer;          /**< Timer, used for scrolling */
+    uint16_t        m_scrollSpeed;          /**< Scroll speed in pixel/s. If 0, the speed is derived from the scroll pause. */
+    uint32_t        m_scrollTimestamp;      /**< Timestamp in ms of the last scroll movement calculation. */
+    uint32_t        m_scrollDistance;       /**< Scroll distance, which is not moved yet, in 1/256 pixel * 1000 (fixed point). */
+    mutable TextLayoutCache m_layoutCache;  /**< Cache of measured text bounding boxes. */
 
     static KeywordHandler   m_keywordHandlers[];    /**< List of all supported keyword handlers. */
     static uint32_t         m_scrollPause;          /**< Pause in ms, between each scroll movement. */
@@ -378,6 +471,41 @@ private:
      */
     void paint(YAGfx& gfx) override;
 
+    /**
+     * Start scrolling. The scroll position will be derived from the time,
+     * elapsed since now.
+     */
+    void startScrolling();
+
+    /**
+     * Get the number of pixels, the text shall be moved since the last call.
+     * The not moved remaining sub-pixel distance is kept for the next time.
+     *
+     * @return Number of pixels to move
+     */
+    uint32_t getScrollSteps();
+
+    /**
+     * Move the current text and the new text one pixel further.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void scroll(YAGfx& gfx);
+
+    /**
+     * Get bounding box of a text, which may contain format tags.
+     * The result is cached, so measuring the same text again is cheap.
+     *
+     * @param[in]   gfx         Graphics interface, which provides the canvas size.
+     * @param[in]   gfxText     Text gfx, which provides the font.
+     * @param[in]   formatStr   String which may contain format tags
+     * @param[out]  textWidth   Bounding box width in pixel
+     * @param[out]  textHeight  Bounding box height in pixel
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool getTextBoundingBox(const YAGfx& gfx, const YAGfxText& gfxText, const char* formatStr, uint16_t& textWidth, uint16_t& textHeight) const;
+
     /**
      * Remove format tags from string.
      *
@@ -59,16 +59,14 @@
 ** Apr 09, 2021: Increased readability by adapting the appearance of the degree
 ** symbol (0xB0) for better readability
 ** Yann Le Glaz (yann_le@web.de)
+**
+** Oct 19, 2026: The extended character set is provided as unicode font with
+** sparse code point ranges, because its glyphs are not contiguous.
+** The ASCII only variant is still provided as GFXfont.
 */
 
 #define TOMTHUMB_USE_EXTENDED 1
 
-#if TOMTHUMB_USE_EXTENDED
-#define TOMTHUMB_LAST_CHAR_ID (0xEB)
-#else
-#define TOMTHUMB_LAST_CHAR_ID (0x7E)
-#endif
-
 const uint8_t TomThumbBitmaps[] PROGMEM = {
     0x00,                /* 0x20 space */
     0xE8,                /* 0x21 exclam */
@@ -489,11 +487,44 @@ const GFXglyph TomThumbGlyphs[] PROGMEM = {
 #endif /* (TOMTHUMB_USE_EXTENDED) */
 };
 
+#if (TOMTHUMB_USE_EXTENDED)
+
+/* {first code point, last code point, glyph index} */
+const UnicodeRange TomThumbRanges[] PROGMEM = {
+    { 0x0020, 0x007E,   0 },
+    { 0x00A1, 0x00FF,  95 },
+    { 0x011D, 0x011D, 190 },
+    { 0x0152, 0x0153, 191 },
+    { 0x0160, 0x0161, 193 },
+    { 0x0178, 0x0178, 195 },
+    { 0x017D, 0x017E, 196 },
+    { 0x0EA4, 0x0EA4, 198 },
+    { 0x13A0, 0x13A0, 199 },
+    { 0x2022, 0x2022, 200 },
+    { 0x2026, 0x2026, 201 },
+    { 0x20AC, 0x20AC, 202 },
+    { 0xFFFD, 0xFFFD, 203 }
+};
+
+const UnicodeFont TomThumb PROGMEM =
+{
+    TomThumbBitmaps,
+    TomThumbGlyphs,
+    TomThumbRanges,
+    sizeof(TomThumbRanges) / sizeof(TomThumbRanges[0]),
+    6,
+    UNICODE_FONT_ENCODING_BITMAP
+};
+
+#else /* (TOMTHUMB_USE_EXTENDED) */
+
 const GFXfont TomThumb PROGMEM =
 {
     (uint8_t *)TomThumbBitmaps,
     (GFXglyph*)TomThumbGlyphs,
     0x20,
-    TOMTHUMB_LAST_CHAR_ID,
+    0x7E,
     6
 };
+
+#endif /* (TOMTHUMB_USE_EXTENDED) */
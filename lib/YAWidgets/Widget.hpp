@@ -46,6 +46,8 @@
 #include <stdint.h>
 #include <WString.h>
 #include <YAGfx.h>
+#include <GfxRect.hpp>
+#include <WidgetNames.h>
 
 /******************************************************************************
  * Macros
@@ -58,6 +60,12 @@
 /**
  * Base widget, which contains the position
  * inside a canvas and declares the graphics interface.
+ *
+ * A widget marks itself as dirty, if its appearance changed. This allows
+ * a widget group to repaint only the invalidated regions.
+ *
+ * The widget name is interned to a name id, which is used to find widgets
+ * without string comparisons.
  */
 class Widget
 {
@@ -85,8 +93,9 @@ public:
             m_type      = widget.m_type;
             m_posX      = widget.m_posX;
             m_posY      = widget.m_posY;
-            /* m_name is not assigned! */
+            /* m_name, m_nameId and m_parent are not assigned! */
             m_isEnabled = widget.m_isEnabled;
+            m_isDirty   = true;
         }
 
         return *this;
@@ -100,8 +109,14 @@ public:
      */
     void move(int16_t x, int16_t y)
     {
-        m_posX = x;
-        m_posY = y;
+        if ((x != m_posX) ||
+            (y != m_posY))
+        {
+            m_posX = x;
+            m_posY = y;
+            invalidate();
+        }
+
         return;
     }
 
@@ -129,11 +144,72 @@ public:
         if (true == m_isEnabled)
         {
             paint(gfx);
+
+            /* Remember the painted region, because it must be repainted
+             * after the widget moved, shrinked or was disabled.
+             */
+            if (false == getBoundingBox(m_paintedRect))
+            {
+                m_paintedRect.clear();
+            }
+        }
+        else
+        {
+            m_paintedRect.clear();
         }
 
+        m_isDirty = false;
+
+        return;
+    }
+
+    /**
+     * Mark the widget as dirty, which requests to repaint it.
+     */
+    void invalidate()
+    {
+        m_isDirty = true;
         return;
     }
 
+    /**
+     * Is the widget dirty and needs to be repainted?
+     * Note, it must be overriden by the inherited widget, if it changes its
+     * appearance by itself, like a animation.
+     *
+     * @return If the widget needs to be repainted, it will return true otherwise false.
+     */
+    virtual bool isDirty() const
+    {
+        return m_isDirty;
+    }
+
+    /**
+     * Get the region in the canvas, which is covered by the widget.
+     * Note, it must be overriden by the inherited widget, if its size is known.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return If the bounding box is known, it will return true otherwise false.
+     */
+    virtual bool getBoundingBox(GfxRect& box) const
+    {
+        (void)box;
+
+        return false;
+    }
+
+    /**
+     * Get the region in the canvas, which was covered by the widget at the
+     * last update. It is empty, if the bounding box is unknown.
+     *
+     * @return Painted region
+     */
+    const GfxRect& getPaintedRect() const
+    {
+        return m_paintedRect;
+    }
+
     /**
      * Get widget type as string.
      * 
@@ -155,14 +231,38 @@ public:
         return m_name;
     }
 
+    /**
+     * Get widget name id.
+     * If no name is set, WidgetNames::INVALID_ID will be returned.
+     *
+     * @return Name id
+     */
+    uint16_t getNameId() const
+    {
+        return m_nameId;
+    }
+
     /**
      * Set widget name.
+     * If the widget is part of a group, the group index is updated.
      * 
      * @param[in] name Name to set
      */
     void setName(const String& name)
     {
-        m_name = name;
+        if (nullptr != m_parent)
+        {
+            m_parent->unregisterName(m_nameId, *this);
+        }
+
+        m_name      = name;
+        m_nameId    = WidgetNames::getInstance().intern(name);
+
+        if (nullptr != m_parent)
+        {
+            m_parent->registerName(m_nameId, *this);
+        }
+
         return;
     }
 
@@ -182,7 +282,12 @@ public:
      */
     void enable()
     {
-        m_isEnabled = true;
+        if (false == m_isEnabled)
+        {
+            m_isEnabled = true;
+            invalidate();
+        }
+
         return;
     }
 
@@ -192,24 +297,44 @@ public:
      */
     void disable()
     {
-        m_isEnabled = false;
+        if (true == m_isEnabled)
+        {
+            m_isEnabled = false;
+            invalidate();
+        }
+
         return;
     }
 
     /**
      * Find widget by its name.
-     * Note, it must be overriden by the inherited widget, if it is like a
-     * container of widgets.
+     * If the same name is requested often, prefer to get its name id once
+     * via WidgetNames and find the widget by id.
      * 
      * @param[in] name  Widget name to search for
      * 
      * @return If widget is found, it will be returned otherwise nullptr.
      */
-    virtual Widget* find(const String& name)
+    Widget* find(const String& name)
+    {
+        return find(WidgetNames::getInstance().getId(name));
+    }
+
+    /**
+     * Find widget by its name id.
+     * Note, it must be overriden by the inherited widget, if it is like a
+     * container of widgets.
+     *
+     * @param[in] nameId    Widget name id to search for
+     *
+     * @return If widget is found, it will be returned otherwise nullptr.
+     */
+    virtual Widget* find(uint16_t nameId)
     {
         Widget* widget = nullptr;
 
-        if (name == m_name)
+        if ((WidgetNames::INVALID_ID != nameId) &&
+            (nameId == m_nameId))
         {
             widget = this;
         }
@@ -223,7 +348,11 @@ protected:
     int16_t     m_posX;         /**< Upper left corner (x-coordinate) of the widget in a canvas. */
     int16_t     m_posY;         /**< Upper left corner (y-coordinate) of the widget in a canvas. */
     String      m_name;         /**< Widget name for identification. */
+    uint16_t    m_nameId;       /**< Interned widget name */
+    Widget*     m_parent;       /**< Widget group, which contains the widget. */
     bool        m_isEnabled;    /**< If widget is enabled, it will be drawn otherwise not. */
+    bool        m_isDirty;      /**< If widget is dirty, it needs to be repainted. */
+    GfxRect     m_paintedRect;  /**< Region, which was covered at the last update. */
 
     /**
      * Constructs a widget at position (0, 0) in the canvas.
@@ -235,7 +364,11 @@ protected:
         m_posX(0),
         m_posY(0),
         m_name(),
-        m_isEnabled(true)
+        m_nameId(WidgetNames::INVALID_ID),
+        m_parent(nullptr),
+        m_isEnabled(true),
+        m_isDirty(true),
+        m_paintedRect()
     {
     }
 
@@ -251,7 +384,11 @@ protected:
         m_posX(x),
         m_posY(y),
         m_name(),
-        m_isEnabled(true)
+        m_nameId(WidgetNames::INVALID_ID),
+        m_parent(nullptr),
+        m_isEnabled(true),
+        m_isDirty(true),
+        m_paintedRect()
     {
     }
 
@@ -266,10 +403,50 @@ protected:
         m_posX(widget.m_posX),
         m_posY(widget.m_posY),
         m_name(),
-        m_isEnabled(widget.m_isEnabled)
+        m_nameId(WidgetNames::INVALID_ID),
+        m_parent(nullptr),
+        m_isEnabled(widget.m_isEnabled),
+        m_isDirty(true),
+        m_paintedRect()
     {
     }
 
+    /**
+     * Register a name id of a widget in the widget tree. Every widget group
+     * adds it to its index and forwards it to its parent.
+     *
+     * @param[in] nameId    Name id of the widget
+     * @param[in] widget    Widget
+     */
+    virtual void registerName(uint16_t nameId, Widget& widget)
+    {
+        if ((WidgetNames::INVALID_ID != nameId) &&
+            (nullptr != m_parent))
+        {
+            m_parent->registerName(nameId, widget);
+        }
+
+        return;
+    }
+
+    /**
+     * Unregister a name id of a widget in the widget tree. Every widget group
+     * removes it from its index and forwards it to its parent.
+     *
+     * @param[in] nameId    Name id of the widget
+     * @param[in] widget    Widget
+     */
+    virtual void unregisterName(uint16_t nameId, Widget& widget)
+    {
+        if ((WidgetNames::INVALID_ID != nameId) &&
+            (nullptr != m_parent))
+        {
+            m_parent->unregisterName(nameId, widget);
+        }
+
+        return;
+    }
+
     /**
      * Paint the widget with the given graphics interface.
      * 
@@ -279,6 +456,9 @@ protected:
 
 private:
 
+    /* The widget group maintains the parent of its widgets. */
+    friend class WidgetGroup;
+
     /* Default constructor not allowed. */
     Widget();
 };
@@ -61,6 +61,126 @@ const char* WidgetGroup::WIDGET_TYPE = "widgetGroup";
  * Public Methods
  *****************************************************************************/
 
+bool WidgetGroup::isDirty() const
+{
+    bool isDirty = Widget::isDirty();
+
+    if (false == isDirty)
+    {
+        DLinkedListConstIterator<Widget*> it(m_widgets);
+
+        if (true == it.first())
+        {
+            do
+            {
+                isDirty = (*it.current())->isDirty();
+            }
+            while(  (false == isDirty) &&
+                    (true == it.next()));
+        }
+    }
+
+    return isDirty;
+}
+
+bool WidgetGroup::updateInvalidated(YAGfx& gfx)
+{
+    bool isRepainted = false;
+
+    /* A disabled group is not painted, but its last painted region
+     * must be cleared once.
+     */
+    if (false == m_isEnabled)
+    {
+        if (false == m_paintedRect.isEmpty())
+        {
+            gfx.fillRect(m_paintedRect.getX(), m_paintedRect.getY(), m_paintedRect.getWidth(), m_paintedRect.getHeight(), m_backgroundColor);
+            m_paintedRect.clear();
+
+            isRepainted = true;
+        }
+    }
+    else
+    {
+        GfxRect canvasRect(0, 0, m_width, m_height);
+        GfxRect dirtyRect;
+
+        /* Group itself invalidated? Handle it like a complete update. */
+        if (true == Widget::isDirty())
+        {
+            dirtyRect = canvasRect;
+        }
+        else
+        {
+            DLinkedListIterator<Widget*> it(m_widgets);
+
+            /* Union of the old and new regions of all dirty widgets. */
+            if (true == it.first())
+            {
+                do
+                {
+                    Widget* widget = *it.current();
+
+                    if (true == widget->isDirty())
+                    {
+                        GfxRect box;
+
+                        /* If the size is unknown, the whole canvas is repainted. */
+                        if (false == widget->getBoundingBox(box))
+                        {
+                            box = canvasRect;
+                        }
+
+                        dirtyRect.unite(box);
+                        dirtyRect.unite(widget->getPaintedRect());
+                    }
+                }
+                while(true == it.next());
+            }
+
+            dirtyRect.intersect(canvasRect);
+        }
+
+        if (false == dirtyRect.isEmpty())
+        {
+            DLinkedListIterator<Widget*> it(m_widgets);
+
+            m_gfx       = &gfx;
+            m_clipRect  = dirtyRect;
+
+            fillRect(dirtyRect.getX(), dirtyRect.getY(), dirtyRect.getWidth(), dirtyRect.getHeight(), m_backgroundColor);
+
+            /* Repaint all widgets in their priority, which overlap the dirty region. */
+            if (true == it.first())
+            {
+                do
+                {
+                    Widget* widget  = *it.current();
+                    GfxRect box;
+
+                    if ((false == widget->getBoundingBox(box)) ||
+                        (true == box.isIntersecting(dirtyRect)) ||
+                        (true == widget->isDirty()))
+                    {
+                        widget->update(*this);
+                    }
+                }
+                while(true == it.next());
+            }
+
+            m_gfx = nullptr;
+
+            (void)getBoundingBox(m_paintedRect);
+
+            isRepainted = true;
+        }
+    }
+
+    m_isDirty = false;
+
+    return isRepainted;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -69,6 +189,69 @@ const char* WidgetGroup::WIDGET_TYPE = "widgetGroup";
  * Private Methods
  *****************************************************************************/
 
+void WidgetGroup::registerName(uint16_t nameId, Widget& widget)
+{
+    if (WidgetNames::INVALID_ID != nameId)
+    {
+        (void)m_index.add(nameId, &widget);
+        Widget::registerName(nameId, widget);
+    }
+}
+
+void WidgetGroup::unregisterName(uint16_t nameId, Widget& widget)
+{
+    if (WidgetNames::INVALID_ID != nameId)
+    {
+        (void)m_index.remove(nameId, &widget);
+        Widget::unregisterName(nameId, widget);
+    }
+}
+
+void WidgetGroup::registerTree(Widget& widget)
+{
+    registerName(widget.getNameId(), widget);
+
+    /* The named widgets of a sub group are already in its index. */
+    if (WIDGET_TYPE == widget.getType())
+    {
+        const WidgetIndex&  index   = static_cast<WidgetGroup&>(widget).m_index;
+        uint16_t            idx     = 0U;
+
+        for(idx = 0U; idx < index.getSlotCount(); ++idx)
+        {
+            uint16_t    nameId  = WidgetNames::INVALID_ID;
+            Widget*     child   = nullptr;
+
+            if (true == index.getSlot(idx, nameId, child))
+            {
+                registerName(nameId, *child);
+            }
+        }
+    }
+}
+
+void WidgetGroup::unregisterTree(Widget& widget)
+{
+    unregisterName(widget.getNameId(), widget);
+
+    if (WIDGET_TYPE == widget.getType())
+    {
+        const WidgetIndex&  index   = static_cast<WidgetGroup&>(widget).m_index;
+        uint16_t            idx     = 0U;
+
+        for(idx = 0U; idx < index.getSlotCount(); ++idx)
+        {
+            uint16_t    nameId  = WidgetNames::INVALID_ID;
+            Widget*     child   = nullptr;
+
+            if (true == index.getSlot(idx, nameId, child))
+            {
+                unregisterName(nameId, *child);
+            }
+        }
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -47,6 +47,7 @@
 #include <WString.h>
 #include <LinkedList.hpp>
 #include <Widget.hpp>
+#include <WidgetIndex.h>
 
 /******************************************************************************
  * Macros
@@ -58,6 +59,15 @@
 
 /**
  * This class defines a widget group and can contain several widgets.
+ *
+ * The group can either be updated completely or only in the invalidated
+ * regions. In the second case the union of the dirty widget regions is
+ * cleared with the background color and only the widgets, which overlap
+ * it, are painted again.
+ *
+ * All named widgets in the group and its sub groups are kept in a index,
+ * which is updated whenever a widget is added, removed or renamed. This
+ * avoids to walk through the widget tree, if a widget is searched.
  */
 class WidgetGroup : public Widget, private YAGfx
 {
@@ -76,7 +86,10 @@ public:
         m_width(width),
         m_height(height),
         m_widgets(),
-        m_gfx(nullptr)
+        m_gfx(nullptr),
+        m_clipRect(),
+        m_backgroundColor(),
+        m_index()
     {
     }
 
@@ -90,7 +103,10 @@ public:
         m_width(group.m_width),
         m_height(group.m_height),
         m_widgets(group.m_widgets),
-        m_gfx(group.m_gfx)
+        m_gfx(group.m_gfx),
+        m_clipRect(),
+        m_backgroundColor(group.m_backgroundColor),
+        m_index(group.m_index)
     {
     }
 
@@ -116,8 +132,10 @@ public:
 
             m_width     = group.m_width;
             m_height    = group.m_height;
-            m_widgets   = group.m_widgets;
-            m_gfx       = group.m_gfx;
+            m_widgets           = group.m_widgets;
+            m_gfx               = group.m_gfx;
+            m_backgroundColor   = group.m_backgroundColor;
+            m_index             = group.m_index;
         }
 
         return *this;
@@ -197,6 +215,7 @@ public:
     void setWidth(uint16_t width)
     {
         m_width = width;
+        invalidate();
     }
 
     /**
@@ -207,6 +226,7 @@ public:
     void setHeight(uint16_t height)
     {
         m_height = height;
+        invalidate();
     }
 
     /**
@@ -223,6 +243,29 @@ public:
         m_posY      = offsY;
         m_width     = width;
         m_height    = height;
+        invalidate();
+    }
+
+    /**
+     * Set the background color, which is used to clear the invalidated
+     * regions by updateInvalidated().
+     *
+     * @param[in] color Background color
+     */
+    void setBackgroundColor(const Color& color)
+    {
+        m_backgroundColor = color;
+        invalidate();
+    }
+
+    /**
+     * Get the background color.
+     *
+     * @return Background color
+     */
+    const Color& getBackgroundColor() const
+    {
+        return m_backgroundColor;
     }
 
     /**
@@ -234,8 +277,18 @@ public:
      */
     bool addWidget(Widget& widget)
     {
-        Widget* ptr = &widget;
-        return m_widgets.append(ptr);
+        Widget* ptr     = &widget;
+        bool    status  = m_widgets.append(ptr);
+
+        if (true == status)
+        {
+            widget.m_parent = this;
+            registerTree(widget);
+
+            invalidate();
+        }
+
+        return status;
     }
 
     /**
@@ -256,6 +309,15 @@ public:
             /* Remove widget */
             it.remove();
             status = true;
+
+            unregisterTree(const_cast<Widget&>(widget));
+
+            if (this == widget.m_parent)
+            {
+                const_cast<Widget&>(widget).m_parent = nullptr;
+            }
+
+            invalidate();
         }
 
         return status;
@@ -271,50 +333,105 @@ public:
         return m_widgets;
     }
 
+    using Widget::find;
+
     /**
-     * Find widget by its name.
+     * Find widget by its name id.
      *
-     * @param[in] name  Widget name to search for
+     * @param[in] nameId    Widget name id to search for
      *
      * @return If widget is found, it will be returned otherwise nullptr.
      */
-    Widget* find(const String& name) override
+    Widget* find(uint16_t nameId) override
     {
-        Widget* widget = nullptr;
+        Widget* widget = Widget::find(nameId);
 
-        if (name == m_name)
-        {
-            widget = this;
-        }
-
-        /* If its not the group itself, continue searching in the widget list. */
+        /* If its not the group itself, continue searching in the index. */
         if (nullptr == widget)
         {
-            DLinkedListIterator<Widget*> it(m_widgets);
-
-            if (true == it.first())
-            {
-                do
-                {
-                    widget = (*it.current())->find(name);
-                }
-                while(  (nullptr == widget) &&
-                        (true == it.next()));
-            }
+            widget = m_index.find(nameId);
         }
 
         return widget;
     }
 
+    /**
+     * Is the group or any of its widgets dirty?
+     *
+     * @return If the group needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const override;
+
+    /**
+     * Get the region in the canvas, which is covered by the group.
+     *
+     * @param[out] box  Bounding box in the canvas
+     *
+     * @return The bounding box of a group is always known, therefore it returns true.
+     */
+    bool getBoundingBox(GfxRect& box) const override
+    {
+        box = GfxRect(m_posX, m_posY, m_width, m_height);
+
+        return true;
+    }
+
+    /**
+     * Update only the invalidated regions of the group in the canvas.
+     * The underlying canvas must keep the content of the last update,
+     * otherwise use update(), which paints all widgets.
+     *
+     * If the group itself is invalidated, e.g. after it was resized, it will
+     * be cleared and painted completely.
+     *
+     * @param[in] gfx   Graphics interface
+     *
+     * @return If anything was repainted, it will return true otherwise false.
+     */
+    bool updateInvalidated(YAGfx& gfx);
+
     /** Widget type string */
     static const char*      WIDGET_TYPE;
 
 private:
 
-    uint16_t                m_width;    /**< Canvas width in pixels */
-    uint16_t                m_height;   /**< Canvas height in pixels */
-    DLinkedList<Widget*>    m_widgets;  /**< Widgets in the group */
-    YAGfx*                  m_gfx;      /**< Graphics interface of the underlying layer */
+    uint16_t                m_width;            /**< Canvas width in pixels */
+    uint16_t                m_height;           /**< Canvas height in pixels */
+    DLinkedList<Widget*>    m_widgets;          /**< Widgets in the group */
+    YAGfx*                  m_gfx;              /**< Graphics interface of the underlying layer */
+    GfxRect                 m_clipRect;         /**< Region in the group canvas, where painting is allowed. */
+    Color                   m_backgroundColor;  /**< Background color used to clear invalidated regions */
+    WidgetIndex             m_index;            /**< Index of all named widgets in the group and its sub groups */
+
+    /**
+     * Register a name id of a widget in the index and forward it to the parent.
+     *
+     * @param[in] nameId    Name id of the widget
+     * @param[in] widget    Widget
+     */
+    void registerName(uint16_t nameId, Widget& widget) override;
+
+    /**
+     * Unregister a name id of a widget in the index and forward it to the parent.
+     *
+     * @param[in] nameId    Name id of the widget
+     * @param[in] widget    Widget
+     */
+    void unregisterName(uint16_t nameId, Widget& widget) override;
+
+    /**
+     * Register a widget and in case it is a group, all of its named widgets.
+     *
+     * @param[in] widget    Widget
+     */
+    void registerTree(Widget& widget);
+
+    /**
+     * Unregister a widget and in case it is a group, all of its named widgets.
+     *
+     * @param[in] widget    Widget
+     */
+    void unregisterTree(Widget& widget);
 
     /**
      * Paint the widget with the given graphics interface.
@@ -325,7 +442,8 @@ private:
     {
         DLinkedListIterator<Widget*> it(m_widgets);
 
-        m_gfx = &gfx;
+        m_gfx       = &gfx;
+        m_clipRect  = GfxRect(0, 0, m_width, m_height);
 
         /* Walk through all widgets and draw them in the priority as
          * they were added.
@@ -353,13 +471,10 @@ private:
      */
     void drawPixel(int16_t x, int16_t y, const Color& color) final
     {
-        /* Don't draw outside the canvas. */
+        /* Don't draw outside the canvas and the region, which is repainted. */
         if ((nullptr != m_gfx) &&
-            (0 <= x) &&
-            (0 <= y) &&
-            (m_width > x) &&
-            (m_height > y))
-        {    
+            (true == m_clipRect.contains(x, y)))
+        {
             m_gfx->drawPixel(m_posX + x, m_posY + y, color);
         }
 
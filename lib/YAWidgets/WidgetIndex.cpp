@@ -0,0 +1,189 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Widget index
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WidgetIndex.h"
+#include "WidgetNames.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+WidgetIndex::WidgetIndex() :
+    m_table()
+{
+}
+
+WidgetIndex::WidgetIndex(const WidgetIndex& index) :
+    m_table(index.m_table)
+{
+}
+
+WidgetIndex::~WidgetIndex()
+{
+}
+
+WidgetIndex& WidgetIndex::operator=(const WidgetIndex& index)
+{
+    if (&index != this)
+    {
+        m_table = index.m_table;
+    }
+
+    return *this;
+}
+
+bool WidgetIndex::add(uint16_t nameId, Widget* widget)
+{
+    bool isSuccessful = false;
+
+    if ((WidgetNames::INVALID_ID != nameId) &&
+        (nullptr != widget))
+    {
+        /* Keep the load factor low, otherwise the probe sequences become long. */
+        if (true == m_table.reserve(m_table.getCount() + 1U))
+        {
+            Entry entry;
+
+            entry.nameId = nameId;
+            entry.widget = widget;
+
+            /* Several widgets may have the same name. */
+            isSuccessful = m_table.add(entry);
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool WidgetIndex::remove(uint16_t nameId, const Widget* widget)
+{
+    bool isRemoved = false;
+
+    if (WidgetNames::INVALID_ID != nameId)
+    {
+        Entry entry;
+
+        entry.nameId = nameId;
+        entry.widget = const_cast<Widget*>(widget);
+
+        isRemoved = m_table.remove(nameId, entry);
+    }
+
+    return isRemoved;
+}
+
+Widget* WidgetIndex::find(uint16_t nameId) const
+{
+    Widget*         widget  = nullptr;
+    const Entry*    entry   = nullptr;
+
+    if (WidgetNames::INVALID_ID != nameId)
+    {
+        entry = m_table.find(nameId, nameId);
+    }
+
+    if (nullptr != entry)
+    {
+        widget = entry->widget;
+    }
+
+    return widget;
+}
+
+void WidgetIndex::clear()
+{
+    m_table.release();
+}
+
+bool WidgetIndex::getSlot(uint16_t idx, uint16_t& nameId, Widget*& widget) const
+{
+    bool            isUsed  = false;
+    const Entry*    entry   = m_table.getSlot(idx);
+
+    if (nullptr != entry)
+    {
+        nameId  = entry->nameId;
+        widget  = entry->widget;
+        isUsed  = true;
+    }
+
+    return isUsed;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+WidgetIndex::Entry::Entry() :
+    nameId(WidgetNames::INVALID_ID),
+    widget(nullptr)
+{
+}
+
+bool WidgetIndex::EntryTraits::isEmpty(const Entry& entry)
+{
+    return (WidgetNames::INVALID_ID == entry.nameId);
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,242 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Widget index
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __WIDGET_INDEX_H__
+#define __WIDGET_INDEX_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <HashTable.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+class Widget;
+
+/**
+ * Index, which maps widget name ids to widgets. It is used by a widget group
+ * to find any widget in its tree without walking through it.
+ *
+ * The index is a hash table with open addressing and linear probing. The name
+ * ids are handed out sequentially, therefore they are directly used as hash.
+ * Several widgets may have the same name, but only one of them will be found.
+ */
+class WidgetIndex
+{
+public:
+
+    /**
+     * Constructs a empty index.
+     */
+    WidgetIndex();
+
+    /**
+     * Constructs a index by copy.
+     *
+     * @param[in] index Index, which to copy.
+     */
+    WidgetIndex(const WidgetIndex& index);
+
+    /**
+     * Destroys the index.
+     */
+    ~WidgetIndex();
+
+    /**
+     * Assigns a index.
+     *
+     * @param[in] index Index, which to assign.
+     *
+     * @return Index
+     */
+    WidgetIndex& operator=(const WidgetIndex& index);
+
+    /**
+     * Add a widget.
+     *
+     * @param[in] nameId    Name id of the widget
+     * @param[in] widget    Widget
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool add(uint16_t nameId, Widget* widget);
+
+    /**
+     * Remove a widget.
+     *
+     * @param[in] nameId    Name id of the widget
+     * @param[in] widget    Widget
+     *
+     * @return If the widget was found and removed, it will return true otherwise false.
+     */
+    bool remove(uint16_t nameId, const Widget* widget);
+
+    /**
+     * Find a widget by its name id.
+     *
+     * @param[in] nameId    Name id of the widget
+     *
+     * @return If widget is found, it will be returned otherwise nullptr.
+     */
+    Widget* find(uint16_t nameId) const;
+
+    /**
+     * Remove all widgets.
+     */
+    void clear();
+
+    /**
+     * Get number of widgets in the index.
+     *
+     * @return Number of widgets
+     */
+    uint16_t getCount() const
+    {
+        return m_table.getCount();
+    }
+
+    /**
+     * Get number of hash table slots. Together with getSlot() it can be
+     * used to walk through all widgets in the index.
+     *
+     * @return Number of slots
+     */
+    uint16_t getSlotCount() const
+    {
+        return m_table.getSlotCount();
+    }
+
+    /**
+     * Get the widget in a hash table slot.
+     *
+     * @param[in]   idx     Slot index
+     * @param[out]  nameId  Name id of the widget
+     * @param[out]  widget  Widget
+     *
+     * @return If the slot is used, it will return true otherwise false.
+     */
+    bool getSlot(uint16_t idx, uint16_t& nameId, Widget*& widget) const;
+
+private:
+
+    /**
+     * Hash table entry.
+     */
+    struct Entry
+    {
+        uint16_t    nameId; /**< Name id, a invalid id marks a empty entry. */
+        Widget*     widget; /**< Widget */
+
+        /**
+         * Initializes a empty entry.
+         */
+        Entry();
+    };
+
+    /**
+     * Hash table entry traits.
+     */
+    struct EntryTraits
+    {
+        /**
+         * Is the entry empty?
+         *
+         * @param[in] entry Entry
+         *
+         * @return If empty, it will return true otherwise false.
+         */
+        static bool isEmpty(const Entry& entry);
+
+        /**
+         * Get the hash of the entry, which is the name id.
+         *
+         * @param[in] entry Entry
+         *
+         * @return Hash
+         */
+        static uint32_t getHash(const Entry& entry)
+        {
+            return entry.nameId;
+        }
+
+        /**
+         * Does the entry belong to the name id?
+         *
+         * @param[in] entry     Entry
+         * @param[in] nameId    Name id
+         *
+         * @return If it matches, it will return true otherwise false.
+         */
+        static bool isMatch(const Entry& entry, uint16_t nameId)
+        {
+            return (nameId == entry.nameId);
+        }
+
+        /**
+         * Is the entry equal to the other one?
+         *
+         * @param[in] entry Entry
+         * @param[in] other Other entry
+         *
+         * @return If equal, it will return true otherwise false.
+         */
+        static bool isMatch(const Entry& entry, const Entry& other)
+        {
+            return ((other.nameId == entry.nameId) &&
+                    (other.widget == entry.widget));
+        }
+    };
+
+    HashTable<Entry, EntryTraits>   m_table;    /**< Hash table */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __WIDGET_INDEX_H__ */
+
+/** @} */
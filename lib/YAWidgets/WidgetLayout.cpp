@@ -0,0 +1,386 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Widget layout
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WidgetLayout.h"
+#include "BitmapWidget.h"
+#include "LampWidget.h"
+#include "ProgressBar.h"
+#include "TextWidget.h"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Size of the layout file header in byte. */
+static const size_t HEADER_SIZE     = 5U;
+
+/** Size of the fixed node part in byte. */
+static const size_t NODE_SIZE       = 19U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+WidgetLayout::WidgetLayout() :
+    m_entries(nullptr),
+    m_entryCnt(0U),
+    m_index(),
+    m_map()
+{
+}
+
+WidgetLayout::~WidgetLayout()
+{
+    clear();
+}
+
+bool WidgetLayout::load(FS& fs, const String& fileName)
+{
+    bool    isSuccessful    = false;
+    File    fd              = fs.open(fileName, "r");
+
+    clear();
+
+    if (true == fd)
+    {
+        uint8_t header[HEADER_SIZE];
+
+        if ((HEADER_SIZE == fd.read(header, HEADER_SIZE)) &&
+            ('W' == header[0]) &&
+            ('L' == header[1]) &&
+            ('Y' == header[2]) &&
+            (VERSION == header[3]))
+        {
+            uint8_t     nodeCnt     = header[4];
+            Placement*  placements  = new(std::nothrow) Placement[nodeCnt];
+
+            /* The number of nodes is the upper limit of widgets, because groups
+             * are not instantiated.
+             */
+            m_entries = new(std::nothrow) Entry[nodeCnt];
+
+            if ((nullptr != placements) &&
+                (nullptr != m_entries))
+            {
+                uint8_t nodeIdx = 0U;
+
+                isSuccessful = true;
+
+                while((true == isSuccessful) && (nodeCnt > nodeIdx))
+                {
+                    Node        node;
+                    Placement&  placement   = placements[nodeIdx];
+
+                    if (false == readNode(fd, node))
+                    {
+                        isSuccessful = false;
+                    }
+                    /* A parent must be a group, which is stored before its children. */
+                    else if ((NO_PARENT != node.parent) &&
+                             ((nodeIdx <= node.parent) ||
+                              (NODE_TYPE_GROUP != placements[node.parent].type)))
+                    {
+                        isSuccessful = false;
+                    }
+                    else
+                    {
+                        placement.type  = node.type;
+                        placement.x     = node.x;
+                        placement.y     = node.y;
+
+                        /* Calculate the absolute position and clip it by the parents. */
+                        if (NO_PARENT != node.parent)
+                        {
+                            const Placement& parent = placements[node.parent];
+
+                            placement.x += parent.x;
+                            placement.y += parent.y;
+                            placement.clip = GfxRect(placement.x, placement.y, node.width, node.height);
+                            placement.clip.intersect(parent.clip);
+                        }
+                        else
+                        {
+                            placement.clip = GfxRect(placement.x, placement.y, node.width, node.height);
+                        }
+
+                        if (NODE_TYPE_GROUP != node.type)
+                        {
+                            Widget* widget = createWidget(fs, node);
+
+                            if (nullptr == widget)
+                            {
+                                isSuccessful = false;
+                            }
+                            else
+                            {
+                                Entry& entry = m_entries[m_entryCnt];
+
+                                /* The widget is painted relative to its clipping region. */
+                                widget->move(placement.x - placement.clip.getX(), placement.y - placement.clip.getY());
+
+                                entry.widget    = widget;
+                                entry.clip      = placement.clip;
+                                ++m_entryCnt;
+
+                                if (0U < node.name.length())
+                                {
+                                    widget->setName(node.name);
+
+                                    if (false == m_index.add(widget->getNameId(), widget))
+                                    {
+                                        isSuccessful = false;
+                                    }
+                                }
+                            }
+                        }
+
+                        ++nodeIdx;
+                    }
+                }
+            }
+
+            if (nullptr != placements)
+            {
+                delete[] placements;
+            }
+        }
+
+        fd.close();
+    }
+
+    if (false == isSuccessful)
+    {
+        clear();
+    }
+
+    return isSuccessful;
+}
+
+void WidgetLayout::clear()
+{
+    if (nullptr != m_entries)
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < m_entryCnt; ++idx)
+        {
+            delete m_entries[idx].widget;
+        }
+
+        delete[] m_entries;
+        m_entries = nullptr;
+    }
+
+    m_entryCnt = 0U;
+    m_index.clear();
+}
+
+void WidgetLayout::update(YAGfx& gfx)
+{
+    uint8_t idx = 0U;
+
+    m_map.setGfx(gfx);
+
+    /* Every widget is painted in its clipping region directly over the
+     * canvas, there is no nesting of canvases.
+     */
+    for(idx = 0U; idx < m_entryCnt; ++idx)
+    {
+        const Entry& entry = m_entries[idx];
+
+        if (false == entry.clip.isEmpty())
+        {
+            m_map.setOffsetX(entry.clip.getX());
+            m_map.setOffsetY(entry.clip.getY());
+            m_map.setWidth(entry.clip.getWidth());
+            m_map.setHeight(entry.clip.getHeight());
+
+            entry.widget->update(m_map);
+        }
+    }
+}
+
+bool WidgetLayout::isDirty() const
+{
+    bool    isDirty = false;
+    uint8_t idx     = 0U;
+
+    for(idx = 0U; (idx < m_entryCnt) && (false == isDirty); ++idx)
+    {
+        isDirty = m_entries[idx].widget->isDirty();
+    }
+
+    return isDirty;
+}
+
+void WidgetLayout::invalidate()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < m_entryCnt; ++idx)
+    {
+        m_entries[idx].widget->invalidate();
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool WidgetLayout::readNode(File& fd, Node& node)
+{
+    bool    isSuccessful = false;
+    uint8_t data[NODE_SIZE];
+
+    if (NODE_SIZE == fd.read(data, NODE_SIZE))
+    {
+        uint8_t nameLen     = data[17];
+        uint8_t valueLen    = data[18];
+        char    buffer[UINT8_MAX + 1U];
+
+        node.type   = data[0];
+        node.parent = data[1];
+        node.x      = static_cast<int16_t>(static_cast<uint16_t>(data[2]) | (static_cast<uint16_t>(data[3]) << 8U));
+        node.y      = static_cast<int16_t>(static_cast<uint16_t>(data[4]) | (static_cast<uint16_t>(data[5]) << 8U));
+        node.width  = static_cast<uint16_t>(data[6]) | (static_cast<uint16_t>(data[7]) << 8U);
+        node.height = static_cast<uint16_t>(data[8]) | (static_cast<uint16_t>(data[9]) << 8U);
+        node.color  = Color(data[10], data[11], data[12]);
+        node.color2 = Color(data[13], data[14], data[15]);
+        node.option = data[16];
+
+        if ((NODE_TYPE_MAX > node.type) &&
+            (nameLen == fd.read(reinterpret_cast<uint8_t*>(buffer), nameLen)))
+        {
+            buffer[nameLen] = '\0';
+            node.name       = buffer;
+
+            if (valueLen == fd.read(reinterpret_cast<uint8_t*>(buffer), valueLen))
+            {
+                buffer[valueLen]    = '\0';
+                node.value          = buffer;
+                isSuccessful        = true;
+            }
+        }
+    }
+
+    return isSuccessful;
+}
+
+Widget* WidgetLayout::createWidget(FS& fs, const Node& node)
+{
+    Widget* widget = nullptr;
+
+    switch(node.type)
+    {
+    case NODE_TYPE_BITMAP:
+        {
+            BitmapWidget* bitmapWidget = new(std::nothrow) BitmapWidget();
+
+            if (nullptr != bitmapWidget)
+            {
+                /* The image may be uploaded later, therefore a missing one is no error. */
+                if (0U < node.value.length())
+                {
+                    (void)bitmapWidget->load(fs, node.value);
+                }
+
+                widget = bitmapWidget;
+            }
+        }
+        break;
+
+    case NODE_TYPE_TEXT:
+        widget = new(std::nothrow) TextWidget(node.value, node.color);
+        break;
+
+    case NODE_TYPE_LAMP:
+        widget = new(std::nothrow) LampWidget(0U != node.option, node.color2, node.color, node.width);
+        break;
+
+    case NODE_TYPE_PROGRESS_BAR:
+        {
+            ProgressBar* progressBar = new(std::nothrow) ProgressBar();
+
+            if (nullptr != progressBar)
+            {
+                progressBar->setColor(node.color);
+
+                if (ProgressBar::ALGORITHM_MAX > node.option)
+                {
+                    progressBar->setAlgo(static_cast<ProgressBar::Algorithm>(node.option));
+                }
+
+                widget = progressBar;
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return widget;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
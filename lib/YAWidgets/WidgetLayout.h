@@ -0,0 +1,290 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Widget layout
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __WIDGET_LAYOUT_H__
+#define __WIDGET_LAYOUT_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <FS.h>
+#include <YAGfxMap.h>
+#include <GfxRect.hpp>
+#include "Widget.hpp"
+#include "WidgetIndex.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A widget layout is loaded from a compiled layout file (.wly) and creates
+ * all of its widgets. In difference to nested widget groups, the layout tree
+ * is flattened during loading: every widget gets its absolute position and
+ * the clipping region of its parents. The widgets are kept in a flat array
+ * and painted via a single map over the display canvas.
+ *
+ * Layout files are compiled from JSON with scripts/layout_compiler.py.
+ *
+ * File format, all values are little endian:
+ * - Header
+ *   - 3 byte magic "WLY"
+ *   - 1 byte version
+ *   - 1 byte number of nodes
+ * - Nodes, a parent node is always stored before its children.
+ *   - 1 byte node type, see NodeType.
+ *   - 1 byte parent node index, NO_PARENT for the root level.
+ *   - 2 byte x-coordinate relative to the parent (signed)
+ *   - 2 byte y-coordinate relative to the parent (signed)
+ *   - 2 byte width
+ *   - 2 byte height
+ *   - 3 byte color (RGB), e.g. text color or lamp on color.
+ *   - 3 byte second color (RGB), e.g. lamp off color.
+ *   - 1 byte option, e.g. initial lamp state or progress bar algorithm.
+ *   - 1 byte name length
+ *   - 1 byte value length
+ *   - Name, without string termination
+ *   - Value, without string termination. It is the text of a text widget
+ *     or the image file name of a bitmap widget.
+ */
+class WidgetLayout
+{
+public:
+
+    /**
+     * Node types in the layout file.
+     */
+    enum NodeType
+    {
+        NODE_TYPE_GROUP = 0,    /**< Group, which only provides position and clipping to its children. */
+        NODE_TYPE_BITMAP,       /**< Bitmap widget */
+        NODE_TYPE_TEXT,         /**< Text widget */
+        NODE_TYPE_LAMP,         /**< Lamp widget */
+        NODE_TYPE_PROGRESS_BAR, /**< Progress bar */
+        NODE_TYPE_MAX           /**< Number of node types */
+    };
+
+    /** Layout file format version */
+    static const uint8_t    VERSION     = 1U;
+
+    /** Parent node index of a node on root level. */
+    static const uint8_t    NO_PARENT   = 0xFFU;
+
+    /**
+     * Constructs a empty layout.
+     */
+    WidgetLayout();
+
+    /**
+     * Destroys the layout and all of its widgets.
+     */
+    ~WidgetLayout();
+
+    /**
+     * Load a compiled layout file and create its widgets.
+     * Images, which are referenced by bitmap widgets, are loaded from the
+     * same filesystem.
+     * A already loaded layout is destroyed before.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] fileName  Name of the layout file
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool load(FS& fs, const String& fileName);
+
+    /**
+     * Destroy all widgets.
+     */
+    void clear();
+
+    /**
+     * Update/Draw all widgets in the canvas with the given graphics interface.
+     *
+     * @param[in] gfx   Graphics interface
+     */
+    void update(YAGfx& gfx);
+
+    /**
+     * Is any widget dirty and needs to be repainted?
+     *
+     * @return If the layout needs to be repainted, it will return true otherwise false.
+     */
+    bool isDirty() const;
+
+    /**
+     * Invalidate all widgets, which forces a repaint with the next update.
+     */
+    void invalidate();
+
+    /**
+     * Get number of widgets.
+     *
+     * @return Number of widgets
+     */
+    uint8_t getWidgetCount() const
+    {
+        return m_entryCnt;
+    }
+
+    /**
+     * Get widget by its index in the order of the layout file.
+     *
+     * @param[in] idx   Widget index
+     *
+     * @return If widget is available, it will be returned otherwise nullptr.
+     */
+    Widget* getWidget(uint8_t idx) const
+    {
+        Widget* widget = nullptr;
+
+        if (m_entryCnt > idx)
+        {
+            widget = m_entries[idx].widget;
+        }
+
+        return widget;
+    }
+
+    /**
+     * Find widget by its name.
+     *
+     * @param[in] name  Widget name to search for
+     *
+     * @return If widget is found, it will be returned otherwise nullptr.
+     */
+    Widget* find(const String& name) const
+    {
+        return m_index.find(WidgetNames::getInstance().getId(name));
+    }
+
+    /**
+     * Find widget by its name id.
+     *
+     * @param[in] nameId    Widget name id to search for
+     *
+     * @return If widget is found, it will be returned otherwise nullptr.
+     */
+    Widget* find(uint16_t nameId) const
+    {
+        return m_index.find(nameId);
+    }
+
+private:
+
+    /**
+     * A single widget with its absolute clipping region in the canvas.
+     */
+    struct Entry
+    {
+        Widget*     widget; /**< Widget, its position is relative to the clipping region. */
+        GfxRect     clip;   /**< Clipping region in the canvas */
+    };
+
+    /**
+     * Node in the layout file.
+     */
+    struct Node
+    {
+        uint8_t     type;       /**< Node type */
+        uint8_t     parent;     /**< Parent node index */
+        int16_t     x;          /**< x-coordinate relative to the parent */
+        int16_t     y;          /**< y-coordinate relative to the parent */
+        uint16_t    width;      /**< Width in pixel */
+        uint16_t    height;     /**< Height in pixel */
+        Color       color;      /**< Color */
+        Color       color2;     /**< Second color */
+        uint8_t     option;     /**< Widget specific option */
+        String      name;       /**< Widget name */
+        String      value;      /**< Widget specific value */
+    };
+
+    /**
+     * Absolute position and clipping region of a node, which is necessary
+     * to place its children.
+     */
+    struct Placement
+    {
+        uint8_t     type;   /**< Node type */
+        int16_t     x;      /**< Absolute x-coordinate in the canvas */
+        int16_t     y;      /**< Absolute y-coordinate in the canvas */
+        GfxRect     clip;   /**< Absolute clipping region in the canvas */
+    };
+
+    Entry*      m_entries;  /**< Flat widget array */
+    uint8_t     m_entryCnt; /**< Number of widgets */
+    WidgetIndex m_index;    /**< Index of all named widgets */
+    YAGfxMap    m_map;      /**< Map, which is used to paint a widget in its clipping region. */
+
+    WidgetLayout(const WidgetLayout& layout);
+    WidgetLayout& operator=(const WidgetLayout& layout);
+
+    /**
+     * Read the next node from the layout file.
+     *
+     * @param[in]   fd      File descriptor
+     * @param[out]  node    Node
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    static bool readNode(File& fd, Node& node);
+
+    /**
+     * Create and configure the widget of a node.
+     *
+     * @param[in] fs    Filesystem, used to load images.
+     * @param[in] node  Node
+     *
+     * @return If successful, it will return the widget otherwise nullptr.
+     */
+    static Widget* createWidget(FS& fs, const Node& node);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __WIDGET_LAYOUT_H__ */
+
+/** @} */
@@ -0,0 +1,132 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Widget names
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WidgetNames.h"
+
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+uint16_t WidgetNames::intern(const String& name)
+{
+    uint16_t            id = INVALID_ID;
+    MutexGuard<Mutex>   guard(m_mutex);
+
+    if (0U < name.length())
+    {
+        uint32_t        hash    = Util::hashFnv1aStr(name.c_str());
+        const Entry*    entry   = m_table.find(hash, name);
+
+        if (nullptr != entry)
+        {
+            id = entry->id;
+        }
+        /* Keep the load factor low, otherwise the probe sequences become long. */
+        else if (true == m_table.reserve(m_table.getCount() + 1U))
+        {
+            Entry newEntry;
+
+            newEntry.name   = name;
+            newEntry.hash   = hash;
+            newEntry.id     = m_table.getCount() + 1U;
+
+            if (true == m_table.add(newEntry))
+            {
+                id = newEntry.id;
+            }
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    return id;
+}
+
+uint16_t WidgetNames::getId(const String& name) const
+{
+    uint16_t            id = INVALID_ID;
+    MutexGuard<Mutex>   guard(m_mutex);
+
+    if (0U < name.length())
+    {
+        const Entry* entry = m_table.find(Util::hashFnv1aStr(name.c_str()), name);
+
+        if (nullptr != entry)
+        {
+            id = entry->id;
+        }
+    }
+
+    return id;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,212 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Widget names
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __WIDGET_NAMES_H__
+#define __WIDGET_NAMES_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <WString.h>
+#include <Mutex.hpp>
+#include <HashTable.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Interns widget names. Every different name gets a unique id, which stays
+ * valid for the whole runtime. Comparing ids is much cheaper than comparing
+ * strings, therefore the widget lookup is based on them.
+ *
+ * The names are stored in a hash table with open addressing, which grows
+ * if it gets too crowded. Names are never removed.
+ */
+class WidgetNames
+{
+public:
+
+    /**
+     * Get widget names instance.
+     *
+     * @return Widget names instance
+     */
+    static WidgetNames& getInstance()
+    {
+        static WidgetNames instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /** Id of a empty name and used if a name is unknown. */
+    static const uint16_t   INVALID_ID      = 0U;
+
+    /**
+     * Get the id of the name. If the name is not known yet, it will be
+     * added.
+     *
+     * @param[in] name  Widget name
+     *
+     * @return Name id. In case of a empty name or if no memory is available, it will return INVALID_ID.
+     */
+    uint16_t intern(const String& name);
+
+    /**
+     * Get the id of a already known name. In difference to intern() a
+     * unknown name is not added.
+     *
+     * @param[in] name  Widget name
+     *
+     * @return Name id. If the name is unknown, it will return INVALID_ID.
+     */
+    uint16_t getId(const String& name) const;
+
+    /**
+     * Get the number of known names.
+     *
+     * @return Number of known names
+     */
+    uint16_t getCount() const
+    {
+        return m_table.getCount();
+    }
+
+private:
+
+    /**
+     * Hash table entry.
+     */
+    struct Entry
+    {
+        String      name;   /**< Widget name */
+        uint32_t    hash;   /**< Hash of the name */
+        uint16_t    id;     /**< Name id, INVALID_ID marks a empty entry. */
+
+        /**
+         * Initializes a empty entry.
+         */
+        Entry() :
+            name(),
+            hash(0U),
+            id(INVALID_ID)
+        {
+        }
+    };
+
+    /**
+     * Hash table entry traits.
+     */
+    struct EntryTraits
+    {
+        /**
+         * Is the entry empty?
+         *
+         * @param[in] entry Entry
+         *
+         * @return If empty, it will return true otherwise false.
+         */
+        static bool isEmpty(const Entry& entry)
+        {
+            return (INVALID_ID == entry.id);
+        }
+
+        /**
+         * Get the hash of the entry.
+         *
+         * @param[in] entry Entry
+         *
+         * @return Hash
+         */
+        static uint32_t getHash(const Entry& entry)
+        {
+            return entry.hash;
+        }
+
+        /**
+         * Does the entry belong to the name?
+         *
+         * @param[in] entry Entry
+         * @param[in] name  Widget name
+         *
+         * @return If it matches, it will return true otherwise false.
+         */
+        static bool isMatch(const Entry& entry, const String& name)
+        {
+            return (name == entry.name);
+        }
+    };
+
+    HashTable<Entry, EntryTraits>   m_table;    /**< Hash table */
+    mutable Mutex                   m_mutex;    /**< Mutex to protect against concurrent access. */
+
+    /**
+     * Constructs the widget names.
+     */
+    WidgetNames() :
+        m_table(),
+        m_mutex()
+    {
+        (void)m_mutex.create();
+    }
+
+    /**
+     * Destroys the widget names.
+     */
+    ~WidgetNames()
+    {
+        /* Will never be called. */
+    }
+
+    WidgetNames(const WidgetNames& names);
+    WidgetNames& operator=(const WidgetNames& names);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __WIDGET_NAMES_H__ */
+
+/** @} */
@@ -0,0 +1,442 @@
+"""
+MIT License
+
+Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+================================================================================
+Font compiler, which converts a BDF or TTF font to a unicode font C header
+(see lib/BaseGfx/UnicodeFont.h).
+
+The glyph bitmaps are either 1 bit per pixel encoded or run length encoded.
+With encoding "auto", the smaller one is selected.
+
+Examples:
+    python font_compiler.py -i 5x7.bdf -n Font5x7 -o lib/YAWidgets/Font5x7.h
+    python font_compiler.py -i Arial.ttf -s 12 -r 0x20-0x7E,0xA0-0xFF -n Arial12 -o Arial12.h
+
+TTF fonts require the Pillow package. BDF fonts are parsed without any
+additional package.
+"""
+
+import argparse
+import os
+import sys
+
+ENCODING_BITMAP = "UNICODE_FONT_ENCODING_BITMAP"
+ENCODING_RLE = "UNICODE_FONT_ENCODING_RLE"
+
+# Max. run length, which fits into a nibble.
+RLE_MAX_RUN = 15
+
+# The glyph bitmap offset is a 16-bit value.
+MAX_BITMAP_SIZE = 0x10000
+
+# pylint: disable=too-few-public-methods
+class Glyph():
+    """A single glyph, already cropped to its bounding box.
+    """
+    def __init__(self, code_point, width, height, x_advance, x_offset, y_offset, pixels):
+        """Create a glyph.
+
+        Args:
+            code_point (int): Unicode code point
+            width (int): Bitmap width in pixel
+            height (int): Bitmap height in pixel
+            x_advance (int): Distance to advance the cursor (x axis)
+            x_offset (int): x distance from cursor position to upper left corner
+            y_offset (int): y distance from cursor position (baseline) to upper left corner
+            pixels (list): Rows of booleans, True is foreground.
+        """
+        self.code_point = code_point
+        self.width = width
+        self.height = height
+        self.x_advance = x_advance
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        self.pixels = pixels
+
+def crop(code_point, pixels, x_advance, x_offset, y_offset):
+    """Crop the pixels to the smallest bounding box of the foreground pixels.
+
+    Args:
+        code_point (int): Unicode code point
+        pixels (list): Rows of booleans
+        x_advance (int): Distance to advance the cursor (x axis)
+        x_offset (int): x distance from cursor to the upper left corner of the pixels
+        y_offset (int): y distance from baseline to the upper left corner of the pixels
+
+    Returns:
+        Glyph: Cropped glyph
+    """
+    rows = [y for y, row in enumerate(pixels) if any(row)]
+
+    # An empty glyph, e.g. space, keeps a single background pixel like the
+    # Adafruit GFX font converter does.
+    if not rows:
+        return Glyph(code_point, 1, 1, x_advance, 0, y_offset, [[False]])
+
+    cols = [x for x in range(len(pixels[0])) if any(row[x] for row in pixels)]
+    top, bottom = rows[0], rows[-1]
+    left, right = cols[0], cols[-1]
+    cropped = [row[left:right + 1] for row in pixels[top:bottom + 1]]
+
+    return Glyph(code_point,
+                 right - left + 1,
+                 bottom - top + 1,
+                 x_advance,
+                 x_offset + left,
+                 y_offset + top,
+                 cropped)
+
+def load_bdf(file_name, code_points):
+    """Load the glyphs of a BDF font.
+
+    Args:
+        file_name (str): BDF font file name
+        code_points (set): Code points which to load. If None, all are loaded.
+
+    Returns:
+        tuple: Glyph list and newline distance (y axis)
+    """
+    glyphs = []
+    ascent = 0
+    descent = 0
+    glyph = None
+    bitmap_rows = None
+
+    with open(file_name, "r", encoding="latin-1") as file_desc:
+        for line in file_desc:
+            fields = line.split()
+
+            if not fields:
+                continue
+
+            keyword = fields[0]
+
+            if bitmap_rows is not None:
+                if keyword == "ENDCHAR":
+                    pixels = []
+                    for row in bitmap_rows:
+                        value = int(row, 16)
+                        bits = len(row) * 4
+                        pixels.append([0 != (value >> (bits - 1 - x)) & 1 for x in range(glyph["width"])])
+                    # BBX y offset is the distance from baseline to the bottom row,
+                    # but the glyph y offset is from baseline to the top row.
+                    y_offset = -(glyph["y_offset"] + glyph["height"])
+                    glyphs.append(crop(glyph["code_point"], pixels, glyph["x_advance"], glyph["x_offset"], y_offset))
+                    bitmap_rows = None
+                    glyph = None
+                else:
+                    bitmap_rows.append(keyword)
+            elif keyword == "FONT_ASCENT":
+                ascent = int(fields[1])
+            elif keyword == "FONT_DESCENT":
+                descent = int(fields[1])
+            elif keyword == "STARTCHAR":
+                glyph = {"code_point": -1, "x_advance": 0, "width": 0, "height": 0, "x_offset": 0, "y_offset": 0}
+            elif glyph is not None:
+                if keyword == "ENCODING":
+                    glyph["code_point"] = int(fields[1])
+                elif keyword == "DWIDTH":
+                    glyph["x_advance"] = int(fields[1])
+                elif keyword == "BBX":
+                    glyph["width"] = int(fields[1])
+                    glyph["height"] = int(fields[2])
+                    glyph["x_offset"] = int(fields[3])
+                    glyph["y_offset"] = int(fields[4])
+                elif keyword == "BITMAP":
+                    if (glyph["code_point"] < 0) or \
+                       ((code_points is not None) and (glyph["code_point"] not in code_points)):
+                        # Skip unwanted glyph.
+                        glyph = None
+                    else:
+                        bitmap_rows = []
+
+    return glyphs, ascent + descent
+
+def load_ttf(file_name, size, code_points):
+    """Load the glyphs of a TTF font, rendered in the given size.
+
+    Args:
+        file_name (str): TTF font file name
+        size (int): Font size in pixel
+        code_points (set): Code points which to load.
+
+    Returns:
+        tuple: Glyph list and newline distance (y axis)
+    """
+    try:
+        # pylint: disable=import-outside-toplevel
+        from PIL import Image, ImageFont, ImageDraw
+    except ImportError:
+        print("TTF fonts require the Pillow package (pip install pillow).")
+        sys.exit(1)
+
+    font = ImageFont.truetype(file_name, size)
+    ascent, descent = font.getmetrics()
+    glyphs = []
+
+    for code_point in sorted(code_points):
+        char = chr(code_point)
+
+        # Skip code points, which are not covered by the font.
+        if font.getmask(char).getbbox() is None and not char.isspace():
+            continue
+
+        x_advance = int(round(font.getlength(char)))
+        width = max(x_advance, 1) + size
+        height = ascent + descent
+        image = Image.new("1", (width, height), 0)
+        draw = ImageDraw.Draw(image)
+        draw.fontmode = "1" # No anti aliasing
+        draw.text((0, 0), char, font=font, fill=1)
+
+        pixels = [[0 != image.getpixel((x, y)) for x in range(width)] for y in range(height)]
+        glyphs.append(crop(code_point, pixels, x_advance, 0, -ascent))
+
+    return glyphs, ascent + descent
+
+def encode_bitmap(glyph):
+    """Encode the glyph with 1 bit per pixel, row by row.
+
+    Args:
+        glyph (Glyph): Glyph
+
+    Returns:
+        list: Bytes
+    """
+    data = []
+    value = 0
+    bit_cnt = 0
+
+    for row in glyph.pixels:
+        for pixel in row:
+            value = (value << 1) | (1 if pixel else 0)
+            bit_cnt += 1
+            if bit_cnt == 8:
+                data.append(value)
+                value = 0
+                bit_cnt = 0
+
+    if bit_cnt > 0:
+        data.append(value << (8 - bit_cnt))
+
+    return data
+
+def encode_rle(glyph):
+    """Run length encode the glyph, see UNICODE_FONT_ENCODING_RLE.
+
+    Args:
+        glyph (Glyph): Glyph
+
+    Returns:
+        list: Bytes
+    """
+    nibbles = []
+    is_foreground = False
+    pixels = [pixel for row in glyph.pixels for pixel in row]
+    idx = 0
+
+    while idx < len(pixels):
+        run = 0
+        while (idx < len(pixels)) and (pixels[idx] == is_foreground):
+            run += 1
+            idx += 1
+
+        # Split long runs by a zero length run of the other kind.
+        while run > RLE_MAX_RUN:
+            nibbles.append(RLE_MAX_RUN)
+            nibbles.append(0)
+            run -= RLE_MAX_RUN
+
+        nibbles.append(run)
+        is_foreground = not is_foreground
+
+    if len(nibbles) % 2:
+        nibbles.append(0)
+
+    return [(nibbles[idx] << 4) | nibbles[idx + 1] for idx in range(0, len(nibbles), 2)]
+
+def build_ranges(glyphs):
+    """Build the sorted code point ranges of the glyphs.
+
+    Args:
+        glyphs (list): Glyphs, sorted by code point.
+
+    Returns:
+        list: Tuples of first code point, last code point and glyph index.
+    """
+    ranges = []
+
+    for idx, glyph in enumerate(glyphs):
+        if ranges and (ranges[-1][1] + 1 == glyph.code_point):
+            ranges[-1][1] = glyph.code_point
+        else:
+            ranges.append([glyph.code_point, glyph.code_point, idx])
+
+    return ranges
+
+def char_name(code_point):
+    """Get a printable comment for the code point.
+
+    Args:
+        code_point (int): Unicode code point
+
+    Returns:
+        str: Comment text
+    """
+    text = f"U+{code_point:04X}"
+
+    if (0x20 < code_point < 0x7F) and (chr(code_point) not in "*/\\"):
+        text += f" '{chr(code_point)}'"
+
+    return text
+
+def write_header(file_name, name, glyphs, y_advance, encoding, data):
+    """Write the unicode font C header.
+
+    Args:
+        file_name (str): Output file name
+        name (str): Font name, used as C identifier
+        glyphs (list): Glyphs, sorted by code point
+        y_advance (int): Newline distance (y axis)
+        encoding (str): Used encoding
+        data (list): Encoded bitmap bytes per glyph
+    """
+    ranges = build_ranges(glyphs)
+    guard = f"__{name.upper()}_H__"
+    lines = []
+
+    lines.append("/* Generated by scripts/font_compiler.py, do not edit. */")
+    lines.append("")
+    lines.append(f"#ifndef {guard}")
+    lines.append(f"#define {guard}")
+    lines.append("")
+    lines.append("#include <UnicodeFont.h>")
+    lines.append("")
+    lines.append(f"const uint8_t {name}Bitmaps[] PROGMEM = {{")
+    for glyph, glyph_data in zip(glyphs, data):
+        values = ", ".join(f"0x{value:02X}" for value in glyph_data)
+        lines.append(f"    {values}, /* {char_name(glyph.code_point)} */")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const GFXglyph {name}Glyphs[] PROGMEM = {{")
+    offset = 0
+    for glyph, glyph_data in zip(glyphs, data):
+        lines.append(f"    {{ {offset}, {glyph.width}, {glyph.height}, {glyph.x_advance}, "
+                     f"{glyph.x_offset}, {glyph.y_offset} }}, /* {char_name(glyph.code_point)} */")
+        offset += len(glyph_data)
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const UnicodeRange {name}Ranges[] PROGMEM = {{")
+    for first, last, glyph_idx in ranges:
+        lines.append(f"    {{ 0x{first:04X}, 0x{last:04X}, {glyph_idx} }},")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const UnicodeFont {name} PROGMEM =")
+    lines.append("{")
+    lines.append(f"    {name}Bitmaps,")
+    lines.append(f"    {name}Glyphs,")
+    lines.append(f"    {name}Ranges,")
+    lines.append(f"    sizeof({name}Ranges) / sizeof({name}Ranges[0]),")
+    lines.append(f"    {y_advance},")
+    lines.append(f"    {encoding}")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"#endif  /* {guard} */")
+
+    with open(file_name, "w", encoding="utf-8") as file_desc:
+        file_desc.write("\n".join(lines) + "\n")
+
+def parse_ranges(text):
+    """Parse code point ranges, e.g. "0x20-0x7E,0xA0-0xFF,0x20AC".
+
+    Args:
+        text (str): Comma separated ranges
+
+    Returns:
+        set: Code points
+    """
+    code_points = set()
+
+    for item in text.split(","):
+        bounds = item.strip().split("-")
+        first = int(bounds[0], 0)
+        last = int(bounds[-1], 0)
+        code_points.update(range(first, last + 1))
+
+    # Only the basic multilingual plane is supported by the unicode font.
+    return {code_point for code_point in code_points if code_point <= 0xFFFF}
+
+def main():
+    """The program entry point function.
+
+    Returns:
+        int: System exit status
+    """
+    parser = argparse.ArgumentParser(description="Compile a BDF/TTF font to a unicode font C header.")
+    parser.add_argument("-i", "--input", required=True, help="BDF or TTF font file")
+    parser.add_argument("-o", "--output", required=True, help="C header file")
+    parser.add_argument("-n", "--name", required=True, help="Font name, used as C identifier")
+    parser.add_argument("-s", "--size", type=int, default=8, help="Font size in pixel (TTF only)")
+    parser.add_argument("-r", "--ranges", default=None,
+                        help="Code point ranges, e.g. 0x20-0x7E,0xA0-0xFF (default: BDF all, TTF 0x20-0x7E)")
+    parser.add_argument("-e", "--encoding", choices=["bitmap", "rle", "auto"], default="auto",
+                        help="Glyph bitmap encoding (default: auto, the smaller one)")
+    args = parser.parse_args()
+
+    code_points = None if args.ranges is None else parse_ranges(args.ranges)
+
+    if os.path.splitext(args.input)[1].lower() == ".bdf":
+        glyphs, y_advance = load_bdf(args.input, code_points)
+    else:
+        if code_points is None:
+            code_points = parse_ranges("0x20-0x7E")
+        glyphs, y_advance = load_ttf(args.input, args.size, code_points)
+
+    glyphs = sorted([glyph for glyph in glyphs if glyph.code_point <= 0xFFFF], key=lambda glyph: glyph.code_point)
+
+    if not glyphs:
+        print("No glyphs found.")
+        return 1
+
+    bitmap_data = [encode_bitmap(glyph) for glyph in glyphs]
+    rle_data = [encode_rle(glyph) for glyph in glyphs]
+    bitmap_size = sum(len(glyph_data) for glyph_data in bitmap_data)
+    rle_size = sum(len(glyph_data) for glyph_data in rle_data)
+
+    if (args.encoding == "rle") or ((args.encoding == "auto") and (rle_size < bitmap_size)):
+        encoding, data, size = ENCODING_RLE, rle_data, rle_size
+    else:
+        encoding, data, size = ENCODING_BITMAP, bitmap_data, bitmap_size
+
+    if size > MAX_BITMAP_SIZE:
+        print(f"Glyph bitmaps too large: {size} bytes.")
+        return 1
+
+    write_header(args.output, args.name, glyphs, y_advance, encoding, data)
+
+    print(f"{len(glyphs)} glyphs, bitmap {bitmap_size} bytes, rle {rle_size} bytes, using {encoding}.")
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,214 @@
+"""
+MIT License
+
+Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+================================================================================
+Layout compiler, which converts a JSON widget layout to a compiled layout
+file (.wly), which is loaded by the firmware (see lib/YAWidgets/WidgetLayout.h).
+
+The JSON layout contains a list of widgets. A group only provides the position
+and clipping region for its widgets and is flattened by the firmware.
+
+{
+    "widgets": [{
+        "type": "bitmap", "name": "icon", "x": 0, "y": 0, "width": 8, "height": 8,
+        "file": "/configuration/icon.bmp"
+    }, {
+        "type": "group", "x": 8, "y": 0, "width": 24, "height": 8,
+        "widgets": [{
+            "type": "text", "name": "text", "x": 0, "y": 0, "width": 24, "height": 6,
+            "text": "Hello", "color": "#FFFFFF"
+        }, {
+            "type": "lamp", "name": "lamp0", "x": 1, "y": 7, "width": 4, "height": 1,
+            "colorOn": "#00FF00", "colorOff": "#FF0000", "on": false
+        }]
+    }, {
+        "type": "progressBar", "name": "progress", "x": 0, "y": 7, "width": 8, "height": 1,
+        "color": "#FF0000", "algorithm": "bar"
+    }]
+}
+
+Example:
+    python layout_compiler.py -i iconTextLamp.json -o iconTextLamp.wly
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"WLY"
+VERSION = 1
+
+# Parent index of a node on root level.
+NO_PARENT = 0xFF
+
+# The number of nodes is stored in a single byte, but NO_PARENT is reserved.
+MAX_NODES = 0xFF
+
+NODE_TYPES = {
+    "group": 0,
+    "bitmap": 1,
+    "text": 2,
+    "lamp": 3,
+    "progressBar": 4
+}
+
+PROGRESS_BAR_ALGORITHMS = {
+    "bar": 0,
+    "pixel": 1
+}
+
+class LayoutError(Exception):
+    """Invalid layout description.
+    """
+
+def parse_color(value):
+    """Parse a color in the format "#RRGGBB" or as number.
+
+    Args:
+        value (str|int): Color
+
+    Returns:
+        bytes: Red, green and blue
+    """
+    if isinstance(value, str):
+        value = int(value.lstrip("#"), 16)
+
+    return bytes([(value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF])
+
+def encode_str(value, what):
+    """Encode a string with its length prefix.
+
+    Args:
+        value (str): String
+        what (str): Description used in the error message
+
+    Returns:
+        bytes: UTF-8 encoded string
+    """
+    data = value.encode("utf-8")
+
+    if len(data) > 0xFF:
+        raise LayoutError(f"{what} too long: {value}")
+
+    return data
+
+def encode_node(widget, parent):
+    """Encode a single node.
+
+    Args:
+        widget (dict): Widget description
+        parent (int): Parent node index
+
+    Returns:
+        bytes: Encoded node
+    """
+    widget_type = widget.get("type")
+
+    if widget_type not in NODE_TYPES:
+        raise LayoutError(f"Unknown widget type: {widget_type}")
+
+    color = parse_color(widget.get("color", widget.get("colorOn", 0xFFFFFF)))
+    color2 = parse_color(widget.get("colorOff", 0))
+    option = 0
+    value = ""
+
+    if widget_type == "lamp":
+        option = 1 if widget.get("on", False) else 0
+    elif widget_type == "progressBar":
+        option = PROGRESS_BAR_ALGORITHMS[widget.get("algorithm", "bar")]
+    elif widget_type == "text":
+        value = widget.get("text", "")
+    elif widget_type == "bitmap":
+        value = widget.get("file", "")
+
+    name = encode_str(widget.get("name", ""), "Name")
+    value = encode_str(value, "Value")
+
+    return struct.pack("<BBhhHH3s3sBBB",
+                       NODE_TYPES[widget_type], parent,
+                       widget.get("x", 0), widget.get("y", 0),
+                       widget.get("width", 0), widget.get("height", 0),
+                       color, color2, option, len(name), len(value)) + name + value
+
+def encode_widgets(widgets, parent, nodes):
+    """Encode the widgets recursive. A parent is always encoded before its children.
+
+    Args:
+        widgets (list): Widget descriptions
+        parent (int): Parent node index
+        nodes (list): Encoded nodes
+    """
+    for widget in widgets:
+        nodes.append(encode_node(widget, parent))
+
+        if len(nodes) > MAX_NODES:
+            raise LayoutError(f"Too many widgets, max. {MAX_NODES}.")
+
+        if widget.get("type") == "group":
+            encode_widgets(widget.get("widgets", []), len(nodes) - 1, nodes)
+
+def compile_layout(layout):
+    """Compile a layout description.
+
+    Args:
+        layout (dict): Layout description
+
+    Returns:
+        bytes: Compiled layout
+    """
+    nodes = []
+
+    encode_widgets(layout.get("widgets", []), NO_PARENT, nodes)
+
+    return MAGIC + bytes([VERSION, len(nodes)]) + b"".join(nodes)
+
+def main():
+    """The program entry point function.
+
+    Returns:
+        int: System exit status
+    """
+    parser = argparse.ArgumentParser(description="Compile a JSON widget layout to a layout file.")
+    parser.add_argument("-i", "--input", required=True, help="JSON layout file")
+    parser.add_argument("-o", "--output", required=True, help="Compiled layout file (.wly)")
+    args = parser.parse_args()
+
+    with open(args.input, "r", encoding="utf-8") as file:
+        layout = json.load(file)
+
+    try:
+        data = compile_layout(layout)
+    except (LayoutError, KeyError, struct.error) as error:
+        print(f"Invalid layout: {error}")
+        return 1
+
+    with open(args.output, "wb") as file:
+        file.write(data)
+
+    print(f"{data[4]} nodes, {len(data)} bytes.")
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,130 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Binary configuration file handler
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup common
+ *
+ * @{
+ */
+
+#ifndef __BINARY_CONFIG_FILE_H__
+#define __BINARY_CONFIG_FILE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <BinaryConfig.h>
+#include <FS.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Binary configuration file handler. The whole file is read at once into
+ * the buffer of the binary configuration, therefore no DOM is necessary.
+ */
+class BinaryConfigFile
+{
+public:
+
+    /**
+     * Constructs the binary configuration file handler.
+     * 
+     * @param[in] fs    Filesystem
+     */
+    BinaryConfigFile(FS& fs) :
+        m_fs(fs)
+    {
+    }
+
+    /**
+     * Constructs the binary configuration file handler, using the same
+     * filesystem as the assigned file handler.
+     * 
+     * @param[in] file  Binary configuration file handler
+     */
+    BinaryConfigFile(const BinaryConfigFile& file) :
+        m_fs(file.m_fs)
+    {
+    }
+
+    /**
+     * Destroys the binary configuration file handler.
+     */
+    ~BinaryConfigFile()
+    {
+    }
+
+    /**
+     * Load binary configuration file. If successful, the fields can be
+     * read from the configuration.
+     * 
+     * @param[in] fileName  Name of the binary configuration file.
+     * @param[in] config    Binary configuration, which shall contain the loaded content.
+     * 
+     * @return If successful, it will return true otherwise false.
+     */
+    bool load(const String& fileName, BinaryConfig& config);
+
+    /**
+     * Save binary configuration file.
+     * 
+     * @param[in] fileName  Name of the binary configuration file.
+     * @param[in] config    Binary configuration, which was finished with endWrite().
+     * 
+     * @return If successful, it will return true otherwise false.
+     */
+    bool save(const String& fileName, const BinaryConfig& config);
+
+protected:
+
+private:
+
+    FS  m_fs;   /**< Filesystem */
+
+    BinaryConfigFile();
+    BinaryConfigFile& operator=(const BinaryConfigFile& file);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BINARY_CONFIG_FILE_H__ */
+
+/** @} */
@@ -35,6 +35,8 @@
 #include "MemMon.h"
 
 #include <Logging.h>
+#include <ImageCache.h>
+#include <PoolAllocator.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -95,6 +97,9 @@ void MemMon::process()
         {
             LOG_FATAL("----- Heap corrupt! ------");
         }
+
+        updateImageCacheBudget();
+        checkPools();
     }
 }
 
@@ -106,6 +111,72 @@ void MemMon::process()
  * Private Methods
  *****************************************************************************/
 
+void MemMon::updateImageCacheBudget()
+{
+    ImageCache& imageCache  = ImageCache::getInstance();
+    size_t      freeHeap    = ESP.getFreeHeap();
+    size_t      budget      = 0U;
+
+    /* The memory used by the image cache is available for it too. */
+    budget = (freeHeap + imageCache.getSize()) / IMAGE_CACHE_HEAP_DIVIDER;
+
+    if (IMAGE_CACHE_MAX_BUDGET < budget)
+    {
+        budget = IMAGE_CACHE_MAX_BUDGET;
+    }
+
+    /* If the heap becomes low, all unused images will be released. */
+    if (MIN_HEAP_BLOCK_MEMORY > freeHeap)
+    {
+        budget = 0U;
+    }
+
+    imageCache.setBudget(budget);
+
+    return;
+}
+
+void MemMon::checkPools()
+{
+    PoolAllocator&              poolAllocator   = PoolAllocator::getInstance();
+    uint32_t                    failCount       = poolAllocator.getOversizeCount();
+    uint8_t                     idx             = 0U;
+    PoolAllocator::Statistics   stats;
+
+    for(idx = 0U; idx < poolAllocator.getPoolCount(); ++idx)
+    {
+        if (true == poolAllocator.getStatistics(idx, stats))
+        {
+            failCount += stats.failCount;
+        }
+    }
+
+    /* Requests served by the heap may fragment it again, therefore show
+     * which pool is too small.
+     */
+    if (m_poolFailCount != failCount)
+    {
+        LOG_WARNING("%u pool allocations served by heap, %u oversized.", failCount - m_poolFailCount, poolAllocator.getOversizeCount());
+
+        for(idx = 0U; idx < poolAllocator.getPoolCount(); ++idx)
+        {
+            if (true == poolAllocator.getStatistics(idx, stats))
+            {
+                LOG_INFO("Pool %u byte: %u/%u blocks used, peak %u, exhausted %u times.",
+                    stats.blockSize,
+                    stats.usedCount,
+                    stats.blockCount,
+                    stats.peakCount,
+                    stats.failCount);
+            }
+        }
+
+        m_poolFailCount = failCount;
+    }
+
+    return;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
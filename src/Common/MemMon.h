@@ -88,14 +88,23 @@ public:
     /** Minimum size of largest block of heap that can be allocated at once in bytes, the monitor starts to warn. */
     static const size_t     MIN_HEAP_BLOCK_MEMORY   = 4096U;
 
+    /** The image cache budget is this fraction of the free heap memory. */
+    static const size_t     IMAGE_CACHE_HEAP_DIVIDER    = 8U;
+
+    /** Max. image cache budget in bytes. */
+    static const size_t     IMAGE_CACHE_MAX_BUDGET      = 32U * 1024U;
+
 private:
 
-    SimpleTimer m_timer;    /**< Timer used for cyclic processing. */
+    SimpleTimer m_timer;            /**< Timer used for cyclic processing. */
+    uint32_t    m_poolFailCount;    /**< Number of pool allocator requests, which were served by the heap at the last check. */
 
     /**
      * Constructs the memory monitor.
      */
-    MemMon()
+    MemMon() :
+        m_timer(),
+        m_poolFailCount(0U)
     {
     }
 
@@ -109,6 +118,17 @@ private:
 
     MemMon(const MemMon& taskMon);
     MemMon& operator=(const MemMon& taskMon);
+
+    /**
+     * Update the image cache memory budget, derived from the free heap memory.
+     */
+    void updateImageCacheBudget();
+
+    /**
+     * Check the pool allocator and show the pool statistics, if requests
+     * were served by the heap since the last check.
+     */
+    void checkPools();
 };
 
 /******************************************************************************
@@ -77,6 +77,8 @@ struct Statistics
  * Prototypes
  *****************************************************************************/
 
+static uint8_t getPriorityWeight(IPluginMaintenance::Priority priority);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -124,8 +126,27 @@ bool DisplayMgr::begin()
         {
             m_slots = new(std::nothrow) Slot[m_maxSlots];
 
-            /* Load slot configuration */
-            load();
+            /* Slots are only usable together with their process and hibernation deadlines, UID index and rotation. */
+            if ((nullptr == m_slots) ||
+                (false == m_processQueue.create(m_maxSlots)) ||
+                (false == m_hibernateQueue.create(m_maxSlots)) ||
+                (false == m_uidIndex.create(m_maxSlots)) ||
+                (false == m_rotation.create(m_maxSlots)))
+            {
+                delete[] m_slots;
+                m_slots = nullptr;
+
+                m_processQueue.release();
+                m_hibernateQueue.release();
+                m_uidIndex.release();
+                m_rotation.release();
+                m_maxSlots = 0U;
+            }
+            else
+            {
+                /* Load slot configuration */
+                load();
+            }
         }
     }
 
@@ -146,23 +167,28 @@ bool DisplayMgr::begin()
     if (false == isError)
     {
         m_selectedFrameBuffer = &m_framebuffers[0U];
+        m_frameTracker.setGfx(*m_selectedFrameBuffer);
     }
 
     /* Not started yet? */
     if ((nullptr == m_taskHandle) &&
         (nullptr != m_slots))
     {
-        if (true == m_mutex.create())
+        if ((true == m_mutex.create()) &&
+            (true == m_processMutex.create()))
         {
-            /* Create binary semaphore to signal task exit. */
-            m_xSemaphore = xSemaphoreCreateBinary();
+            /* Create binary semaphores to signal task exit. */
+            m_xSemaphore        = xSemaphoreCreateBinary();
+            m_processXSemaphore = xSemaphoreCreateBinary();
 
-            if (nullptr != m_xSemaphore)
+            if ((nullptr != m_xSemaphore) &&
+                (nullptr != m_processXSemaphore))
             {
                 BaseType_t  osRet   = pdFAIL;
 
-                /* Task shall run */
-                m_taskExit = false;
+                /* Tasks shall run */
+                m_taskExit          = false;
+                m_processTaskExit   = false;
 
                 osRet = xTaskCreateUniversal(   updateTask,
                                                 "displayTask",
@@ -175,8 +201,27 @@ bool DisplayMgr::begin()
                 /* Task successful created? */
                 if (pdPASS == osRet)
                 {
-                    (void)xSemaphoreGive(m_xSemaphore);
-                    status = true;
+                    osRet = xTaskCreateUniversal(   processTask,
+                                                    "pluginProcessTask",
+                                                    PROCESS_TASK_STACK_SIZE,
+                                                    this,
+                                                    PROCESS_TASK_PRIORITY,
+                                                    &m_processTaskHandle,
+                                                    PROCESS_TASK_RUN_CORE);
+
+                    /* Task successful created? */
+                    if (pdPASS == osRet)
+                    {
+                        (void)xSemaphoreGive(m_xSemaphore);
+                        (void)xSemaphoreGive(m_processXSemaphore);
+                        status = true;
+                    }
+                    else
+                    {
+                        /* The display task still waits for the start signal. */
+                        vTaskDelete(m_taskHandle);
+                        m_taskHandle = nullptr;
+                    }
                 }
             }
         }
@@ -190,6 +235,12 @@ bool DisplayMgr::begin()
             vSemaphoreDelete(m_xSemaphore);
             m_xSemaphore = nullptr;
         }
+
+        if (nullptr != m_processXSemaphore)
+        {
+            vSemaphoreDelete(m_processXSemaphore);
+            m_processXSemaphore = nullptr;
+        }
     }
     else
     {
@@ -203,6 +254,22 @@ void DisplayMgr::end()
 {
     /* Note, don't destroy the slots and the canvas framebuffers here. They shall live until the system restarts. */
 
+    /* Plugin process task already running? */
+    if (nullptr != m_processTaskHandle)
+    {
+        m_processTaskExit = true;
+        notifyProcessTask();
+
+        /* Join */
+        (void)xSemaphoreTake(m_processXSemaphore, portMAX_DELAY);
+        m_processTaskHandle = nullptr;
+
+        vSemaphoreDelete(m_processXSemaphore);
+        m_processXSemaphore = nullptr;
+
+        m_processMutex.destroy();
+    }
+
     /* Already running? */
     if (nullptr != m_taskHandle)
     {
@@ -290,8 +357,15 @@ uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId)
                 }
                 else
                 {
+                    (void)m_uidIndex.insert(plugin->getUID(), slotId);
+
                     LOG_INFO("Start plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
                     plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+
+                    /* Process it as soon as possible and hibernate it, if it is not shown for a while. */
+                    (void)m_processQueue.schedule(slotId, millis());
+                    scheduleHibernation(slotId);
+                    notifyProcessTask();
                 }
             }
             else
@@ -312,8 +386,15 @@ uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId)
             }
             else
             {
+                (void)m_uidIndex.insert(plugin->getUID(), slotId);
+
                 LOG_INFO("Start plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
                 plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+
+                /* Process it as soon as possible and hibernate it, if it is not shown for a while. */
+                (void)m_processQueue.schedule(slotId, millis());
+                scheduleHibernation(slotId);
+                notifyProcessTask();
             }
         }
         else
@@ -337,6 +418,7 @@ bool DisplayMgr::uninstallPlugin(IPluginMaintenance* plugin)
     if (nullptr != plugin)
     {
         uint8_t                     slotId = SLOT_ID_INVALID;
+        MutexGuard<MutexRecursive>  processGuard(m_processMutex);   /* Wait until the plugin is not processed anymore. */
         MutexGuard<MutexRecursive>  guard(m_mutex);
 
         slotId = getSlotIdByPluginUID(plugin->getUID());
@@ -352,6 +434,19 @@ bool DisplayMgr::uninstallPlugin(IPluginMaintenance* plugin)
                     m_selectedPlugin = nullptr;
                 }
 
+                /* Is this plugin requested to prepare? */
+                if (m_preparedPlugin == plugin)
+                {
+                    m_preparedPlugin    = nullptr;
+                    m_isPreparePending  = false;
+                }
+
+                /* Is this plugin woken up to be activated? */
+                if (m_wakingSlot == slotId)
+                {
+                    m_wakingSlot = SLOT_ID_INVALID;
+                }
+
                 LOG_INFO("Stop plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
                 plugin->stop();
                 if (false == m_slots[slotId].setPlugin(nullptr))
@@ -360,6 +455,9 @@ bool DisplayMgr::uninstallPlugin(IPluginMaintenance* plugin)
                 }
                 else
                 {
+                    m_processQueue.remove(slotId);
+                    m_hibernateQueue.remove(slotId);
+                    m_uidIndex.remove(plugin->getUID());
                     status = true;
                 }
             }
@@ -424,24 +522,10 @@ bool DisplayMgr::setPluginAliasName(uint16_t uid, const String& alias)
 
 uint8_t DisplayMgr::getSlotIdByPluginUID(uint16_t uid)
 {
-    uint8_t                     index   = 0U;
-    uint8_t                     slotId  = SLOT_ID_INVALID;
-    MutexGuard<MutexRecursive>  guard(m_mutex);
-
-    while((m_maxSlots > index) && (m_maxSlots <= slotId))
-    {
-        if (false == m_slots[index].isEmpty())
-        {
-            if (uid == m_slots[index].getPlugin()->getUID())
-            {
-                slotId = index;
-            }
-        }
-
-        ++index;
-    }
+    MutexGuard<MutexRecursive> guard(m_mutex);
 
-    return slotId;
+    /* Note, UidIndex::INVALID_INDEX is equal to SLOT_ID_INVALID. */
+    return m_uidIndex.find(uid);
 }
 
 IPluginMaintenance* DisplayMgr::getPluginInSlot(uint8_t slotId)
@@ -470,6 +554,9 @@ void DisplayMgr::activatePlugin(IPluginMaintenance* plugin)
         if (m_maxSlots > slotId)
         {
             m_requestedPlugin = plugin;
+
+            /* A explicit request cancels a interrupt. */
+            m_interruptedSlot = SLOT_ID_INVALID;
         }
     }
 
@@ -539,9 +626,48 @@ bool DisplayMgr::movePluginToSlot(IPluginMaintenance* plugin, uint8_t slotId)
 
             if (false == dstSlot->isLocked())
             {
+                bool isSrcHibernated = srcSlot->isHibernated();
+                bool isDstHibernated = dstSlot->isHibernated();
+
                 srcSlot->setPlugin(dstSlot->getPlugin());
                 dstSlot->setPlugin(plugin);
 
+                /* The hibernation state belongs to the plugins. */
+                srcSlot->setHibernated(isDstHibernated);
+                dstSlot->setHibernated(isSrcHibernated);
+
+                if (false == srcSlot->isEmpty())
+                {
+                    (void)m_uidIndex.insert(srcSlot->getPlugin()->getUID(), srcSlotId);
+                }
+
+                (void)m_uidIndex.insert(plugin->getUID(), slotId);
+
+                /* The process deadlines belong to the slots, therefore
+                 * process the moved plugins as soon as possible.
+                 */
+                m_processQueue.remove(srcSlotId);
+
+                if (false == srcSlot->isEmpty())
+                {
+                    (void)m_processQueue.schedule(srcSlotId, millis());
+                }
+
+                (void)m_processQueue.schedule(slotId, millis());
+
+                /* The hibernation deadlines belong to the slots too, therefore
+                 * start the delay of the moved plugins again.
+                 */
+                m_hibernateQueue.remove(srcSlotId);
+
+                if (false == srcSlot->isEmpty())
+                {
+                    scheduleHibernation(srcSlotId);
+                }
+
+                scheduleHibernation(slotId);
+                notifyProcessTask();
+
                 /* Is one of the moved plugins selected at the moment? */
                 if ((m_selectedPlugin == srcSlot->getPlugin()) ||
                     (m_selectedPlugin == dstSlot->getPlugin()))
@@ -550,6 +676,16 @@ bool DisplayMgr::movePluginToSlot(IPluginMaintenance* plugin, uint8_t slotId)
                     m_selectedPlugin = nullptr;
                 }
 
+                /* The next slot may have changed, determine it again. */
+                if (nullptr != m_preparedPlugin)
+                {
+                    m_preparedPlugin->discardPreparation();
+                }
+
+                m_preparedPlugin    = nullptr;
+                m_isPreparePending  = false;
+                m_wakingSlot        = SLOT_ID_INVALID;
+
                 status = true;
             }
         }
@@ -596,6 +732,23 @@ bool DisplayMgr::isSlotLocked(uint8_t slotId)
     return isLocked;
 }
 
+void DisplayMgr::lock()
+{
+    /* Same order as everywhere else, to avoid a deadlock. */
+    (void)m_processMutex.take(portMAX_DELAY);
+    (void)m_mutex.take(portMAX_DELAY);
+
+    return;
+}
+
+void DisplayMgr::unlock()
+{
+    (void)m_mutex.give();
+    (void)m_processMutex.give();
+
+    return;
+}
+
 uint32_t DisplayMgr::getSlotDuration(uint8_t slotId)
 {
     uint32_t duration = 0U;
@@ -683,15 +836,28 @@ DisplayMgr::DisplayMgr() :
     m_taskHandle(nullptr),
     m_taskExit(false),
     m_xSemaphore(nullptr),
+    m_processMutex(),
+    m_processTaskHandle(nullptr),
+    m_processTaskExit(false),
+    m_processXSemaphore(nullptr),
+    m_processQueue(),
+    m_hibernateQueue(),
     m_slots(nullptr),
     m_maxSlots(0U),
+    m_uidIndex(),
+    m_rotation(),
+    m_interruptedSlot(SLOT_ID_INVALID),
     m_selectedSlot(SLOT_ID_INVALID),
     m_selectedPlugin(nullptr),
     m_requestedPlugin(nullptr),
+    m_preparedPlugin(nullptr),
+    m_isPreparePending(false),
+    m_wakingSlot(SLOT_ID_INVALID),
     m_slotTimer(),
     m_displayFadeState(FADE_IN),
     m_selectedFrameBuffer(nullptr),
     m_framebuffers(),
+    m_frameTracker(),
     m_fadeLinearEffect(),
     m_fadeMoveXEffect(),
     m_fadeMoveYEffect(),
@@ -708,44 +874,72 @@ DisplayMgr::~DisplayMgr()
 
 uint8_t DisplayMgr::nextSlot(uint8_t slotId)
 {
-    uint8_t count = 0U;
+    uint8_t idx                 = 0U;
+    bool    isReadyAvailable    = false;
 
-    if (m_maxSlots <= slotId)
-    {
-        slotId = 0U;
-    }
-    else
+    /* Only slots with a installed, enabled and ready plugin take part in the rotation. */
+    for(idx = 0U; idx < m_maxSlots; ++idx)
     {
-        ++slotId;
-        slotId %= m_maxSlots;
+        IPluginMaintenance* plugin  = m_slots[idx].getPlugin();
+        uint8_t             weight  = 0U;
+
+        if ((nullptr != plugin) &&
+            (true == plugin->isEnabled()) &&
+            (true == plugin->isReady()))
+        {
+            weight              = getPriorityWeight(plugin->getPriority());
+            isReadyAvailable    = true;
+        }
+
+        m_rotation.setWeight(idx, weight);
     }
 
-    /* Set next slot active, precondition is a installed plugin which is enabled.  */
-    do
+    /* If no plugin is ready, a not ready one is still better than a black display. */
+    if (false == isReadyAvailable)
     {
-        /* Plugin installed? */
-        if (false == m_slots[slotId].isEmpty())
+        for(idx = 0U; idx < m_maxSlots; ++idx)
         {
-            /* Plugin enabled? */
-            if (true == m_slots[slotId].getPlugin()->isEnabled())
+            IPluginMaintenance* plugin = m_slots[idx].getPlugin();
+
+            if ((nullptr != plugin) &&
+                (true == plugin->isEnabled()))
             {
-                break;
+                m_rotation.setWeight(idx, getPriorityWeight(plugin->getPriority()));
             }
         }
+    }
 
-        ++slotId;
-        slotId %= m_maxSlots;
+    return m_rotation.peek(slotId);
+}
 
-        ++count;
-    }
-    while (m_maxSlots > count);
+uint8_t DisplayMgr::getInterruptSlot()
+{
+    uint8_t interruptSlot   = SLOT_ID_INVALID;
+    uint8_t idx             = 0U;
 
-    if (m_maxSlots <= count)
+    for(idx = 0U; idx < m_maxSlots; ++idx)
     {
-        slotId = SLOT_ID_INVALID;
+        IPluginMaintenance* plugin = m_slots[idx].getPlugin();
+
+        if ((nullptr != plugin) &&
+            (true == plugin->isEnabled()) &&
+            (true == plugin->isReady()) &&
+            (IPluginMaintenance::PRIORITY_URGENT == plugin->getPriority()))
+        {
+            if ((SLOT_ID_INVALID == interruptSlot) &&
+                (false == m_slots[idx].isInterruptServed()))
+            {
+                interruptSlot = idx;
+            }
+        }
+        /* Not urgent anymore, therefore it may interrupt again next time. */
+        else
+        {
+            m_slots[idx].setInterruptServed(false);
+        }
     }
 
-    return slotId;
+    return interruptSlot;
 }
 
 void DisplayMgr::startFadeOut()
@@ -762,6 +956,8 @@ void DisplayMgr::startFadeOut()
         m_selectedFrameBuffer = &m_framebuffers[FB_ID_0];
     }
 
+    m_frameTracker.setGfx(*m_selectedFrameBuffer);
+
     m_displayFadeState = FADE_OUT;
 
     if (nullptr != m_fadeEffect)
@@ -775,7 +971,7 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
     if ((nullptr != m_selectedFrameBuffer) &&
         (nullptr != m_fadeEffect))
     {
-        YAGfxBitmap* prevFb = nullptr;
+        YAGfxDynamicBitmap* prevFb = nullptr;
 
         /* Determine previous frame buffer */
         if (m_selectedFrameBuffer == &m_framebuffers[FB_ID_0])
@@ -787,10 +983,12 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
             prevFb = &m_framebuffers[FB_ID_0];
         }
 
-        /* Continously update the current canvas with its framebuffer. */
+        /* Continously update the current canvas with its framebuffer.
+         * The modified region is tracked, to transfer only this one.
+         */
         if (nullptr != m_selectedPlugin)
         {
-            m_selectedPlugin->update(*m_selectedFrameBuffer);
+            m_selectedPlugin->update(m_frameTracker);
         }
 
         /* Handle fading */
@@ -798,7 +996,7 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
         {
         /* No fading at all */
         case FADE_IDLE:
-            dst.drawBitmap(0, 0, *m_selectedFrameBuffer);
+            transferDirtyRegion(dst);
             break;
 
         /* Fade new display content in */
@@ -806,6 +1004,9 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
             if (true == m_fadeEffect->fadeIn(dst, *prevFb, *m_selectedFrameBuffer))
             {
                 m_displayFadeState = FADE_IDLE;
+
+                /* Ensure that the display shows the complete framebuffer after fading. */
+                m_frameTracker.invalidate();
             }
             break;
 
@@ -825,15 +1026,60 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
     return;
 }
 
+void DisplayMgr::transferDirtyRegion(YAGfx& dst)
+{
+    const GfxRect&  dirtyRect   = m_frameTracker.getDirtyRect();
+    uint16_t        row         = 0U;
+
+    for(row = 0U; row < dirtyRect.getHeight(); ++row)
+    {
+        int16_t         y       = dirtyRect.getY() + row;
+        const Color*    pixels  = m_selectedFrameBuffer->getRow(y);
+
+        if (nullptr != pixels)
+        {
+            dst.drawRow(dirtyRect.getX(), y, &pixels[dirtyRect.getX()], dirtyRect.getWidth());
+        }
+    }
+
+    m_frameTracker.clearDirtyRect();
+
+    return;
+}
+
 void DisplayMgr::process()
 {
     IDisplay&                   display = Display::getInstance();
-    uint8_t                     index   = 0U;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     /* Handle display brightness */
     BrightnessCtrl::getInstance().process();
 
+    /* Urgent plugin shall interrupt the slot rotation? A interrupt is not
+     * nested and won't disturb a pending slot change.
+     */
+    if ((nullptr == m_requestedPlugin) &&
+        (nullptr != m_selectedPlugin) &&
+        (FADE_IDLE == m_displayFadeState) &&
+        (SLOT_ID_INVALID == m_interruptedSlot))
+    {
+        uint8_t slotId = getInterruptSlot();
+
+        if (m_maxSlots > slotId)
+        {
+            m_slots[slotId].setInterruptServed(true);
+
+            /* If it is already shown, there is nothing to interrupt. */
+            if (m_selectedPlugin != m_slots[slotId].getPlugin())
+            {
+                LOG_INFO("Slot %u (%s) interrupts slot %u.", slotId, m_slots[slotId].getPlugin()->getName(), m_selectedSlot);
+
+                m_interruptedSlot = m_selectedSlot;
+                m_requestedPlugin = m_slots[slotId].getPlugin();
+            }
+        }
+    }
+
     /* Plugin requested to choose? */
     if (nullptr != m_requestedPlugin)
     {
@@ -873,6 +1119,7 @@ void DisplayMgr::process()
             {
                 /* Remove selected plugin, which forces to select the requested one in the next step. */
                 m_selectedPlugin->inactive();
+                scheduleHibernation(getSlotIdByPluginUID(m_selectedPlugin->getUID()));
                 m_selectedPlugin = nullptr;
 
                 /* Fade old display content out */
@@ -890,37 +1137,68 @@ void DisplayMgr::process()
     if ((nullptr != m_selectedPlugin) &&
         (FADE_IDLE == m_displayFadeState))
     {
+        bool isSlotTimeout = (true == m_slotTimer.isTimerRunning()) && (true == m_slotTimer.isTimeout());
+
         m_selectedSlot = getSlotIdByPluginUID(m_selectedPlugin->getUID());
 
         /* Plugin disabled in the meantime? */
         if (false == m_selectedPlugin->isEnabled())
         {
             m_selectedPlugin->inactive();
+            scheduleHibernation(m_selectedSlot);
             m_selectedPlugin = nullptr;
             m_slotTimer.stop();
 
             /* Fade old display content out */
             startFadeOut();
         }
-        /* Plugin run duration timeout? */
-        else if ((true == m_slotTimer.isTimerRunning()) &&
-                 (true == m_slotTimer.isTimeout()))
+        /* Plugin run duration timeout or nothing to show anymore? */
+        else if ((true == isSlotTimeout) ||
+                 (false == m_selectedPlugin->isReady()))
         {
-            uint8_t slotId = nextSlot(m_selectedSlot);
+            uint8_t slotId      = nextSlot(m_selectedSlot);
+            bool    isChange    = false;
 
+            /* The interrupt ends, the interrupted slot continues, but not
+             * before its plugin is woken up.
+             */
+            if (SLOT_ID_INVALID != m_interruptedSlot)
+            {
+                isChange = (false == requestWakeUp(m_interruptedSlot));
+            }
             /* If the next slot is the same as the current slot,
              * just restart the plugin duration timer.
              */
-            if (m_selectedSlot == slotId)
+            else if ((m_maxSlots <= slotId) ||
+                     (m_selectedSlot == slotId))
             {
-                if (true == m_slotTimer.isTimerRunning())
+                if (true == isSlotTimeout)
                 {
+                    m_rotation.commit(m_selectedSlot);
                     m_slotTimer.restart();
                 }
             }
+            /* The plugin of the next slot is still hibernated? Keep showing
+             * the current plugin, until the plugin process task woke it up.
+             */
+            else if (true == requestWakeUp(slotId))
+            {
+                isChange = false;
+            }
+            else if (true == isSlotTimeout)
+            {
+                isChange = true;
+            }
+            /* Plugin is not ready, but change only to a ready one. */
             else
+            {
+                isChange = m_slots[slotId].getPlugin()->isReady();
+            }
+
+            if (true == isChange)
             {
                 m_selectedPlugin->inactive();
+                scheduleHibernation(m_selectedSlot);
                 m_selectedPlugin = nullptr;
                 m_slotTimer.stop();
 
@@ -928,6 +1206,33 @@ void DisplayMgr::process()
                 startFadeOut();
             }
         }
+        /* Slot change upcoming? Let the plugin process task prepare the
+         * plugin of the next slot, so its activation won't delay the fade effect.
+         */
+        else if ((nullptr == m_preparedPlugin) &&
+                 (true == m_slotTimer.isTimerRunning()) &&
+                 (PREPARE_LEAD_TIME >= m_slotTimer.getRemaining()))
+        {
+            uint8_t slotId = SLOT_ID_INVALID;
+
+            /* After a interrupt, the interrupted slot continues. */
+            if (SLOT_ID_INVALID != m_interruptedSlot)
+            {
+                slotId = m_interruptedSlot;
+            }
+            else
+            {
+                slotId = nextSlot(m_selectedSlot);
+            }
+
+            if ((m_maxSlots > slotId) &&
+                (m_selectedSlot != slotId))
+            {
+                m_preparedPlugin    = m_slots[slotId].getPlugin();
+                m_isPreparePending  = true;
+                notifyProcessTask();
+            }
+        }
         else
         {
             /* Nothing to do. */
@@ -943,33 +1248,104 @@ void DisplayMgr::process()
         {
             m_selectedSlot      = getSlotIdByPluginUID(m_requestedPlugin->getUID());
             m_requestedPlugin   = nullptr;
+            m_wakingSlot        = SLOT_ID_INVALID;
+        }
+        /* Selected plugin is still woken up? Keep the selection. */
+        else if (SLOT_ID_INVALID != m_wakingSlot)
+        {
+            m_selectedSlot = m_wakingSlot;
+        }
+        /* Interrupt finished? Continue with the interrupted slot, if its plugin is still enabled. */
+        else if ((SLOT_ID_INVALID != m_interruptedSlot) &&
+                 (false == m_slots[m_interruptedSlot].isEmpty()) &&
+                 (true == m_slots[m_interruptedSlot].getPlugin()->isEnabled()))
+        {
+            m_selectedSlot      = m_interruptedSlot;
+            m_interruptedSlot   = SLOT_ID_INVALID;
         }
         /* Select next slot, which contains a enabled plugin. */
         else
         {
-            m_selectedSlot = nextSlot(m_selectedSlot);
+            m_interruptedSlot   = SLOT_ID_INVALID;
+            m_selectedSlot      = nextSlot(m_selectedSlot);
+
+            m_rotation.commit(m_selectedSlot);
         }
 
+        /* Next plugin found, but hibernated? It can't be woken up here, because
+         * the wake up requires the process mutex, like prepare(). The plugin
+         * process task wakes it up and prepares it, afterwards it is activated.
+         * Until then the display shows an empty frame instead of outdated content.
+         */
+        if (true == requestWakeUp(m_selectedSlot))
+        {
+            if (m_wakingSlot != m_selectedSlot)
+            {
+                m_wakingSlot = m_selectedSlot;
+
+                if (nullptr != m_selectedFrameBuffer)
+                {
+                    m_selectedFrameBuffer->fillScreen(ColorDef::BLACK);
+                    m_frameTracker.invalidate();
+                }
+                else
+                {
+                    display.clear();
+                }
+            }
+        }
         /* Next enabled plugin found? */
-        if (m_maxSlots > m_selectedSlot)
+        else if (m_maxSlots > m_selectedSlot)
         {
             uint32_t duration = 0U;
 
+            m_wakingSlot = SLOT_ID_INVALID;
+
             m_selectedPlugin    = m_slots[m_selectedSlot].getPlugin();
             duration            = m_slots[m_selectedSlot].getDuration();
 
+            /* The preparation is done or not necessary anymore, e.g. because
+             * another plugin was requested, became urgent or the prepared one
+             * was skipped, because it is not ready.
+             */
+            if ((nullptr != m_preparedPlugin) &&
+                (m_selectedPlugin != m_preparedPlugin))
+            {
+                m_preparedPlugin->discardPreparation();
+            }
+
+            m_preparedPlugin    = nullptr;
+            m_isPreparePending  = false;
+
+            /* A interrupt is limited in time, afterwards the interrupted slot continues. */
+            if ((SLOT_ID_INVALID != m_interruptedSlot) &&
+                ((0U == duration) || (INTERRUPT_MAX_DURATION < duration)))
+            {
+                duration = INTERRUPT_MAX_DURATION;
+            }
+
             /* If plugin shall not be infinite active, start the slot timer. */
             if (0U != duration)
             {
                 m_slotTimer.start(duration);
             }
 
+            /* The plugin stays awake, as long as it is shown. */
+            m_hibernateQueue.remove(m_selectedSlot);
+
+            /* The framebuffer still contains the content of the previous plugin.
+             * The plugins repaint only their invalidated widgets, therefore it
+             * is cleared here once for all of them.
+             */
             if (nullptr != m_selectedFrameBuffer)
             {
+                m_selectedFrameBuffer->fillScreen(ColorDef::BLACK);
+                m_frameTracker.invalidate();
                 m_selectedPlugin->active(*m_selectedFrameBuffer);
             }
             else
             {
+                display.clear();
                 m_selectedPlugin->active(display);
             }
 
@@ -981,6 +1357,7 @@ void DisplayMgr::process()
             if (nullptr != m_selectedFrameBuffer)
             {
                 m_selectedFrameBuffer->fillScreen(ColorDef::BLACK);
+                m_frameTracker.invalidate();
             }
             display.clear();
         }
@@ -1012,17 +1389,6 @@ void DisplayMgr::process()
         m_fadeEffectUpdate = false;
     }
     
-    /* Process all installed plugins. */
-    for(index = 0U; index < m_maxSlots; ++index)
-    {
-        IPluginMaintenance* plugin = m_slots[index].getPlugin();
-
-        if (nullptr != plugin)
-        {
-            plugin->process();
-        }
-    }
-
     /* Update display (main canvas available) */
     if (nullptr != m_selectedFrameBuffer)
     {
@@ -1159,6 +1525,324 @@ void DisplayMgr::updateTask(void* parameters)
     return;
 }
 
+uint32_t DisplayMgr::processPlugins()
+{
+    uint32_t                    waitTime        = PROCESS_TASK_MAX_WAIT;
+    uint32_t                    timestamp       = millis();
+    IPluginMaintenance*         preparePlugin   = nullptr;
+    IPluginMaintenance*         plugin          = nullptr;
+    bool                        isHibernated    = false;
+    uint8_t                     slotId          = SLOT_ID_INVALID;
+    uint32_t                    deadline        = 0U;
+    int32_t                     remaining       = 0;
+    MutexGuard<MutexRecursive>  processGuard(m_processMutex);
+
+    /* Get the plugin to prepare or the plugin with the earliest deadline.
+     * The display mutex is only hold during the queue access, so the display
+     * task is not blocked by the plugin processing.
+     */
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        /* The upcoming slot change is more urgent than the processing. */
+        if (true == m_isPreparePending)
+        {
+            preparePlugin       = m_preparedPlugin;
+            m_isPreparePending  = false;
+            slotId              = getSlotIdByPluginUID(preparePlugin->getUID());
+
+            /* The plugin is shown soon, therefore its pending hibernation is canceled. */
+            if (m_maxSlots > slotId)
+            {
+                m_hibernateQueue.remove(slotId);
+                isHibernated = m_slots[slotId].isHibernated();
+            }
+        }
+        else if (true == m_processQueue.peek(slotId, deadline))
+        {
+            plugin = m_slots[slotId].getPlugin();
+
+            /* Signed difference to be robust against timestamp overflow. */
+            remaining = static_cast<int32_t>(deadline - timestamp);
+
+            /* Should never happen, but a empty slot must not block the queue. */
+            if (nullptr == plugin)
+            {
+                m_processQueue.remove(slotId);
+                waitTime = 0U;
+            }
+        }
+    }
+
+    if (nullptr != preparePlugin)
+    {
+        bool isDiscarded = false;
+
+        /* A hibernated plugin needs its resources again, before it can prepare. */
+        if (true == isHibernated)
+        {
+            wakeUpPlugin(preparePlugin);
+        }
+
+        /* The plugin can't be uninstalled meanwhile, because of the process mutex. */
+        preparePlugin->prepare();
+
+        /* The display task may have discarded the preparation, while it was
+         * running. Discard it again, otherwise the plugin would keep it.
+         */
+        {
+            MutexGuard<MutexRecursive> guard(m_mutex);
+
+            isDiscarded = (m_preparedPlugin != preparePlugin) && (m_selectedPlugin != preparePlugin);
+        }
+
+        if (true == isDiscarded)
+        {
+            preparePlugin->discardPreparation();
+        }
+
+        waitTime = 0U;
+    }
+    else if (nullptr != plugin)
+    {
+        /* Deadline not reached yet? */
+        if (0 < remaining)
+        {
+            if (PROCESS_TASK_MAX_WAIT > static_cast<uint32_t>(remaining))
+            {
+                waitTime = static_cast<uint32_t>(remaining);
+            }
+        }
+        else
+        {
+            uint32_t period = 0U;
+
+            /* The plugin can't be uninstalled meanwhile, because of the process mutex. */
+            plugin->process();
+
+            /* Request the period after processing, because the plugin may
+             * derive it from its own timers.
+             */
+            period = plugin->getProcessPeriod();
+
+            {
+                MutexGuard<MutexRecursive> guard(m_mutex);
+
+                /* If the plugin was moved meanwhile, its new slot is already scheduled. */
+                if (plugin == m_slots[slotId].getPlugin())
+                {
+                    /* Deadline missed by more than one period? Don't try to catch up. */
+                    if (period < static_cast<uint32_t>(-remaining))
+                    {
+                        deadline = timestamp + period;
+                    }
+                    else
+                    {
+                        deadline += period;
+                    }
+
+                    (void)m_processQueue.schedule(slotId, deadline);
+                }
+            }
+
+            waitTime = 0U;
+        }
+    }
+
+    return waitTime;
+}
+
+uint32_t DisplayMgr::hibernatePlugins()
+{
+    uint32_t                    waitTime    = PROCESS_TASK_MAX_WAIT;
+    uint8_t                     slotId      = SLOT_ID_INVALID;
+    uint32_t                    deadline    = 0U;
+    IPluginMaintenance*         plugin      = nullptr;
+    MutexGuard<MutexRecursive>  processGuard(m_processMutex);   /* Like prepare(), the plugin must not be processed meanwhile. */
+
+    /* The display mutex is only hold to access the hibernation state, so the
+     * display task is not blocked while the plugin releases its resources.
+     */
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        if (true == m_hibernateQueue.peek(slotId, deadline))
+        {
+            /* Signed difference to be robust against timestamp overflow. */
+            int32_t remaining = static_cast<int32_t>(deadline - millis());
+
+            /* Deadline not reached yet? */
+            if (0 < remaining)
+            {
+                if (PROCESS_TASK_MAX_WAIT > static_cast<uint32_t>(remaining))
+                {
+                    waitTime = static_cast<uint32_t>(remaining);
+                }
+            }
+            else
+            {
+                IPluginMaintenance* slotPlugin = m_slots[slotId].getPlugin();
+
+                m_hibernateQueue.remove(slotId);
+
+                /* The plugin may be shown again or shown soon. */
+                if ((nullptr != slotPlugin) &&
+                    (m_selectedPlugin != slotPlugin) &&
+                    (m_preparedPlugin != slotPlugin) &&
+                    (false == m_slots[slotId].isHibernated()))
+                {
+                    /* Marked as hibernated before, so the display task won't
+                     * activate it meanwhile. Instead it requests the wake up,
+                     * which waits for the process mutex.
+                     */
+                    m_slots[slotId].setHibernated(true);
+                    plugin = slotPlugin;
+                }
+
+                waitTime = 0U;
+            }
+        }
+    }
+
+    if (nullptr != plugin)
+    {
+        bool                        isHibernated    = plugin->hibernate();
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+
+        /* The plugin may be moved meanwhile, but not uninstalled, because of the process mutex. */
+        slotId = getSlotIdByPluginUID(plugin->getUID());
+
+        if (m_maxSlots > slotId)
+        {
+            if (true == isHibernated)
+            {
+                LOG_INFO("Slot %u (%s) hibernated.", slotId, plugin->getName());
+            }
+            else
+            {
+                m_slots[slotId].setHibernated(false);
+            }
+        }
+    }
+
+    return waitTime;
+}
+
+void DisplayMgr::scheduleHibernation(uint8_t slotId)
+{
+    if (m_maxSlots > slotId)
+    {
+        (void)m_hibernateQueue.schedule(slotId, millis() + HIBERNATE_DELAY);
+        notifyProcessTask();
+    }
+
+    return;
+}
+
+void DisplayMgr::wakeUpPlugin(IPluginMaintenance* plugin)
+{
+    uint8_t slotId = SLOT_ID_INVALID;
+
+    /* The slot stays hibernated, until the plugin is woken up. Therefore
+     * the display task won't activate it meanwhile.
+     */
+    plugin->wakeUp();
+
+    {
+        MutexGuard<MutexRecursive> guard(m_mutex);
+
+        /* The plugin may be moved meanwhile, but not uninstalled, because of the process mutex. */
+        slotId = getSlotIdByPluginUID(plugin->getUID());
+
+        if (m_maxSlots > slotId)
+        {
+            m_slots[slotId].setHibernated(false);
+
+            LOG_INFO("Slot %u (%s) woken up.", slotId, plugin->getName());
+        }
+    }
+
+    return;
+}
+
+bool DisplayMgr::requestWakeUp(uint8_t slotId)
+{
+    bool isHibernated = false;
+
+    if ((m_maxSlots > slotId) &&
+        (true == m_slots[slotId].isHibernated()))
+    {
+        IPluginMaintenance* plugin = m_slots[slotId].getPlugin();
+
+        /* The plugin process task wakes up the plugin, before it prepares it. */
+        if (m_preparedPlugin != plugin)
+        {
+            if (nullptr != m_preparedPlugin)
+            {
+                m_preparedPlugin->discardPreparation();
+            }
+
+            m_preparedPlugin    = plugin;
+            m_isPreparePending  = true;
+            notifyProcessTask();
+        }
+
+        isHibernated = true;
+    }
+
+    return isHibernated;
+}
+
+void DisplayMgr::notifyProcessTask()
+{
+    if (nullptr != m_processTaskHandle)
+    {
+        (void)xTaskNotifyGive(m_processTaskHandle);
+    }
+
+    return;
+}
+
+void DisplayMgr::processTask(void* parameters)
+{
+    DisplayMgr* tthis = reinterpret_cast<DisplayMgr*>(parameters);
+
+    if ((nullptr != tthis) &&
+        (nullptr != tthis->m_processXSemaphore))
+    {
+        (void)xSemaphoreTake(tthis->m_processXSemaphore, portMAX_DELAY);
+
+        while(false == tthis->m_processTaskExit)
+        {
+            uint32_t waitTime           = tthis->processPlugins();
+            uint32_t hibernateWaitTime  = tthis->hibernatePlugins();
+
+            /* Wake up for whatever is due first. */
+            if (hibernateWaitTime < waitTime)
+            {
+                waitTime = hibernateWaitTime;
+            }
+
+            /* Give other tasks a chance, even if further plugins are due. */
+            if (0U == waitTime)
+            {
+                delay(1U);
+            }
+            /* Sleep until the next plugin is due or the schedule changed. */
+            else
+            {
+                (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitTime));
+            }
+        }
+
+        (void)xSemaphoreGive(tthis->m_processXSemaphore);
+    }
+
+    vTaskDelete(nullptr);
+
+    return;
+}
+
 void DisplayMgr::load()
 {
     Settings& settings = Settings::getInstance();
@@ -1277,3 +1961,38 @@ void DisplayMgr::save()
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Get the weight of a plugin priority in the slot rotation.
+ * A high priority slot is shown twice as often as a normal one and four
+ * times as often as a low one.
+ *
+ * @param[in] priority  Plugin priority
+ *
+ * @return Weight
+ */
+static uint8_t getPriorityWeight(IPluginMaintenance::Priority priority)
+{
+    uint8_t weight = 2U;
+
+    switch(priority)
+    {
+    case IPluginMaintenance::PRIORITY_LOW:
+        weight = 1U;
+        break;
+
+    case IPluginMaintenance::PRIORITY_NORMAL:
+        weight = 2U;
+        break;
+
+    case IPluginMaintenance::PRIORITY_HIGH:
+    case IPluginMaintenance::PRIORITY_URGENT:
+        weight = 4U;
+        break;
+
+    default:
+        break;
+    }
+
+    return weight;
+}
@@ -52,6 +52,10 @@
 #include <FadeMoveY.h>
 #include <Mutex.hpp>
 #include <YAGfxBitmap.h>
+#include <YAGfxTracker.h>
+#include <DeadlineQueue.h>
+#include <WeightedRoundRobin.h>
+#include <UidIndex.h>
 
 #include "IPluginMaintenance.hpp"
 #include "Slot.h"
@@ -253,6 +257,19 @@ public:
      */
     bool isSlotLocked(uint8_t slotId);
 
+    /**
+     * Lock the display manager, e.g. to apply several slot changes at once.
+     * The display update and the plugin processing wait until it is unlocked.
+     * It can be locked several times by the same task, but must be unlocked
+     * as often.
+     */
+    void lock();
+
+    /**
+     * Unlock the display manager.
+     */
+    void unlock();
+
     /**
      * Get slot duration in ms, how long the given plugin will be shown.
      *
@@ -307,6 +324,40 @@ public:
     /** Task priority, note Arduino loop and AsyncTcp have lower priorities. */
     static const UBaseType_t    TASK_PRIORITY       = 4U;
 
+    /** Plugin process task stack size in bytes */
+    static const uint32_t       PROCESS_TASK_STACK_SIZE = 4096U;
+
+    /**
+     * Max. time in ms, the plugin process task sleeps. Usually it sleeps until
+     * the next plugin is due or it is notified about a schedule change.
+     */
+    static const uint32_t       PROCESS_TASK_MAX_WAIT   = 60000U;
+
+    /** MCU core where the plugin process task shall run, which is the other one than the display task. */
+    static const BaseType_t     PROCESS_TASK_RUN_CORE   = 0;
+
+    /** Plugin process task priority, lower than the display task. */
+    static const UBaseType_t    PROCESS_TASK_PRIORITY   = 2U;
+
+    /**
+     * Time in ms before a slot change, when the plugin of the next slot is
+     * prepared by the plugin process task.
+     */
+    static const uint32_t       PREPARE_LEAD_TIME       = 1000U;
+
+    /**
+     * Max. time in ms, a urgent plugin interrupts the slot rotation.
+     * Afterwards the interrupted slot continues.
+     */
+    static const uint32_t       INTERRUPT_MAX_DURATION  = 15000U;
+
+    /**
+     * Time in ms after a slot was shown, when its plugin is requested to
+     * hibernate. It is woken up again before it is prepared or set active.
+     * Hibernation and wake up happen in the plugin process task only.
+     */
+    static const uint32_t       HIBERNATE_DELAY         = 60000U;
+
 private:
 
     /** Mutex to lock/unlock display update. */
@@ -321,12 +372,42 @@ private:
     /** Binary semaphore used to signal the task exit. */
     SemaphoreHandle_t   m_xSemaphore;
 
+    /**
+     * Mutex to protect the plugins against removal, while they are processed.
+     * If both mutexes are needed, it shall be locked before m_mutex.
+     */
+    MutexRecursive      m_processMutex;
+
+    /** Plugin process task handle */
+    TaskHandle_t        m_processTaskHandle;
+
+    /** Flag to signal the plugin process task to exit. */
+    bool                m_processTaskExit;
+
+    /** Binary semaphore used to signal the plugin process task exit. */
+    SemaphoreHandle_t   m_processXSemaphore;
+
+    /** Per slot timestamp in ms, when the plugin shall be processed next. The earliest is on top. */
+    DeadlineQueue       m_processQueue;
+
+    /** Per slot timestamp in ms, when the plugin shall hibernate. The earliest is on top. */
+    DeadlineQueue       m_hibernateQueue;
+
     /** List of all slots with their connected plugins. */
     Slot*               m_slots;
 
     /** Max. number of slots. */
     uint8_t             m_maxSlots;
 
+    /** Slot id per plugin UID of all installed plugins. */
+    UidIndex            m_uidIndex;
+
+    /** Weighted rotation over the slots, derived from the plugin priorities. */
+    WeightedRoundRobin  m_rotation;
+
+    /** Slot which is interrupted by a urgent plugin, otherwise SLOT_ID_INVALID. */
+    uint8_t             m_interruptedSlot;
+
     /** Current selected slot. */
     uint8_t             m_selectedSlot;
 
@@ -336,6 +417,15 @@ private:
     /** Plugin which is requested to be activated immediately. */
     IPluginMaintenance* m_requestedPlugin;
 
+    /** Plugin of the next slot, which was requested to prepare for the upcoming slot change. */
+    IPluginMaintenance* m_preparedPlugin;
+
+    /** Flag to signal the plugin process task to prepare the m_preparedPlugin. */
+    bool                m_isPreparePending;
+
+    /** Selected slot, whose hibernated plugin is woken up by the plugin process task, otherwise SLOT_ID_INVALID. */
+    uint8_t             m_wakingSlot;
+
     /** Timer, used for changing the slot after a specific duration. */
     SimpleTimer         m_slotTimer;
 
@@ -360,8 +450,9 @@ private:
      * the old plugin out and from the new plugin in.
      */
     FadeState           m_displayFadeState;
-    YAGfxBitmap*        m_selectedFrameBuffer;          /**< Points to the current framebuffer, used to update the display. */
+    YAGfxDynamicBitmap* m_selectedFrameBuffer;          /**< Points to the current framebuffer, used to update the display. */
     YAGfxDynamicBitmap  m_framebuffers[FB_ID_MAX];      /**< Two framebuffers, which will contain the old and the new plugin content. */
+    YAGfxTracker        m_frameTracker;                 /**< Tracks the modified region of the current framebuffer. */
     FadeLinear          m_fadeLinearEffect;             /**< Linear fade effect. */
     FadeMoveX           m_fadeMoveXEffect;              /**< Moving along x-axis fade effect. */
     FadeMoveY           m_fadeMoveYEffect;              /**< Moving along y-axis fade effect. */
@@ -384,7 +475,10 @@ private:
     DisplayMgr& operator=(const DisplayMgr& mgr);
 
     /**
-     * Schedule next slot with a installed and enabled plugin.
+     * Determine next slot with a installed and enabled plugin, without
+     * advancing the rotation. The slots are weighted by the plugin
+     * priorities and slots whose plugin is not ready are skipped. Only if
+     * no plugin is ready at all, the not ready ones are considered.
      *
      * @param[in] slotId    Id of current slot
      *
@@ -392,6 +486,15 @@ private:
      */
     uint8_t nextSlot(uint8_t slotId);
 
+    /**
+     * Get the slot of a urgent plugin, which shall interrupt the slot
+     * rotation. A urgent plugin interrupts only once, until it is not
+     * urgent anymore.
+     *
+     * @return Id of slot or SLOT_ID_INVALID if there is no interrupt.
+     */
+    uint8_t getInterruptSlot();
+
     /**
      * Start fade effect.
      */
@@ -404,11 +507,22 @@ private:
      */
     void fadeInOut(YAGfx& dst);
 
+    /**
+     * Transfer only the modified region of the current framebuffer to the
+     * display. If nothing was modified since the last transfer, the
+     * display keeps its content.
+     *
+     * @param[in] dst   Destination display
+     */
+    void transferDirtyRegion(YAGfx& dst);
+
     /**
      * Process the slots. This shall be called periodically in
      * a higher period than the DEFAULT_PERIOD.
      *
-     * It will handle which slot to show on the display.
+     * It will handle which slot to show on the display and updates only
+     * the selected plugin. The plugins are processed by the plugin
+     * process task.
      */
     void process(void);
 
@@ -419,6 +533,67 @@ private:
      */
     static void updateTask(void* parameters);
 
+    /**
+     * Process the plugin with the earliest deadline, if its deadline is
+     * reached. The next deadline is its process period later. If a plugin
+     * missed its deadline by more than one period, it won't try to catch up.
+     * A pending preparation of the next slot's plugin has precedence.
+     *
+     * @return Time in ms until the next plugin is due, but max. PROCESS_TASK_MAX_WAIT.
+     */
+    uint32_t processPlugins(void);
+
+    /**
+     * Hibernate the plugin with the earliest hibernation deadline, if its
+     * deadline is reached. The selected plugin and the plugin which is
+     * prepared for the next slot stay awake.
+     *
+     * @return Time in ms until the next plugin shall hibernate, but max. PROCESS_TASK_MAX_WAIT.
+     */
+    uint32_t hibernatePlugins(void);
+
+    /**
+     * Schedule the hibernation of the plugin in the given slot, after it
+     * was deactivated.
+     *
+     * @param[in] slotId    Slot id
+     */
+    void scheduleHibernation(uint8_t slotId);
+
+    /**
+     * Wake up a hibernated plugin and mark its slot as awake afterwards.
+     * It must be called with the process mutex taken, like prepare(), but
+     * without the display mutex, so the display task is not blocked meanwhile.
+     *
+     * @param[in] plugin    Hibernated plugin
+     */
+    void wakeUpPlugin(IPluginMaintenance* plugin);
+
+    /**
+     * Request the plugin process task to wake up the plugin in the given
+     * slot, if it is hibernated. The plugin is prepared afterwards.
+     * It must be called with the display mutex taken.
+     *
+     * @param[in] slotId    Slot id
+     *
+     * @return If the plugin is hibernated, it will return true otherwise false.
+     */
+    bool requestWakeUp(uint8_t slotId);
+
+    /**
+     * Notify the plugin process task about a schedule change, which wakes
+     * it up to determine the next due plugin.
+     */
+    void notifyProcessTask(void);
+
+    /**
+     * Plugin process task is responsible to process all installed plugins
+     * independent of the display refresh.
+     *
+     * @param[in]   parameters  Task pParameters
+     */
+    static void processTask(void* parameters);
+
     /**
      * Load display slot configuration from persistent memory.
      */
@@ -0,0 +1,469 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Icon store in a memory mapped flash partition
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IconStore.h"
+
+#include <stddef.h>
+#include <string.h>
+#include <esp_spi_flash.h>
+#include <Logging.h>
+#include <PackedImg.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Initialize partition label. */
+const char* IconStore::PARTITION_LABEL  = "icons";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool IconStore::begin()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if (nullptr == m_data)
+    {
+        m_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, PARTITION_LABEL);
+
+        if (nullptr == m_partition)
+        {
+            LOG_WARNING("Partition %s not found.", PARTITION_LABEL);
+        }
+        else
+        {
+            uint32_t    sectorCnt   = m_partition->size / SPI_FLASH_SEC_SIZE;
+            const void* data        = nullptr;
+
+            if (MAX_SECTORS < sectorCnt)
+            {
+                sectorCnt = MAX_SECTORS;
+            }
+
+            if (ESP_OK != esp_partition_mmap(m_partition, 0U, sectorCnt * SPI_FLASH_SEC_SIZE, SPI_FLASH_MMAP_DATA, &data, &m_mmapHandle))
+            {
+                LOG_ERROR("Failed to map partition %s.", PARTITION_LABEL);
+                m_partition = nullptr;
+            }
+            else
+            {
+                m_data      = static_cast<const uint8_t*>(data);
+                m_slotCnt   = (sectorCnt * SPI_FLASH_SEC_SIZE) / SLOT_SIZE;
+            }
+        }
+    }
+
+    return (nullptr != m_data);
+}
+
+void IconStore::end()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if (nullptr != m_data)
+    {
+        spi_flash_munmap(m_mmapHandle);
+
+        m_partition = nullptr;
+        m_data      = nullptr;
+        m_slotCnt   = 0U;
+    }
+
+    return;
+}
+
+bool IconStore::store(FS& fs, const String& fileName)
+{
+    bool                        isSuccessful    = false;
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    if (nullptr == m_data)
+    {
+        /* No icon partition available. */
+        ;
+    }
+    else if (FILE_NAME_SIZE <= fileName.length())
+    {
+        LOG_WARNING("File name %s is too long for the icon store.", fileName.c_str());
+    }
+    else
+    {
+        File fd = fs.open(fileName);
+
+        if (false == fd)
+        {
+            LOG_WARNING("Failed to open file %s.", fileName.c_str());
+        }
+        else
+        {
+            PackedImgHeader imgHeader;
+            uint32_t        slotCnt     = (sizeof(Header) + fd.size() + SLOT_SIZE - 1U) / SLOT_SIZE;
+            uint32_t        slot        = 0U;
+            bool            isFound     = false;
+
+            remove(fileName);
+
+            if ((sizeof(imgHeader) != fd.read(reinterpret_cast<uint8_t*>(&imgHeader), sizeof(imgHeader))) ||
+                (PACKED_IMG_SIGNATURE != imgHeader.signature) ||
+                (0U != (imgHeader.flags & PACKED_IMG_FLAG_RLE)) ||
+                (false == fd.seek(0U)))
+            {
+                LOG_WARNING("%s is no uncompressed packed image.", fileName.c_str());
+            }
+            else
+            {
+                isFound = findFreeSlots(slotCnt, slot);
+
+                /* Erase the sectors of the removed images and try again. */
+                if (false == isFound)
+                {
+                    reclaim();
+                    isFound = findFreeSlots(slotCnt, slot);
+                }
+
+                if (false == isFound)
+                {
+                    LOG_WARNING("No space left in the icon store for %s.", fileName.c_str());
+                }
+                else
+                {
+                    isSuccessful = write(fd, fileName, slot, slotCnt);
+                }
+            }
+
+            fd.close();
+        }
+    }
+
+    return isSuccessful;
+}
+
+void IconStore::remove(const String& fileName)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint32_t                    slot    = 0U;
+
+    if (nullptr != findHeader(fileName, slot))
+    {
+        uint32_t validFlag = HEADER_REMOVED;
+
+        if (ESP_OK != esp_partition_write(m_partition, slot * SLOT_SIZE + offsetof(Header, validFlag), &validFlag, sizeof(validFlag)))
+        {
+            LOG_ERROR("Failed to remove %s from the icon store.", fileName.c_str());
+        }
+    }
+
+    return;
+}
+
+bool IconStore::find(const String& fileName, const uint8_t*& data, size_t& size) const
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint32_t                    slot    = 0U;
+    const Header*               header  = findHeader(fileName, slot);
+
+    if (nullptr != header)
+    {
+        data = reinterpret_cast<const uint8_t*>(header) + sizeof(Header);
+        size = header->size;
+    }
+
+    return (nullptr != header);
+}
+
+bool IconStore::load(FS& fs, const String& fileName, BitmapWidget& widget)
+{
+    bool                        isSuccessful    = false;
+    const uint8_t*              data            = nullptr;
+    size_t                      size            = 0U;
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    /* A packed image of a older firmware is not stored yet. */
+    if ((false == find(fileName, data, size)) &&
+        (true == fs.exists(fileName)) &&
+        (true == store(fs, fileName)))
+    {
+        (void)find(fileName, data, size);
+    }
+
+    if ((nullptr != data) &&
+        (true == widget.map(data, size)))
+    {
+        isSuccessful = true;
+    }
+    else
+    {
+        isSuccessful = widget.load(fs, fileName);
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+const IconStore::Header* IconStore::getHeader(uint32_t slot) const
+{
+    const Header* header = reinterpret_cast<const Header*>(&m_data[slot * SLOT_SIZE]);
+
+    /* Check the header too, because a interrupted write may leave garbage behind. */
+    if ((HEADER_MAGIC != header->magic) ||
+        (0U == header->slotCnt) ||
+        ((m_slotCnt - slot) < header->slotCnt) ||
+        ((header->slotCnt * SLOT_SIZE - sizeof(Header)) < header->size))
+    {
+        header = nullptr;
+    }
+
+    return header;
+}
+
+const IconStore::Header* IconStore::findHeader(const String& fileName, uint32_t& slot) const
+{
+    const Header*   header  = nullptr;
+    uint32_t        idx     = 0U;
+
+    while((m_slotCnt > idx) && (nullptr == header))
+    {
+        const Header* current = getHeader(idx);
+
+        if (nullptr == current)
+        {
+            ++idx;
+        }
+        else if ((HEADER_VALID == current->validFlag) &&
+                 (0 == strncmp(current->fileName, fileName.c_str(), FILE_NAME_SIZE)))
+        {
+            header  = current;
+            slot    = idx;
+        }
+        else
+        {
+            idx += current->slotCnt;
+        }
+    }
+
+    return header;
+}
+
+bool IconStore::findFreeSlots(uint32_t slotCnt, uint32_t& slot) const
+{
+    bool        isFound     = false;
+    uint32_t    idx         = 0U;
+    uint32_t    firstIdx    = 0U;
+    uint32_t    freeCnt     = 0U;
+
+    while((m_slotCnt > idx) && (false == isFound))
+    {
+        const Header* header = getHeader(idx);
+
+        if (nullptr != header)
+        {
+            idx     += header->slotCnt;
+            freeCnt = 0U;
+        }
+        else
+        {
+            if (false == isErased(idx))
+            {
+                freeCnt = 0U;
+            }
+            else
+            {
+                if (0U == freeCnt)
+                {
+                    firstIdx = idx;
+                }
+
+                ++freeCnt;
+
+                if (slotCnt == freeCnt)
+                {
+                    slot    = firstIdx;
+                    isFound = true;
+                }
+            }
+
+            ++idx;
+        }
+    }
+
+    return isFound;
+}
+
+bool IconStore::isErased(uint32_t slot) const
+{
+    const uint32_t* words   = reinterpret_cast<const uint32_t*>(&m_data[slot * SLOT_SIZE]);
+    uint32_t        idx     = 0U;
+
+    while((SLOT_SIZE / sizeof(uint32_t) > idx) &&
+          (UINT32_MAX == words[idx]))
+    {
+        ++idx;
+    }
+
+    return (SLOT_SIZE / sizeof(uint32_t) == idx);
+}
+
+void IconStore::reclaim()
+{
+    const uint32_t  SLOTS_PER_SECTOR    = SPI_FLASH_SEC_SIZE / SLOT_SIZE;
+    uint32_t        usedSectors         = 0U;   /* One bit per sector, see MAX_SECTORS. */
+    uint32_t        idx                 = 0U;
+    uint32_t        sector              = 0U;
+
+    /* Determine the sectors, which contain valid images. */
+    while(m_slotCnt > idx)
+    {
+        const Header* header = getHeader(idx);
+
+        if (nullptr == header)
+        {
+            ++idx;
+        }
+        else
+        {
+            if (HEADER_VALID == header->validFlag)
+            {
+                for(sector = idx / SLOTS_PER_SECTOR; sector <= ((idx + header->slotCnt - 1U) / SLOTS_PER_SECTOR); ++sector)
+                {
+                    usedSectors |= (1U << sector);
+                }
+            }
+
+            idx += header->slotCnt;
+        }
+    }
+
+    for(sector = 0U; sector < (m_slotCnt / SLOTS_PER_SECTOR); ++sector)
+    {
+        bool isErasedSector = true;
+
+        for(idx = sector * SLOTS_PER_SECTOR; (idx < ((sector + 1U) * SLOTS_PER_SECTOR)) && (true == isErasedSector); ++idx)
+        {
+            isErasedSector = isErased(idx);
+        }
+
+        if ((0U == (usedSectors & (1U << sector))) &&
+            (false == isErasedSector) &&
+            (ESP_OK != esp_partition_erase_range(m_partition, sector * SPI_FLASH_SEC_SIZE, SPI_FLASH_SEC_SIZE)))
+        {
+            LOG_ERROR("Failed to erase sector %u of the icon store.", sector);
+        }
+    }
+
+    return;
+}
+
+bool IconStore::write(File& fd, const String& fileName, uint32_t slot, uint32_t slotCnt)
+{
+    bool        isSuccessful    = true;
+    Header      header;
+    uint8_t     buffer[128U];
+    size_t      offset          = slot * SLOT_SIZE + sizeof(Header);
+    size_t      size            = 0U;
+
+    /* Write the image first and the header at last. A interrupted write
+     * leaves no valid header behind.
+     */
+    while((0 < fd.available()) && (true == isSuccessful))
+    {
+        size_t len = fd.read(buffer, sizeof(buffer));
+
+        if ((0U == len) ||
+            (ESP_OK != esp_partition_write(m_partition, offset, buffer, len)))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            offset  += len;
+            size    += len;
+        }
+    }
+
+    if (true == isSuccessful)
+    {
+        memset(&header, 0, sizeof(header));
+
+        header.magic        = HEADER_MAGIC;
+        header.validFlag    = HEADER_VALID;
+        header.size         = size;
+        header.slotCnt      = slotCnt;
+        strncpy(header.fileName, fileName.c_str(), FILE_NAME_SIZE - 1U);
+
+        if (ESP_OK != esp_partition_write(m_partition, slot * SLOT_SIZE, &header, sizeof(header)))
+        {
+            isSuccessful = false;
+        }
+    }
+
+    if (false == isSuccessful)
+    {
+        LOG_ERROR("Failed to write %s to the icon store.", fileName.c_str());
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
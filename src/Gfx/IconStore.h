@@ -0,0 +1,279 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Icon store in a memory mapped flash partition
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __ICON_STORE_H__
+#define __ICON_STORE_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <FS.h>
+#include <WString.h>
+#include <Mutex.hpp>
+#include <BitmapWidget.h>
+#include <esp_partition.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The icon store keeps uncompressed packed images (.pim) in a raw data
+ * partition, which is mapped read-only into the address space. A mapped
+ * bitmap (see YAGfxMappedBitmap) shows them directly from flash, therefore
+ * the icons need no heap memory.
+ *
+ * The partition is divided into slots. A image starts at a slot with a
+ * header and occupies as many following slots as necessary. Because flash
+ * can only be erased sector wise, a removed image is only marked. Its
+ * sectors are erased, as soon as more space is needed and no other valid
+ * image is located in them.
+ *
+ * The image files in the filesystem stay the origin. If the partition is
+ * not available or full, the images shall be loaded from the filesystem.
+ */
+class IconStore
+{
+public:
+
+    /**
+     * Get icon store instance.
+     *
+     * @return Icon store instance
+     */
+    static IconStore& getInstance()
+    {
+        static IconStore instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Find the icon partition and map it into the address space.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin();
+
+    /**
+     * Unmap the icon partition.
+     * All images, which were found before, are invalid afterwards.
+     */
+    void end();
+
+    /**
+     * Store a packed image file from the filesystem. A already stored image
+     * with the same file name is replaced. Only uncompressed packed images
+     * are accepted, because run length encoded ones can't be mapped.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] fileName  Name of the image file
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool store(FS& fs, const String& fileName);
+
+    /**
+     * Remove a stored image.
+     *
+     * @param[in] fileName  Name of the image file
+     */
+    void remove(const String& fileName);
+
+    /**
+     * Find a stored image. The returned memory is located in flash and
+     * stays valid until the image is removed.
+     *
+     * @param[in]   fileName    Name of the image file
+     * @param[out]  data        Image data
+     * @param[out]  size        Image size in byte
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool find(const String& fileName, const uint8_t*& data, size_t& size) const;
+
+    /**
+     * Show a packed image file in a bitmap widget. If possible, the widget
+     * shows it directly from the icon store, otherwise it is loaded from
+     * the filesystem into the heap. A image, which is not stored yet, is
+     * stored on the fly.
+     *
+     * @param[in] fs        Filesystem
+     * @param[in] fileName  Name of the packed image file
+     * @param[in] widget    Bitmap widget
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool load(FS& fs, const String& fileName, BitmapWidget& widget);
+
+    /** Label of the icon partition in the partition table. */
+    static const char*      PARTITION_LABEL;
+
+    /** Slot size in byte. Every image starts at a slot boundary. */
+    static const size_t     SLOT_SIZE           = 1024U;
+
+    /** Max. number of handled flash sectors. A larger partition is used up to this limit. */
+    static const uint32_t   MAX_SECTORS         = 32U;
+
+    /** Max. file name length, including the string termination. */
+    static const size_t     FILE_NAME_SIZE      = 48U;
+
+private:
+
+    /**
+     * Header in front of every stored image.
+     * Flash bits can be cleared without erasing, therefore a image is
+     * removed by clearing its valid flag.
+     */
+    struct Header
+    {
+        uint32_t    magic;                      /**< Magic number, see HEADER_MAGIC */
+        uint32_t    validFlag;                  /**< Valid flag, see HEADER_VALID */
+        uint32_t    size;                       /**< Image size in byte */
+        uint32_t    slotCnt;                    /**< Number of occupied slots, including the header. */
+        char        fileName[FILE_NAME_SIZE];   /**< Image file name */
+    };
+
+    /** Magic number of a header ("ICON", little endian). */
+    static const uint32_t   HEADER_MAGIC    = 0x4E4F4349U;
+
+    /** Valid flag value of a valid image. A erased flash word has this value. */
+    static const uint32_t   HEADER_VALID    = 0xFFFFFFFFU;
+
+    /** Valid flag value of a removed image. */
+    static const uint32_t   HEADER_REMOVED  = 0x00000000U;
+
+    mutable MutexRecursive      m_mutex;        /**< Mutex to protect against concurrent access. */
+    const esp_partition_t*      m_partition;    /**< Icon partition */
+    spi_flash_mmap_handle_t     m_mmapHandle;   /**< Handle of the mapped partition */
+    const uint8_t*              m_data;         /**< Mapped partition or nullptr */
+    uint32_t                    m_slotCnt;      /**< Number of slots in the partition */
+
+    /**
+     * Constructs the icon store.
+     */
+    IconStore() :
+        m_mutex(),
+        m_partition(nullptr),
+        m_mmapHandle(0U),
+        m_data(nullptr),
+        m_slotCnt(0U)
+    {
+        (void)m_mutex.create();
+    }
+
+    /**
+     * Destroys the icon store.
+     */
+    ~IconStore()
+    {
+        /* Will never be called. */
+    }
+
+    IconStore(const IconStore& store);
+    IconStore& operator=(const IconStore& store);
+
+    /**
+     * Get the header of a slot.
+     *
+     * @param[in] slot  Slot index
+     *
+     * @return If a image starts at the slot, it will return its header otherwise nullptr.
+     */
+    const Header* getHeader(uint32_t slot) const;
+
+    /**
+     * Find the header of a valid image.
+     *
+     * @param[in]   fileName    Name of the image file
+     * @param[out]  slot        Slot index of the image
+     *
+     * @return If found, it will return the header otherwise nullptr.
+     */
+    const Header* findHeader(const String& fileName, uint32_t& slot) const;
+
+    /**
+     * Find erased slots, which are located one after another.
+     *
+     * @param[in]   slotCnt Number of required slots
+     * @param[out]  slot    Index of the first slot
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool findFreeSlots(uint32_t slotCnt, uint32_t& slot) const;
+
+    /**
+     * Is the slot erased?
+     *
+     * @param[in] slot  Slot index
+     *
+     * @return If erased, it will return true otherwise false.
+     */
+    bool isErased(uint32_t slot) const;
+
+    /**
+     * Erase all sectors, which contain no valid image.
+     */
+    void reclaim();
+
+    /**
+     * Write the image file to the slots.
+     *
+     * @param[in] fd        Image file
+     * @param[in] fileName  Name of the image file
+     * @param[in] slot      Index of the first slot
+     * @param[in] slotCnt   Number of slots
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool write(File& fd, const String& fileName, uint32_t slot, uint32_t slotCnt);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __ICON_STORE_H__ */
+
+/** @} */
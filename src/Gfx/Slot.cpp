@@ -69,7 +69,9 @@
 Slot::Slot() :
     m_plugin(nullptr),
     m_duration(DURATION_DEFAULT),
-    m_isLocked(false)
+    m_isLocked(false),
+    m_isInterruptServed(false),
+    m_isHibernated(false)
 {
 }
 
@@ -93,7 +95,9 @@ bool Slot::setPlugin(IPluginMaintenance* plugin)
             m_plugin->setSlot(nullptr);
         }
 
-        m_plugin = plugin;
+        m_plugin            = plugin;
+        m_isInterruptServed = false;
+        m_isHibernated      = false;
 
         if (nullptr != m_plugin)
         {
@@ -136,6 +140,26 @@ bool Slot::isLocked() const
     return m_isLocked;
 }
 
+bool Slot::isInterruptServed() const
+{
+    return m_isInterruptServed;
+}
+
+void Slot::setInterruptServed(bool isServed)
+{
+    m_isInterruptServed = isServed;
+}
+
+bool Slot::isHibernated() const
+{
+    return m_isHibernated;
+}
+
+void Slot::setHibernated(bool isHibernated)
+{
+    m_isHibernated = isHibernated;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -128,14 +128,45 @@ public:
      */
     bool isLocked() const;
 
+    /**
+     * Did the plugin already interrupt the slot rotation because it is urgent?
+     *
+     * @return If the interrupt was served, it will return true otherwise false.
+     */
+    bool isInterruptServed() const;
+
+    /**
+     * Mark the interrupt of the plugin as served or not. A served interrupt
+     * is not repeated, until the plugin is not urgent anymore.
+     *
+     * @param[in] isServed  Interrupt served or not
+     */
+    void setInterruptServed(bool isServed);
+
+    /**
+     * Is the plugin hibernated?
+     *
+     * @return If the plugin is hibernated, it will return true otherwise false.
+     */
+    bool isHibernated() const;
+
+    /**
+     * Mark the plugin as hibernated or not.
+     *
+     * @param[in] isHibernated  Hibernated or not
+     */
+    void setHibernated(bool isHibernated);
+
     /** Default duration in ms */
     static const uint32_t DURATION_DEFAULT  = 30000U;
 
 private:
 
-    IPluginMaintenance* m_plugin;   /**< Plugged in slot */
-    uint32_t            m_duration; /**< Duration in ms, how long the plugin shall be active. */
-    bool                m_isLocked; /**< Is slot locked or not. */
+    IPluginMaintenance* m_plugin;               /**< Plugged in slot */
+    uint32_t            m_duration;             /**< Duration in ms, how long the plugin shall be active. */
+    bool                m_isLocked;             /**< Is slot locked or not. */
+    bool                m_isInterruptServed;    /**< Did the urgent plugin already interrupt the slot rotation? */
+    bool                m_isHibernated;         /**< Is the plugin hibernated? */
 
     Slot(const Slot& slot);
     Slot& operator=(const Slot& slot);
@@ -0,0 +1,296 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Base class for plugins, which request their data via HTTP
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "HttpPlugin.h"
+
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+HttpPlugin::~HttpPlugin()
+{
+    destroyConnection();
+
+    m_mutex.destroy();
+}
+
+void HttpPlugin::prepare()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* Retry, in case the wake-up failed because of less memory. */
+    if (true == createResources())
+    {
+        prepareView();
+    }
+
+    return;
+}
+
+bool HttpPlugin::hibernate()
+{
+    bool                        isHibernated    = true;
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    if (true == m_isViewCreated)
+    {
+        String text = getShownText();
+
+        /* Without the shown text, the plugin would be empty after wake-up. Stay awake instead. */
+        if ((0U < text.length()) &&
+            (false == m_stateBlob.storeString(text.c_str())))
+        {
+            isHibernated = false;
+        }
+        else
+        {
+            destroyView();
+            m_isViewCreated = false;
+
+            if (false == m_isConnectionKept)
+            {
+                destroyConnection();
+            }
+        }
+    }
+
+    return isHibernated;
+}
+
+void HttpPlugin::wakeUp()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* The view is prepared by prepare(), which always follows. */
+    (void)createResources();
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+HttpPlugin::HttpPlugin(const String& name, uint16_t uid, ResponseParser parser, bool isConnectionKept) :
+    Plugin(name, uid),
+    m_mutex(),
+    m_parseResponse(parser),
+    m_isConnectionKept(isConnectionKept),
+    m_connection(nullptr),
+    m_isViewCreated(false),
+    m_stateBlob()
+{
+    (void)m_mutex.create();
+}
+
+bool HttpPlugin::createResources()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if ((true == createConnection()) &&
+        (false == m_isViewCreated))
+    {
+        m_isViewCreated = createView();
+
+        /* Restore the text, which was shown before hibernation. */
+        if ((true == m_isViewCreated) &&
+            (false == m_stateBlob.isEmpty()))
+        {
+            setShownText(m_stateBlob.getString());
+            m_stateBlob.release();
+        }
+    }
+
+    return m_isViewCreated;
+}
+
+bool HttpPlugin::storeShownText(const String& text)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    return m_stateBlob.storeString(text.c_str());
+}
+
+AsyncHttpClient* HttpPlugin::getHttpClient()
+{
+    AsyncHttpClient* client = nullptr;
+
+    if (nullptr != m_connection)
+    {
+        client = &m_connection->client;
+    }
+
+    return client;
+}
+
+bool HttpPlugin::receiveMsg(Msg& msg)
+{
+    bool isReceived = false;
+
+    if (nullptr != m_connection)
+    {
+        isReceived = m_connection->taskProxy.receive(msg);
+    }
+
+    return isReceived;
+}
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool HttpPlugin::createConnection()
+{
+    if (nullptr == m_connection)
+    {
+        m_connection = new(std::nothrow) Connection();
+
+        if (nullptr != m_connection)
+        {
+            Connection*     connection      = m_connection;
+            ResponseParser  parseResponse   = m_parseResponse;
+
+            /* Note: All registered callbacks are running in a different task context!
+             *       Therefore they have no access to the plugin, only to the
+             *       connection. The processing must be deferred via task proxy.
+             */
+            m_connection->client.regOnResponse(
+                [connection, parseResponse](const HttpResponse& rsp)
+                {
+                    Msg msg;
+
+                    msg.type    = MSG_TYPE_RSP;
+                    msg.rsp     = parseResponse(rsp);
+
+                    if ((nullptr != msg.rsp) &&
+                        (false == connection->taskProxy.send(msg)))
+                    {
+                        delete msg.rsp;
+                        msg.rsp = nullptr;
+                    }
+                }
+            );
+
+            m_connection->client.regOnClosed(
+                [connection]()
+                {
+                    Msg msg;
+
+                    msg.type = MSG_TYPE_CONN_CLOSED;
+
+                    (void)connection->taskProxy.send(msg);
+                }
+            );
+
+            m_connection->client.regOnError(
+                [connection]()
+                {
+                    Msg msg;
+
+                    msg.type = MSG_TYPE_CONN_ERROR;
+
+                    (void)connection->taskProxy.send(msg);
+                }
+            );
+        }
+    }
+
+    return (nullptr != m_connection);
+}
+
+void HttpPlugin::destroyConnection()
+{
+    if (nullptr != m_connection)
+    {
+        m_connection->client.regOnResponse(nullptr);
+        m_connection->client.regOnClosed(nullptr);
+        m_connection->client.regOnError(nullptr);
+
+        /* Abort any pending TCP request to avoid getting a callback after the
+         * connection is destroyed.
+         */
+        m_connection->client.abort();
+
+        clearQueue();
+
+        delete m_connection;
+        m_connection = nullptr;
+    }
+
+    return;
+}
+
+void HttpPlugin::clearQueue()
+{
+    Msg msg;
+
+    while(true == m_connection->taskProxy.receive(msg))
+    {
+        if (MSG_TYPE_RSP == msg.type)
+        {
+            delete msg.rsp;
+            msg.rsp = nullptr;
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,290 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Base class for plugins, which request their data via HTTP
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup plugin
+ *
+ * @{
+ */
+
+#ifndef __HTTP_PLUGIN_H__
+#define __HTTP_PLUGIN_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "Plugin.hpp"
+#include "AsyncHttpClient.h"
+
+#include <ArduinoJson.h>
+#include <TaskProxy.hpp>
+#include <Mutex.hpp>
+#include <StateBlob.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Base class for plugins, which request their data from a server via HTTP.
+ *
+ * It provides the asynchronous HTTP client and the task proxy, which
+ * decouples the server responses from the HTTP client task context.
+ *
+ * The plugin keeps its widgets in a view, which is created and destroyed by
+ * the derived plugin. During hibernation the view, the HTTP client and the
+ * task proxy are released. Only the shown text is kept in a state blob and
+ * restored after wake-up.
+ */
+class HttpPlugin : public Plugin
+{
+public:
+
+    /**
+     * Destroys the plugin.
+     * The derived plugin shall destroy its view.
+     */
+    virtual ~HttpPlugin();
+
+    /**
+     * This method will be called shortly before the plugin is set active.
+     * After a hibernation, the view is created again and prepared.
+     */
+    void prepare() override;
+
+    /**
+     * This method will be called if the slot of the plugin was not shown for
+     * a while. The view, the HTTP client and the task proxy are released.
+     * The shown text is kept in a compact state blob.
+     *
+     * @return If hibernated, it will return true otherwise false.
+     */
+    bool hibernate() final;
+
+    /**
+     * This method will be called to restore the resources of the hibernated
+     * plugin.
+     */
+    void wakeUp() final;
+
+protected:
+
+    /**
+     * Defines the message types, which are necessary for HTTP client/server handling.
+     */
+    enum MsgType
+    {
+        MSG_TYPE_INVALID = 0,   /**< Invalid message type. */
+        MSG_TYPE_RSP,           /**< A response, caused by a previous request. */
+        MSG_TYPE_CONN_CLOSED,   /**< The connection is closed. */
+        MSG_TYPE_CONN_ERROR     /**< A connection error happened. */
+    };
+
+    /**
+     * A message for HTTP client/server handling.
+     */
+    struct Msg
+    {
+        MsgType                 type;   /**< Message type */
+        DynamicJsonDocument*    rsp;    /**< Response, only valid if message type is a response. */
+
+        /**
+         * Constructs a message.
+         */
+        Msg() :
+            type(MSG_TYPE_INVALID),
+            rsp(nullptr)
+        {
+        }
+    };
+
+    /**
+     * Parses the payload of a server response.
+     * It runs in the HTTP client task context, therefore it has no access
+     * to the plugin.
+     *
+     * @param[in] rsp   Server response
+     *
+     * @return If successful, it will return the allocated JSON document otherwise nullptr.
+     */
+    typedef DynamicJsonDocument* (*ResponseParser)(const HttpResponse& rsp);
+
+    mutable MutexRecursive  m_mutex;    /**< Mutex to protect against concurrent access. */
+
+    /**
+     * Constructs the plugin.
+     *
+     * @param[in] name              Plugin name
+     * @param[in] uid               Unique id
+     * @param[in] parser            Parser of the server responses
+     * @param[in] isConnectionKept  Keep the HTTP client and the task proxy during hibernation,
+     *                              e.g. if the plugin must continue polling its server.
+     */
+    HttpPlugin(const String& name, uint16_t uid, ResponseParser parser, bool isConnectionKept = false);
+
+    /**
+     * Create the view with all its widgets.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    virtual bool createView() = 0;
+
+    /**
+     * Destroy the view with all its widgets.
+     */
+    virtual void destroyView() = 0;
+
+    /**
+     * Prepare the view for the activation, e.g. load the icons from the
+     * filesystem. It is called with a created view.
+     */
+    virtual void prepareView() = 0;
+
+    /**
+     * Get the shown text, which shall be kept during hibernation.
+     * Overwrite it if your plugin can't restore its text otherwise.
+     *
+     * @return Shown text or a empty string, if nothing shall be kept.
+     */
+    virtual String getShownText() const
+    {
+        return String();
+    }
+
+    /**
+     * Restore the shown text after hibernation.
+     * It is called with a created view.
+     *
+     * @param[in] text  Shown text
+     */
+    virtual void setShownText(const String& text)
+    {
+        UTIL_NOT_USED(text);
+        return;
+    }
+
+    /**
+     * Create the HTTP client, the task proxy and the view, if not already
+     * done. The text which was shown before hibernation is restored.
+     *
+     * @return If the view is available, it will return true otherwise false.
+     */
+    bool createResources();
+
+    /**
+     * Keep the text, which shall be shown after wake-up. Use it if the text
+     * changes during hibernation.
+     *
+     * @param[in] text  Text to show
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool storeShownText(const String& text);
+
+    /**
+     * Get the HTTP client.
+     *
+     * @return HTTP client or nullptr, if it is released during hibernation.
+     */
+    AsyncHttpClient* getHttpClient();
+
+    /**
+     * Receive a message from the HTTP client task context.
+     * If a response is received, the caller is responsible to delete it.
+     *
+     * @param[out] msg  Message
+     *
+     * @return If a message was received, it will return true otherwise false.
+     */
+    bool receiveMsg(Msg& msg);
+
+private:
+
+    /**
+     * HTTP client and the task proxy, which are released during hibernation.
+     */
+    struct Connection
+    {
+        AsyncHttpClient         client;     /**< Asynchronous HTTP client. */
+        TaskProxy<Msg, 2U, 0U>  taskProxy;  /**< Task proxy used to decouple server responses, which happen in a different task context. */
+
+        /**
+         * Constructs the connection.
+         */
+        Connection() :
+            client(),
+            taskProxy()
+        {
+        }
+    };
+
+    ResponseParser  m_parseResponse;    /**< Parser of the server responses */
+    bool            m_isConnectionKept; /**< Keep the connection during hibernation? */
+    Connection*     m_connection;       /**< HTTP client and task proxy, nullptr during hibernation. */
+    bool            m_isViewCreated;    /**< Is the view created? */
+    StateBlob       m_stateBlob;        /**< Shown text during hibernation. */
+
+    /**
+     * Create the HTTP client and the task proxy and register the callbacks.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool createConnection();
+
+    /**
+     * Destroy the HTTP client and the task proxy. A pending request is aborted.
+     */
+    void destroyConnection();
+
+    /**
+     * Clear the task proxy queue.
+     */
+    void clearQueue();
+
+    HttpPlugin();
+    HttpPlugin(const HttpPlugin& plugin);
+    HttpPlugin& operator=(const HttpPlugin& plugin);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __HTTP_PLUGIN_H__ */
+
+/** @} */
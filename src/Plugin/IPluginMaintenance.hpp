@@ -68,6 +68,17 @@ public:
      */
     typedef IPluginMaintenance* (*CreateFunc)(const String& name, uint16_t uid);
 
+    /**
+     * Plugin priority, which is considered by the slot scheduling.
+     */
+    enum Priority
+    {
+        PRIORITY_LOW = 0,   /**< Shown less often than normal */
+        PRIORITY_NORMAL,    /**< Default */
+        PRIORITY_HIGH,      /**< Shown more often than normal */
+        PRIORITY_URGENT     /**< Interrupts the current slot once for a limited time, otherwise like high. */
+    };
+
     /**
      * Destroys the interface.
      */
@@ -206,11 +217,94 @@ public:
      */
     virtual void process() = 0;
 
+    /**
+     * Get the time in ms, until process() shall be called again.
+     * It is requested after every process() call, so a plugin can derive it
+     * from its own timers and isn't called until then.
+     * Note, process() is called by the plugin process task, which is
+     * independent of the display update.
+     *
+     * @return Process period in ms
+     */
+    virtual uint32_t getProcessPeriod() const = 0;
+
+    /**
+     * This method will be called shortly before the plugin is set active,
+     * by the plugin process task and therefore concurrently to the display
+     * update. Expensive preparations like loading icons or the configuration
+     * shall be done here, so active() is fast and doesn't delay the fade
+     * effect. Note, it is not called if the plugin is activated immediately,
+     * e.g. on request.
+     * Overwrite it if your plugin needs to know this.
+     */
+    virtual void prepare() = 0;
+
+    /**
+     * This method will be called in case the preparation is discarded, because
+     * the plugin won't be set active next, e.g. because the slot order changed.
+     * A plugin which remembers its preparation shall forget it, otherwise it
+     * would be activated later with the content from long ago.
+     * It is not called if the plugin was set active after the preparation.
+     * Overwrite it if your plugin needs to know this.
+     */
+    virtual void discardPreparation() = 0;
+
+    /**
+     * Is the plugin ready to be shown, which means it has content?
+     * If not, its slot is skipped by the slot scheduling as long as other
+     * slots are ready.
+     * Note, it is called by the display task and shall be fast.
+     *
+     * @return If ready, it will return true otherwise false.
+     */
+    virtual bool isReady() const = 0;
+
+    /**
+     * Get the plugin priority, which weights how often its slot is shown.
+     * Note, it is called by the display task and shall be fast.
+     *
+     * @return Priority
+     */
+    virtual Priority getPriority() const = 0;
+
+    /**
+     * This method will be called if the slot of the plugin was not shown for
+     * a while. The plugin shall release its heavy resources like canvases and
+     * buffers and keep only a compact state, which is necessary to restore
+     * them in wakeUp(). It is still processed, but not shown until it is
+     * woken up again.
+     * Note, it is called with the display locked and shall be fast, therefore
+     * no file or network access is allowed.
+     *
+     * @return If hibernated, it will return true otherwise false.
+     */
+    virtual bool hibernate() = 0;
+
+    /**
+     * This method will be called to restore the resources of a hibernated
+     * plugin, before it is prepared or set active.
+     * Note, it is called with the display locked and shall be fast, therefore
+     * no file or network access is allowed.
+     */
+    virtual void wakeUp() = 0;
+
+    /**
+     * Notify the plugin, that its configuration in the filesystem was changed
+     * from outside, e.g. by the file REST API. The plugin keeps its parsed
+     * configuration in memory and shall reload it from the filesystem only
+     * after such a notification.
+     * Note, it is called in the context of the web task and shall be fast.
+     */
+    virtual void notifyConfigurationChanged() = 0;
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
      * Overwrite it if your plugin needs to know this.
      *
+     * The display graphics is already cleared. A plugin, which repaints only
+     * its invalidated widgets, shall invalidate all of them here.
+     *
      * @param[in] gfx   Display graphics interface
      */
     virtual void active(YAGfx& gfx) = 0;
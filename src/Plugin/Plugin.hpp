@@ -44,8 +44,10 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
+#include <atomic>
 #include <YAGfx.h>
 #include <Util.h>
+#include <PoolAllocator.h>
 #include "IPluginMaintenance.hpp"
 
 /******************************************************************************
@@ -70,6 +72,42 @@ public:
     {
     }
 
+    /**
+     * Allocate a plugin instance from the pool allocator, because plugins
+     * are installed and uninstalled again and again during runtime.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* operator new(size_t size) noexcept
+    {
+        return PoolAllocator::getInstance().allocate(size);
+    }
+
+    /**
+     * Allocate a plugin instance from the pool allocator, because plugins
+     * are installed and uninstalled again and again during runtime.
+     *
+     * @param[in] size  Size in byte
+     *
+     * @return If successful, it will return the memory otherwise nullptr.
+     */
+    static void* operator new(size_t size, const std::nothrow_t&) noexcept
+    {
+        return PoolAllocator::getInstance().allocate(size);
+    }
+
+    /**
+     * Release a plugin instance to the pool allocator.
+     *
+     * @param[in] ptr   Memory of the plugin instance
+     */
+    static void operator delete(void* ptr)
+    {
+        PoolAllocator::getInstance().deallocate(ptr);
+    }
+
     /**
      * Set the slot interface, which the plugin can used to request information
      * from the slot, it is plugged in.
@@ -262,11 +300,105 @@ public:
         return;
     }
 
+    /**
+     * Get the time in ms, until process() shall be called again.
+     * It is requested after every process() call.
+     * Overwrite it if your plugin needs a different period, e.g. if it
+     * waits for its own timer to expire.
+     *
+     * @return Process period in ms
+     */
+    virtual uint32_t getProcessPeriod() const override
+    {
+        return DEFAULT_PROCESS_PERIOD;
+    }
+
+    /**
+     * This method will be called shortly before the plugin is set active.
+     * It runs concurrently to the display update.
+     * Overwrite it if your plugin needs to prepare expensive stuff, which
+     * shall not delay active().
+     */
+    virtual void prepare() override
+    {
+        return;
+    }
+
+    /**
+     * This method will be called in case the preparation is discarded,
+     * because the plugin won't be set active next.
+     * Overwrite it if your plugin remembers that it was prepared.
+     */
+    virtual void discardPreparation() override
+    {
+        return;
+    }
+
+    /**
+     * Is the plugin ready to be shown, which means it has content?
+     * Overwrite it if your plugin may have nothing to show, e.g. because
+     * the data is not available.
+     *
+     * @return If ready, it will return true otherwise false.
+     */
+    virtual bool isReady() const override
+    {
+        return true;
+    }
+
+    /**
+     * Get the plugin priority, which weights how often its slot is shown.
+     * Overwrite it if your plugin shall be shown more or less often or if
+     * it shall interrupt the current slot.
+     *
+     * @return Priority
+     */
+    virtual Priority getPriority() const override
+    {
+        return PRIORITY_NORMAL;
+    }
+
+    /**
+     * This method will be called if the slot of the plugin was not shown for
+     * a while. Overwrite it if your plugin can release heavy resources
+     * meanwhile.
+     *
+     * @return If hibernated, it will return true otherwise false.
+     */
+    virtual bool hibernate() override
+    {
+        return false;
+    }
+
+    /**
+     * This method will be called to restore the resources of a hibernated
+     * plugin. Overwrite it if your plugin supports hibernation.
+     */
+    virtual void wakeUp() override
+    {
+        return;
+    }
+
+    /**
+     * Notify the plugin, that its configuration in the filesystem was changed
+     * from outside. The plugin will consume the notification with
+     * consumeConfigurationChange() and reload its configuration.
+     * It may be called from any task context.
+     */
+    void notifyConfigurationChanged() override
+    {
+        m_isConfigurationChanged = true;
+        return;
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
      * Overwrite it if your plugin needs to know this.
      *
+     * The display graphics is already cleared. A plugin, which repaints only
+     * its invalidated widgets, shall invalidate all of them here.
+     *
      * @param[in] gfx   Display graphics interface
      */
     virtual void active(YAGfx& gfx) override
@@ -299,6 +431,11 @@ public:
      */
     static constexpr const char*    CONFIG_PATH = "/configuration";
 
+    /**
+     * Default period in ms, in which process() is called.
+     */
+    static const uint32_t           DEFAULT_PROCESS_PERIOD  = 20U;
+
 protected:
 
     /**
@@ -312,7 +449,8 @@ protected:
         m_uid(uid),
         m_alias(),
         m_name(name),
-        m_isEnabled(false)
+        m_isEnabled(false),
+        m_isConfigurationChanged(false)
     {
     }
 
@@ -340,12 +478,42 @@ protected:
         return generateFullPath(".json");
     }
 
+    /**
+     * Get full path (path + filename) to plugin instance specific configuration
+     * in binary format, see BinaryConfig.
+     * 
+     * @return Full path to binary configuration file
+     */
+    String getFullPathToBinaryConfiguration() const
+    {
+        return generateFullPath(".bin");
+    }
+
+    /**
+     * Consume a configuration change notification.
+     * The plugin keeps its configuration in memory after it was loaded once
+     * and shall reload it from the filesystem only if this method returns true.
+     * Note, changes by the plugin itself, e.g. via setTopic(), are written
+     * through to the filesystem and don't need a reload.
+     *
+     * @return If the configuration file was changed from outside since the last call, it will return true otherwise false.
+     */
+    bool consumeConfigurationChange()
+    {
+        /* Clear it before the configuration is reloaded, otherwise a change
+         * during the reload would be lost. The exchange is atomic, because
+         * the notification comes from a different task.
+         */
+        return m_isConfigurationChanged.exchange(false);
+    }
+
 private:
 
-    uint16_t    m_uid;          /**< Unique id */
-    String      m_alias;        /**< Alias name */
-    String      m_name;         /**< Plugin name */
-    bool        m_isEnabled;    /**< Plugin is enabled or disabled */
+    uint16_t            m_uid;                      /**< Unique id */
+    String              m_alias;                    /**< Alias name */
+    String              m_name;                     /**< Plugin name */
+    bool                m_isEnabled;                /**< Plugin is enabled or disabled */
+    std::atomic<bool>   m_isConfigurationChanged;   /**< Configuration file was changed from outside and shall be reloaded. */
 
     Plugin();
     Plugin(const Plugin& plugin);
@@ -0,0 +1,426 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Plugin installation batch
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PluginBatch.h"
+#include "PluginMgr.h"
+#include "DisplayMgr.h"
+
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool PluginBatch::addInstall(const String& name)
+{
+    bool isSuccessful = false;
+
+    if (MAX_OPS > m_count)
+    {
+        m_ops[m_count].type     = OP_INSTALL;
+        m_ops[m_count].name     = name;
+        m_ops[m_count].uid      = 0U;
+        m_ops[m_count].slotId   = DisplayMgr::SLOT_ID_INVALID;
+        ++m_count;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool PluginBatch::addUninstall(uint8_t slotId)
+{
+    bool isSuccessful = false;
+
+    if (MAX_OPS > m_count)
+    {
+        m_ops[m_count].type     = OP_UNINSTALL;
+        m_ops[m_count].name.clear();
+        m_ops[m_count].uid      = 0U;
+        m_ops[m_count].slotId   = slotId;
+        ++m_count;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool PluginBatch::addMove(uint16_t uid, uint8_t slotId)
+{
+    bool isSuccessful = false;
+
+    if (MAX_OPS > m_count)
+    {
+        m_ops[m_count].type     = OP_MOVE;
+        m_ops[m_count].name.clear();
+        m_ops[m_count].uid      = uid;
+        m_ops[m_count].slotId   = slotId;
+        ++m_count;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+uint8_t PluginBatch::getSlotId(uint8_t index) const
+{
+    uint8_t slotId = DisplayMgr::SLOT_ID_INVALID;
+
+    if (m_count > index)
+    {
+        slotId = m_ops[index].slotId;
+    }
+
+    return slotId;
+}
+
+uint16_t PluginBatch::getUID(uint8_t index) const
+{
+    uint16_t uid = 0U;
+
+    if (m_count > index)
+    {
+        uid = m_ops[index].uid;
+    }
+
+    return uid;
+}
+
+bool PluginBatch::execute()
+{
+    PluginMgr&  pluginMgr   = PluginMgr::getInstance();
+    uint8_t     index       = 0U;
+
+    m_failedIndex   = INVALID_INDEX;
+    m_error         = nullptr;
+
+    /* All operations are applied under a single display manager lock and
+     * the plugin installation is saved once at the end.
+     */
+    pluginMgr.beginTransaction();
+
+    /* Nothing is applied, if any operation is invalid. The slots can't
+     * change in between, because the display manager is locked.
+     */
+    m_error = validate();
+
+    while((m_count > index) && (nullptr == m_error))
+    {
+        m_error = apply(m_ops[index]);
+
+        if (nullptr != m_error)
+        {
+            LOG_WARNING("Batch operation %u failed: %s", index, m_error);
+            m_failedIndex = index;
+        }
+
+        ++index;
+    }
+
+    /* Save the operations before the failed one too, because they were applied. */
+    if (0U < index)
+    {
+        pluginMgr.save();
+    }
+
+    pluginMgr.commitTransaction();
+
+    return (nullptr == m_error);
+}
+
+void PluginBatch::clear()
+{
+    uint8_t index = 0U;
+
+    for(index = 0U; index < m_count; ++index)
+    {
+        m_ops[index].name.clear();
+    }
+
+    m_count         = 0U;
+    m_failedIndex   = INVALID_INDEX;
+    m_error         = nullptr;
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+const char* PluginBatch::validate()
+{
+    const char* error       = nullptr;
+    DisplayMgr& displayMgr  = DisplayMgr::getInstance();
+    uint8_t     maxSlots    = displayMgr.getMaxSlots();
+    SlotState*  slots       = new(std::nothrow) SlotState[maxSlots];
+
+    if (nullptr == slots)
+    {
+        error = "Out of memory.";
+    }
+    else
+    {
+        uint8_t slotId  = 0U;
+        uint8_t index   = 0U;
+
+        for(slotId = 0U; slotId < maxSlots; ++slotId)
+        {
+            IPluginMaintenance* plugin = displayMgr.getPluginInSlot(slotId);
+
+            if (nullptr != plugin)
+            {
+                slots[slotId].isEmpty   = false;
+                slots[slotId].uid       = plugin->getUID();
+            }
+
+            slots[slotId].isLocked = displayMgr.isSlotLocked(slotId);
+        }
+
+        while((m_count > index) && (nullptr == error))
+        {
+            error = validate(m_ops[index], slots, maxSlots);
+
+            if (nullptr != error)
+            {
+                LOG_WARNING("Batch operation %u invalid: %s", index, error);
+                m_failedIndex = index;
+            }
+
+            ++index;
+        }
+
+        delete[] slots;
+    }
+
+    return error;
+}
+
+const char* PluginBatch::validate(const Op& op, SlotState* slots, uint8_t maxSlots) const
+{
+    const char* error   = nullptr;
+    uint8_t     slotId  = 0U;
+
+    switch(op.type)
+    {
+    case OP_INSTALL:
+        /* Same slot, as the display manager will choose. */
+        while((maxSlots > slotId) && ((false == slots[slotId].isEmpty) || (true == slots[slotId].isLocked)))
+        {
+            ++slotId;
+        }
+
+        if (false == PluginMgr::getInstance().isRegistered(op.name))
+        {
+            error = "Plugin not found.";
+        }
+        else if (maxSlots <= slotId)
+        {
+            error = "No free slot.";
+        }
+        else
+        {
+            slots[slotId].isEmpty   = false;
+            slots[slotId].isNew     = true;
+        }
+        break;
+
+    case OP_UNINSTALL:
+        if ((maxSlots <= op.slotId) ||
+            (true == slots[op.slotId].isEmpty))
+        {
+            error = "Slot is empty.";
+        }
+        else if (true == slots[op.slotId].isLocked)
+        {
+            error = "Slot is locked.";
+        }
+        else
+        {
+            slots[op.slotId].isEmpty    = true;
+            slots[op.slotId].isNew      = false;
+        }
+        break;
+
+    case OP_MOVE:
+        while((maxSlots > slotId) &&
+              ((true == slots[slotId].isEmpty) || (true == slots[slotId].isNew) || (op.uid != slots[slotId].uid)))
+        {
+            ++slotId;
+        }
+
+        if (maxSlots <= slotId)
+        {
+            error = "Plugin UID not found.";
+        }
+        else if ((maxSlots <= op.slotId) ||
+                 (slotId == op.slotId) ||
+                 (true == slots[op.slotId].isLocked))
+        {
+            error = "Move failed.";
+        }
+        else
+        {
+            /* The plugins are swapped, the locks stay with the slots. */
+            SlotState src = slots[slotId];
+
+            slots[slotId].isEmpty   = slots[op.slotId].isEmpty;
+            slots[slotId].isNew     = slots[op.slotId].isNew;
+            slots[slotId].uid       = slots[op.slotId].uid;
+
+            slots[op.slotId].isEmpty    = src.isEmpty;
+            slots[op.slotId].isNew      = src.isNew;
+            slots[op.slotId].uid        = src.uid;
+        }
+        break;
+
+    default:
+        error = "Unknown operation.";
+        break;
+    }
+
+    return error;
+}
+
+const char* PluginBatch::apply(Op& op)
+{
+    const char* error       = nullptr;
+    PluginMgr&  pluginMgr   = PluginMgr::getInstance();
+    DisplayMgr& displayMgr  = DisplayMgr::getInstance();
+
+    switch(op.type)
+    {
+    case OP_INSTALL:
+        {
+            IPluginMaintenance* plugin = pluginMgr.install(op.name);
+
+            if (nullptr == plugin)
+            {
+                error = "Plugin not found.";
+            }
+            else
+            {
+                plugin->enable();
+
+                op.slotId   = displayMgr.getSlotIdByPluginUID(plugin->getUID());
+                op.uid      = plugin->getUID();
+            }
+        }
+        break;
+
+    case OP_UNINSTALL:
+        {
+            IPluginMaintenance* plugin = displayMgr.getPluginInSlot(op.slotId);
+
+            if (nullptr == plugin)
+            {
+                error = "Slot is empty.";
+            }
+            else if (true == displayMgr.isSlotLocked(op.slotId))
+            {
+                error = "Slot is locked.";
+            }
+            else if (false == pluginMgr.uninstall(plugin))
+            {
+                error = "Failed to uninstall.";
+            }
+            else
+            {
+                ;
+            }
+        }
+        break;
+
+    case OP_MOVE:
+        {
+            uint8_t             srcSlotId   = displayMgr.getSlotIdByPluginUID(op.uid);
+            IPluginMaintenance* plugin      = displayMgr.getPluginInSlot(srcSlotId);
+
+            if (nullptr == plugin)
+            {
+                error = "Plugin UID not found.";
+            }
+            else if (false == displayMgr.movePluginToSlot(plugin, op.slotId))
+            {
+                error = "Move failed.";
+            }
+            else
+            {
+                ;
+            }
+        }
+        break;
+
+    default:
+        error = "Unknown operation.";
+        break;
+    }
+
+    return error;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,297 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Plugin installation batch
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup plugin
+ *
+ * @{
+ */
+
+#ifndef __PLUGINBATCH_H__
+#define __PLUGINBATCH_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <WString.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A batch of plugin installation changes, which are applied at once in a
+ * single plugin manager transaction. Therefore the display manager is locked
+ * only once and the plugin installation is written only once to persistent
+ * memory, instead of after every single change.
+ *
+ * The operations are applied in the order they were added. Before any
+ * operation is applied, all of them are validated against the current slot
+ * states. If one is invalid, nothing is changed. Only a failure during
+ * application, e.g. out of memory, stops the batch after operations were
+ * already applied. These operations are kept.
+ */
+class PluginBatch
+{
+public:
+
+    /** Max. number of operations in a batch. */
+    static const uint8_t    MAX_OPS         = 16U;
+
+    /** Invalid operation index. */
+    static const uint8_t    INVALID_INDEX   = UINT8_MAX;
+
+    /**
+     * Constructs a empty batch.
+     */
+    PluginBatch() :
+        m_ops(),
+        m_count(0U),
+        m_failedIndex(INVALID_INDEX),
+        m_error(nullptr)
+    {
+    }
+
+    /**
+     * Destroys the batch.
+     */
+    ~PluginBatch()
+    {
+    }
+
+    /**
+     * Add a plugin installation to the next available slot.
+     * The installed plugin will be enabled.
+     *
+     * @param[in] name  Plugin name
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addInstall(const String& name);
+
+    /**
+     * Add a plugin uninstallation.
+     *
+     * @param[in] slotId    Id of the slot, where to uninstall the plugin.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addUninstall(uint8_t slotId);
+
+    /**
+     * Add a plugin move.
+     *
+     * @param[in] uid       UID of the plugin, which to move.
+     * @param[in] slotId    Id of the slot, where to move the plugin.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addMove(uint16_t uid, uint8_t slotId);
+
+    /**
+     * Get number of operations.
+     *
+     * @return Number of operations
+     */
+    uint8_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Is the operation a plugin installation?
+     *
+     * @param[in] index Operation index
+     *
+     * @return If it is a plugin installation, it will return true otherwise false.
+     */
+    bool isInstall(uint8_t index) const
+    {
+        return (m_count > index) && (OP_INSTALL == m_ops[index].type);
+    }
+
+    /**
+     * Get the slot id of a operation. After execution, it is the slot id where
+     * a plugin was installed to.
+     *
+     * @param[in] index Operation index
+     *
+     * @return Slot id
+     */
+    uint8_t getSlotId(uint8_t index) const;
+
+    /**
+     * Get the plugin UID of a operation. After execution, it is the UID of
+     * a installed plugin.
+     *
+     * @param[in] index Operation index
+     *
+     * @return Plugin UID
+     */
+    uint16_t getUID(uint8_t index) const;
+
+    /**
+     * Validate and apply all operations in a single plugin manager transaction.
+     *
+     * @return If all operations were successful, it will return true otherwise false.
+     */
+    bool execute();
+
+    /**
+     * Get the index of the failed operation.
+     *
+     * @return Operation index or INVALID_INDEX, if no operation failed.
+     */
+    uint8_t getFailedIndex() const
+    {
+        return m_failedIndex;
+    }
+
+    /**
+     * Get the reason, why the operation failed.
+     *
+     * @return Error message or nullptr, if no operation failed.
+     */
+    const char* getError() const
+    {
+        return m_error;
+    }
+
+    /**
+     * Remove all operations.
+     */
+    void clear();
+
+private:
+
+    /** Operation types */
+    enum OpType
+    {
+        OP_INSTALL = 0, /**< Install a plugin */
+        OP_UNINSTALL,   /**< Uninstall a plugin */
+        OP_MOVE         /**< Move a plugin */
+    };
+
+    /**
+     * A single operation.
+     */
+    struct Op
+    {
+        OpType      type;   /**< Operation type */
+        String      name;   /**< Plugin name, used to install a plugin. */
+        uint16_t    uid;    /**< Plugin UID */
+        uint8_t     slotId; /**< Slot id */
+
+        /**
+         * Initializes the operation.
+         */
+        Op() :
+            type(OP_INSTALL),
+            name(),
+            uid(0U),
+            slotId(UINT8_MAX)
+        {
+        }
+    };
+
+    Op          m_ops[MAX_OPS]; /**< Operations */
+    uint8_t     m_count;        /**< Number of operations */
+    uint8_t     m_failedIndex;  /**< Index of the failed operation */
+    const char* m_error;        /**< Reason of the failed operation */
+
+    /**
+     * State of a slot, used to validate the operations.
+     */
+    struct SlotState
+    {
+        bool        isEmpty;    /**< Is slot empty? */
+        bool        isLocked;   /**< Is slot locked? */
+        bool        isNew;      /**< Is the plugin installed by this batch? Its UID is not known yet. */
+        uint16_t    uid;        /**< UID of the installed plugin */
+
+        /**
+         * Initializes a empty slot state.
+         */
+        SlotState() :
+            isEmpty(true),
+            isLocked(false),
+            isNew(false),
+            uid(0U)
+        {
+        }
+    };
+
+    PluginBatch(const PluginBatch& batch);
+    PluginBatch& operator=(const PluginBatch& batch);
+
+    /**
+     * Validate all operations, by applying them to a copy of the current
+     * slot states. On failure, the failed operation index is set.
+     *
+     * @return If all are valid, it will return nullptr otherwise the error reason.
+     */
+    const char* validate();
+
+    /**
+     * Validate a single operation and update the slot states accordingly.
+     *
+     * @param[in]       op          Operation
+     * @param[in,out]   slots       Slot states
+     * @param[in]       maxSlots    Number of slots
+     *
+     * @return If valid, it will return nullptr otherwise the error reason.
+     */
+    const char* validate(const Op& op, SlotState* slots, uint8_t maxSlots) const;
+
+    /**
+     * Apply a single operation.
+     *
+     * @param[in] op    Operation
+     *
+     * @return If successful, it will return nullptr otherwise the error reason.
+     */
+    const char* apply(Op& op);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __PLUGINBATCH_H__ */
+
+/** @} */
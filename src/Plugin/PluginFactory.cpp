@@ -35,6 +35,7 @@
 #include "PluginFactory.h"
 
 #include <Logging.h>
+#include <string.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -60,31 +61,92 @@
  * Public Methods
  *****************************************************************************/
 
+PluginFactory::~PluginFactory()
+{
+    if (nullptr != m_registry)
+    {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < m_registryCount; ++idx)
+        {
+            delete m_registry[idx];
+        }
+
+        delete[] m_registry;
+        m_registry = nullptr;
+    }
+}
+
 void PluginFactory::registerPlugin(const String& name, IPluginMaintenance::CreateFunc createFunc)
 {
-    PluginRegEntry* entry = new(std::nothrow) PluginRegEntry();
+    bool    isFound = false;
+    uint8_t pos     = findRegEntry(name.c_str(), isFound);
 
-    if (nullptr != entry)
+    if (true == isFound)
     {
-        entry->name         = name;
-        entry->createFunc   = createFunc;
+        LOG_WARNING("Plugin type %s already registered.", name.c_str());
+    }
+    else
+    {
+        /* Registry full? */
+        if (m_registrySize <= m_registryCount)
+        {
+            PluginRegEntry**    registry    = nullptr;
+            uint16_t            size        = m_registrySize + REGISTRY_GROW_SIZE;
 
-        if (false == m_registry.append(entry))
+            if (UINT8_MAX >= size)
+            {
+                registry = new(std::nothrow) PluginRegEntry*[size];
+            }
+
+            if (nullptr != registry)
+            {
+                uint8_t idx = 0U;
+
+                for(idx = 0U; idx < m_registryCount; ++idx)
+                {
+                    registry[idx] = m_registry[idx];
+                }
+
+                delete[] m_registry;
+                m_registry      = registry;
+                m_registrySize  = static_cast<uint8_t>(size);
+            }
+        }
+
+        if (m_registrySize <= m_registryCount)
         {
             LOG_ERROR("Couldn't add %s to registry.", name.c_str());
-
-            delete entry;
-            entry = nullptr;
         }
         else
         {
-            LOG_INFO("Plugin type %s registered.", name.c_str());
+            PluginRegEntry* entry = new(std::nothrow) PluginRegEntry();
+
+            if (nullptr == entry)
+            {
+                LOG_ERROR("Couldn't add %s to registry.", name.c_str());
+            }
+            else
+            {
+                uint8_t idx = m_registryCount;
+
+                entry->name         = name;
+                entry->createFunc   = createFunc;
+
+                /* Keep the registry sorted. */
+                while(pos < idx)
+                {
+                    m_registry[idx] = m_registry[idx - 1U];
+                    --idx;
+                }
+
+                m_registry[pos] = entry;
+                ++m_registryCount;
+
+                LOG_INFO("Plugin type %s registered.", name.c_str());
+            }
         }
     }
-    else
-    {
-        LOG_ERROR("Couldn't add %s to registry.", name.c_str());
-    }
 
     return;
 }
@@ -96,45 +158,21 @@ IPluginMaintenance* PluginFactory::createPlugin(const String& name)
 
 IPluginMaintenance* PluginFactory::createPlugin(const String& name, uint16_t uid)
 {
-    IPluginMaintenance*                     plugin  = nullptr;
-    PluginRegEntry*                         entry   = nullptr;
-    DLinkedListIterator<PluginRegEntry*>    itPluginReg(m_registry);
+    IPluginMaintenance* plugin  = nullptr;
+    bool                isFound = false;
+    uint8_t             pos     = findRegEntry(name.c_str(), isFound);
 
-    /* Walk through registry and find the requested plugin type. */
-    if (true == itPluginReg.first())
+    /* Plugin type found? */
+    if (true == isFound)
     {
-        bool isFound = false;
+        PluginRegEntry* entry = m_registry[pos];
 
-        /* Find plugin type in the registry */
-        entry = *itPluginReg.current();
-
-        while((false == isFound) && (nullptr != entry))
-        {
-            if (name == entry->name)
-            {
-                isFound = true;
-            }
-            else if (false == itPluginReg.next())
-            {
-                entry = nullptr;
-            }
-            else
-            {
-                entry = *itPluginReg.current();
-            }
-        }
+        /* Produce the plugin object. */
+        plugin = entry->createFunc(entry->name, uid);
 
-        /* Plugin type found? */
-        if ((true == isFound) &&
-            (nullptr != entry))
+        if (nullptr != plugin)
         {
-            /* Produce the plugin object. */
-            plugin = entry->createFunc(entry->name, uid);
-
-            if (nullptr != plugin)
-            {
-                m_plugins.append(plugin);
-            }
+            m_plugins.append(plugin);
         }
     }
 
@@ -163,9 +201,11 @@ const char* PluginFactory::findFirst()
 {
     const char* name = nullptr;
 
-    if (true == m_registryIter.first())
+    m_registryIterIdx = 0U;
+
+    if (m_registryCount > m_registryIterIdx)
     {
-        name = (*m_registryIter.current())->name.c_str();
+        name = m_registry[m_registryIterIdx]->name.c_str();
     }
 
     return name;
@@ -175,9 +215,14 @@ const char* PluginFactory::findNext()
 {
     const char* name = nullptr;
 
-    if (true == m_registryIter.next())
+    if (m_registryCount > m_registryIterIdx)
     {
-        name = (*m_registryIter.current())->name.c_str();
+        ++m_registryIterIdx;
+
+        if (m_registryCount > m_registryIterIdx)
+        {
+            name = m_registry[m_registryIterIdx]->name.c_str();
+        }
     }
 
     return name;
@@ -191,6 +236,37 @@ const char* PluginFactory::findNext()
  * Private Methods
  *****************************************************************************/
 
+uint8_t PluginFactory::findRegEntry(const char* name, bool& isFound) const
+{
+    uint8_t low     = 0U;
+    uint8_t high    = m_registryCount;
+
+    isFound = false;
+
+    /* Binary search in [low; high) */
+    while((false == isFound) && (low < high))
+    {
+        uint8_t mid     = low + ((high - low) / 2U);
+        int     result  = strcmp(name, m_registry[mid]->name.c_str());
+
+        if (0 == result)
+        {
+            low     = mid;
+            isFound = true;
+        }
+        else if (0 > result)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1U;
+        }
+    }
+
+    return low;
+}
+
 uint16_t PluginFactory::generateUID()
 {
     uint16_t                                        uid;
@@ -69,8 +69,10 @@ public:
      * Constructs the plugin factory.
      */
     PluginFactory() :
-        m_registry(),
-        m_registryIter(m_registry),
+        m_registry(nullptr),
+        m_registryCount(0U),
+        m_registrySize(0U),
+        m_registryIterIdx(0U),
         m_plugins()
     {
     }
@@ -81,12 +83,12 @@ public:
      * will survive. This is a feature where a factory could live shorter than its
      * produced plugin objects.
      */
-    ~PluginFactory()
-    {
-    }
+    ~PluginFactory();
 
     /**
      * Register a plugin, so the factory is able to produce it.
+     * The registry is kept sorted by name, therefore a plugin type is found
+     * by binary search. A plugin type can only be registered once.
      *
      * @param[in] name          Plugin name
      * @param[in] createFunc    The plugin creation function.
@@ -121,19 +123,35 @@ public:
     void destroyPlugin(IPluginMaintenance* plugin);
 
     /**
-     * Find first registered plugin type.
+     * Find first registered plugin type in alphabetic order.
      *
      * @return If plugin type found, it will return its name otherwise nullptr.
      */
     const char* findFirst();
 
     /**
-     * Find next registered plugin type.
+     * Find next registered plugin type in alphabetic order.
      *
      * @return If plugin type found, it will return its name otherwise nullptr.
      */
     const char* findNext();
 
+    /**
+     * Is the plugin type registered?
+     *
+     * @param[in] name  Plugin type name
+     *
+     * @return If registered, it will return true otherwise false.
+     */
+    bool isRegistered(const String& name) const
+    {
+        bool isFound = false;
+
+        (void)findRegEntry(name.c_str(), isFound);
+
+        return isFound;
+    }
+
 private:
 
     /**
@@ -145,13 +163,29 @@ private:
         IPluginMaintenance::CreateFunc  createFunc; /**< Plugin creation function */
     };
 
-    DLinkedList<PluginRegEntry*>            m_registry;     /**< Plugin registry, which contains all registered plugin types. */
-    DLinkedListIterator<PluginRegEntry*>    m_registryIter; /**< Plugin registry iterator. Exclusive use in findFirst() and findNext()! */
-    DLinkedList<IPluginMaintenance*>        m_plugins;      /**< List with all produced plugin objects. */
+    /** Number of entries, the registry grows if it is full. */
+    static const uint8_t REGISTRY_GROW_SIZE = 8U;
+
+    PluginRegEntry**                    m_registry;         /**< Plugin registry, which contains all registered plugin types sorted by name. */
+    uint8_t                             m_registryCount;    /**< Number of registered plugin types. */
+    uint8_t                             m_registrySize;     /**< Number of entries, the registry can hold. */
+    uint8_t                             m_registryIterIdx;  /**< Plugin registry iterator. Exclusive use in findFirst() and findNext()! */
+    DLinkedList<IPluginMaintenance*>    m_plugins;          /**< List with all produced plugin objects. */
 
     PluginFactory(const PluginFactory& factory);
     PluginFactory& operator=(const PluginFactory& factory);
 
+    /**
+     * Find the registry position of a plugin type by binary search.
+     * If it is not registered, the position is where it would be inserted.
+     *
+     * @param[in]   name    Plugin type name
+     * @param[out]  isFound Is plugin type registered?
+     *
+     * @return Registry position
+     */
+    uint8_t findRegEntry(const char* name, bool& isFound) const;
+
     /**
      * Generate a 16-bit unique id, for a plugin instance.
      *
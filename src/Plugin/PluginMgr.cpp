@@ -43,6 +43,7 @@
 
 #include <Logging.h>
 #include <ArduinoJson.h>
+#include <ImageCache.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -264,6 +265,117 @@ void PluginMgr::load()
 }
 
 void PluginMgr::save()
+{
+    /* Within a transaction, the installation is written only once at the commit. */
+    if (0U < m_transactionDepth)
+    {
+        m_isSavePending = true;
+    }
+    else
+    {
+        writeInstallation();
+    }
+
+    return;
+}
+
+void PluginMgr::beginTransaction()
+{
+    DisplayMgr::getInstance().lock();
+    ++m_transactionDepth;
+
+    return;
+}
+
+void PluginMgr::commitTransaction()
+{
+    if (0U < m_transactionDepth)
+    {
+        bool isWriteRequired = false;
+
+        --m_transactionDepth;
+
+        if ((0U == m_transactionDepth) &&
+            (true == m_isSavePending))
+        {
+            m_isSavePending = false;
+            isWriteRequired = true;
+        }
+
+        /* Release the display before the filesystem access, otherwise the
+         * display would stall during the write.
+         */
+        DisplayMgr::getInstance().unlock();
+
+        if (true == isWriteRequired)
+        {
+            writeInstallation();
+        }
+    }
+
+    return;
+}
+
+void PluginMgr::notifyFileChanged(const String& fullPath)
+{
+    const String    CONFIG_DIR  = String(Plugin::CONFIG_PATH) + "/";
+    int             extIdx      = fullPath.lastIndexOf('.');
+    String          ext;
+
+    if (0 <= extIdx)
+    {
+        ext = fullPath.substring(extIdx);
+    }
+
+    /* Plugin configuration files are named "<CONFIG_PATH>/<uid>.json" or
+     * "<CONFIG_PATH>/<uid>.bin" in binary format.
+     */
+    if ((true == fullPath.startsWith(CONFIG_DIR)) &&
+        ((0U != ext.equals(".json")) || (0U != ext.equals(".bin"))) &&
+        (static_cast<int>(CONFIG_DIR.length()) < extIdx))
+    {
+        DisplayMgr&         displayMgr  = DisplayMgr::getInstance();
+        String              uidStr      = fullPath.substring(CONFIG_DIR.length(), extIdx);
+        uint16_t            uid         = static_cast<uint16_t>(uidStr.toInt());
+        IPluginMaintenance* plugin      = displayMgr.getPluginInSlot(displayMgr.getSlotIdByPluginUID(uid));
+
+        /* No need to lock the display manager, which would stall the display
+         * task. Plugins are only installed and uninstalled in the web server
+         * context, which is the caller context too. The notification itself
+         * is just an atomic flag, which is consumed by the plugin.
+         */
+        if ((nullptr != plugin) &&
+            (uid == plugin->getUID()))
+        {
+            LOG_INFO("Configuration of plugin %s (uid %u) changed.", plugin->getName(), uid);
+
+            plugin->notifyConfigurationChanged();
+        }
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void PluginMgr::createPluginConfigDirectory()
+{
+    if (false == FILESYSTEM.exists(Plugin::CONFIG_PATH))
+    {
+        if (false == FILESYSTEM.mkdir(Plugin::CONFIG_PATH))
+        {
+            LOG_WARNING("Couldn't create directory: %s", Plugin::CONFIG_PATH);
+        }
+    }
+}
+
+void PluginMgr::writeInstallation()
 {
     String              installation;
     uint8_t             slotId      = 0;
@@ -313,25 +425,6 @@ void PluginMgr::save()
     }
 }
 
-/******************************************************************************
- * Protected Methods
- *****************************************************************************/
-
-/******************************************************************************
- * Private Methods
- *****************************************************************************/
-
-void PluginMgr::createPluginConfigDirectory()
-{
-    if (false == FILESYSTEM.exists(Plugin::CONFIG_PATH))
-    {
-        if (false == FILESYSTEM.mkdir(Plugin::CONFIG_PATH))
-        {
-            LOG_WARNING("Couldn't create directory: %s", Plugin::CONFIG_PATH);
-        }
-    }
-}
-
 bool PluginMgr::install(IPluginMaintenance* plugin, uint8_t slotId)
 {
     bool isSuccessful = false;
@@ -658,6 +751,9 @@ void PluginMgr::uploadHandler(AsyncWebServerRequest *request, const String& file
             LOG_INFO("Upload of %s finished.", filename.c_str());
 
             webHandlerData->fd.close();
+
+            /* A cached image of a overwritten file is outdated. */
+            ImageCache::getInstance().invalidate(webHandlerData->fullPath);
         }
     }
 
@@ -127,6 +127,18 @@ public:
      */
     const char* findNext();
 
+    /**
+     * Is the plugin registered?
+     *
+     * @param[in] name  Plugin name
+     *
+     * @return If registered, it will return true otherwise false.
+     */
+    bool isRegistered(const String& name) const
+    {
+        return m_pluginFactory.isRegistered(name);
+    }
+
     /**
      * Set the alias name of a plugin.
      * If the plugin has registered a REST API, the corresponding URIs will be updated.
@@ -164,9 +176,34 @@ public:
 
     /**
      * Save plugin installation to persistent memory.
+     * Within a transaction, it is saved at the commit.
      */
     void save();
 
+    /**
+     * Begin a transaction to apply several installation changes at once,
+     * e.g. install, uninstall and move plugins. The display manager is locked
+     * until the transaction is committed and the plugin installation is saved
+     * to persistent memory only once, at the commit.
+     * Transactions can be nested, only the outermost commit saves.
+     */
+    void beginTransaction();
+
+    /**
+     * Commit the transaction. If the plugin installation was changed, it
+     * will be saved to persistent memory.
+     */
+    void commitTransaction();
+
+    /**
+     * Notify about a file, which was written to the filesystem from outside,
+     * e.g. by the file REST API. If it is the configuration file of an
+     * installed plugin, the plugin will be notified to reload it.
+     *
+     * @param[in] fullPath  Full path of the written file
+     */
+    void notifyFileChanged(const String& fullPath);
+
 private:
 
     /**
@@ -215,12 +252,17 @@ private:
 
     PluginFactory               m_pluginFactory;    /**< The plugin factory with the plugin type registry. */
     DLinkedList<PluginObjData*> m_pluginMeta;       /**< Plugin object management information. */
+    uint8_t                     m_transactionDepth; /**< Number of nested transactions */
+    bool                        m_isSavePending;    /**< Save the plugin installation at the commit of the transaction? */
 
     /**
      * Constructs the plugin manager.
      */
     PluginMgr() :
-        m_pluginFactory()
+        m_pluginFactory(),
+        m_pluginMeta(),
+        m_transactionDepth(0U),
+        m_isSavePending(false)
     {
     }
 
@@ -241,6 +283,11 @@ private:
      */
     void createPluginConfigDirectory();
 
+    /**
+     * Write plugin installation to persistent memory.
+     */
+    void writeInstallation();
+
     /**
      * Install plugin.
      * If no slot id is given, the plugin will be installed in the next available slot.
@@ -71,15 +71,14 @@ void BTCQuotePlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    m_width     = width;
+    m_height    = height;
 
-    (void)m_bitmapWidget.load(FILESYSTEM, BTC_USD_IMAGE_PATH);
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        prepareView();
+    }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
@@ -106,7 +105,9 @@ void BTCQuotePlugin::process()
     Msg                         msg;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    if ((true == m_requestTimer.isTimerRunning()) &&
+    /* During hibernation, a expired request is deferred until wake-up. */
+    if ((nullptr != m_view) &&
+        (true == m_requestTimer.isTimerRunning()) &&
         (true == m_requestTimer.isTimeout()))
     {
         if (false == startHttpRequest())
@@ -119,7 +120,8 @@ void BTCQuotePlugin::process()
         }
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if ((nullptr != m_view) &&
+        (true == receiveMsg(msg)))
     {
         switch(msg.type)
         {
@@ -136,6 +138,14 @@ void BTCQuotePlugin::process()
             }
             break;
 
+        case MSG_TYPE_CONN_CLOSED:
+            LOG_INFO("Connection closed.");
+            break;
+
+        case MSG_TYPE_CONN_ERROR:
+            LOG_WARNING("Connection error.");
+            break;
+
         default:
             /* Should never happen. */
             break;
@@ -145,13 +155,30 @@ void BTCQuotePlugin::process()
     return;
 }
 
+void BTCQuotePlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
+
+    return;
+}
+
 void BTCQuotePlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    if (nullptr != m_view)
+    {
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
+        (void)m_view->textCanvas.updateInvalidated(gfx);
+    }
 
     return;
 }
@@ -164,14 +191,71 @@ void BTCQuotePlugin::update(YAGfx& gfx)
  * Private Methods
  *****************************************************************************/
 
+bool BTCQuotePlugin::createView()
+{
+    if (nullptr == m_view)
+    {
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+            (void)m_view->iconCanvas.addWidget(m_view->bitmapWidget);
+
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
+
+    return (nullptr != m_view);
+}
+
+void BTCQuotePlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
+    }
+
+    return;
+}
+
+void BTCQuotePlugin::prepareView()
+{
+    if (false == m_view->isIconLoaded)
+    {
+        m_view->isIconLoaded = m_view->bitmapWidget.load(FILESYSTEM, BTC_USD_IMAGE_PATH);
+    }
+
+    return;
+}
+
+String BTCQuotePlugin::getShownText() const
+{
+    return m_view->textWidget.getFormatStr();
+}
+
+void BTCQuotePlugin::setShownText(const String& text)
+{
+    m_view->textWidget.setFormatStr(text);
+
+    return;
+}
+
 bool BTCQuotePlugin::startHttpRequest()
 {
-    bool    status  = false;
-    String  url     = String("http://api.coindesk.com/v1/bpi/currentprice/USD.json");
+    bool                status  = false;
+    String              url     = String("http://api.coindesk.com/v1/bpi/currentprice/USD.json");
+    AsyncHttpClient*    client  = getHttpClient();
 
-    if (true == m_client.begin(url))
+    if (nullptr == client)
+    {
+        ;
+    }
+    else if (true == client->begin(url))
     {
-        if (false == m_client.GET())
+        if (false == client->GET())
         {
             LOG_WARNING("GET %s failed.", url.c_str());
         }
@@ -185,80 +269,50 @@ bool BTCQuotePlugin::startHttpRequest()
     return status;
 }
 
-void BTCQuotePlugin::initHttpClient()
+DynamicJsonDocument* BTCQuotePlugin::parseResponse(const HttpResponse& rsp)
 {
-    /* Note: All registered callbacks are running in a different task context!
-     *       Therefore it is not allowed to access a member here directly.
-     *       The processing must be deferred via task proxy.
-     */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
+    const size_t            JSON_DOC_SIZE   = 512U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+
+    if (nullptr != jsonDoc)
+    {
+        size_t                          payloadSize = 0U;
+        const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        const size_t                    FILTER_SIZE = 128U;
+        StaticJsonDocument<FILTER_SIZE> filter;
+        DeserializationError            error;
+
+        filter["bpi"]["USD"]["rate_float"]      = true;
+        filter["bpi"]["USD"]["rate"]            = true;
+
+        if (true == filter.overflowed())
         {
-            const size_t            JSON_DOC_SIZE   = 512U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+            LOG_ERROR("Less memory for filter available.");
+        }
 
-            if (nullptr != jsonDoc)
-            {
-                size_t                          payloadSize = 0U;
-                const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                const size_t                    FILTER_SIZE = 128U;
-                StaticJsonDocument<FILTER_SIZE> filter;
-                DeserializationError            error;
-
-                filter["bpi"]["USD"]["rate_float"]      = true;
-                filter["bpi"]["USD"]["rate"]            = true;
-
-                if (true == filter.overflowed())
-                {
-                    LOG_ERROR("Less memory for filter available.");
-                }
-
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
-
-                if (DeserializationError::Ok != error.code())
-                {
-                    LOG_ERROR("Invalid JSON message received: %s", error.c_str());
-                }
-                else
-                {
-                    Msg msg;
-
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
-
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
-            }
+        error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
+
+        if (DeserializationError::Ok != error.code())
+        {
+            LOG_ERROR("Invalid JSON message received: %s", error.c_str());
+
+            delete jsonDoc;
+            jsonDoc = nullptr;
         }
-    );
+    }
+
+    return jsonDoc;
 }
 
 void BTCQuotePlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
 {
-    m_relevantResponsePart = jsonDoc["bpi"]["USD"]["rate"].as<String>() + " $/BTC";
-    m_relevantResponsePart.replace(",", "'");               // beautify to european(?) standard formatting ' for 1000s
-    
-    LOG_INFO("BTC/USD to print %s", m_relevantResponsePart.c_str());
+    String relevantResponsePart = jsonDoc["bpi"]["USD"]["rate"].as<String>() + " $/BTC";
 
-    m_textWidget.setFormatStr(m_relevantResponsePart);
-}
+    relevantResponsePart.replace(",", "'");                 // beautify to european(?) standard formatting ' for 1000s
 
-void BTCQuotePlugin::clearQueue()
-{
-    Msg msg;
+    LOG_INFO("BTC/USD to print %s", relevantResponsePart.c_str());
 
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
+    m_view->textWidget.setFormatStr(relevantResponsePart);
 }
 
 /******************************************************************************
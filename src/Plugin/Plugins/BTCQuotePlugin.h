@@ -42,16 +42,13 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
-#include "Plugin.hpp"
+#include "HttpPlugin.h"
 
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
 #include <stdint.h>
 #include <TextWidget.h>
 #include <SimpleTimer.hpp>
-#include <TaskProxy.hpp>
-#include <Mutex.hpp>
 
 /******************************************************************************
  * Macros
@@ -67,7 +64,7 @@
  *
  * Powered by CoinDesk - https://www.coindesk.com/price/bitcoin
  */
-class BTCQuotePlugin : public Plugin
+class BTCQuotePlugin : public HttpPlugin
 {
 public:
 
@@ -78,21 +75,12 @@ public:
      * @param[in] uid   Unique id
      */
     BTCQuotePlugin(const String& name, uint16_t uid) :
-        Plugin(name, uid),
-        m_textCanvas(),
-        m_iconCanvas(),
-        m_bitmapWidget(),
-        m_textWidget("\\calign?"),
-        m_relevantResponsePart(""),
-        m_client(),
-        m_mutex(),
-        m_requestTimer(),
-        m_taskProxy()
+        HttpPlugin(name, uid, parseResponse),
+        m_view(nullptr),
+        m_width(0U),
+        m_height(0U),
+        m_requestTimer()
     {
-        /* Move the text widget one line lower for better look. */
-        m_textWidget.move(0, 1);
-
-        (void)m_mutex.create();
     }
 
     /**
@@ -100,18 +88,7 @@ public:
      */
     ~BTCQuotePlugin()
     {
-        m_client.regOnResponse(nullptr);
-        m_client.regOnClosed(nullptr);
-        m_client.regOnError(nullptr);
-
-        /* Abort any pending TCP request to avoid getting a callback after the
-         * object is destroyed.
-         */
-        m_client.abort();
-        
-        clearQueue();
-
-        m_mutex.destroy();
+        destroyView();
     }
 
     /**
@@ -154,6 +131,14 @@ public:
      */
     void process(void) final;
 
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -190,46 +175,67 @@ private:
      */
     static const uint32_t   UPDATE_PERIOD_SHORT = (60U * 1000U);
 
-    WidgetGroup         m_textCanvas;               /**< Canvas used for the text widget. */
-    WidgetGroup         m_iconCanvas;               /**< Canvas used for the bitmap widget. */
-    BitmapWidget        m_bitmapWidget;             /**< Bitmap widget, used to show the icon. */
-    TextWidget          m_textWidget;               /**< Text widget, used for showing the text. */
-    String              m_relevantResponsePart;     /**< String used for the relevant part of the HTTP response. */
-    AsyncHttpClient     m_client;                   /**< Asynchronous HTTP client. */
-    MutexRecursive      m_mutex;                    /**< Mutex to protect against concurrent access. */
-    SimpleTimer         m_requestTimer;             /**< Timer is used for cyclic weather http request. */
-
     /**
-     * Defines the message types, which are necessary for HTTP client/server handling.
+     * Widgets, which are released during hibernation.
      */
-    enum MsgType
+    struct View
     {
-        MSG_TYPE_INVALID = 0,   /**< Invalid message type. */
-        MSG_TYPE_RSP            /**< A response, caused by a previous request. */
-    };
-
-    /**
-     * A message for HTTP client/server handling.
-     */
-    struct Msg
-    {
-        MsgType                 type;   /**< Message type */
-        DynamicJsonDocument*    rsp;    /**< Response, only valid if message type is a response. */
+        WidgetGroup             textCanvas;     /**< Canvas used for the text widget. */
+        WidgetGroup             iconCanvas;     /**< Canvas used for the bitmap widget. */
+        BitmapWidget            bitmapWidget;   /**< Bitmap widget, used to show the icon. */
+        TextWidget              textWidget;     /**< Text widget, used for showing the text. */
+        bool                    isIconLoaded;   /**< Is the icon loaded? */
 
         /**
-         * Constructs a message.
+         * Constructs the view.
          */
-        Msg() :
-            type(MSG_TYPE_INVALID),
-            rsp(nullptr)
+        View() :
+            textCanvas(),
+            iconCanvas(),
+            bitmapWidget(),
+            textWidget("\\calign?"),
+            isIconLoaded(false)
         {
+            /* Move the text widget one line lower for better look. */
+            textWidget.move(0, 1);
         }
-    }; 
+    };
+
+    View*               m_view;         /**< Widgets, nullptr during hibernation. */
+    uint16_t            m_width;        /**< Display width in pixel */
+    uint16_t            m_height;       /**< Display height in pixel */
+    SimpleTimer         m_requestTimer; /**< Timer is used for cyclic weather http request. */
 
     /**
-     * Task proxy used to decouple server responses, which happen in a different task context.
+     * Create the view with the icon and the text.
+     *
+     * @return If successful, it will return true otherwise false.
      */
-    TaskProxy<Msg, 2U, 0U> m_taskProxy;
+    bool createView() final;
+
+    /**
+     * Destroy the view.
+     */
+    void destroyView() final;
+
+    /**
+     * Load the icon, if it is not loaded yet.
+     */
+    void prepareView() final;
+
+    /**
+     * Get the shown text, which is kept during hibernation.
+     *
+     * @return Shown text
+     */
+    String getShownText() const final;
+
+    /**
+     * Restore the shown text after hibernation.
+     *
+     * @param[in] text  Shown text
+     */
+    void setShownText(const String& text) final;
 
     /**
      * Request new data.
@@ -239,9 +245,14 @@ private:
     bool startHttpRequest(void);
 
     /**
-     * Register callback function on response reception.
+     * Parse the server response.
+     * It runs in the HTTP client task context.
+     *
+     * @param[in] rsp   Server response
+     *
+     * @return If successful, it will return the JSON document otherwise nullptr.
      */
-    void initHttpClient(void);
+    static DynamicJsonDocument* parseResponse(const HttpResponse& rsp);
 
     /**
      * Handle a web response from the server.
@@ -249,11 +260,6 @@ private:
      * @param[in] jsonDoc   Web response as JSON document
      */
     void handleWebResponse(DynamicJsonDocument& jsonDoc);
-
-    /**
-     * Clear the task proxy queue.
-     */
-    void clearQueue();
 };
 
 /******************************************************************************
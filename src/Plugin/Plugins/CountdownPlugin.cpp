@@ -41,6 +41,7 @@
 #include <ArduinoJson.h>
 #include <Logging.h>
 #include <JsonFile.h>
+#include <BinaryConfigFile.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -58,6 +59,8 @@
  * Prototypes
  *****************************************************************************/
 
+static String cutUtf8(const String& str, size_t maxLength);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -166,48 +169,80 @@ void CountdownPlugin::start(uint16_t width, uint16_t height)
     {
         if (false == saveConfiguration())
         {
-            LOG_WARNING("Failed to create initial configuration file %s.", getFullPathToConfiguration().c_str());
+            LOG_WARNING("Failed to create initial configuration file %s.", getFullPathToBinaryConfiguration().c_str());
         }
     }
 
     calculateDifferenceInDays();
 
-    m_cfgReloadTimer.start(CFG_RELOAD_PERIOD);
+    m_dateUpdateTimer.start(DATE_UPDATE_PERIOD);
 
     return;
 }
 
 void CountdownPlugin::stop()
 {
-    String                      configurationFilename = getFullPathToConfiguration();
+    String                      configurationFilename       = getFullPathToConfiguration();
+    String                      binaryConfigurationFilename = getFullPathToBinaryConfiguration();
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    m_cfgReloadTimer.stop();
+    m_dateUpdateTimer.stop();
 
     if (false != FILESYSTEM.remove(configurationFilename))
     {
         LOG_INFO("File %s removed", configurationFilename.c_str());
     }
 
+    if (false != FILESYSTEM.remove(binaryConfigurationFilename))
+    {
+        LOG_INFO("File %s removed", binaryConfigurationFilename.c_str());
+    }
+
     return;
 }
 
-void CountdownPlugin::update(YAGfx& gfx)
+void CountdownPlugin::process()
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    if ((true == m_cfgReloadTimer.isTimerRunning()) &&
-        (true == m_cfgReloadTimer.isTimeout()))
+    /* The configuration is kept in memory and only reloaded, if the file
+     * was changed from outside.
+     */
+    if (true == consumeConfigurationChange())
     {
         (void)loadConfiguration();
         calculateDifferenceInDays();
+    }
+
+    return;
+}
+
+void CountdownPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    m_iconCanvas.invalidate();
+    m_textCanvas.invalidate();
+
+    return;
+}
+
+void CountdownPlugin::update(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if ((true == m_dateUpdateTimer.isTimerRunning()) &&
+        (true == m_dateUpdateTimer.isTimeout()))
+    {
+        calculateDifferenceInDays();
 
-        m_cfgReloadTimer.restart();
+        m_dateUpdateTimer.restart();
     }
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    (void)m_iconCanvas.updateInvalidated(gfx);
+    (void)m_textCanvas.updateInvalidated(gfx);
 
     return;
 }
@@ -233,6 +268,7 @@ void CountdownPlugin::setTargetDate(const DateDMY& targetDate)
         LOG_INFO("New target date: %04u-%02u-%02u", targetDate.year, targetDate.month, targetDate.day);
 
         m_targetDate = targetDate;
+        calculateDifferenceInDays();
 
         /* Always stores the configuration, otherwise it will be overwritten during
          * plugin activation.
@@ -263,6 +299,7 @@ void CountdownPlugin::setTargetDayDescription(const TargetDayDescription& target
         LOG_INFO("New unit description: \"%s\" / \"%s\"", targetDayDescription.plural.c_str(), targetDayDescription.singular.c_str());
 
         m_targetDateInformation = targetDayDescription;
+        calculateDifferenceInDays();
 
         /* Always stores the configuration, otherwise it will be overwritten during
          * plugin activation.
@@ -284,18 +321,21 @@ void CountdownPlugin::setTargetDayDescription(const TargetDayDescription& target
 bool CountdownPlugin::saveConfiguration() const
 {
     bool                status                  = true;
-    JsonFile            jsonFile(FILESYSTEM);
-    const size_t        JSON_DOC_SIZE           = 512U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-    String              configurationFilename   = getFullPathToConfiguration();
-
-    jsonDoc["day"]                  = m_targetDate.day;
-    jsonDoc["month"]                = m_targetDate.month;
-    jsonDoc["year"]                 = m_targetDate.year;
-    jsonDoc["descriptionPlural"]    = m_targetDateInformation.plural;
-    jsonDoc["descriptionSingular"]  = m_targetDateInformation.singular;
-    
-    if (false == jsonFile.save(configurationFilename, jsonDoc))
+    BinaryConfigFile    binaryConfigFile(FILESYSTEM);
+    uint8_t             buffer[CFG_BUFFER_SIZE];
+    BinaryConfig        binaryConfig(buffer, sizeof(buffer));
+    String              configurationFilename   = getFullPathToBinaryConfiguration();
+
+    /* Too long descriptions are cut, otherwise they can't be loaded anymore. */
+    binaryConfig.beginWrite(CFG_SCHEMA_VERSION);
+    binaryConfig.writeUInt8(m_targetDate.day);
+    binaryConfig.writeUInt8(m_targetDate.month);
+    binaryConfig.writeUInt16(m_targetDate.year);
+    binaryConfig.writeString(cutUtf8(m_targetDateInformation.plural, CFG_DESCRIPTION_SIZE - 1U).c_str());
+    binaryConfig.writeString(cutUtf8(m_targetDateInformation.singular, CFG_DESCRIPTION_SIZE - 1U).c_str());
+
+    if ((false == binaryConfig.endWrite()) ||
+        (false == binaryConfigFile.save(configurationFilename, binaryConfig)))
     {
         LOG_WARNING("Failed to save file %s.", configurationFilename.c_str());
         status = false;
@@ -309,6 +349,70 @@ bool CountdownPlugin::saveConfiguration() const
 }
 
 bool CountdownPlugin::loadConfiguration()
+{
+    bool    status                  = false;
+    String  configurationFilename   = getFullPathToConfiguration();
+
+    /* A JSON configuration, e.g. of a older firmware or uploaded via file
+     * REST API, has priority. It is converted once to the binary configuration,
+     * which is faster to load and needs less memory.
+     */
+    if (true == FILESYSTEM.exists(configurationFilename))
+    {
+        status = loadJsonConfiguration();
+
+        if ((true == status) &&
+            (true == saveConfiguration()))
+        {
+            LOG_INFO("File %s converted to binary configuration.", configurationFilename.c_str());
+            (void)FILESYSTEM.remove(configurationFilename);
+        }
+    }
+    else
+    {
+        status = loadBinaryConfiguration();
+    }
+
+    return status;
+}
+
+bool CountdownPlugin::loadBinaryConfiguration()
+{
+    bool                status                  = true;
+    BinaryConfigFile    binaryConfigFile(FILESYSTEM);
+    uint8_t             buffer[CFG_BUFFER_SIZE];
+    BinaryConfig        binaryConfig(buffer, sizeof(buffer));
+    String              configurationFilename   = getFullPathToBinaryConfiguration();
+
+    if (false == binaryConfigFile.load(configurationFilename, binaryConfig))
+    {
+        LOG_WARNING("Failed to load file %s.", configurationFilename.c_str());
+        status = false;
+    }
+    else
+    {
+        char description[CFG_DESCRIPTION_SIZE];
+
+        /* Fields, which are not available, keep their current value. */
+        (void)binaryConfig.readUInt8(m_targetDate.day);
+        (void)binaryConfig.readUInt8(m_targetDate.month);
+        (void)binaryConfig.readUInt16(m_targetDate.year);
+
+        if (true == binaryConfig.readString(description, sizeof(description)))
+        {
+            m_targetDateInformation.plural = description;
+        }
+
+        if (true == binaryConfig.readString(description, sizeof(description)))
+        {
+            m_targetDateInformation.singular = description;
+        }
+    }
+
+    return status;
+}
+
+bool CountdownPlugin::loadJsonConfiguration()
 {
     bool                status                  = true;
     JsonFile            jsonFile(FILESYSTEM);
@@ -420,3 +524,34 @@ uint32_t CountdownPlugin::dateToDays(const CountdownPlugin::DateDMY& date) const
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Cut a UTF-8 encoded string to a maximum length in bytes.
+ * The string is never cut inside a multi-byte character, otherwise the
+ * remaining invalid sequence would be shown as garbage.
+ *
+ * @param[in] str       UTF-8 encoded string
+ * @param[in] maxLength Max. length in bytes
+ *
+ * @return Cut string
+ */
+static String cutUtf8(const String& str, size_t maxLength)
+{
+    size_t length = str.length();
+
+    if (maxLength < length)
+    {
+        length = maxLength;
+
+        /* Continuation bytes (10xxxxxx) belong to the character before.
+         * Cut in front of the lead byte of the incomplete character.
+         */
+        while ((0U < length) &&
+               (0x80U == (static_cast<uint8_t>(str[length]) & 0xC0U)))
+        {
+            --length;
+        }
+    }
+
+    return str.substring(0U, length);
+}
@@ -65,8 +65,9 @@
 /**
  * Shows the remaining days until a configured target date.
  *
- * At the first installation a json document is generated to the /configuration/UUID.json
- * in the filesystem, where the target date has to be configured.
+ * At the first installation a binary configuration is generated to the /configuration/UUID.bin
+ * in the filesystem. The target date can be configured via REST API or by uploading a json
+ * document to /configuration/UUID.json, which will be converted to the binary configuration.
  *
  */
 class CountdownPlugin : public Plugin
@@ -186,7 +187,7 @@ public:
         m_targetDateInformation(),
         m_remainingDays(""),
         m_mutex(),
-        m_cfgReloadTimer()
+        m_dateUpdateTimer()
     {
         /* Example data, used to generate the very first configuration file. */
         m_targetDate.day                    = 29;
@@ -279,6 +280,32 @@ public:
      */
     void stop() final;
 
+    /**
+     * Process the plugin.
+     * If the configuration file was changed from outside, it will be reloaded.
+     */
+    void process() final;
+
+    /**
+     * Get the time in ms, until process() shall be called again.
+     * A configuration change is checked with the same period, as the
+     * remaining days are updated. There is nothing else to process.
+     *
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return DATE_UPDATE_PERIOD;
+    }
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -350,11 +377,26 @@ private:
     static const int16_t    TM_OFFSET_YEAR  = 1900;
 
     /**
-     * The configuration in the persistent memory shall be cyclic loaded.
-     * This mechanism ensure that manual changes in the file are considered.
-     * This is the reload period in ms.
+     * The remaining days shall be cyclic calculated, to consider the change
+     * of the current date. This is the update period in ms.
      */
-    static const uint32_t   CFG_RELOAD_PERIOD   = 30000U;
+    static const uint32_t   DATE_UPDATE_PERIOD  = 30000U;
+
+    /**
+     * Schema version of the binary configuration. Increase it, if fields
+     * are appended.
+     */
+    static const uint8_t    CFG_SCHEMA_VERSION  = 1U;
+
+    /**
+     * Binary configuration buffer size in byte.
+     */
+    static const size_t     CFG_BUFFER_SIZE     = 96U;
+
+    /**
+     * Max. size of a target day description in byte, including string termination.
+     */
+    static const size_t     CFG_DESCRIPTION_SIZE = 32U;
 
     WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
     WidgetGroup             m_iconCanvas;               /**< Canvas used for the bitmap widget. */
@@ -365,18 +407,29 @@ private:
     TargetDayDescription    m_targetDateInformation;    /**< String used for configured additional target date information. */
     String                  m_remainingDays;            /**< String used for displaying the remaining days untril the target date. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
-    SimpleTimer             m_cfgReloadTimer;           /**< Timer is used to cyclic reload the configuration from persistent memory. */
+    SimpleTimer             m_dateUpdateTimer;          /**< Timer is used to cyclic update the remaining days. */
 
     /**
-     * Saves current configuration to JSON file.
+     * Saves current configuration to binary configuration file.
      */
     bool saveConfiguration() const;
 
     /**
-     * Load configuration from JSON file.
+     * Load configuration. A JSON configuration file has priority and
+     * will be converted to the binary configuration file.
      */
     bool loadConfiguration();
 
+    /**
+     * Load configuration from binary configuration file.
+     */
+    bool loadBinaryConfiguration();
+
+    /**
+     * Load configuration from JSON file.
+     */
+    bool loadJsonConfiguration();
+
     /**
      * Calculates the difference between m_targetTime and m_currentTime in days.
      */
@@ -189,13 +189,14 @@ void DateTimePlugin::active(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
+    UTIL_NOT_USED(gfx);
+
     /* Force immediate date/time update on activation */
     updateDateTime(true);
 
-    /* Force drawing on display in the update() method for the very first time
-     * after activation.
-     */
-    m_isUpdateAvailable = true;
+    m_textCanvas.invalidate();
+    m_lampCanvas.invalidate();
+
     m_durationCounter = 0U;
     m_checkUpdateTimer.start(CHECK_UPDATE_PERIOD);
 }
@@ -213,14 +214,8 @@ void DateTimePlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    if (false != m_isUpdateAvailable)
-    {
-        gfx.fillScreen(ColorDef::BLACK);
-        m_textCanvas.update(gfx);
-        m_lampCanvas.update(gfx);
-
-        m_isUpdateAvailable = false;
-    }
+    (void)m_textCanvas.updateInvalidated(gfx);
+    (void)m_lampCanvas.updateInvalidated(gfx);
 
     return;
 }
@@ -343,7 +338,6 @@ void DateTimePlugin::updateDateTime(bool force)
 
             strftime(timeBuffer, sizeof(timeBuffer), formattedTimeString, &timeinfo);
             m_textWidget.setFormatStr(timeBuffer);
-            m_isUpdateAvailable = true;
         }
         else if (true == showDate)
         {
@@ -354,8 +348,6 @@ void DateTimePlugin::updateDateTime(bool force)
 
             strftime(dateBuffer, sizeof(dateBuffer), formattedDateString, &timeinfo);
             m_textWidget.setFormatStr(dateBuffer);
-
-            m_isUpdateAvailable = true;
         }
         else
         {
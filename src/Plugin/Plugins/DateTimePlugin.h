@@ -83,7 +83,6 @@ public:
         m_cfg(CFG_DATE_TIME),
         m_checkUpdateTimer(),
         m_durationCounter(0u),
-        m_isUpdateAvailable(false),
         m_slotInterf(nullptr),
         m_mutex()
 
@@ -187,6 +186,26 @@ public:
      */
     void process(void) final;
 
+    /**
+     * Get the time in ms, until process() shall be called again.
+     * The plugin has only to check for a date/time update, if the check
+     * update timer expires. If the plugin is inactive, the timer is stopped
+     * and it is checked in the regular period.
+     *
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        uint32_t period = m_checkUpdateTimer.getRemaining();
+
+        if (0U == period)
+        {
+            period = CHECK_UPDATE_PERIOD;
+        }
+
+        return period;
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -293,7 +312,6 @@ private:
     Cfg                     m_cfg;                      /**< Configuration about what shall be shown. */
     SimpleTimer             m_checkUpdateTimer;         /**< Timer, used for cyclic check if date/time update is necessarry. */
     uint8_t                 m_durationCounter;          /**< Variable to count the Plugin duration in CHECK_UPDATE_PERIOD ticks . */
-    bool                    m_isUpdateAvailable;        /**< Flag to indicate an updated date value. */
     const ISlotPlugin*      m_slotInterf;               /**< Slot interface */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
 
@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include "FirePlugin.h"
 
+#include <string.h>
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -60,6 +62,8 @@
 
 void FirePlugin::start(uint16_t width, uint16_t height)
 {
+    m_rng.seed(ESP.getCycleCount());
+
     if (nullptr == m_heat)
     {
         m_heatSize = width * height;
@@ -82,6 +86,52 @@ void FirePlugin::stop()
         m_heat = nullptr;
     }
 
+    m_heatBlob.release();
+
+    return;
+}
+
+bool FirePlugin::hibernate()
+{
+    bool isHibernated = true;
+
+    if (nullptr != m_heat)
+    {
+        /* Above the flames the air is mostly cold, which compresses well. */
+        uint8_t* blob = m_heatBlob.allocate(encodeHeat(nullptr));
+
+        /* Without the blob, the fire would go out. Stay awake instead. */
+        if (nullptr == blob)
+        {
+            isHibernated = false;
+        }
+        else
+        {
+            (void)encodeHeat(blob);
+
+            delete[] m_heat;
+            m_heat = nullptr;
+        }
+    }
+
+    return isHibernated;
+}
+
+void FirePlugin::wakeUp()
+{
+    if ((nullptr == m_heat) &&
+        (0U < m_heatSize))
+    {
+        m_heat = new(std::nothrow) uint8_t[m_heatSize];
+
+        /* The fire continues, where it was before hibernation. */
+        if (nullptr != m_heat)
+        {
+            decodeHeat(m_heatBlob.getData(), m_heatBlob.getSize());
+            m_heatBlob.release();
+        }
+    }
+
     return;
 }
 
@@ -114,7 +164,7 @@ void FirePlugin::update(YAGfx& gfx)
         /* Step 1) Cool down every cell a little bit */
         for(y = 0; y < gfx.getHeight(); ++y)
         {
-            uint8_t     coolDownTemperature = random(0, ((COOLING * 10U) / gfx.getHeight()) + 2U);
+            uint8_t     coolDownTemperature = m_rng.nextRange(((COOLING * 10U) / gfx.getHeight()) + 2U);
             uint32_t    heatPos             = x + y * gfx.getWidth();
 
             if (coolDownTemperature >= m_heat[heatPos])
@@ -151,9 +201,9 @@ void FirePlugin::update(YAGfx& gfx)
         }
 
         /* Step 3) Randomly ignite new 'sparks' of heat near the bottom */
-        if (random(0, 255) < SPARKING)
+        if (m_rng.nextRange(255U) < SPARKING)
         {
-            uint8_t     randValue   = random(160, 255);
+            uint8_t     randValue   = m_rng.nextRange(160U, 255U);
             uint32_t    heatPos     = x + (gfx.getHeight() - 1U) * gfx.getWidth();
             uint16_t    heat        = m_heat[heatPos] + randValue;
 
@@ -226,6 +276,70 @@ Color FirePlugin::heatColor(uint8_t temperature)
     return heatColor;
 }
 
+size_t FirePlugin::encodeHeat(uint8_t* dst) const
+{
+    size_t size = 0U;
+    size_t idx  = 0U;
+
+    while(m_heatSize > idx)
+    {
+        uint8_t temperature = m_heat[idx];
+        size_t  runLength   = 1U;
+
+        while(((idx + runLength) < m_heatSize) &&
+              (UINT8_MAX > runLength) &&
+              (temperature == m_heat[idx + runLength]))
+        {
+            ++runLength;
+        }
+
+        if (nullptr != dst)
+        {
+            dst[size + 0U] = static_cast<uint8_t>(runLength);
+            dst[size + 1U] = temperature;
+        }
+
+        size    += 2U;
+        idx     += runLength;
+    }
+
+    return size;
+}
+
+void FirePlugin::decodeHeat(const uint8_t* src, size_t size)
+{
+    size_t  srcIdx  = 0U;
+    size_t  idx     = 0U;
+
+    if (nullptr != src)
+    {
+        while(((srcIdx + 1U) < size) &&
+              (m_heatSize > idx))
+        {
+            size_t  runLength   = src[srcIdx + 0U];
+            uint8_t temperature = src[srcIdx + 1U];
+
+            if ((m_heatSize - idx) < runLength)
+            {
+                runLength = m_heatSize - idx;
+            }
+
+            memset(&m_heat[idx], temperature, runLength);
+
+            idx     += runLength;
+            srcIdx  += 2U;
+        }
+    }
+
+    /* Missing temperatures are cold. */
+    if (m_heatSize > idx)
+    {
+        memset(&m_heat[idx], 0, m_heatSize - idx);
+    }
+
+    return;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -45,6 +45,8 @@
  *****************************************************************************/
 #include <stdint.h>
 #include "Plugin.hpp"
+#include <XorShift.hpp>
+#include <StateBlob.h>
 
 /******************************************************************************
  * Macros
@@ -84,7 +86,9 @@ public:
     FirePlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
         m_heat(nullptr),
-        m_heatSize(0U)
+        m_heatSize(0U),
+        m_rng(),
+        m_heatBlob()
     {
     }
 
@@ -133,6 +137,21 @@ public:
      */
     void stop() final;
 
+    /**
+     * This method will be called if the slot of the plugin was not shown for
+     * a while. The heat temperatures are released and kept run-length encoded
+     * in a compact blob instead, so the fire continues after wake up.
+     *
+     * @return If hibernated, it will return true otherwise false.
+     */
+    bool hibernate() final;
+
+    /**
+     * This method will be called to restore the heat temperatures of the
+     * hibernated plugin.
+     */
+    void wakeUp() final;
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -159,6 +178,8 @@ private:
 
     uint8_t*    m_heat;     /**< Heat temperature [0; 255] */
     size_t      m_heatSize; /**< Number of heat temperatures */
+    XorShift32  m_rng;      /**< Random number generator, cheap enough to be used per cell */
+    StateBlob   m_heatBlob; /**< Run-length encoded heat temperatures during hibernation */
 
     /**
      * Cooling: How much does the air cool as it rises?
@@ -181,6 +202,25 @@ private:
      * spectrum, but it's surprisingly close, and it's fast and small.
      */
     Color heatColor(uint8_t temperature);
+
+    /**
+     * Run-length encode the heat temperatures. Every run is a pair of its
+     * length and the temperature.
+     *
+     * @param[out] dst  Destination buffer or nullptr to determine the size only.
+     *
+     * @return Encoded size in byte
+     */
+    size_t encodeHeat(uint8_t* dst) const;
+
+    /**
+     * Decode the run-length encoded heat temperatures.
+     * Missing temperatures are cold.
+     *
+     * @param[in] src   Encoded heat temperatures
+     * @param[in] size  Size in byte
+     */
+    void decodeHeat(const uint8_t* src, size_t size);
 };
 
 /******************************************************************************
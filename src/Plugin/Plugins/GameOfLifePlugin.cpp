@@ -76,6 +76,24 @@ void GameOfLifePlugin::stop()
     return;
 }
 
+bool GameOfLifePlugin::hibernate()
+{
+    destroyGrids();
+
+    return true;
+}
+
+void GameOfLifePlugin::wakeUp()
+{
+    /* The grids are allocated and released always together. */
+    if (nullptr == m_grids[0U])
+    {
+        (void)createGrids();
+    }
+
+    return;
+}
+
 void GameOfLifePlugin::active(YAGfx& gfx)
 {
     uint8_t index   = 0U;
@@ -142,6 +142,20 @@ public:
      */
     void stop() final;
 
+    /**
+     * This method will be called if the slot of the plugin was not shown for
+     * a while. The grids are released, because a new initial pattern is
+     * generated anyway, when the plugin is activated again.
+     *
+     * @return If hibernated, it will return true otherwise false.
+     */
+    bool hibernate() final;
+
+    /**
+     * This method will be called to restore the grids of the hibernated plugin.
+     */
+    void wakeUp() final;
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -126,16 +126,16 @@ void GithubPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_stdIconWidget);
+    m_width     = width;
+    m_height    = height;
 
     /* Load all icons from filesystem now, to prevent filesystem
      * access during active/inactive/update methods.
      */
-    (void)m_stdIconWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        prepareView();
+    }
 
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
@@ -148,11 +148,15 @@ void GithubPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         /* If a request fails, show standard icon and a '?' */
-        m_textWidget.setFormatStr("\\calign?");
+        if (nullptr != m_view)
+        {
+            m_view->textWidget.setFormatStr("\\calign?");
+        }
+
+        m_isDataValid = false;
 
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
     }
@@ -184,13 +188,16 @@ void GithubPlugin::process()
     Msg                         msg;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    if ((true == m_requestTimer.isTimerRunning()) &&
+    /* During hibernation, a expired request is deferred until wake-up. */
+    if ((nullptr != m_view) &&
+        (true == m_requestTimer.isTimerRunning()) &&
         (true == m_requestTimer.isTimeout()))
     {
         if (false == startHttpRequest())
         {
             /* If a request fails, show standard icon and a '?' */
-            m_textWidget.setFormatStr("\\calign?");
+            m_view->textWidget.setFormatStr("\\calign?");
+            m_isDataValid = false;
 
             m_requestTimer.start(UPDATE_PERIOD_SHORT);
         }
@@ -200,7 +207,8 @@ void GithubPlugin::process()
         }
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if ((nullptr != m_view) &&
+        (true == receiveMsg(msg)))
     {
         switch(msg.type)
         {
@@ -223,7 +231,8 @@ void GithubPlugin::process()
             if (true == m_isConnectionError)
             {
                 /* If a request fails, show standard icon and a '?' */
-                m_textWidget.setFormatStr("\\calign?");
+                m_view->textWidget.setFormatStr("\\calign?");
+                m_isDataValid = false;
 
                 m_requestTimer.start(UPDATE_PERIOD_SHORT);
             }
@@ -244,13 +253,37 @@ void GithubPlugin::process()
     return;
 }
 
+bool GithubPlugin::isReady() const
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    return m_isDataValid;
+}
+
+void GithubPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
+
+    return;
+}
+
 void GithubPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    if (nullptr != m_view)
+    {
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
+        (void)m_view->textCanvas.updateInvalidated(gfx);
+    }
 
     return;
 }
@@ -317,18 +350,72 @@ void GithubPlugin::setRepository(const String& name)
  * Private Methods
  *****************************************************************************/
 
+bool GithubPlugin::createView()
+{
+    if (nullptr == m_view)
+    {
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+            (void)m_view->iconCanvas.addWidget(m_view->stdIconWidget);
+
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
+
+    return (nullptr != m_view);
+}
+
+void GithubPlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
+    }
+
+    return;
+}
+
+void GithubPlugin::prepareView()
+{
+    if (false == m_view->isIconLoaded)
+    {
+        m_view->isIconLoaded = m_view->stdIconWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
+    }
+
+    return;
+}
+
+String GithubPlugin::getShownText() const
+{
+    return m_view->textWidget.getFormatStr();
+}
+
+void GithubPlugin::setShownText(const String& text)
+{
+    m_view->textWidget.setFormatStr(text);
+
+    return;
+}
+
 bool GithubPlugin::startHttpRequest()
 {
-    bool status = false;
+    bool                status  = false;
+    AsyncHttpClient*    client  = getHttpClient();
 
-    if ((0 < m_githubUser.length()) &&
+    if ((nullptr != client) &&
+        (0 < m_githubUser.length()) &&
         (0 < m_githubRepository.length()))
     {
         String url = String("https://api.github.com/repos/") + m_githubUser + "/" + m_githubRepository;
 
-        if (true == m_client.begin(url))
+        if (true == client->begin(url))
         {
-            if (false == m_client.GET())
+            if (false == client->GET())
             {
                 LOG_WARNING("GET %s failed.", url.c_str());
             }
@@ -342,77 +429,38 @@ bool GithubPlugin::startHttpRequest()
     return status;
 }
 
-void GithubPlugin::initHttpClient()
+DynamicJsonDocument* GithubPlugin::parseResponse(const HttpResponse& rsp)
 {
-    /* Note: All registered callbacks are running in a different task context!
-     *       Therefore it is not allowed to access a member here directly.
-     *       The processing must be deferred via task proxy.
-     */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
-        {
-            const size_t            JSON_DOC_SIZE   = 512U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+    const size_t            JSON_DOC_SIZE   = 512U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
 
-            if (nullptr != jsonDoc)
-            {
-                size_t                          payloadSize = 0U;
-                const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                const size_t                    FILTER_SIZE = 128U;
-                StaticJsonDocument<FILTER_SIZE> filter;
-                DeserializationError            error;
-
-                filter["stargazers_count"] = true;
-                
-                if (true == filter.overflowed())
-                {
-                    LOG_ERROR("Less memory for filter available.");
-                }
-
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
-
-                if (DeserializationError::Ok != error.code())
-                {
-                    LOG_WARNING("JSON parse error: %s", error.c_str());
-                }
-                else
-                {
-                    Msg msg;
-
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
-
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
-            }
-        }
-    );
+    if (nullptr != jsonDoc)
+    {
+        size_t                          payloadSize = 0U;
+        const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        const size_t                    FILTER_SIZE = 128U;
+        StaticJsonDocument<FILTER_SIZE> filter;
+        DeserializationError            error;
 
-    m_client.regOnClosed(
-        [this]()
+        filter["stargazers_count"] = true;
+        
+        if (true == filter.overflowed())
         {
-            Msg msg;
-
-            msg.type = MSG_TYPE_CONN_CLOSED;
-
-            (void)this->m_taskProxy.send(msg);
+            LOG_ERROR("Less memory for filter available.");
         }
-    );
 
-    m_client.regOnError(
-        [this]()
-        {
-            Msg msg;
+        error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
 
-            msg.type = MSG_TYPE_CONN_ERROR;
+        if (DeserializationError::Ok != error.code())
+        {
+            LOG_WARNING("JSON parse error: %s", error.c_str());
 
-            (void)this->m_taskProxy.send(msg);
+            delete jsonDoc;
+            jsonDoc = nullptr;
         }
-    );
+    }
+
+    return jsonDoc;
 }
 
 void GithubPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -428,7 +476,8 @@ void GithubPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
         
         info += stargazersCount;
 
-        m_textWidget.setFormatStr(info);
+        m_view->textWidget.setFormatStr(info);
+        m_isDataValid = true;
     }
 }
 
@@ -488,20 +537,6 @@ bool GithubPlugin::loadConfiguration()
     return status;
 }
 
-void GithubPlugin::clearQueue()
-{
-    Msg msg;
-
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -44,14 +44,11 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
-#include "Plugin.hpp"
-#include "AsyncHttpClient.h"
+#include "HttpPlugin.h"
 
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
 #include <TextWidget.h>
-#include <TaskProxy.hpp>
-#include <Mutex.hpp>
 
 /******************************************************************************
  * Macros
@@ -64,7 +61,7 @@
 /**
  * Shows the current number of stars, of the given github repository.
  */
-class GithubPlugin : public Plugin
+class GithubPlugin : public HttpPlugin
 {
 public:
 
@@ -75,25 +72,18 @@ public:
      * @param[in] uid   Unique id
      */
     GithubPlugin(const String& name, uint16_t uid) :
-        Plugin(name, uid),
-        m_textCanvas(),
-        m_iconCanvas(),
-        m_stdIconWidget(),
-        m_textWidget("\\calign?"),
+        HttpPlugin(name, uid, parseResponse),
         m_githubUser("BlueAndi"),
         m_githubRepository("esp-rgb-led-matrix"),
         m_urlIcon(),
         m_urlText(),
-        m_client(),
         m_requestTimer(),
-        m_mutex(),
         m_isConnectionError(false),
-        m_taskProxy()
+        m_isDataValid(false),
+        m_view(nullptr),
+        m_width(0U),
+        m_height(0U)
     {
-        /* Move the text widget one line lower for better look. */
-        m_textWidget.move(0, 1);
-
-        (void)m_mutex.create();
     }
 
     /**
@@ -101,18 +91,7 @@ public:
      */
     ~GithubPlugin()
     {
-        m_client.regOnResponse(nullptr);
-        m_client.regOnClosed(nullptr);
-        m_client.regOnError(nullptr);
-
-        /* Abort any pending TCP request to avoid getting a callback after the
-         * object is destroyed.
-         */
-        m_client.abort();
-        
-        clearQueue();
-
-        m_mutex.destroy();
+        destroyView();
     }
 
     /**
@@ -192,6 +171,22 @@ public:
      */
     void process(void) final;
 
+    /**
+     * Is the plugin ready to be shown?
+     * It is only ready if the last request was successful, otherwise its slot is skipped.
+     *
+     * @return If ready, it will return true otherwise false.
+     */
+    bool isReady() const final;
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -262,52 +257,74 @@ private:
      */
     static const uint32_t   UPDATE_PERIOD_SHORT = (10U * 1000U);
 
-    WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
-    WidgetGroup             m_iconCanvas;               /**< Canvas used for the bitmap widget. */
-    BitmapWidget            m_stdIconWidget;            /**< Bitmap widget, used to show the standard icon. */
-    TextWidget              m_textWidget;               /**< Text widget, used for showing the text. */
     String                  m_githubUser;               /**< The github user name */
     String                  m_githubRepository;         /**< The github repository name */
     String                  m_urlIcon;                  /**< REST API URL for updating the icon */
     String                  m_urlText;                  /**< REST API URL for updating the text */
-    AsyncHttpClient         m_client;                   /**< Asynchronous HTTP client. */
     SimpleTimer             m_requestTimer;             /**< Timer used for cyclic request of new data. */
-    mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                    m_isConnectionError;        /**< Is connection error happened? */
+    bool                    m_isDataValid;              /**< Is the shown information valid? */
 
     /**
-     * Defines the message types, which are necessary for HTTP client/server handling.
-     */
-    enum MsgType
-    {
-        MSG_TYPE_INVALID = 0,   /**< Invalid message type. */
-        MSG_TYPE_RSP,           /**< A response, caused by a previous request. */
-        MSG_TYPE_CONN_CLOSED,   /**< The connection is closed. */
-        MSG_TYPE_CONN_ERROR     /**< A connection error happened. */
-    };
-
-    /**
-     * A message for HTTP client/server handling.
+     * Widgets, which are released during hibernation.
      */
-    struct Msg
+    struct View
     {
-        MsgType                 type;   /**< Message type */
-        DynamicJsonDocument*    rsp;    /**< Response, only valid if message type is a response. */
+        WidgetGroup             textCanvas;     /**< Canvas used for the text widget. */
+        WidgetGroup             iconCanvas;     /**< Canvas used for the bitmap widget. */
+        BitmapWidget            stdIconWidget;  /**< Bitmap widget, used to show the standard icon. */
+        TextWidget              textWidget;     /**< Text widget, used for showing the text. */
+        bool                    isIconLoaded;   /**< Is the icon loaded? */
 
         /**
-         * Constructs a message.
+         * Constructs the view.
          */
-        Msg() :
-            type(MSG_TYPE_INVALID),
-            rsp(nullptr)
+        View() :
+            textCanvas(),
+            iconCanvas(),
+            stdIconWidget(),
+            textWidget("\\calign?"),
+            isIconLoaded(false)
         {
+            /* Move the text widget one line lower for better look. */
+            textWidget.move(0, 1);
         }
-    }; 
+    };
+
+    View*                   m_view;                     /**< Widgets, nullptr during hibernation. */
+    uint16_t                m_width;                    /**< Display width in pixel */
+    uint16_t                m_height;                   /**< Display height in pixel */
 
     /**
-     * Task proxy used to decouple server responses, which happen in a different task context.
+     * Create the view with the icon and the text.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool createView() final;
+
+    /**
+     * Destroy the view.
+     */
+    void destroyView() final;
+
+    /**
+     * Load the icon, if it is not loaded yet.
+     */
+    void prepareView() final;
+
+    /**
+     * Get the shown text, which is kept during hibernation.
+     *
+     * @return Shown text
+     */
+    String getShownText() const final;
+
+    /**
+     * Restore the shown text after hibernation.
+     *
+     * @param[in] text  Shown text
      */
-    TaskProxy<Msg, 2U, 0U> m_taskProxy;
+    void setShownText(const String& text) final;
 
     /**
      * Request new data.
@@ -317,9 +334,14 @@ private:
     bool startHttpRequest(void);
 
     /**
-     * Register callback function on response reception.
+     * Parse the server response.
+     * It runs in the HTTP client task context.
+     *
+     * @param[in] rsp   Server response
+     *
+     * @return If successful, it will return the JSON document otherwise nullptr.
      */
-    void initHttpClient(void);
+    static DynamicJsonDocument* parseResponse(const HttpResponse& rsp);
 
     /**
      * Handle a web response from the server.
@@ -337,11 +359,6 @@ private:
      * Load configuration from JSON file.
      */
     bool loadConfiguration();
-
-    /**
-     * Clear the task proxy queue.
-     */
-    void clearQueue();
 };
 
 /******************************************************************************
@@ -119,13 +119,13 @@ void GruenbeckPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    m_width     = width;
+    m_height    = height;
 
-    (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        prepareView();
+    }
 
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
@@ -138,11 +138,13 @@ void GruenbeckPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         /* If a request fails, show a '?' */
-        m_textWidget.setFormatStr("\\calign?");
+        if (nullptr != m_view)
+        {
+            m_view->textWidget.setFormatStr("\\calign?");
+        }
 
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
     }
@@ -174,13 +176,15 @@ void GruenbeckPlugin::process()
     Msg                         msg;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    if ((true == m_requestTimer.isTimerRunning()) &&
+    /* During hibernation, a expired request is deferred until wake-up. */
+    if ((nullptr != m_view) &&
+        (true == m_requestTimer.isTimerRunning()) &&
         (true == m_requestTimer.isTimeout()))
     {
         if (false == startHttpRequest())
         {
             /* If a request fails, show a '?' */
-            m_textWidget.setFormatStr("\\calign?");
+            m_view->textWidget.setFormatStr("\\calign?");
 
             m_requestTimer.start(UPDATE_PERIOD_SHORT);
         }
@@ -190,7 +194,8 @@ void GruenbeckPlugin::process()
         }
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if ((nullptr != m_view) &&
+        (true == receiveMsg(msg)))
     {
         switch(msg.type)
         {
@@ -213,7 +218,7 @@ void GruenbeckPlugin::process()
             if (true == m_isConnectionError)
             {
                 /* If a request fails, show a '?' */
-                m_textWidget.setFormatStr("\\calign?");
+                m_view->textWidget.setFormatStr("\\calign?");
 
                 m_requestTimer.start(UPDATE_PERIOD_SHORT);
             }
@@ -238,9 +243,13 @@ void GruenbeckPlugin::active(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    UTIL_NOT_USED(gfx);
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
 
     return;
 }
@@ -255,17 +264,19 @@ void GruenbeckPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    if (false != m_httpResponseReceived)
+    if (nullptr != m_view)
     {
-        m_textWidget.setFormatStr("\\calign" + m_relevantResponsePart + "%");
-        
-        gfx.fillScreen(ColorDef::BLACK);
-        m_iconCanvas.update(gfx);
-        m_textCanvas.update(gfx);
+        if (false != m_httpResponseReceived)
+        {
+            m_view->textWidget.setFormatStr("\\calign" + m_relevantResponsePart + "%");
+
+            m_relevantResponsePart = "";
 
-        m_relevantResponsePart = "";
+            m_httpResponseReceived = false;
+        }
 
-        m_httpResponseReceived = false;
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
+        (void)m_view->textCanvas.updateInvalidated(gfx);
     }
 
     return;
@@ -299,20 +310,74 @@ void GruenbeckPlugin::setIPAddress(const String& ipAddress)
  * Private Methods
  *****************************************************************************/
 
+bool GruenbeckPlugin::createView()
+{
+    if (nullptr == m_view)
+    {
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+            (void)m_view->iconCanvas.addWidget(m_view->bitmapWidget);
+
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
+
+    return (nullptr != m_view);
+}
+
+void GruenbeckPlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
+    }
+
+    return;
+}
+
+void GruenbeckPlugin::prepareView()
+{
+    if (false == m_view->isIconLoaded)
+    {
+        m_view->isIconLoaded = m_view->bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
+    }
+
+    return;
+}
+
+String GruenbeckPlugin::getShownText() const
+{
+    return m_view->textWidget.getFormatStr();
+}
+
+void GruenbeckPlugin::setShownText(const String& text)
+{
+    m_view->textWidget.setFormatStr(text);
+
+    return;
+}
+
 bool GruenbeckPlugin::startHttpRequest()
 {
-    bool status  = false;
+    bool                status  = false;
+    AsyncHttpClient*    client  = getHttpClient();
 
-    if (0 < m_ipAddress.length())
+    if ((nullptr != client) &&
+        (0 < m_ipAddress.length()))
     {
         String url = String("http://") + m_ipAddress + "/mux_http";
 
-        if (true == m_client.begin(url))
+        if (true == client->begin(url))
         {
-            m_client.addPar("id","42");
-            m_client.addPar("show","D_Y_10_1~");
+            client->addPar("id","42");
+            client->addPar("show","D_Y_10_1~");
 
-            if (false == m_client.POST())
+            if (false == client->POST())
             {
                 LOG_WARNING("POST %s failed.", url.c_str());
             }
@@ -326,82 +391,47 @@ bool GruenbeckPlugin::startHttpRequest()
     return status;
 }
 
-void GruenbeckPlugin::initHttpClient()
+DynamicJsonDocument* GruenbeckPlugin::parseResponse(const HttpResponse& rsp)
 {
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
-        {
-            const size_t            JSON_DOC_SIZE   = 256U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
-
-            if (nullptr != jsonDoc)
-            {
-                /* Structure of response-payload for requesting D_Y_10_1
-                *
-                * <data><code>ok</code><D_Y_10_1>XYZ</D_Y_10_1></data>
-                *
-                * <data><code>ok</code><D_Y_10_1>  = 31 bytes
-                * XYZ                              = 3 byte (relevant data)
-                * </D_Y_10_1></data>               = 18 bytes
-                */
-
-                /* Start index of relevant data */
-                const uint32_t  START_INDEX_OF_RELEVANT_DATA    = 31U;
-
-                /* Length of relevant data */
-                const uint32_t  RELEVANT_DATA_LENGTH            = 3U;
-
-                size_t          payloadSize                     = 0U;
-                const char*     payload                         = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                char            restCapacity[RELEVANT_DATA_LENGTH + 1];
-                Msg             msg;
-
-                if (payloadSize >= (START_INDEX_OF_RELEVANT_DATA + RELEVANT_DATA_LENGTH))
-                {
-                    memcpy(restCapacity, &payload[START_INDEX_OF_RELEVANT_DATA], RELEVANT_DATA_LENGTH);
-                    restCapacity[RELEVANT_DATA_LENGTH] = '\0';
-                }
-                else
-                {
-                    restCapacity[0] = '?';
-                    restCapacity[1] = '\0';
-                }
-
-                (*jsonDoc)["restCapacity"] = restCapacity;
-
-                msg.type    = MSG_TYPE_RSP;
-                msg.rsp     = jsonDoc;
-
-                if (false == this->m_taskProxy.send(msg))
-                {
-                    delete jsonDoc;
-                    jsonDoc = nullptr;
-                }
-            }
-        }
-    );
+    const size_t            JSON_DOC_SIZE   = 256U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
 
-    m_client.regOnClosed(
-        [this]()
+    if (nullptr != jsonDoc)
+    {
+        /* Structure of response-payload for requesting D_Y_10_1
+        *
+        * <data><code>ok</code><D_Y_10_1>XYZ</D_Y_10_1></data>
+        *
+        * <data><code>ok</code><D_Y_10_1>  = 31 bytes
+        * XYZ                              = 3 byte (relevant data)
+        * </D_Y_10_1></data>               = 18 bytes
+        */
+
+        /* Start index of relevant data */
+        const uint32_t  START_INDEX_OF_RELEVANT_DATA    = 31U;
+
+        /* Length of relevant data */
+        const uint32_t  RELEVANT_DATA_LENGTH            = 3U;
+
+        size_t          payloadSize                     = 0U;
+        const char*     payload                         = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        char            restCapacity[RELEVANT_DATA_LENGTH + 1];
+
+        if (payloadSize >= (START_INDEX_OF_RELEVANT_DATA + RELEVANT_DATA_LENGTH))
         {
-            Msg msg;
-
-            msg.type = MSG_TYPE_CONN_CLOSED;
-
-            (void)this->m_taskProxy.send(msg);
+            memcpy(restCapacity, &payload[START_INDEX_OF_RELEVANT_DATA], RELEVANT_DATA_LENGTH);
+            restCapacity[RELEVANT_DATA_LENGTH] = '\0';
         }
-    );
-
-    m_client.regOnError(
-        [this]()
+        else
         {
-            Msg msg;
+            restCapacity[0] = '?';
+            restCapacity[1] = '\0';
+        }
 
-            msg.type = MSG_TYPE_CONN_ERROR;
+        (*jsonDoc)["restCapacity"] = restCapacity;
+    }
 
-            (void)this->m_taskProxy.send(msg);
-        }
-    );
+    return jsonDoc;
 }
 
 void GruenbeckPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -461,20 +491,6 @@ bool GruenbeckPlugin::loadConfiguration()
     return status;
 }
 
-void GruenbeckPlugin::clearQueue()
-{
-    Msg msg;
-
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
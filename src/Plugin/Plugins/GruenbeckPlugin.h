@@ -44,14 +44,11 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
 #include <stdint.h>
-#include "Plugin.hpp"
+#include "HttpPlugin.h"
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
 #include <TextWidget.h>
-#include <TaskProxy.hpp>
-#include <Mutex.hpp>
 
 /******************************************************************************
  * Macros
@@ -65,7 +62,7 @@
  * Shows the remaining system capacity (parameter = D_Y_10_1 ) 
  * of the Gruenbeck softliQ SC18 via the system's RESTful webservice.
  */
-class GruenbeckPlugin : public Plugin
+class GruenbeckPlugin : public HttpPlugin
 {
 public:
 
@@ -76,24 +73,16 @@ public:
      * @param[in] uid   Unique id
      */
     GruenbeckPlugin(const String& name, uint16_t uid) :
-        Plugin(name, uid),
-        m_textCanvas(),
-        m_iconCanvas(),
-        m_bitmapWidget(),
-        m_textWidget("\\calign?"),
+        HttpPlugin(name, uid, parseResponse),
         m_ipAddress("192.168.0.16"),
         m_httpResponseReceived(false),
         m_relevantResponsePart(),
-        m_client(),
         m_requestTimer(),
-        m_mutex(),
         m_isConnectionError(false),
-        m_taskProxy()
+        m_view(nullptr),
+        m_width(0U),
+        m_height(0U)
     {
-        /* Move the text widget one line lower for better look. */
-        m_textWidget.move(0, 1);
-
-        (void)m_mutex.create();
     }
 
     /**
@@ -101,18 +90,7 @@ public:
      */
     ~GruenbeckPlugin()
     {
-        m_client.regOnResponse(nullptr);
-        m_client.regOnClosed(nullptr);
-        m_client.regOnError(nullptr);
-
-        /* Abort any pending TCP request to avoid getting a callback after the
-         * object is destroyed.
-         */
-        m_client.abort();
-        
-        clearQueue();
-
-        m_mutex.destroy();
+        destroyView();
     }
 
     /**
@@ -262,51 +240,72 @@ private:
      */
     static const uint32_t   UPDATE_PERIOD_SHORT = (10U * 1000U);
 
-    WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
-    WidgetGroup             m_iconCanvas;               /**< Canvas used for the bitmap widget. */
-    BitmapWidget            m_bitmapWidget;             /**< Bitmap widget, used to show the icon. */
-    TextWidget              m_textWidget;               /**< Text widget, used for showing the text. */
     String                  m_ipAddress;                /**< IP-address of the Gruenbeck server. */
     bool                    m_httpResponseReceived;     /**< Flag to indicate a received HTTP response. */
     String                  m_relevantResponsePart;     /**< String used for the relevant part of the HTTP response. */
-    AsyncHttpClient         m_client;                   /**< Asynchronous HTTP client. */
     SimpleTimer             m_requestTimer;             /**< Timer, used for cyclic request of new data. */
-    mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                    m_isConnectionError;        /**< Is connection error happened? */
 
     /**
-     * Defines the message types, which are necessary for HTTP client/server handling.
-     */
-    enum MsgType
-    {
-        MSG_TYPE_INVALID = 0,   /**< Invalid message type. */
-        MSG_TYPE_RSP,           /**< A response, caused by a previous request. */
-        MSG_TYPE_CONN_CLOSED,   /**< The connection is closed. */
-        MSG_TYPE_CONN_ERROR     /**< A connection error happened. */
-    };
-
-    /**
-     * A message for HTTP client/server handling.
+     * Widgets, which are released during hibernation.
      */
-    struct Msg
+    struct View
     {
-        MsgType                 type;   /**< Message type */
-        DynamicJsonDocument*    rsp;    /**< Response, only valid if message type is a response. */
+        WidgetGroup             textCanvas;     /**< Canvas used for the text widget. */
+        WidgetGroup             iconCanvas;     /**< Canvas used for the bitmap widget. */
+        BitmapWidget            bitmapWidget;   /**< Bitmap widget, used to show the icon. */
+        TextWidget              textWidget;     /**< Text widget, used for showing the text. */
+        bool                    isIconLoaded;   /**< Is the icon loaded? */
 
         /**
-         * Constructs a message.
+         * Constructs the view.
          */
-        Msg() :
-            type(MSG_TYPE_INVALID),
-            rsp(nullptr)
+        View() :
+            textCanvas(),
+            iconCanvas(),
+            bitmapWidget(),
+            textWidget("\\calign?"),
+            isIconLoaded(false)
         {
+            /* Move the text widget one line lower for better look. */
+            textWidget.move(0, 1);
         }
-    }; 
+    };
+
+    View*                   m_view;                     /**< Widgets, nullptr during hibernation. */
+    uint16_t                m_width;                    /**< Display width in pixel */
+    uint16_t                m_height;                   /**< Display height in pixel */
+
+    /**
+     * Create the view with the icon and the text.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool createView() final;
 
     /**
-     * Task proxy used to decouple server responses, which happen in a different task context.
+     * Destroy the view.
      */
-    TaskProxy<Msg, 2U, 0U> m_taskProxy;
+    void destroyView() final;
+
+    /**
+     * Load the icon, if it is not loaded yet.
+     */
+    void prepareView() final;
+
+    /**
+     * Get the shown text, which is kept during hibernation.
+     *
+     * @return Shown text
+     */
+    String getShownText() const final;
+
+    /**
+     * Restore the shown text after hibernation.
+     *
+     * @param[in] text  Shown text
+     */
+    void setShownText(const String& text) final;
 
     /**
      * Request new data.
@@ -316,9 +315,14 @@ private:
     bool startHttpRequest(void);
 
     /**
-     * Register callback function on response reception.
+     * Parse the server response.
+     * It runs in the HTTP client task context.
+     *
+     * @param[in] rsp   Server response
+     *
+     * @return If successful, it will return the JSON document otherwise nullptr.
      */
-    void initHttpClient(void);
+    static DynamicJsonDocument* parseResponse(const HttpResponse& rsp);
 
     /**
      * Handle a web response from the server.
@@ -336,11 +340,6 @@ private:
      * Load configuration from JSON file.
      */
     bool loadConfiguration();
-
-    /**
-     * Clear the task proxy queue.
-     */
-    void clearQueue();
 };
 
 /******************************************************************************
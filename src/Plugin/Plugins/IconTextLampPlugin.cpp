@@ -38,6 +38,8 @@
 
 #include <Logging.h>
 #include <ArduinoJson.h>
+#include <PackedImgLoader.h>
+#include <IconStore.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -71,12 +73,24 @@ const char* IconTextLampPlugin::TOPIC_LAMP              = "/lamp";
 /* Initialize plugin topic. */
 const char* IconTextLampPlugin::TOPIC_ICON              = "/bitmap";
 
+/* Initialize plugin topic. */
+const char* IconTextLampPlugin::TOPIC_LAYOUT            = "/layout";
+
 /* Initialize bitmap image filename extension. */
 const char* IconTextLampPlugin::FILE_EXT_BITMAP         = ".bmp";
 
+/* Initialize packed image filename extension. */
+const char* IconTextLampPlugin::FILE_EXT_PACKED_IMG     = ".pim";
+
 /* Initialize sprite sheet parameter filename extension. */
 const char* IconTextLampPlugin::FILE_EXT_SPRITE_SHEET   = ".sprite";
 
+/* Initialize layout filename extension. */
+const char* IconTextLampPlugin::FILE_EXT_LAYOUT         = ".wly";
+
+/* Initialize default layout filename. */
+const char* IconTextLampPlugin::DEFAULT_LAYOUT          = "/layouts/iconTextLamp.wly";
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -94,6 +108,7 @@ void IconTextLampPlugin::getTopics(JsonArray& topics) const
     }
 
     (void)topics.add(TOPIC_ICON);
+    (void)topics.add(TOPIC_LAYOUT);
 }
 
 bool IconTextLampPlugin::getTopic(const String& topic, JsonObject& value) const
@@ -208,6 +223,16 @@ bool IconTextLampPlugin::setTopic(const String& topic, const JsonObject& value)
             isSuccessful = loadBitmap(fullPath);
         }
     }
+    else if (0U != topic.equals(TOPIC_LAYOUT))
+    {
+        if (false == value["fullPath"].isNull())
+        {
+            String                      fullPath = value["fullPath"].as<String>();
+            MutexGuard<MutexRecursive>  guard(m_mutex);
+
+            isSuccessful = loadLayout(fullPath);
+        }
+    }
     else
     {
         ;
@@ -242,6 +267,20 @@ bool IconTextLampPlugin::isUploadAccepted(const String& topic, const String& src
             ;
         }
     }
+    else if (0U != topic.equals(TOPIC_LAYOUT))
+    {
+        /* Accept upload of a compiled layout file. */
+        if (0U != srcFilename.endsWith(FILE_EXT_LAYOUT))
+        {
+            dstFilename = getFileName(FILE_EXT_LAYOUT);
+
+            isAccepted = true;
+        }
+    }
+    else
+    {
+        ;
+    }
 
     return isAccepted;
 }
@@ -249,73 +288,90 @@ bool IconTextLampPlugin::isUploadAccepted(const String& topic, const String& src
 void IconTextLampPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive>  guard(m_mutex);
-    uint16_t                    lampWidth       = 0U;
-    uint16_t                    lampDistance    = 0U;
-    const uint16_t              minDistance     = 1U;   /* Min. distance between lamps. */
-    const uint16_t              minBorder       = 1U;   /* Min. border left and right of all lamps. */
-    const uint16_t              canvasWidth     = width - ICON_WIDTH;
+    String                      layoutFilename  = getFileName(FILE_EXT_LAYOUT);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    UTIL_NOT_USED(width);
+    UTIL_NOT_USED(height);
 
-    /* If there is already an icon in the filesystem, it will be loaded.
-     * First check whether it is a animated sprite sheet and if not, try
-     * to load just a bitmap image.
+    /* A bitmap image, which was not converted yet, is converted once.
+     * The icon is loaded together with the layout.
      */
-    if (false == m_bitmapWidget.loadSpriteSheet(FILESYSTEM, getFileName(FILE_EXT_SPRITE_SHEET), getFileName(FILE_EXT_BITMAP)))
+    if (true == FILESYSTEM.exists(getFileName(FILE_EXT_BITMAP)))
     {
-        (void)m_bitmapWidget.load(FILESYSTEM, getFileName(FILE_EXT_BITMAP));
+        (void)packBitmap(getFileName(FILE_EXT_BITMAP), getFileName(FILE_EXT_PACKED_IMG));
     }
 
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height - 2U);
-    (void)m_textCanvas.addWidget(m_textWidget);
-
-    m_lampCanvas.setPosAndSize(ICON_WIDTH, height - 1, canvasWidth, 1U);
-
-    if (true == calcLayout(canvasWidth, MAX_LAMPS, minDistance, minBorder, lampWidth, lampDistance))
+    /* An uploaded layout replaces the default layout. */
+    if (false == FILESYSTEM.exists(layoutFilename))
     {
-        /* Calculate the border to have the lamps shown aligned to center. */
-        uint16_t    border  = ((canvasWidth - (MAX_LAMPS * lampWidth)) - ((MAX_LAMPS - 1U) * lampDistance)) / 2U;
-        uint8_t     index   = 0U;
-
-        for(index = 0U; index < MAX_LAMPS; ++index)
-        {
-            /* One space at the begin, two spaces between the lamps. */
-            int16_t x = (lampWidth + lampDistance) * index + border;
-
-            m_lampWidgets[index].setWidth(lampWidth);
-
-            (void)m_lampCanvas.addWidget(m_lampWidgets[index]);
-            m_lampWidgets[index].move(x, 0);
-        }
+        layoutFilename = DEFAULT_LAYOUT;
     }
 
+    (void)loadLayout(layoutFilename);
+
     return;
 }
 
 void IconTextLampPlugin::stop()
 {
-    MutexGuard<MutexRecursive> guard(m_mutex);
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint8_t                     lampId  = 0U;
 
     if (false != FILESYSTEM.remove(getFileName(FILE_EXT_BITMAP)))
     {
         LOG_INFO("File %s removed", getFileName(FILE_EXT_BITMAP).c_str());
     }
 
+    IconStore::getInstance().remove(getFileName(FILE_EXT_PACKED_IMG));
+
+    if (false != FILESYSTEM.remove(getFileName(FILE_EXT_PACKED_IMG)))
+    {
+        LOG_INFO("File %s removed", getFileName(FILE_EXT_PACKED_IMG).c_str());
+    }
+
     if (false != FILESYSTEM.remove(getFileName(FILE_EXT_SPRITE_SHEET)))
     {
         LOG_INFO("File %s removed", getFileName(FILE_EXT_SPRITE_SHEET).c_str());
     }
+
+    if (false != FILESYSTEM.remove(getFileName(FILE_EXT_LAYOUT)))
+    {
+        LOG_INFO("File %s removed", getFileName(FILE_EXT_LAYOUT).c_str());
+    }
+
+    m_layout.clear();
+    m_bitmapWidget  = nullptr;
+    m_textWidget    = nullptr;
+
+    for(lampId = 0U; lampId < MAX_LAMPS; ++lampId)
+    {
+        m_lampWidgets[lampId] = nullptr;
+    }
+}
+
+void IconTextLampPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    m_layout.invalidate();
+
+    return;
 }
 
 void IconTextLampPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
-    m_lampCanvas.update(gfx);
+    /* The widgets of a layout don't clear their background, therefore
+     * the whole layout is repainted if any widget changed.
+     */
+    if (true == m_layout.isDirty())
+    {
+        gfx.fillScreen(ColorDef::BLACK);
+        m_layout.update(gfx);
+    }
 
     return;
 }
@@ -325,7 +381,7 @@ String IconTextLampPlugin::getText() const
     String                      formattedText;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    formattedText = m_textWidget.getFormatStr();
+    formattedText = m_formatText;
 
     return formattedText;
 }
@@ -334,7 +390,12 @@ void IconTextLampPlugin::setText(const String& formatText)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_textWidget.setFormatStr(formatText);
+    m_formatText = formatText;
+
+    if (nullptr != m_textWidget)
+    {
+        m_textWidget->setFormatStr(formatText);
+    }
 
     return;
 }
@@ -346,7 +407,15 @@ bool IconTextLampPlugin::loadBitmap(const String& filename)
 
     if (0U != filename.endsWith(FILE_EXT_BITMAP))
     {
-        status = m_bitmapWidget.load(FILESYSTEM, filename);
+        String pimFilename = filename;
+
+        pimFilename.replace(FILE_EXT_BITMAP, FILE_EXT_PACKED_IMG);
+
+        if ((true == packBitmap(filename, pimFilename)) &&
+            (nullptr != m_bitmapWidget))
+        {
+            status = IconStore::getInstance().load(FILESYSTEM, pimFilename, *m_bitmapWidget);
+        }
 
         /* Ensure that only the bitmap image file exists in the filesystem,
          * otherwise after a restart, the obsolete sprite sheet will
@@ -359,11 +428,14 @@ bool IconTextLampPlugin::loadBitmap(const String& filename)
     }
     else if (0U != filename.endsWith(FILE_EXT_SPRITE_SHEET))
     {
-        String bmpFilename = filename;
+        String pimFilename = filename;
 
-        bmpFilename.replace(FILE_EXT_SPRITE_SHEET, FILE_EXT_BITMAP);
+        pimFilename.replace(FILE_EXT_SPRITE_SHEET, FILE_EXT_PACKED_IMG);
 
-        status = m_bitmapWidget.loadSpriteSheet(FILESYSTEM, filename,  bmpFilename);
+        if (nullptr != m_bitmapWidget)
+        {
+            status = m_bitmapWidget->loadSpriteSheet(FILESYSTEM, filename,  pimFilename);
+        }
     }
     else
     {
@@ -382,7 +454,7 @@ bool IconTextLampPlugin::getLamp(uint8_t lampId) const
     {
         MutexGuard<MutexRecursive> guard(m_mutex);
 
-        lampState = m_lampWidgets[lampId].getOnState();
+        lampState = m_lampStates[lampId];
     }
 
     return lampState;
@@ -394,7 +466,12 @@ void IconTextLampPlugin::setLamp(uint8_t lampId, bool state)
     {
         MutexGuard<MutexRecursive> guard(m_mutex);
 
-        m_lampWidgets[lampId].setOnState(state);
+        m_lampStates[lampId] = state;
+
+        if (nullptr != m_lampWidgets[lampId])
+        {
+            m_lampWidgets[lampId]->setOnState(state);
+        }
     }
 
     return;
@@ -413,60 +490,88 @@ String IconTextLampPlugin::getFileName(const String& ext)
     return generateFullPath(ext);
 }
 
-bool IconTextLampPlugin::calcLayout(uint16_t width, uint16_t cnt, uint16_t minDistance, uint16_t minBorder, uint16_t& elementWidth, uint16_t& elementDistance)
+bool IconTextLampPlugin::loadLayout(const String& filename)
 {
-    bool    status  = false;
+    bool    isSuccessful    = m_layout.load(FILESYSTEM, filename);
+    uint8_t lampId          = 0U;
 
-    /* The min. border (left and right) must not be greater than the given width. */
-    if (width > (2U * minBorder))
+    if (false == isSuccessful)
     {
-        uint16_t    availableWidth  = width - (2U * minBorder); /* The available width is calculated considering the min. borders. */
+        LOG_WARNING("Failed to load layout %s.", filename.c_str());
 
-        /* The available width must be greater than the number of elements, including the min. element distance. */
-        if (availableWidth > (cnt + ((cnt - 1U) * minDistance)))
+        /* Without any layout nothing would be shown. */
+        if (filename != DEFAULT_LAYOUT)
         {
-            uint16_t    maxElementWidth                     = (availableWidth - ((cnt - 1U) * minDistance)) / cnt; /* Max. element width, considering the given limitation. */
-            uint16_t    elementWidthToAvailWidthRatio       = 8U;   /* 1 / N */
-            uint16_t    elementDistanceToElementWidthRatio  = 4U;   /* 1 / N */
-            uint16_t    elementWidthConsideringRatio        = availableWidth / elementWidthToAvailWidthRatio;
-
-            /* Consider the ratio between element width to available width and
-             * ratio between element distance to element width.
-             * This is just to have a nice look.
-             */
-            if (maxElementWidth > elementWidthConsideringRatio)
-            {
-                uint16_t    elementDistanceConsideringRatio = elementWidthConsideringRatio / elementDistanceToElementWidthRatio;
-
-                if (0U == elementDistanceConsideringRatio)
-                {
-                    if (0U == minDistance)
-                    {
-                        elementDistance = 0U;
-                    }
-                    else
-                    {
-                        elementWidth    = maxElementWidth;
-                        elementDistance = (availableWidth - (cnt * maxElementWidth)) / (cnt - 1U);
-                    }
-                }
-                else
-                {
-                    elementWidth    = elementWidthConsideringRatio - elementDistanceConsideringRatio;
-                    elementDistance = elementDistanceConsideringRatio;
-                }
-            }
-            else
-            {
-                elementWidth    = maxElementWidth;
-                elementDistance = minDistance;
-            }
+            (void)m_layout.load(FILESYSTEM, DEFAULT_LAYOUT);
+        }
+    }
+
+    m_bitmapWidget  = static_cast<BitmapWidget*>(findWidget("icon", BitmapWidget::WIDGET_TYPE));
+    m_textWidget    = static_cast<TextWidget*>(findWidget("text", TextWidget::WIDGET_TYPE));
+
+    for(lampId = 0U; lampId < MAX_LAMPS; ++lampId)
+    {
+        m_lampWidgets[lampId] = static_cast<LampWidget*>(findWidget(String("lamp") + lampId, LampWidget::WIDGET_TYPE));
 
-            status = true;
+        if (nullptr != m_lampWidgets[lampId])
+        {
+            m_lampWidgets[lampId]->setOnState(m_lampStates[lampId]);
         }
     }
 
-    return status;
+    if (nullptr != m_textWidget)
+    {
+        m_textWidget->setFormatStr(m_formatText);
+    }
+
+    /* If there is already an icon in the filesystem, it will be loaded.
+     * First check whether it is a animated sprite sheet and if not, try
+     * to load just a packed image.
+     */
+    if (nullptr != m_bitmapWidget)
+    {
+        if (false == m_bitmapWidget->loadSpriteSheet(FILESYSTEM, getFileName(FILE_EXT_SPRITE_SHEET), getFileName(FILE_EXT_PACKED_IMG)))
+        {
+            (void)IconStore::getInstance().load(FILESYSTEM, getFileName(FILE_EXT_PACKED_IMG), *m_bitmapWidget);
+        }
+    }
+
+    return isSuccessful;
+}
+
+Widget* IconTextLampPlugin::findWidget(const String& name, const char* type) const
+{
+    Widget* widget = m_layout.find(name);
+
+    /* A widget with the expected name, but a different type is ignored. */
+    if ((nullptr != widget) &&
+        (type != widget->getType()))
+    {
+        widget = nullptr;
+    }
+
+    return widget;
+}
+
+bool IconTextLampPlugin::packBitmap(const String& bmpFilename, const String& pimFilename)
+{
+    bool            isSuccessful    = false;
+    PackedImgLoader loader;
+
+    /* Without run length encoding, the icon can be shown directly from the icon store. */
+    if (PackedImgLoader::RET_OK != loader.convert(FILESYSTEM, bmpFilename, pimFilename, false))
+    {
+        LOG_WARNING("Failed to convert %s.", bmpFilename.c_str());
+    }
+    else
+    {
+        (void)FILESYSTEM.remove(bmpFilename);
+        (void)IconStore::getInstance().store(FILESYSTEM, pimFilename);
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
 }
 
 /******************************************************************************
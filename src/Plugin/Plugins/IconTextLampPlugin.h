@@ -47,7 +47,7 @@
 #include "Plugin.hpp"
 
 #include <FS.h>
-#include <WidgetGroup.h>
+#include <WidgetLayout.h>
 #include <BitmapWidget.h>
 #include <TextWidget.h>
 #include <LampWidget.h>
@@ -65,6 +65,11 @@
  * Shows an icon (bitmap) on the left side in 8 x 8, text on the right side and
  * under the text a bar with lamps.
  * If the text is too long for the display width, it automatically scrolls.
+ *
+ * The widgets are created from a compiled layout file (.wly), see WidgetLayout.
+ * The default layout can be replaced per plugin instance by uploading a layout
+ * file. The plugin uses the widgets with the names "icon", "text" and "lamp0"
+ * to "lamp3". A widget which is not part of the layout is just not shown.
  */
 class IconTextLampPlugin : public Plugin
 {
@@ -78,16 +83,21 @@ public:
      */
     IconTextLampPlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
-        m_iconCanvas(),
-        m_textCanvas(),
-        m_lampCanvas(),
-        m_bitmapWidget(),
-        m_textWidget(),
+        m_layout(),
+        m_bitmapWidget(nullptr),
+        m_textWidget(nullptr),
         m_lampWidgets(),
+        m_formatText(),
+        m_lampStates(),
         m_mutex()
     {
-        /* Move the text widget one line lower for better look. */
-        m_textWidget.move(0, 1);
+        uint8_t lampId = 0U;
+
+        for(lampId = 0U; lampId < MAX_LAMPS; ++lampId)
+        {
+            m_lampWidgets[lampId]   = nullptr;
+            m_lampStates[lampId]    = false;
+        }
 
         (void)m_mutex.create();
     }
@@ -178,6 +188,14 @@ public:
      */
     void stop() final;
 
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -202,6 +220,8 @@ public:
 
     /**
      * Load bitmap image / sprite sheet from filesystem.
+     * A bitmap image is converted to a packed image first, which replaces
+     * the bitmap image file in the filesystem.
      * If a bitmap image is loaded, it will remove a corresponding sprite
      * sheet file from filesystem.
      * If a sprite sheet is loaded, it will load the texture file from
@@ -253,36 +273,46 @@ private:
     static const char*  TOPIC_ICON;
 
     /**
-     * Icon width in pixels.
+     * Plugin topic, used for parameter exchange.
      */
-    static const uint16_t   ICON_WIDTH  = 8U;
+    static const char*  TOPIC_LAYOUT;
 
     /**
-     * Icon height in pixels.
+     * Filename extension of bitmap image file.
      */
-    static const uint16_t   ICON_HEIGHT = 8U;
+    static const char*      FILE_EXT_BITMAP;
 
     /**
-     * Filename extension of bitmap image file.
+     * Filename extension of packed image file.
      */
-    static const char*      FILE_EXT_BITMAP;
+    static const char*      FILE_EXT_PACKED_IMG;
 
     /**
      * Filename extension of sprite sheet parameter file.
      */
     static const char*      FILE_EXT_SPRITE_SHEET;
 
+    /**
+     * Filename extension of layout file.
+     */
+    static const char*      FILE_EXT_LAYOUT;
+
+    /**
+     * Default layout file, used if no layout was uploaded.
+     */
+    static const char*      DEFAULT_LAYOUT;
+
     /**
      * Max. number of lamps.
      */
     static const uint8_t    MAX_LAMPS   = 4U;
 
-    WidgetGroup             m_iconCanvas;               /**< Canvas used for the bitmap widget. */
-    WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
-    WidgetGroup             m_lampCanvas;               /**< Canvas used for the lamp widget. */
-    BitmapWidget            m_bitmapWidget;             /**< Bitmap widget, used to show the icon. */
-    TextWidget              m_textWidget;               /**< Text widget, used for showing the text. */
-    LampWidget              m_lampWidgets[MAX_LAMPS];   /**< Lamp widgets, used to signal different things. */
+    WidgetLayout            m_layout;                   /**< Layout, which contains all widgets. */
+    BitmapWidget*           m_bitmapWidget;             /**< Bitmap widget of the layout, used to show the icon. */
+    TextWidget*             m_textWidget;               /**< Text widget of the layout, used for showing the text. */
+    LampWidget*             m_lampWidgets[MAX_LAMPS];   /**< Lamp widgets of the layout, used to signal different things. */
+    String                  m_formatText;               /**< Text, which may contain format tags. It is kept over a layout change. */
+    bool                    m_lampStates[MAX_LAMPS];    /**< Lamp states, which are kept over a layout change. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
 
     /**
@@ -295,18 +325,38 @@ private:
     String getFileName(const String& ext);
 
     /**
-     * Calculates the optimal layout for several elements, which shall be aligned.
-     * 
-     * @param[in]   width           Max. available width in pixel.
-     * @param[in]   cnt             Number of elements in a row.
-     * @param[in]   minDistance     The minimal distance in pixel between each element.
-     * @param[in]   minBorder       The minimal border left and right of all elements.
-     * @param[out]  elementWidth    The calculated optimal element width in pixel.
-     * @param[out]  elementDistance The calculated optimal element distance in pixel.
-     * 
-     * @return If the calculation is successful, it will return true otherwise false.
+     * Load a layout file and show the current icon, text and lamp states
+     * with its widgets. If the layout can't be loaded, the default layout
+     * will be used.
+     *
+     * @param[in] filename  Layout filename
+     *
+     * @return If the layout file is loaded, it will return true otherwise false.
+     */
+    bool loadLayout(const String& filename);
+
+    /**
+     * Get a widget of the layout by its name and type.
+     *
+     * @param[in] name  Widget name
+     * @param[in] type  Widget type
+     *
+     * @return If the widget is found, it will be returned otherwise nullptr.
+     */
+    Widget* findWidget(const String& name, const char* type) const;
+
+    /**
+     * Convert a bitmap image file to a packed image file and remove the
+     * bitmap image file afterwards. A packed image is loaded without any
+     * decoding effort. It is put in the icon store too, which shows it
+     * directly from flash.
+     *
+     * @param[in] bmpFilename   Bitmap image filename
+     * @param[in] pimFilename   Packed image filename
+     *
+     * @return If successful converted, it will return true otherwise false.
      */
-    bool calcLayout(uint16_t width, uint16_t cnt, uint16_t minDistance, uint16_t minBorder, uint16_t& elementWidth, uint16_t& elementDistance);
+    bool packBitmap(const String& bmpFilename, const String& pimFilename);
 };
 
 /******************************************************************************
@@ -38,6 +38,8 @@
 
 #include <Logging.h>
 #include <ArduinoJson.h>
+#include <PackedImgLoader.h>
+#include <IconStore.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -68,9 +70,15 @@ const char* IconTextPlugin::TOPIC_ICON              = "/bitmap";
 /* Initialize bitmap image filename extension. */
 const char* IconTextPlugin::FILE_EXT_BITMAP         = ".bmp";
 
+/* Initialize packed image filename extension. */
+const char* IconTextPlugin::FILE_EXT_PACKED_IMG     = ".pim";
+
 /* Initialize sprite sheet parameter filename extension. */
 const char* IconTextPlugin::FILE_EXT_SPRITE_SHEET   = ".sprite";
 
+/* Initialize GIF image filename extension. */
+const char* IconTextPlugin::FILE_EXT_GIF            = ".gif";
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -153,6 +161,13 @@ bool IconTextPlugin::isUploadAccepted(const String& topic, const String& srcFile
 
             isAccepted = true;
         }
+        /* Accept upload of a animated GIF file. */
+        else if (0U != srcFilename.endsWith(FILE_EXT_GIF))
+        {
+            dstFilename = getFileName(FILE_EXT_GIF);
+
+            isAccepted = true;
+        }
         else
         {
             /* Not accepted. */
@@ -169,14 +184,31 @@ void IconTextPlugin::start(uint16_t width, uint16_t height)
 
     m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
     (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    (void)m_iconCanvas.addWidget(m_gifWidget);
 
     /* If there is already an icon in the filesystem, it will be loaded.
-     * First check whether it is a animated sprite sheet and if not, try
-     * to load just a bitmap image.
+     * First check whether it is a animated GIF image, then whether it is
+     * a animated sprite sheet and if not, try to load just a bitmap image.
      */
-    if (false == m_bitmapWidget.loadSpriteSheet(FILESYSTEM, getFileName(FILE_EXT_SPRITE_SHEET), getFileName(FILE_EXT_BITMAP)))
+    if ((true == FILESYSTEM.exists(getFileName(FILE_EXT_GIF))) &&
+        (true == m_gifWidget.load(FILESYSTEM, getFileName(FILE_EXT_GIF))))
+    {
+        m_bitmapWidget.disable();
+    }
+    else
     {
-        (void)m_bitmapWidget.load(FILESYSTEM, getFileName(FILE_EXT_BITMAP));
+        m_gifWidget.disable();
+
+        /* A bitmap image, which was not converted yet, is converted once. */
+        if (true == FILESYSTEM.exists(getFileName(FILE_EXT_BITMAP)))
+        {
+            (void)packBitmap(getFileName(FILE_EXT_BITMAP), getFileName(FILE_EXT_PACKED_IMG));
+        }
+
+        if (false == m_bitmapWidget.loadSpriteSheet(FILESYSTEM, getFileName(FILE_EXT_SPRITE_SHEET), getFileName(FILE_EXT_PACKED_IMG)))
+        {
+            (void)IconStore::getInstance().load(FILESYSTEM, getFileName(FILE_EXT_PACKED_IMG), m_bitmapWidget);
+        }
     }
 
     m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
@@ -194,11 +226,38 @@ void IconTextPlugin::stop()
         LOG_INFO("File %s removed", getFileName(FILE_EXT_BITMAP).c_str());
     }
 
+    IconStore::getInstance().remove(getFileName(FILE_EXT_PACKED_IMG));
+
+    if (false != FILESYSTEM.remove(getFileName(FILE_EXT_PACKED_IMG)))
+    {
+        LOG_INFO("File %s removed", getFileName(FILE_EXT_PACKED_IMG).c_str());
+    }
+
     if (false != FILESYSTEM.remove(getFileName(FILE_EXT_SPRITE_SHEET)))
     {
         LOG_INFO("File %s removed", getFileName(FILE_EXT_SPRITE_SHEET).c_str());
     }
 
+    /* The GIF image file is kept open by the widget. */
+    m_gifWidget.clear();
+
+    if (false != FILESYSTEM.remove(getFileName(FILE_EXT_GIF)))
+    {
+        LOG_INFO("File %s removed", getFileName(FILE_EXT_GIF).c_str());
+    }
+
+    return;
+}
+
+void IconTextPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    m_iconCanvas.invalidate();
+    m_textCanvas.invalidate();
+
     return;
 }
 
@@ -206,9 +265,8 @@ void IconTextPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    (void)m_iconCanvas.updateInvalidated(gfx);
+    (void)m_textCanvas.updateInvalidated(gfx);
 
     return;
 }
@@ -239,7 +297,14 @@ bool IconTextPlugin::loadBitmap(const String& filename)
 
     if (0U != filename.endsWith(FILE_EXT_BITMAP))
     {
-        status = m_bitmapWidget.load(FILESYSTEM, filename);
+        String pimFilename = filename;
+
+        pimFilename.replace(FILE_EXT_BITMAP, FILE_EXT_PACKED_IMG);
+
+        if (true == packBitmap(filename, pimFilename))
+        {
+            status = IconStore::getInstance().load(FILESYSTEM, pimFilename, m_bitmapWidget);
+        }
 
         /* Ensure that only the bitmap image file exists in the filesystem,
          * otherwise after a restart, the obsolete sprite sheet will
@@ -248,15 +313,30 @@ bool IconTextPlugin::loadBitmap(const String& filename)
         if (true == status)
         {
             (void)FILESYSTEM.remove(getFileName(FILE_EXT_SPRITE_SHEET));
+            selectIconWidget(false);
         }
     }
     else if (0U != filename.endsWith(FILE_EXT_SPRITE_SHEET))
     {
-        String bmpFilename = filename;
+        String pimFilename = filename;
 
-        bmpFilename.replace(FILE_EXT_SPRITE_SHEET, FILE_EXT_BITMAP);
+        pimFilename.replace(FILE_EXT_SPRITE_SHEET, FILE_EXT_PACKED_IMG);
 
-        status = m_bitmapWidget.loadSpriteSheet(FILESYSTEM, filename,  bmpFilename);
+        status = m_bitmapWidget.loadSpriteSheet(FILESYSTEM, filename,  pimFilename);
+
+        if (true == status)
+        {
+            selectIconWidget(false);
+        }
+    }
+    else if (0U != filename.endsWith(FILE_EXT_GIF))
+    {
+        status = m_gifWidget.load(FILESYSTEM, filename);
+
+        if (true == status)
+        {
+            selectIconWidget(true);
+        }
     }
     else
     {
@@ -280,6 +360,51 @@ String IconTextPlugin::getFileName(const String& ext)
     return generateFullPath(ext);
 }
 
+void IconTextPlugin::selectIconWidget(bool isGif)
+{
+    if (true == isGif)
+    {
+        m_bitmapWidget.disable();
+        m_gifWidget.enable();
+
+        (void)FILESYSTEM.remove(getFileName(FILE_EXT_BITMAP));
+        IconStore::getInstance().remove(getFileName(FILE_EXT_PACKED_IMG));
+        (void)FILESYSTEM.remove(getFileName(FILE_EXT_PACKED_IMG));
+        (void)FILESYSTEM.remove(getFileName(FILE_EXT_SPRITE_SHEET));
+    }
+    else
+    {
+        m_gifWidget.clear();
+        m_gifWidget.disable();
+        m_bitmapWidget.enable();
+
+        (void)FILESYSTEM.remove(getFileName(FILE_EXT_GIF));
+    }
+
+    return;
+}
+
+bool IconTextPlugin::packBitmap(const String& bmpFilename, const String& pimFilename)
+{
+    bool            isSuccessful    = false;
+    PackedImgLoader loader;
+
+    /* Without run length encoding, the icon can be shown directly from the icon store. */
+    if (PackedImgLoader::RET_OK != loader.convert(FILESYSTEM, bmpFilename, pimFilename, false))
+    {
+        LOG_WARNING("Failed to convert %s.", bmpFilename.c_str());
+    }
+    else
+    {
+        (void)FILESYSTEM.remove(bmpFilename);
+        (void)IconStore::getInstance().store(FILESYSTEM, pimFilename);
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -49,6 +49,7 @@
 #include <FS.h>
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
+#include <GifWidget.h>
 #include <TextWidget.h>
 #include <Mutex.hpp>
 
@@ -61,7 +62,7 @@
  *****************************************************************************/
 
 /**
- * Shows an icon (bitmap) on the left side in 8 x 8 and text on the right side.
+ * Shows an icon (bitmap or animated GIF) on the left side in 8 x 8 and text on the right side.
  * If the text is too long for the display width, it automatically scrolls.
  */
 class IconTextPlugin : public Plugin
@@ -79,6 +80,7 @@ public:
         m_textCanvas(),
         m_iconCanvas(),
         m_bitmapWidget(),
+        m_gifWidget(),
         m_textWidget(),
         m_isUploadError(false),
         m_mutex()
@@ -175,6 +177,14 @@ public:
      */
     void stop() final;
 
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -198,13 +208,17 @@ public:
     void setText(const String& formatText);
 
     /**
-     * Load bitmap image / sprite sheet from filesystem.
+     * Load bitmap image / sprite sheet / GIF image from filesystem.
+     * A bitmap image is converted to a packed image first, which replaces
+     * the bitmap image file in the filesystem.
      * If a bitmap image is loaded, it will remove a corresponding sprite
      * sheet file from filesystem.
      * If a sprite sheet is loaded, it will load the texture file from
      * filesystem. This assumes that the texture file was uploaded before!
+     * If a GIF image is loaded, it will remove the bitmap image and sprite
+     * sheet files from filesystem.
      *
-     * @param[in] filename  Bitmap image / Sprite sheet filename
+     * @param[in] filename  Bitmap image / Sprite sheet / GIF image filename
      *
      * @return If successul, it will return true otherwise false.
      */
@@ -237,14 +251,25 @@ private:
      */
     static const char*      FILE_EXT_BITMAP;
 
+    /**
+     * Filename extension of packed image file.
+     */
+    static const char*      FILE_EXT_PACKED_IMG;
+
     /**
      * Filename extension of sprite sheet parameter file.
      */
     static const char*      FILE_EXT_SPRITE_SHEET;
 
+    /**
+     * Filename extension of GIF image file.
+     */
+    static const char*      FILE_EXT_GIF;
+
     WidgetGroup             m_textCanvas;       /**< Canvas used for the text widget. */
     WidgetGroup             m_iconCanvas;       /**< Canvas used for the bitmap widget. */
     BitmapWidget            m_bitmapWidget;     /**< Bitmap widget, used to show the icon. */
+    GifWidget               m_gifWidget;        /**< GIF widget, used to show a animated icon. */
     TextWidget              m_textWidget;       /**< Text widget, used for showing the text. */
     bool                    m_isUploadError;    /**< Flag to signal a upload error. */
     mutable MutexRecursive  m_mutex;            /**< Mutex to protect against concurrent access. */
@@ -257,6 +282,28 @@ private:
      * @return Filename with path.
      */
     String getFileName(const String& ext);
+
+    /**
+     * Show either the bitmap widget or the GIF widget and remove the
+     * obsolete icon files from the filesystem. Otherwise after a restart,
+     * a obsolete icon will be loaded.
+     *
+     * @param[in] isGif Show the GIF widget?
+     */
+    void selectIconWidget(bool isGif);
+
+    /**
+     * Convert a bitmap image file to a packed image file and remove the
+     * bitmap image file afterwards. A packed image is loaded without any
+     * decoding effort. It is put in the icon store too, which shows it
+     * directly from flash.
+     *
+     * @param[in] bmpFilename   Bitmap image filename
+     * @param[in] pimFilename   Packed image filename
+     *
+     * @return If successful converted, it will return true otherwise false.
+     */
+    bool packBitmap(const String& bmpFilename, const String& pimFilename);
 };
 
 /******************************************************************************
@@ -110,12 +110,32 @@ bool JustTextPlugin::setTopic(const String& topic, const JsonObject& value)
     return isSuccessful;
 }
 
+void JustTextPlugin::start(uint16_t width, uint16_t height)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    m_textCanvas.setPosAndSize(0, 0, width, height);
+    (void)m_textCanvas.addWidget(m_textWidget);
+
+    return;
+}
+
+void JustTextPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    m_textCanvas.invalidate();
+
+    return;
+}
+
 void JustTextPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_textWidget.update(gfx);
+    (void)m_textCanvas.updateInvalidated(gfx);
 
     return;
 }
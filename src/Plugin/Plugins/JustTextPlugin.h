@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "Plugin.hpp"
 
+#include <WidgetGroup.h>
 #include <TextWidget.h>
 #include <Mutex.hpp>
 
@@ -73,6 +74,7 @@ public:
      */
     JustTextPlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
+        m_textCanvas(),
         m_textWidget(),
         m_mutex()
     {
@@ -140,6 +142,26 @@ public:
      */
     bool setTopic(const String& topic, const JsonObject& value) final;
 
+    /**
+     * Start the plugin. This is called only once during plugin lifetime.
+     * It can be used as deferred initialization (after the constructor)
+     * and provides the canvas size.
+     * 
+     * Overwrite it if your plugin needs to know that it was installed.
+     * 
+     * @param[in] width     Display width in pixel
+     * @param[in] height    Display height in pixel
+     */
+    void start(uint16_t width, uint16_t height) final;
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -169,6 +191,7 @@ private:
      */
     static const char*  TOPIC_TEXT;
 
+    WidgetGroup             m_textCanvas;   /**< Canvas used for the text widget. */
     TextWidget              m_textWidget;   /**< Text widget, used for showing the text. */
     mutable MutexRecursive  m_mutex;        /**< Mutex to protect against concurrent access. */
 };
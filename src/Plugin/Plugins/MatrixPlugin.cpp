@@ -129,9 +129,9 @@ void MatrixPlugin::update(YAGfx& gfx)
         }
 
         /* Spawn new falling "matrix code". */
-        if (0 == random(2))
+        if (0U == m_rng.nextRange(2U))
         {
-            x = random(gfx.getWidth());
+            x = m_rng.nextRange(gfx.getWidth());
             gfx.drawPixel(x, 0, CODE_COLOR);
         }
 
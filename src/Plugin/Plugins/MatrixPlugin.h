@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "Plugin.hpp"
 #include <SimpleTimer.hpp>
+#include <XorShift.hpp>
 
 /******************************************************************************
  * Macros
@@ -70,7 +71,8 @@ public:
      */
     MatrixPlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
-        m_timer()
+        m_timer(),
+        m_rng(ESP.getCycleCount())
     {
     }
 
@@ -108,6 +110,7 @@ private:
     static const uint32_t   UPDATE_PERIOD   = 100U;
 
     SimpleTimer m_timer;    /**< Updates the display in a slower period than update() is called. */
+    XorShift32  m_rng;      /**< Random number generator to spawn the "matrix code" */
 };
 
 /******************************************************************************
@@ -169,13 +169,13 @@ void OpenWeatherPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    m_width     = width;
+    m_height    = height;
 
-    (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        (void)m_view->bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
+    }
 
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
@@ -188,12 +188,10 @@ void OpenWeatherPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         /* If a request fails, show standard icon and a '?' */
-        (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-        m_textWidget.setFormatStr("\\calign?");
+        showContent(IMAGE_PATH_STD_ICON, "\\calign?");
 
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
     }
@@ -225,14 +223,15 @@ void OpenWeatherPlugin::process()
     Msg                         msg;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    if ((true == m_requestTimer.isTimerRunning()) &&
+    /* During hibernation, a expired request is deferred until wake-up. */
+    if ((nullptr != m_view) &&
+        (true == m_requestTimer.isTimerRunning()) &&
         (true == m_requestTimer.isTimeout()))
     {
         if (false == startHttpRequest())
         {
             /* If a request fails, show standard icon and a '?' */
-            (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-            m_textWidget.setFormatStr("\\calign?");
+            showContent(IMAGE_PATH_STD_ICON, "\\calign?");
 
             m_requestTimer.start(UPDATE_PERIOD_SHORT);
         }
@@ -249,7 +248,8 @@ void OpenWeatherPlugin::process()
         m_updateContentTimer.restart();
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if ((nullptr != m_view) &&
+        (true == receiveMsg(msg)))
     {
         switch(msg.type)
         {
@@ -272,8 +272,7 @@ void OpenWeatherPlugin::process()
             if (true == m_isConnectionError)
             {
                 /* If a request fails, show standard icon and a '?' */
-                (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-                m_textWidget.setFormatStr("\\calign?");
+                showContent(IMAGE_PATH_STD_ICON, "\\calign?");
 
                 m_requestTimer.start(UPDATE_PERIOD_SHORT);
             }
@@ -294,22 +293,60 @@ void OpenWeatherPlugin::process()
     return;
 }
 
-void OpenWeatherPlugin::active(YAGfx& gfx)
+void OpenWeatherPlugin::prepare()
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    /* Load configuration, because it may be changed by web request
-     * or direct editing.
+    /* Reload configuration, if it was changed by direct editing.
+     * Changes by web request are already considered.
      */
-    (void)loadConfiguration();
+    if (true == consumeConfigurationChange())
+    {
+        (void)loadConfiguration();
+    }
 
-    /* Force immediate weather update on activation */
-    updateDisplay(true);
+    HttpPlugin::prepare();
+
+    return;
+}
 
-    /* Force drawing on display in the update() method for the very first time
-     * after activation.
+void OpenWeatherPlugin::discardPreparation()
+{
+    /* No mutex, because a running preparation shall not block the caller.
+     * The flag is atomic.
      */
-    m_isUpdateAvailable = true;
+    m_isPrepared = false;
+
+    return;
+}
+
+void OpenWeatherPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    /* Not prepared in advance, e.g. because activated on request? */
+    if (false == m_isPrepared.exchange(false))
+    {
+        /* Reload configuration, if it was changed by direct editing.
+         * Changes by web request are already considered.
+         */
+        if (true == consumeConfigurationChange())
+        {
+            (void)loadConfiguration();
+        }
+
+        /* Force immediate weather update on activation */
+        updateDisplay(true);
+    }
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
+
     m_durationCounter = 0U;
     m_updateContentTimer.start(DURATION_TICK_PERIOD);
 
@@ -322,6 +359,11 @@ void OpenWeatherPlugin::inactive()
 
     m_updateContentTimer.stop();
 
+    /* A preparation, which runs concurrently to the activation, is outdated
+     * at the next activation.
+     */
+    m_isPrepared = false;
+
     return;
 }
 
@@ -329,13 +371,10 @@ void OpenWeatherPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    if (false != m_isUpdateAvailable)
+    if (nullptr != m_view)
     {
-        gfx.fillScreen(ColorDef::BLACK);
-        m_iconCanvas.update(gfx);
-        m_textCanvas.update(gfx);
-
-        m_isUpdateAvailable = false;
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
+        (void)m_view->textCanvas.updateInvalidated(gfx);
     }
 
     return;
@@ -497,6 +536,61 @@ String OpenWeatherPlugin::uvIndexToColor(float uvIndex)
     return color;
 }
 
+bool OpenWeatherPlugin::createView()
+{
+    if (nullptr == m_view)
+    {
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+            (void)m_view->iconCanvas.addWidget(m_view->bitmapWidget);
+
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
+
+    return (nullptr != m_view);
+}
+
+void OpenWeatherPlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
+    }
+
+    return;
+}
+
+void OpenWeatherPlugin::prepareView()
+{
+    /* Load the weather icon and text for the activation. */
+    updateDisplay(true);
+
+    m_isPrepared = true;
+
+    return;
+}
+
+void OpenWeatherPlugin::showContent(const String& icon, const String& text)
+{
+    if (nullptr != m_view)
+    {
+        if (false == m_view->bitmapWidget.load(FILESYSTEM, icon))
+        {
+            (void)m_view->bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
+        }
+
+        m_view->textWidget.setFormatStr(text);
+    }
+
+    return;
+}
+
 void OpenWeatherPlugin::updateDisplay(bool force)
 {
     bool        showGeneralWeatherInformation = ((0U == m_durationCounter) ? true : false);
@@ -522,15 +616,7 @@ void OpenWeatherPlugin::updateDisplay(bool force)
         icon = m_currentWeatherIcon;
         text = m_currentTemp;
 
-        if (false == m_bitmapWidget.load(FILESYSTEM, icon))
-        {
-            (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-        }
-
-        m_textWidget.setFormatStr(text);
-
-        m_isUpdateAvailable = true;
-
+        showContent(icon, text);
     }
 
     if (false != showAdditionalInformation)
@@ -561,13 +647,7 @@ void OpenWeatherPlugin::updateDisplay(bool force)
             break;
         }
 
-        if (false == m_bitmapWidget.load(FILESYSTEM, icon))
-        {
-            (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-        }
-
-        m_textWidget.setFormatStr(text);
-        m_isUpdateAvailable = true;
+        showContent(icon, text);
     }
 
     /* If infinite duration was switch every 15s between general and additional information. */
@@ -589,9 +669,11 @@ void OpenWeatherPlugin::updateDisplay(bool force)
 
 bool OpenWeatherPlugin::startHttpRequest()
 {
-    bool status = false;
+    bool                status  = false;
+    AsyncHttpClient*    client  = getHttpClient();
 
-    if ((0 < m_latitude.length()) &&
+    if ((nullptr != client) &&
+        (0 < m_latitude.length()) &&
         (0 < m_longitude.length()) &&
         (0 < m_units.length()) &&
         (0 < m_apiKey.length()))
@@ -609,9 +691,9 @@ bool OpenWeatherPlugin::startHttpRequest()
         url += m_apiKey;
         url += "&exclude=minutely,hourly,daily,alerts";
 
-        if (true == m_client.begin(url))
+        if (true == client->begin(url))
         {
-            if (false == m_client.GET())
+            if (false == client->GET())
             {
                 LOG_WARNING("GET %s failed.", url.c_str());
             }
@@ -625,83 +707,44 @@ bool OpenWeatherPlugin::startHttpRequest()
     return status;
 }
 
-void OpenWeatherPlugin::initHttpClient()
+DynamicJsonDocument* OpenWeatherPlugin::parseResponse(const HttpResponse& rsp)
 {
-    /* Note: All registered callbacks are running in a different task context!
-     *       Therefore it is not allowed to access a member here directly.
-     *       The processing must be deferred via task proxy.
-     */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
+    const size_t            JSON_DOC_SIZE   = 256U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+
+    if (nullptr != jsonDoc)
+    {
+        size_t                          payloadSize             = 0U;
+        const char*                     payload                 = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        const size_t                    FILTER_SIZE             = 128U;
+        StaticJsonDocument<FILTER_SIZE> filter;
+        JsonObject                      filterCurrent           = filter.createNestedObject("current");
+        DeserializationError            error;
+
+        /* See https://openweathermap.org/api/one-call-api for an example of API response. */
+        filterCurrent["temp"]                  = true;
+        filterCurrent["uvi"]                   = true;
+        filterCurrent["humidity"]              = true;
+        filterCurrent["wind_speed"]            = true;
+        filterCurrent["weather"][0]["icon"]    = true;
+        
+        if (true == filter.overflowed())
         {
-            const size_t            JSON_DOC_SIZE   = 256U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
-
-            if (nullptr != jsonDoc)
-            {
-                size_t                          payloadSize             = 0U;
-                const char*                     payload                 = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                const size_t                    FILTER_SIZE             = 128U;
-                StaticJsonDocument<FILTER_SIZE> filter;
-                JsonObject                      filterCurrent           = filter.createNestedObject("current");
-                DeserializationError            error;
-
-                /* See https://openweathermap.org/api/one-call-api for an example of API response. */
-                filterCurrent["temp"]                  = true;
-                filterCurrent["uvi"]                   = true;
-                filterCurrent["humidity"]              = true;
-                filterCurrent["wind_speed"]            = true;
-                filterCurrent["weather"][0]["icon"]    = true;
-                
-                if (true == filter.overflowed())
-                {
-                    LOG_ERROR("Less memory for filter available.");
-                }
-
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
-
-                if (DeserializationError::Ok != error.code())
-                {
-                    LOG_WARNING("JSON parse error: %s", error.c_str());
-                }
-                else
-                {
-                    Msg msg;
-
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
-
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
-            }
+            LOG_ERROR("Less memory for filter available.");
         }
-    );
-
-    m_client.regOnClosed(
-        [this]()
-        {
-            Msg msg;
-
-            msg.type = MSG_TYPE_CONN_CLOSED;
 
-            (void)this->m_taskProxy.send(msg);
-        }
-    );
+        error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
 
-    m_client.regOnError(
-        [this]()
+        if (DeserializationError::Ok != error.code())
         {
-            Msg msg;
+            LOG_WARNING("JSON parse error: %s", error.c_str());
 
-            msg.type = MSG_TYPE_CONN_ERROR;
-
-            (void)this->m_taskProxy.send(msg);
+            delete jsonDoc;
+            jsonDoc = nullptr;
         }
-    );
+    }
+
+    return jsonDoc;
 }
 
 void OpenWeatherPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -863,20 +906,6 @@ bool OpenWeatherPlugin::loadConfiguration()
     return status;
 }
 
-void OpenWeatherPlugin::clearQueue()
-{
-    Msg msg;
-
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -44,14 +44,12 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
-#include "Plugin.hpp"
-#include "AsyncHttpClient.h"
+#include <atomic>
+#include "HttpPlugin.h"
 
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
 #include <TextWidget.h>
-#include <TaskProxy.hpp>
-#include <Mutex.hpp>
 
 /******************************************************************************
  * Macros
@@ -64,7 +62,7 @@
 /**
  * Shows weather informations provided by OpenWeather: https://openweathermap.org/
  */
-class OpenWeatherPlugin : public Plugin
+class OpenWeatherPlugin : public HttpPlugin
 {
 public:
 
@@ -75,21 +73,15 @@ public:
      * @param[in] uid   Unique id
      */
     OpenWeatherPlugin(const String& name, uint16_t uid) :
-        Plugin(name, uid),
-        m_textCanvas(),
-        m_iconCanvas(),
-        m_bitmapWidget(),
-        m_textWidget("\\calign?"),
+        HttpPlugin(name, uid, parseResponse),
         m_apiKey(""),
         m_latitude("48.858"),/* Example data */
         m_longitude("2.295"),/* Example data */
         m_additionalInformation(OFF),
         m_units("metric"),
         m_configurationFilename(),
-        m_client(),
         m_requestTimer(),
         m_updateContentTimer(),
-        m_mutex(),
         m_isConnectionError(false),
         m_currentTemp("\\calign?"),
         m_currentWeatherIcon(IMAGE_PATH_STD_ICON),
@@ -98,13 +90,11 @@ public:
         m_currentWindspeed("\\calign?"),
         m_slotInterf(nullptr),
         m_durationCounter(0u),
-        m_isUpdateAvailable(false),
-        m_taskProxy()
+        m_isPrepared(false),
+        m_view(nullptr),
+        m_width(0U),
+        m_height(0U)
     {
-        /* Move the text widget one line lower for better look. */
-        m_textWidget.move(0, 1);
-
-        (void)m_mutex.create();
     }
 
     /**
@@ -123,18 +113,7 @@ public:
      */
     ~OpenWeatherPlugin()
     {
-        m_client.regOnResponse(nullptr);
-        m_client.regOnClosed(nullptr);
-        m_client.regOnError(nullptr);
-
-        /* Abort any pending TCP request to avoid getting a callback after the
-         * object is destroyed.
-         */
-        m_client.abort();
-        
-        clearQueue();
-        
-        m_mutex.destroy();
+        destroyView();
     }
 
     /**
@@ -222,6 +201,18 @@ public:
      */
     void process(void) final;
 
+    /**
+     * This method will be called shortly before the plugin is set active.
+     * It loads the configuration and the icon, so the activation is fast.
+     */
+    void prepare() final;
+
+    /**
+     * This method will be called in case the preparation is discarded,
+     * because the plugin won't be set active next.
+     */
+    void discardPreparation() final;
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -378,20 +369,14 @@ private:
     /** Time for duration tick period in ms */
     static const uint32_t   DURATION_TICK_PERIOD    = 1000U;
 
-    WidgetGroup                 m_textCanvas;               /**< Canvas used for the text widget. */
-    WidgetGroup                 m_iconCanvas;               /**< Canvas used for the bitmap widget. */
-    BitmapWidget                m_bitmapWidget;             /**< Bitmap widget, used to show the icon. */
-    TextWidget                  m_textWidget;               /**< Text widget, used for showing the text. */
     String                      m_apiKey;                   /**< OpenWeather API Key */
     String                      m_latitude;                 /**< The latitude. */
     String                      m_longitude;                /**< The langitude. */
     OtherWeatherInformation     m_additionalInformation;    /**< The configured additional weather information. */
     String                      m_units;                    /**< The units. */
     String                      m_configurationFilename;    /**< String used for specifying the configuration filename. */
-    AsyncHttpClient             m_client;                   /**< Asynchronous HTTP client. */
     SimpleTimer                 m_requestTimer;             /**< Timer used for cyclic request of new data. */
     SimpleTimer                 m_updateContentTimer;       /**< Timer used for duration ticks in [s]. */
-    mutable MutexRecursive      m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                        m_isConnectionError;        /**< Is connection error happened? */
     String                      m_currentTemp;              /**< The current temperature. */
     String                      m_currentWeatherIcon;       /**< The current weather condition icon. */
@@ -400,41 +385,62 @@ private:
     String                      m_currentWindspeed;         /**< The current windspeed. */
     const ISlotPlugin*          m_slotInterf;               /**< Slot interface */
     uint8_t                     m_durationCounter;          /**< Variable to count the Plugin duration in DURATION_TICK_PERIOD ticks. */
-    bool                        m_isUpdateAvailable;        /**< Flag to indicate an updated date value. */
+    std::atomic<bool>           m_isPrepared;               /**< Flag to indicate that the plugin was prepared for activation. */
     
     /**
-     * Defines the message types, which are necessary for HTTP client/server handling.
-     */
-    enum MsgType
-    {
-        MSG_TYPE_INVALID = 0,   /**< Invalid message type. */
-        MSG_TYPE_RSP,           /**< A response, caused by a previous request. */
-        MSG_TYPE_CONN_CLOSED,   /**< The connection is closed. */
-        MSG_TYPE_CONN_ERROR     /**< A connection error happened. */
-    };
-
-    /**
-     * A message for HTTP client/server handling.
+     * Widgets, which are released during hibernation. The weather data is
+     * kept, because the shown content is derived from it by prepare().
      */
-    struct Msg
+    struct View
     {
-        MsgType                 type;   /**< Message type */
-        DynamicJsonDocument*    rsp;    /**< Response, only valid if message type is a response. */
+        WidgetGroup             textCanvas;     /**< Canvas used for the text widget. */
+        WidgetGroup             iconCanvas;     /**< Canvas used for the bitmap widget. */
+        BitmapWidget            bitmapWidget;   /**< Bitmap widget, used to show the icon. */
+        TextWidget              textWidget;     /**< Text widget, used for showing the text. */
 
         /**
-         * Constructs a message.
+         * Constructs the view.
          */
-        Msg() :
-            type(MSG_TYPE_INVALID),
-            rsp(nullptr)
+        View() :
+            textCanvas(),
+            iconCanvas(),
+            bitmapWidget(),
+            textWidget("\\calign?")
         {
+            /* Move the text widget one line lower for better look. */
+            textWidget.move(0, 1);
         }
-    }; 
+    };
+
+    View*                       m_view;                     /**< Widgets, nullptr during hibernation. */
+    uint16_t                    m_width;                    /**< Display width in pixel */
+    uint16_t                    m_height;                   /**< Display height in pixel */
 
     /**
-     * Task proxy used to decouple server responses, which happen in a different task context.
+     * Create the view with the icon and the text.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool createView() final;
+
+    /**
+     * Destroy the view.
+     */
+    void destroyView() final;
+
+    /**
+     * Load the weather icon and text for the activation.
+     */
+    void prepareView() final;
+
+    /**
+     * Show the icon and the text. If the icon can't be loaded, the standard
+     * icon is shown. During hibernation nothing is shown.
+     *
+     * @param[in] icon  Full path to the icon
+     * @param[in] text  Text
      */
-    TaskProxy<Msg, 2U, 0U> m_taskProxy;
+    void showContent(const String& icon, const String& text);
 
     /**
      * Updates the text and icon, which to be displayed.
@@ -456,9 +462,14 @@ private:
     bool startHttpRequest(void);
 
     /**
-     * Register callback function on response reception.
+     * Parse the server response.
+     * It runs in the HTTP client task context.
+     *
+     * @param[in] rsp   Server response
+     *
+     * @return If successful, it will return the JSON document otherwise nullptr.
      */
-    void initHttpClient(void);
+    static DynamicJsonDocument* parseResponse(const HttpResponse& rsp);
 
     /**
      * Handle a web response from the server.
@@ -476,11 +487,6 @@ private:
      * Load configuration from JSON file.
      */
     bool loadConfiguration();
-
-    /**
-     * Clear the task proxy queue.
-     */
-    void clearQueue();
 };
 
 /******************************************************************************
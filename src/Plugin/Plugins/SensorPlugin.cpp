@@ -127,6 +127,9 @@ void SensorPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
+    m_textCanvas.setPosAndSize(0, 0, width, height);
+    (void)m_textCanvas.addWidget(m_textWidget);
+
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
      */
@@ -159,26 +162,65 @@ void SensorPlugin::stop()
     return;
 }
 
+void SensorPlugin::prepare()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    /* Reload configuration, if it was changed by direct editing.
+     * Changes by web request are already considered.
+     */
+    if ((true == consumeConfigurationChange()) &&
+        (true == loadConfiguration()))
+    {
+        m_sensorChannel = getChannel(m_sensorIdx, m_channelIdx);
+    }
+
+    m_isPrepared = true;
+
+    return;
+}
+
+void SensorPlugin::discardPreparation()
+{
+    /* No mutex, because a running preparation shall not block the caller.
+     * The flag is atomic.
+     */
+    m_isPrepared = false;
+
+    return;
+}
+
 void SensorPlugin::active(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
     UTIL_NOT_USED(gfx);
 
-    /* Load configuration, because it may be changed by web request
-     * or direct editing.
-     */
-    if (true == loadConfiguration())
+    /* Not prepared in advance, e.g. because activated on request? */
+    if (false == m_isPrepared.exchange(false))
     {
-        m_sensorChannel = getChannel(m_sensorIdx, m_channelIdx);
+        /* Reload configuration, if it was changed by direct editing.
+         * Changes by web request are already considered.
+         */
+        if ((true == consumeConfigurationChange()) &&
+            (true == loadConfiguration()))
+        {
+            m_sensorChannel = getChannel(m_sensorIdx, m_channelIdx);
+        }
     }
 
+    m_textCanvas.invalidate();
+
     return;
 }
 
 void SensorPlugin::inactive()
 {
-    /* Nothing to do. */
+    /* A preparation, which runs concurrently to the activation, is outdated
+     * at the next activation.
+     */
+    m_isPrepared = false;
+
     return;
 }
 
@@ -192,8 +234,7 @@ void SensorPlugin::update(YAGfx& gfx)
         m_updateTimer.start(UPDATE_PERIOD);
     }
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_textWidget.update(gfx);
+    (void)m_textCanvas.updateInvalidated(gfx);
 
     return;
 }
@@ -44,8 +44,10 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
+#include <atomic>
 #include "Plugin.hpp"
 
+#include <WidgetGroup.h>
 #include <TextWidget.h>
 #include <ISensorChannel.hpp>
 #include <SimpleTimer.hpp>
@@ -74,11 +76,13 @@ public:
      */
     SensorPlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
+        m_textCanvas(),
         m_textWidget(),
         m_mutex(),
         m_sensorIdx(0U),
         m_channelIdx(0U),
-        m_sensorChannel(nullptr)
+        m_sensorChannel(nullptr),
+        m_isPrepared(false)
     {
         /* Move the text widget one line lower for better look. */
         m_textWidget.move(0, 1);
@@ -161,6 +165,18 @@ public:
      */
     void stop() final;
 
+    /**
+     * This method will be called shortly before the plugin is set active.
+     * It loads the configuration, so the activation is fast.
+     */
+    void prepare() final;
+
+    /**
+     * This method will be called in case the preparation is discarded,
+     * because the plugin won't be set active next.
+     */
+    void discardPreparation() final;
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
@@ -213,11 +229,13 @@ private:
     /** Sensor value update period in ms. */
     static const uint32_t   UPDATE_PERIOD   = 2000U;
 
+    WidgetGroup             m_textCanvas;       /**< Canvas used for the text widget. */
     TextWidget              m_textWidget;       /**< Text widget, used for showing the text. */
     mutable MutexRecursive  m_mutex;            /**< Mutex to protect against concurrent access. */
     uint8_t                 m_sensorIdx;        /**< Index of selected sensor. */
     uint8_t                 m_channelIdx;       /**< Index of selected channel. */
     ISensorChannel*         m_sensorChannel;    /**< Values of this channel will be shown. */
+    std::atomic<bool>       m_isPrepared;       /**< Flag to indicate that the plugin was prepared for activation. */
     SimpleTimer             m_updateTimer;      /**< Sensor value update timer. */
 
     /**
@@ -122,13 +122,13 @@ void ShellyPlugSPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    m_width     = width;
+    m_height    = height;
 
-    (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        prepareView();
+    }
 
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
@@ -141,7 +141,6 @@ void ShellyPlugSPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
@@ -174,7 +173,9 @@ void ShellyPlugSPlugin::process()
     Msg                         msg;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    if ((true == m_requestTimer.isTimerRunning()) &&
+    /* During hibernation, a expired request is deferred until wake-up. */
+    if ((nullptr != m_view) &&
+        (true == m_requestTimer.isTimerRunning()) &&
         (true == m_requestTimer.isTimeout()))
     {
         if (false == startHttpRequest())
@@ -187,7 +188,8 @@ void ShellyPlugSPlugin::process()
         }
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if ((nullptr != m_view) &&
+        (true == receiveMsg(msg)))
     {
         switch(msg.type)
         {
@@ -204,6 +206,14 @@ void ShellyPlugSPlugin::process()
             }
             break;
 
+        case MSG_TYPE_CONN_CLOSED:
+            LOG_INFO("Connection closed.");
+            break;
+
+        case MSG_TYPE_CONN_ERROR:
+            LOG_WARNING("Connection error.");
+            break;
+
         default:
             /* Should never happen. */
             break;
@@ -213,13 +223,30 @@ void ShellyPlugSPlugin::process()
     return;
 }
 
+void ShellyPlugSPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
+
+    return;
+}
+
 void ShellyPlugSPlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    if (nullptr != m_view)
+    {
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
+        (void)m_view->textCanvas.updateInvalidated(gfx);
+    }
     
     return;
 }
@@ -256,17 +283,71 @@ String ShellyPlugSPlugin::getIPAddress() const
  * Private Methods
  *****************************************************************************/
 
+bool ShellyPlugSPlugin::createView()
+{
+    if (nullptr == m_view)
+    {
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+            (void)m_view->iconCanvas.addWidget(m_view->bitmapWidget);
+
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
+
+    return (nullptr != m_view);
+}
+
+void ShellyPlugSPlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
+    }
+
+    return;
+}
+
+void ShellyPlugSPlugin::prepareView()
+{
+    if (false == m_view->isIconLoaded)
+    {
+        m_view->isIconLoaded = m_view->bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
+    }
+
+    return;
+}
+
+String ShellyPlugSPlugin::getShownText() const
+{
+    return m_view->textWidget.getFormatStr();
+}
+
+void ShellyPlugSPlugin::setShownText(const String& text)
+{
+    m_view->textWidget.setFormatStr(text);
+
+    return;
+}
+
 bool ShellyPlugSPlugin::startHttpRequest()
 {
-    bool    status  = false;
-    String  url     = String("http://") + m_ipAddress + "/meter/0/";
-    wl_status_t connectionStatus    = WiFi.status();
+    bool                status              = false;
+    String              url                 = String("http://") + m_ipAddress + "/meter/0/";
+    wl_status_t         connectionStatus    = WiFi.status();
+    AsyncHttpClient*    client              = getHttpClient();
 
-    if (WL_CONNECTED == connectionStatus)
+    if ((nullptr != client) &&
+        (WL_CONNECTED == connectionStatus))
     {
-        if (true == m_client.begin(url))
+        if (true == client->begin(url))
         {
-            if (false == m_client.GET())
+            if (false == client->GET())
             {
                 LOG_WARNING("GET %s failed.", url.c_str());
             }
@@ -279,55 +360,38 @@ bool ShellyPlugSPlugin::startHttpRequest()
 
     return status;
 }
-void ShellyPlugSPlugin::initHttpClient()
+DynamicJsonDocument* ShellyPlugSPlugin::parseResponse(const HttpResponse& rsp)
 {
-    /* Note: All registered callbacks are running in a different task context!
-     *       Therefore it is not allowed to access a member here directly.
-     *       The processing must be deferred via task proxy.
-     */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
+    const size_t            JSON_DOC_SIZE   = 512U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+
+    if (nullptr != jsonDoc)
+    {
+        size_t                          payloadSize = 0U;
+        const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        const size_t                    FILTER_SIZE = 128U;
+        StaticJsonDocument<FILTER_SIZE> filter;
+        DeserializationError            error;
+
+        filter["power"] = true;
+
+        if (true == filter.overflowed())
         {
-            const size_t            JSON_DOC_SIZE   = 512U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+            LOG_ERROR("Less memory for filter available.");
+        }
+        
+        error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
 
-            if (nullptr != jsonDoc)
-            {
-                size_t                          payloadSize = 0U;
-                const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                const size_t                    FILTER_SIZE = 128U;
-                StaticJsonDocument<FILTER_SIZE> filter;
-                DeserializationError            error;
-
-                filter["power"] = true;
-
-                if (true == filter.overflowed())
-                {
-                    LOG_ERROR("Less memory for filter available.");
-                }
-                
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
-
-                if (DeserializationError::Ok != error.code())
-                {
-                    LOG_WARNING("JSON parse error: %s", error.c_str());
-                }
-                else
-                {
-                    Msg msg;
-
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
-
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
-            }
+        if (DeserializationError::Ok != error.code())
+        {
+            LOG_WARNING("JSON parse error: %s", error.c_str());
+
+            delete jsonDoc;
+            jsonDoc = nullptr;
         }
-    );
+    }
+
+    return jsonDoc;
 }
 
 void ShellyPlugSPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -358,7 +422,7 @@ void ShellyPlugSPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
         power += powerReducedPrecison;
         power += " W";
         
-        m_textWidget.setFormatStr(power);
+        m_view->textWidget.setFormatStr(power);
     }
 }
 
@@ -411,20 +475,6 @@ bool ShellyPlugSPlugin::loadConfiguration()
     return status;
 }
 
-void ShellyPlugSPlugin::clearQueue()
-{
-    Msg msg;
-
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -382,11 +382,10 @@ void SoundReactivePlugin::update(YAGfx& gfx)
     uint16_t                    barWidth        = gfx.getWidth() / m_numOfFreqBands;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    
     for(bandIdx = 0U; bandIdx < m_numOfFreqBands; ++bandIdx)
     {
-        int16_t peakY = 0;
+        int16_t peakY   = 0;
+        int16_t barY    = gfx.getHeight();
 
         /* The bar shall have a minium height of 2, otherwise it will be
          * overdrawn by the peak. The peak will be always on the top of
@@ -398,13 +397,25 @@ void SoundReactivePlugin::update(YAGfx& gfx)
 
             barColor.turnColorWheel((255U / (m_numOfFreqBands + 1U) * bandIdx));
 
+            barY = gfx.getHeight() - m_barHeight[bandIdx] + 1;
+
             gfx.fillRect(   bandIdx * barWidth,
-                            gfx.getHeight() - m_barHeight[bandIdx] + 1,
+                            barY,
                             barWidth,
                             m_barHeight[bandIdx] - 1U,
                             barColor);
         }
 
+        /* Clear only the region above the bar, instead of the whole display. */
+        if (0 < barY)
+        {
+            gfx.fillRect(   bandIdx * barWidth,
+                            0,
+                            barWidth,
+                            barY,
+                            ColorDef::BLACK);
+        }
+
         /* A peak height of 0 and 1 is handled equal, because is shall always
          * be shown at the bottom in these cases. In all others the peak is
          * on top of the bar.
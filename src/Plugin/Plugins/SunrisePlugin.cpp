@@ -144,13 +144,13 @@ void SunrisePlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-    (void)m_iconCanvas.addWidget(m_bitmapWidget);
+    m_width     = width;
+    m_height    = height;
 
-    (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        prepareView();
+    }
 
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
@@ -163,7 +163,6 @@ void SunrisePlugin::start(uint16_t width, uint16_t height)
         }
     }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
@@ -196,7 +195,9 @@ void SunrisePlugin::process()
     Msg                         msg;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
-    if ((true == m_requestTimer.isTimerRunning()) &&
+    /* During hibernation, a expired request is deferred until wake-up. */
+    if ((nullptr != m_view) &&
+        (true == m_requestTimer.isTimerRunning()) &&
         (true == m_requestTimer.isTimeout()))
     {
         if (false == startHttpRequest())
@@ -209,7 +210,8 @@ void SunrisePlugin::process()
         }
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if ((nullptr != m_view) &&
+        (true == receiveMsg(msg)))
     {
         switch(msg.type)
         {
@@ -226,6 +228,14 @@ void SunrisePlugin::process()
             }
             break;
 
+        case MSG_TYPE_CONN_CLOSED:
+            LOG_INFO("Connection closed.");
+            break;
+
+        case MSG_TYPE_CONN_ERROR:
+            LOG_WARNING("Connection error.");
+            break;
+
         default:
             /* Should never happen. */
             break;
@@ -235,13 +245,30 @@ void SunrisePlugin::process()
     return;
 }
 
+void SunrisePlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
+
+    return;
+}
+
 void SunrisePlugin::update(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    if (nullptr != m_view)
+    {
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
+        (void)m_view->textCanvas.updateInvalidated(gfx);
+    }
 
     return;
 }
@@ -283,14 +310,71 @@ void SunrisePlugin::setLocation(const String& longitude, const String& latitude)
  * Private Methods
  *****************************************************************************/
 
+bool SunrisePlugin::createView()
+{
+    if (nullptr == m_view)
+    {
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+            (void)m_view->iconCanvas.addWidget(m_view->bitmapWidget);
+
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
+
+    return (nullptr != m_view);
+}
+
+void SunrisePlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
+    }
+
+    return;
+}
+
+void SunrisePlugin::prepareView()
+{
+    if (false == m_view->isIconLoaded)
+    {
+        m_view->isIconLoaded = m_view->bitmapWidget.load(FILESYSTEM, IMAGE_PATH);
+    }
+
+    return;
+}
+
+String SunrisePlugin::getShownText() const
+{
+    return m_view->textWidget.getFormatStr();
+}
+
+void SunrisePlugin::setShownText(const String& text)
+{
+    m_view->textWidget.setFormatStr(text);
+
+    return;
+}
+
 bool SunrisePlugin::startHttpRequest()
 {
-    bool    status  = false;
-    String  url     = String("http://api.sunrise-sunset.org/json?lat=") + m_latitude + "&lng=" + m_longitude + "&formatted=0";
+    bool                status  = false;
+    String              url     = String("http://api.sunrise-sunset.org/json?lat=") + m_latitude + "&lng=" + m_longitude + "&formatted=0";
+    AsyncHttpClient*    client  = getHttpClient();
 
-    if (true == m_client.begin(url))
+    if (nullptr == client)
+    {
+        ;
+    }
+    else if (true == client->begin(url))
     {
-        if (false == m_client.GET())
+        if (false == client->GET())
         {
             LOG_WARNING("GET %s failed.", url.c_str());
         }
@@ -303,76 +387,59 @@ bool SunrisePlugin::startHttpRequest()
     return status;
 }
 
-void SunrisePlugin::initHttpClient()
+DynamicJsonDocument* SunrisePlugin::parseResponse(const HttpResponse& rsp)
 {
-    /* Note: All registered callbacks are running in a different task context!
-     *       Therefore it is not allowed to access a member here directly.
-     *       The processing must be deferred via task proxy.
-     */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
+
+    const size_t            JSON_DOC_SIZE   = 512U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+
+    if (nullptr != jsonDoc)
+    {
+        size_t                          payloadSize = 0U;
+        const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        const size_t                    FILTER_SIZE = 128U;
+        StaticJsonDocument<FILTER_SIZE> filter;
+        DeserializationError            error;
+
+        /* Example:
+        * {
+        *   "results":
+        *   {
+        *     "sunrise":"2015-05-21T05:05:35+00:00",
+        *     "sunset":"2015-05-21T19:22:59+00:00",
+        *     "solar_noon":"2015-05-21T12:14:17+00:00",
+        *     "day_length":51444,
+        *     "civil_twilight_begin":"2015-05-21T04:36:17+00:00",
+        *     "civil_twilight_end":"2015-05-21T19:52:17+00:00",
+        *     "nautical_twilight_begin":"2015-05-21T04:00:13+00:00",
+        *     "nautical_twilight_end":"2015-05-21T20:28:21+00:00",
+        *     "astronomical_twilight_begin":"2015-05-21T03:20:49+00:00",
+        *     "astronomical_twilight_end":"2015-05-21T21:07:45+00:00"
+        *   },
+        *    "status":"OK"
+        * }
+        */
+
+        filter["results"]["sunrise"]    = true;
+        filter["results"]["sunset"]     = true;
+
+        if (true == filter.overflowed())
         {
+            LOG_ERROR("Less memory for filter available.");
+        }
 
-            const size_t            JSON_DOC_SIZE   = 512U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+        error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
 
-            if (nullptr != jsonDoc)
-            {
-                size_t                          payloadSize = 0U;
-                const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                const size_t                    FILTER_SIZE = 128U;
-                StaticJsonDocument<FILTER_SIZE> filter;
-                DeserializationError            error;
-
-                /* Example:
-                * {
-                *   "results":
-                *   {
-                *     "sunrise":"2015-05-21T05:05:35+00:00",
-                *     "sunset":"2015-05-21T19:22:59+00:00",
-                *     "solar_noon":"2015-05-21T12:14:17+00:00",
-                *     "day_length":51444,
-                *     "civil_twilight_begin":"2015-05-21T04:36:17+00:00",
-                *     "civil_twilight_end":"2015-05-21T19:52:17+00:00",
-                *     "nautical_twilight_begin":"2015-05-21T04:00:13+00:00",
-                *     "nautical_twilight_end":"2015-05-21T20:28:21+00:00",
-                *     "astronomical_twilight_begin":"2015-05-21T03:20:49+00:00",
-                *     "astronomical_twilight_end":"2015-05-21T21:07:45+00:00"
-                *   },
-                *    "status":"OK"
-                * }
-                */
-
-                filter["results"]["sunrise"]    = true;
-                filter["results"]["sunset"]     = true;
-
-                if (true == filter.overflowed())
-                {
-                    LOG_ERROR("Less memory for filter available.");
-                }
-
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
-
-                if (DeserializationError::Ok != error.code())
-                {
-                    LOG_ERROR("Invalid JSON message received: %s", error.c_str());
-                }
-                else
-                {
-                    Msg msg;
-
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
-
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
-            }
+        if (DeserializationError::Ok != error.code())
+        {
+            LOG_ERROR("Invalid JSON message received: %s", error.c_str());
+
+            delete jsonDoc;
+            jsonDoc = nullptr;
         }
-    );
+    }
+
+    return jsonDoc;
 }
 
 void SunrisePlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -389,7 +456,7 @@ void SunrisePlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
     sunset  = addCurrentTimezoneValues(sunset);
 
     m_relevantResponsePart = sunrise + " / " + sunset;
-    m_textWidget.setFormatStr(m_relevantResponsePart);
+    m_view->textWidget.setFormatStr(m_relevantResponsePart);
 }
 
 String SunrisePlugin::addCurrentTimezoneValues(const String& dateTimeString) const
@@ -461,20 +528,6 @@ bool SunrisePlugin::loadConfiguration()
     return status;
 }
 
-void SunrisePlugin::clearQueue()
-{
-    Msg msg;
-
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
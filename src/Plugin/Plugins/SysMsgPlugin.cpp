@@ -58,14 +58,30 @@
  * Public Methods
  *****************************************************************************/
 
+void SysMsgPlugin::start(uint16_t width, uint16_t height)
+{
+    m_textCanvas.setPosAndSize(0, 0, width, height);
+    (void)m_textCanvas.addWidget(m_textWidget);
+
+    return;
+}
+
+void SysMsgPlugin::active(YAGfx& gfx)
+{
+    UTIL_NOT_USED(gfx);
+
+    m_textCanvas.invalidate();
+
+    return;
+}
+
 void SysMsgPlugin::update(YAGfx& gfx)
 {
     bool        isScrollingEnabled  = false;
     uint32_t    scrollingCnt        = 0U;
     bool        status              = false;
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_textWidget.update(gfx);
+    (void)m_textCanvas.updateInvalidated(gfx);
 
     status = m_textWidget.getScrollInfo(isScrollingEnabled, scrollingCnt);
 
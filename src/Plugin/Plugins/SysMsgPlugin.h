@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "Plugin.hpp"
 
+#include <WidgetGroup.h>
 #include <TextWidget.h>
 #include <SimpleTimer.hpp>
 
@@ -73,6 +74,7 @@ public:
      */
     SysMsgPlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
+        m_textCanvas(),
         m_textWidget(),
         m_timer(),
         m_duration(0U),
@@ -103,6 +105,26 @@ public:
         return new SysMsgPlugin(name, uid);
     }
 
+    /**
+     * Start the plugin. This is called only once during plugin lifetime.
+     * It can be used as deferred initialization (after the constructor)
+     * and provides the canvas size.
+     * 
+     * Overwrite it if your plugin needs to know that it was installed.
+     * 
+     * @param[in] width     Display width in pixel
+     * @param[in] height    Display height in pixel
+     */
+    void start(uint16_t width, uint16_t height) final;
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -122,6 +144,7 @@ public:
 
 private:
 
+    WidgetGroup m_textCanvas;   /**< Canvas used for the text widget. */
     TextWidget  m_textWidget;   /**< Text widget, used for showing the text. */
     SimpleTimer m_timer;        /**< Timer used to observer minimum duration */
     uint32_t    m_duration;     /**< Duration in ms, how long a non-scrolling text shall be shown. */
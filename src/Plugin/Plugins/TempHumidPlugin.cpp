@@ -164,6 +164,8 @@ void TempHumidPlugin::active(YAGfx& gfx)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
+    UTIL_NOT_USED(gfx);
+
     /* Set time to show page - either 10s or slot_time / 4
      * read here because otherwise we do not get config changes during runtime in slot_time.
      */
@@ -171,9 +173,8 @@ void TempHumidPlugin::active(YAGfx& gfx)
         m_pageTime = m_slotInterf->getDuration() / 4U;
     }
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
-    m_textCanvas.update(gfx);
+    m_iconCanvas.invalidate();
+    m_textCanvas.invalidate();
 
     return;
 }
@@ -210,12 +211,6 @@ void TempHumidPlugin::update(YAGfx& gfx)
 
     if (true == showPage)
     {
-        /* Clear display */
-        gfx.fillScreen(ColorDef::BLACK);
-        
-        m_iconCanvas.update(gfx);
-        m_textCanvas.update(gfx);
-
         switch(m_page)
         {
         case TEMPERATURE:
@@ -266,6 +261,9 @@ void TempHumidPlugin::update(YAGfx& gfx)
         }
     }
 
+    (void)m_iconCanvas.updateInvalidated(gfx);
+    (void)m_textCanvas.updateInvalidated(gfx);
+
     return;
 }
 
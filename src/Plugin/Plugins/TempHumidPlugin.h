@@ -164,6 +164,18 @@ public:
      */
     void process(void) final;    
 
+    /**
+     * Get the time in ms, until process() shall be called again.
+     * The plugin has only to read the sensor, if the sensor update timer
+     * expires.
+     *
+     * @return Process period in ms
+     */
+    uint32_t getProcessPeriod() const final
+    {
+        return m_sensorUpdateTimer.getRemaining();
+    }
+
     /**
      * This method will be called in case the plugin is set active, which means
      * it will be shown on the display in the next step.
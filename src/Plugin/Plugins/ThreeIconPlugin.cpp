@@ -38,6 +38,8 @@
 #include "FileSystem.h"
 
 #include <Logging.h>
+#include <PackedImgLoader.h>
+#include <IconStore.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -65,6 +67,9 @@ const char* ThreeIconPlugin::TOPIC_ICON                 = "/bitmap";
 /* Initialize bitmap image filename extension. */
 const char* ThreeIconPlugin::FILE_EXT_BITMAP            = ".bmp";
 
+/* Initialize packed image filename extension. */
+const char* ThreeIconPlugin::FILE_EXT_PACKED_IMG        = ".pim";
+
 /* Initialize sprite sheet parameter filename extension. */
 const char* ThreeIconPlugin::FILE_EXT_SPRITE_SHEET      = ".sprite";
 
@@ -252,12 +257,18 @@ void ThreeIconPlugin::start(uint16_t width, uint16_t height)
         /* If there is already an icon in the filesystem for the respective icon-slot, it will be loaded.
          * First check whether it is a animated sprite sheet and if not, try
          * to load just a bitmap image.
+         * A bitmap image, which was not converted yet, is converted once.
          */
-        m_isSpriteSheetAvailable[iconId] = m_bitmapWidget[iconId].loadSpriteSheet(FILESYSTEM, getFileName(iconId, FILE_EXT_SPRITE_SHEET), getFileName(iconId, FILE_EXT_BITMAP));
+        if (true == FILESYSTEM.exists(getFileName(iconId, FILE_EXT_BITMAP)))
+        {
+            (void)packBitmap(getFileName(iconId, FILE_EXT_BITMAP), getFileName(iconId, FILE_EXT_PACKED_IMG));
+        }
+
+        m_isSpriteSheetAvailable[iconId] = m_bitmapWidget[iconId].loadSpriteSheet(FILESYSTEM, getFileName(iconId, FILE_EXT_SPRITE_SHEET), getFileName(iconId, FILE_EXT_PACKED_IMG));
 
         if (false == m_isSpriteSheetAvailable[iconId])
         {   
-            (void)m_bitmapWidget[iconId].load(FILESYSTEM, getFileName(iconId, FILE_EXT_BITMAP));
+            (void)IconStore::getInstance().load(FILESYSTEM, getFileName(iconId, FILE_EXT_PACKED_IMG), m_bitmapWidget[iconId]);
         }
     }
 
@@ -276,6 +287,13 @@ void ThreeIconPlugin::stop()
             LOG_INFO("File %s removed", getFileName(iconId, FILE_EXT_BITMAP).c_str());
         }
 
+        IconStore::getInstance().remove(getFileName(iconId, FILE_EXT_PACKED_IMG));
+
+        if (false != FILESYSTEM.remove(getFileName(iconId, FILE_EXT_PACKED_IMG)))
+        {
+            LOG_INFO("File %s removed", getFileName(iconId, FILE_EXT_PACKED_IMG).c_str());
+        }
+
         if (false != FILESYSTEM.remove(getFileName(iconId, FILE_EXT_SPRITE_SHEET)))
         {
             LOG_INFO("File %s removed", getFileName(iconId, FILE_EXT_SPRITE_SHEET).c_str());
@@ -285,6 +303,17 @@ void ThreeIconPlugin::stop()
     return;
 }
 
+void ThreeIconPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    m_threeIconCanvas.invalidate();
+
+    return;
+}
+
 void ThreeIconPlugin::update(YAGfx& gfx)
 {
     uint8_t                     iconId = 0U;
@@ -299,8 +328,7 @@ void ThreeIconPlugin::update(YAGfx& gfx)
         }
     }   
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_threeIconCanvas.update(gfx);
+    (void)m_threeIconCanvas.updateInvalidated(gfx);
 
     return;
 }
@@ -312,7 +340,14 @@ bool ThreeIconPlugin::loadBitmap(const String& filename, uint8_t iconId)
 
     if (0U != filename.endsWith(FILE_EXT_BITMAP))
     {
-        status = m_bitmapWidget[iconId].load(FILESYSTEM, filename);
+        String pimFilename = filename;
+
+        pimFilename.replace(FILE_EXT_BITMAP, FILE_EXT_PACKED_IMG);
+
+        if (true == packBitmap(filename, pimFilename))
+        {
+            status = IconStore::getInstance().load(FILESYSTEM, pimFilename, m_bitmapWidget[iconId]);
+        }
 
         /* Ensure that only the bitmap image file exists in the filesystem,
          * otherwise after a restart, the obsolete sprite sheet will
@@ -327,11 +362,11 @@ bool ThreeIconPlugin::loadBitmap(const String& filename, uint8_t iconId)
     }
     else if (0U != filename.endsWith(FILE_EXT_SPRITE_SHEET))
     {
-        String bmpFilename = filename;
+        String pimFilename = filename;
 
-        bmpFilename.replace(FILE_EXT_SPRITE_SHEET, FILE_EXT_BITMAP);
+        pimFilename.replace(FILE_EXT_SPRITE_SHEET, FILE_EXT_PACKED_IMG);
 
-        status = m_bitmapWidget[iconId].loadSpriteSheet(FILESYSTEM, filename,  bmpFilename);
+        status = m_bitmapWidget[iconId].loadSpriteSheet(FILESYSTEM, filename,  pimFilename);
         
         m_isSpriteSheetAvailable[iconId] = status;
     }
@@ -418,6 +453,28 @@ void ThreeIconPlugin::setIsRepeat(uint8_t iconId, bool state)
         LOG_ERROR("Set isRepeat failed, invalid iconId.");
     }
 }
+
+bool ThreeIconPlugin::packBitmap(const String& bmpFilename, const String& pimFilename)
+{
+    bool            isSuccessful    = false;
+    PackedImgLoader loader;
+
+    /* Without run length encoding, the icon can be shown directly from the icon store. */
+    if (PackedImgLoader::RET_OK != loader.convert(FILESYSTEM, bmpFilename, pimFilename, false))
+    {
+        LOG_WARNING("Failed to convert %s.", bmpFilename.c_str());
+    }
+    else
+    {
+        (void)FILESYSTEM.remove(bmpFilename);
+        (void)IconStore::getInstance().store(FILESYSTEM, pimFilename);
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -167,6 +167,14 @@ public:
      */
     void stop() final;
 
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -177,6 +185,8 @@ public:
 
     /**
      * Load bitmap from filesystem.
+     * A bitmap image is converted to a packed image first, which replaces
+     * the bitmap image file in the filesystem.
      *
      * @param[in] filename  Bitmap filename.
      * @param[in] iconId    The icon id.
@@ -217,6 +227,11 @@ private:
      */
     static const char*      FILE_EXT_BITMAP;
 
+    /**
+     * Filename extension of packed image file.
+     */
+    static const char*      FILE_EXT_PACKED_IMG;
+
     /**
      * Filename extension of sprite sheet parameter file.
      */
@@ -275,6 +290,18 @@ private:
      */  
     void setIsRepeat(uint8_t iconId, bool state);
 
+    /**
+     * Convert a bitmap image file to a packed image file and remove the
+     * bitmap image file afterwards. A packed image is loaded without any
+     * decoding effort. It is put in the icon store too, which shows it
+     * directly from flash.
+     *
+     * @param[in] bmpFilename   Bitmap image filename
+     * @param[in] pimFilename   Packed image filename
+     *
+     * @return If successful converted, it will return true otherwise false.
+     */
+    bool packBitmap(const String& bmpFilename, const String& pimFilename);
 
 };
 
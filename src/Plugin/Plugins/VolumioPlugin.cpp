@@ -127,28 +127,16 @@ void VolumioPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
-
-    (void)m_iconCanvas.addWidget(m_stdIconWidget);
-    (void)m_iconCanvas.addWidget(m_stopIconWidget);
-    (void)m_iconCanvas.addWidget(m_playIconWidget);
-    (void)m_iconCanvas.addWidget(m_pauseIconWidget);
+    m_width     = width;
+    m_height    = height;
 
     /* Load all icons from filesystem now, to prevent filesystem
      * access during active/inactive/update methods.
      */
-    (void)m_stdIconWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
-    (void)m_stopIconWidget.load(FILESYSTEM, IMAGE_PATH_STOP_ICON);
-    (void)m_playIconWidget.load(FILESYSTEM, IMAGE_PATH_PLAY_ICON);
-    (void)m_pauseIconWidget.load(FILESYSTEM, IMAGE_PATH_PAUSE_ICON);
-
-    /* Disable all, except the standard icon. */
-    m_stopIconWidget.disable();
-    m_playIconWidget.disable();
-    m_pauseIconWidget.disable();
-
-    m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
-    (void)m_textCanvas.addWidget(m_textWidget);
+    if (true == createResources())
+    {
+        prepareView();
+    }
 
     /* Try to load configuration. If there is no configuration available, a default configuration
      * will be created.
@@ -161,12 +149,11 @@ void VolumioPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
-    initHttpClient();
     if (false == startHttpRequest())
     {
         /* If a request fails, show standard icon and a '?' */
         changeState(STATE_UNKNOWN);
-        m_textWidget.setFormatStr("\\calign?");
+        showText("\\calign?");
 
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
     }
@@ -208,7 +195,7 @@ void VolumioPlugin::process()
         {
             /* If a request fails, show standard icon and a '?' */
             changeState(STATE_UNKNOWN);
-            m_textWidget.setFormatStr("\\calign?");
+            showText("\\calign?");
 
             m_requestTimer.start(UPDATE_PERIOD_SHORT);
         }
@@ -218,7 +205,7 @@ void VolumioPlugin::process()
         }
     }
 
-    if (true == m_taskProxy.receive(msg))
+    if (true == receiveMsg(msg))
     {
         switch(msg.type)
         {
@@ -242,7 +229,7 @@ void VolumioPlugin::process()
             {
                 /* If a request fails, show standard icon and a '?' */
                 changeState(STATE_UNKNOWN);
-                m_textWidget.setFormatStr("\\calign?");
+                showText("\\calign?");
 
                 m_requestTimer.start(UPDATE_PERIOD_SHORT);
             }
@@ -272,22 +259,52 @@ void VolumioPlugin::process()
     return;
 }
 
+bool VolumioPlugin::isReady() const
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    return (STATE_PLAY == m_state);
+}
+
+void VolumioPlugin::active(YAGfx& gfx)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    UTIL_NOT_USED(gfx);
+
+    if (nullptr != m_view)
+    {
+        m_view->iconCanvas.invalidate();
+        m_view->textCanvas.invalidate();
+    }
+
+    return;
+}
+
 void VolumioPlugin::update(YAGfx& gfx)
 {
-    MutexGuard<MutexRecursive>  guard(m_mutex);
-    int16_t                     tcX         = 0;
-    int16_t                     tcY         = 0;
-    uint16_t                    posWidth    = m_textCanvas.getWidth() * m_pos / 100U;
-    Color                       posColor    = ColorDef::RED;
+    MutexGuard<MutexRecursive> guard(m_mutex);
 
-    gfx.fillScreen(ColorDef::BLACK);
-    m_iconCanvas.update(gfx);
+    if (nullptr != m_view)
+    {
+        int16_t     tcX         = 0;
+        int16_t     tcY         = 0;
+        uint16_t    posWidth    = m_view->textCanvas.getWidth() * m_pos / 100U;
+        Color       posColor    = ColorDef::RED;
 
-    m_textCanvas.getPos(tcX, tcY);
-    m_textCanvas.update(gfx);
+        (void)m_view->iconCanvas.updateInvalidated(gfx);
 
-    /* Draw a nice line to represent the current music position. */
-    gfx.drawHLine(tcX, m_textCanvas.getHeight() - 1, posWidth, posColor);
+        m_view->textCanvas.getPos(tcX, tcY);
+
+        /* Draw a nice line to represent the current music position.
+         * It is drawn over the text, therefore it must be drawn again after
+         * the text canvas was repainted.
+         */
+        if (true == m_view->textCanvas.updateInvalidated(gfx))
+        {
+            gfx.drawHLine(tcX, m_view->textCanvas.getHeight() - 1, posWidth, posColor);
+        }
+    }
 
     return;
 }
@@ -323,52 +340,151 @@ void VolumioPlugin::setHost(const String& host)
  * Private Methods
  *****************************************************************************/
 
-void VolumioPlugin::changeState(VolumioState state)
+bool VolumioPlugin::createView()
 {
-    /* Disable current icon */
-    switch(m_state)
+    if (nullptr == m_view)
     {
-    case STATE_UNKNOWN:
-        m_stdIconWidget.disable();
-        break;
+        m_view = new(std::nothrow) View();
+
+        if (nullptr != m_view)
+        {
+            BitmapWidget* iconWidget = nullptr;
+
+            m_view->iconCanvas.setPosAndSize(0, 0, ICON_WIDTH, ICON_HEIGHT);
+
+            (void)m_view->iconCanvas.addWidget(m_view->stdIconWidget);
+            (void)m_view->iconCanvas.addWidget(m_view->stopIconWidget);
+            (void)m_view->iconCanvas.addWidget(m_view->playIconWidget);
+            (void)m_view->iconCanvas.addWidget(m_view->pauseIconWidget);
+
+            /* Disable all, except the icon of the current player state. */
+            m_view->stdIconWidget.disable();
+            m_view->stopIconWidget.disable();
+            m_view->playIconWidget.disable();
+            m_view->pauseIconWidget.disable();
 
-    case STATE_STOP:
-        m_stopIconWidget.disable();
-        break;
+            iconWidget = getStateIconWidget(m_state);
 
-    case STATE_PLAY:
-        m_playIconWidget.disable();
-        break;
+            if (nullptr != iconWidget)
+            {
+                iconWidget->enable();
+            }
 
-    case STATE_PAUSE:
-        m_pauseIconWidget.disable();
-        break;
+            m_view->textCanvas.setPosAndSize(ICON_WIDTH, 0, m_width - ICON_WIDTH, m_height);
+            (void)m_view->textCanvas.addWidget(m_view->textWidget);
+        }
+    }
 
-    default:
-        break;
+    return (nullptr != m_view);
+}
+
+void VolumioPlugin::destroyView()
+{
+    if (nullptr != m_view)
+    {
+        delete m_view;
+        m_view = nullptr;
     }
 
-    /* Enable new icon */
-    switch(state)
+    return;
+}
+
+void VolumioPlugin::prepareView()
+{
+    if (false == m_view->areIconsLoaded)
+    {
+        bool isStdIconLoaded    = m_view->stdIconWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
+        bool isStopIconLoaded   = m_view->stopIconWidget.load(FILESYSTEM, IMAGE_PATH_STOP_ICON);
+        bool isPlayIconLoaded   = m_view->playIconWidget.load(FILESYSTEM, IMAGE_PATH_PLAY_ICON);
+        bool isPauseIconLoaded  = m_view->pauseIconWidget.load(FILESYSTEM, IMAGE_PATH_PAUSE_ICON);
+
+        m_view->areIconsLoaded = (true == isStdIconLoaded) &&
+                                 (true == isStopIconLoaded) &&
+                                 (true == isPlayIconLoaded) &&
+                                 (true == isPauseIconLoaded);
+    }
+
+    return;
+}
+
+String VolumioPlugin::getShownText() const
+{
+    return m_view->textWidget.getFormatStr();
+}
+
+void VolumioPlugin::setShownText(const String& text)
+{
+    m_view->textWidget.setFormatStr(text);
+
+    return;
+}
+
+BitmapWidget* VolumioPlugin::getStateIconWidget(VolumioState state)
+{
+    BitmapWidget* iconWidget = nullptr;
+
+    if (nullptr != m_view)
     {
-    case STATE_UNKNOWN:
-        m_stdIconWidget.enable();
-        break;
+        switch(state)
+        {
+        case STATE_UNKNOWN:
+            iconWidget = &m_view->stdIconWidget;
+            break;
 
-    case STATE_STOP:
-        m_stopIconWidget.enable();
-        break;
+        case STATE_STOP:
+            iconWidget = &m_view->stopIconWidget;
+            break;
 
-    case STATE_PLAY:
-        m_playIconWidget.enable();
-        break;
+        case STATE_PLAY:
+            iconWidget = &m_view->playIconWidget;
+            break;
 
-    case STATE_PAUSE:
-        m_pauseIconWidget.enable();
-        break;
-        
-    default:
-        break;
+        case STATE_PAUSE:
+            iconWidget = &m_view->pauseIconWidget;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return iconWidget;
+}
+
+void VolumioPlugin::showText(const String& text)
+{
+    if (nullptr != m_view)
+    {
+        m_view->textWidget.setFormatStr(text);
+    }
+    else if (false == storeShownText(text))
+    {
+        /* The default text is shown after wake-up, until the next response. */
+        LOG_WARNING("Text lost during hibernation.");
+    }
+    else
+    {
+        ;
+    }
+
+    return;
+}
+
+void VolumioPlugin::changeState(VolumioState state)
+{
+    BitmapWidget* currentIconWidget = getStateIconWidget(m_state);
+    BitmapWidget* newIconWidget     = getStateIconWidget(state);
+
+    /* Disable current icon */
+    if (nullptr != currentIconWidget)
+    {
+        currentIconWidget->disable();
+    }
+
+    /* Enable new icon */
+    if (nullptr != newIconWidget)
+    {
+        newIconWidget->enable();
     }
 
     m_state = state;
@@ -376,15 +492,17 @@ void VolumioPlugin::changeState(VolumioState state)
 
 bool VolumioPlugin::startHttpRequest()
 {
-    bool status = false;
+    bool                status  = false;
+    AsyncHttpClient*    client  = getHttpClient();
 
-    if (0 < m_volumioHost.length())
+    if ((nullptr != client) &&
+        (0 < m_volumioHost.length()))
     {
         String url = String("http://") + m_volumioHost + "/api/v1/getState";
 
-        if (true == m_client.begin(url))
+        if (true == client->begin(url))
         {
-            if (false == m_client.GET())
+            if (false == client->GET())
             {
                 LOG_WARNING("GET %s failed.", url.c_str());
             }
@@ -398,82 +516,43 @@ bool VolumioPlugin::startHttpRequest()
     return status;
 }
 
-void VolumioPlugin::initHttpClient()
+DynamicJsonDocument* VolumioPlugin::parseResponse(const HttpResponse& rsp)
 {
-    /* Note: All registered callbacks are running in a different task context!
-     *       Therefore it is not allowed to access a member here directly.
-     *       The processing must be deferred via task proxy.
-     */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
-        {
-            const size_t            JSON_DOC_SIZE   = 512U;
-            DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+    const size_t            JSON_DOC_SIZE   = 512U;
+    DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
 
-            if (nullptr != jsonDoc)
-            {
-                size_t                          payloadSize = 0U;
-                const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
-                const size_t                    FILTER_SIZE = 128U;
-                StaticJsonDocument<FILTER_SIZE> filter;
-                DeserializationError            error;
-
-                filter["artist"]    = true;
-                filter["duration"]  = true;
-                filter["seek"]      = true;
-                filter["service"]   = true;
-                filter["status"]    = true;
-                filter["title"]     = true;
-                
-                if (true == filter.overflowed())
-                {
-                    LOG_ERROR("Less memory for filter available.");
-                }
-
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
-
-                if (DeserializationError::Ok != error.code())
-                {
-                    LOG_WARNING("JSON parse error: %s", error.c_str());
-                }
-                else
-                {
-                    Msg msg;
-
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
-
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
-            }
-        }
-    );
-
-    m_client.regOnClosed(
-        [this]()
+    if (nullptr != jsonDoc)
+    {
+        size_t                          payloadSize = 0U;
+        const char*                     payload     = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
+        const size_t                    FILTER_SIZE = 128U;
+        StaticJsonDocument<FILTER_SIZE> filter;
+        DeserializationError            error;
+
+        filter["artist"]    = true;
+        filter["duration"]  = true;
+        filter["seek"]      = true;
+        filter["service"]   = true;
+        filter["status"]    = true;
+        filter["title"]     = true;
+        
+        if (true == filter.overflowed())
         {
-            Msg msg;
-
-            msg.type = MSG_TYPE_CONN_CLOSED;
-
-            (void)this->m_taskProxy.send(msg);
+            LOG_ERROR("Less memory for filter available.");
         }
-    );
 
-    m_client.regOnError(
-        [this]()
-        {
-            Msg msg;
+        error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
 
-            msg.type = MSG_TYPE_CONN_ERROR;
+        if (DeserializationError::Ok != error.code())
+        {
+            LOG_WARNING("JSON parse error: %s", error.c_str());
 
-            (void)this->m_taskProxy.send(msg);
+            delete jsonDoc;
+            jsonDoc = nullptr;
         }
-    );
+    }
+
+    return jsonDoc;
 }
 
 void VolumioPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -595,9 +674,20 @@ void VolumioPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
         }
 
         changeState(state);
-        m_textWidget.setFormatStr(infoOnDisplay);
+        showText(infoOnDisplay);
+
+        /* A changed music position requires to repaint the text canvas,
+         * because the position line is drawn over it.
+         */
+        if (m_pos != static_cast<uint8_t>(pos))
+        {
+            m_pos = static_cast<uint8_t>(pos);
 
-        m_pos = static_cast<uint8_t>(pos);
+            if (nullptr != m_view)
+            {
+                m_view->textCanvas.invalidate();
+            }
+        }
 
         /* Feed the offline timer to avoid that the plugin gets disabled. */
         m_offlineTimer.restart();
@@ -660,20 +750,6 @@ bool VolumioPlugin::loadConfiguration()
     return status;
 }
 
-void VolumioPlugin::clearQueue()
-{
-    Msg msg;
-
-    while(true == m_taskProxy.receive(msg))
-    {
-        if (MSG_TYPE_RSP == msg.type)
-        {
-            delete msg.rsp;
-            msg.rsp = nullptr;
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
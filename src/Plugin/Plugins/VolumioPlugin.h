@@ -44,14 +44,11 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
-#include "Plugin.hpp"
-#include "AsyncHttpClient.h"
+#include "HttpPlugin.h"
 
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
 #include <TextWidget.h>
-#include <TaskProxy.hpp>
-#include <Mutex.hpp>
 
 /******************************************************************************
  * Macros
@@ -69,7 +66,7 @@
  * Change VOLUMIO host address via REST API:
  * Text: POST \c "<base-uri>/host?set=<host-address>"
  */
-class VolumioPlugin : public Plugin
+class VolumioPlugin : public HttpPlugin
 {
 public:
 
@@ -80,31 +77,20 @@ public:
      * @param[in] uid   Unique id
      */
     VolumioPlugin(const String& name, uint16_t uid) :
-        Plugin(name, uid),
-        m_textCanvas(),
-        m_iconCanvas(),
-        m_stdIconWidget(),
-        m_stopIconWidget(),
-        m_playIconWidget(),
-        m_pauseIconWidget(),
-        m_textWidget("\\calign?"),
+        HttpPlugin(name, uid, parseResponse, true),
         m_volumioHost("volumio.fritz.box"),
         m_urlIcon(),
         m_urlText(),
-        m_client(),
         m_requestTimer(),
         m_offlineTimer(),
-        m_mutex(),
         m_isConnectionError(false),
         m_lastSeekValue(0U),
         m_pos(0U),
         m_state(STATE_UNKNOWN),
-        m_taskProxy()
+        m_view(nullptr),
+        m_width(0U),
+        m_height(0U)
     {
-        /* Move the text widget one line lower for better look. */
-        m_textWidget.move(0, 1);
-
-        (void)m_mutex.create();
     }
 
     /**
@@ -112,18 +98,7 @@ public:
      */
     ~VolumioPlugin()
     {
-        m_client.regOnResponse(nullptr);
-        m_client.regOnClosed(nullptr);
-        m_client.regOnError(nullptr);
-
-        /* Abort any pending TCP request to avoid getting a callback after the
-         * object is destroyed.
-         */
-        m_client.abort();
-        
-        clearQueue();
-
-        m_mutex.destroy();
+        destroyView();
     }
 
     /**
@@ -203,6 +178,22 @@ public:
      */
     void process(void) final;
 
+    /**
+     * Is the plugin ready to be shown?
+     * It is only ready while VOLUMIO plays, otherwise its slot is skipped.
+     *
+     * @return If ready, it will return true otherwise false.
+     */
+    bool isReady() const final;
+
+    /**
+     * This method will be called in case the plugin is set active, which means
+     * it will be shown on the display in the next step.
+     *
+     * @param[in] gfx   Display graphics interface
+     */
+    void active(YAGfx& gfx) final;
+
     /**
      * Update the display.
      * The scheduler will call this method periodically.
@@ -293,58 +284,100 @@ private:
      */
     static const uint32_t   OFFLINE_PERIOD      = (60U * 1000U);
 
-    WidgetGroup             m_textCanvas;               /**< Canvas used for the text widget. */
-    WidgetGroup             m_iconCanvas;               /**< Canvas used for the bitmap widget. */
-    BitmapWidget            m_stdIconWidget;            /**< Bitmap widget, used to show the standard icon. */
-    BitmapWidget            m_stopIconWidget;           /**< Bitmap widget, used to show the stop icon. */
-    BitmapWidget            m_playIconWidget;           /**< Bitmap widget, used to show the play icon. */
-    BitmapWidget            m_pauseIconWidget;          /**< Bitmap widget, used to show the pause icon. */
-    TextWidget              m_textWidget;               /**< Text widget, used for showing the text. */
     String                  m_volumioHost;              /**< Host address of the VOLUMIO server. */
     String                  m_urlIcon;                  /**< REST API URL for updating the icon */
     String                  m_urlText;                  /**< REST API URL for updating the text */
-    AsyncHttpClient         m_client;                   /**< Asynchronous HTTP client. */
     SimpleTimer             m_requestTimer;             /**< Timer used for cyclic request of new data. */
     SimpleTimer             m_offlineTimer;             /**< Timer used for offline detection. */
-    mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                    m_isConnectionError;        /**< Is connection error happened? */
     uint32_t                m_lastSeekValue;            /**< Last seek value, retrieved from VOLUMIO. Used to cross-check the provided status. */
     uint8_t                 m_pos;                      /**< Current music position in percent. */
     VolumioState            m_state;                    /**< Volumio player state */
 
     /**
-     * Defines the message types, which are necessary for HTTP client/server handling.
+     * Widgets, which are released during hibernation. The HTTP client and
+     * the task proxy are kept, because the player state is still polled to
+     * know whether the plugin is ready to be shown.
      */
-    enum MsgType
+    struct View
     {
-        MSG_TYPE_INVALID = 0,   /**< Invalid message type. */
-        MSG_TYPE_RSP,           /**< A response, caused by a previous request. */
-        MSG_TYPE_CONN_CLOSED,   /**< The connection is closed. */
-        MSG_TYPE_CONN_ERROR     /**< A connection error happened. */
-    };
-
-    /**
-     * A message for HTTP client/server handling.
-     */
-    struct Msg
-    {
-        MsgType                 type;   /**< Message type */
-        DynamicJsonDocument*    rsp;    /**< Response, only valid if message type is a response. */
+        WidgetGroup             textCanvas;         /**< Canvas used for the text widget. */
+        WidgetGroup             iconCanvas;         /**< Canvas used for the bitmap widget. */
+        BitmapWidget            stdIconWidget;      /**< Bitmap widget, used to show the standard icon. */
+        BitmapWidget            stopIconWidget;     /**< Bitmap widget, used to show the stop icon. */
+        BitmapWidget            playIconWidget;     /**< Bitmap widget, used to show the play icon. */
+        BitmapWidget            pauseIconWidget;    /**< Bitmap widget, used to show the pause icon. */
+        TextWidget              textWidget;         /**< Text widget, used for showing the text. */
+        bool                    areIconsLoaded;     /**< Are the icons loaded? */
 
         /**
-         * Constructs a message.
+         * Constructs the view.
          */
-        Msg() :
-            type(MSG_TYPE_INVALID),
-            rsp(nullptr)
+        View() :
+            textCanvas(),
+            iconCanvas(),
+            stdIconWidget(),
+            stopIconWidget(),
+            playIconWidget(),
+            pauseIconWidget(),
+            textWidget("\\calign?"),
+            areIconsLoaded(false)
         {
+            /* Move the text widget one line lower for better look. */
+            textWidget.move(0, 1);
         }
-    }; 
+    };
+
+    View*                   m_view;                     /**< Widgets, nullptr during hibernation. */
+    uint16_t                m_width;                    /**< Display width in pixel */
+    uint16_t                m_height;                   /**< Display height in pixel */
+
+    /**
+     * Create the view with the icons and the text.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool createView() final;
 
     /**
-     * Task proxy used to decouple server responses, which happen in a different task context.
+     * Destroy the view.
      */
-    TaskProxy<Msg, 2U, 0U> m_taskProxy;
+    void destroyView() final;
+
+    /**
+     * Load the icons, if they are not loaded yet.
+     */
+    void prepareView() final;
+
+    /**
+     * Get the shown text, which is kept during hibernation.
+     *
+     * @return Shown text
+     */
+    String getShownText() const final;
+
+    /**
+     * Restore the shown text after hibernation.
+     *
+     * @param[in] text  Shown text
+     */
+    void setShownText(const String& text) final;
+
+    /**
+     * Get the icon widget, which represents the player state.
+     *
+     * @param[in] state Player state
+     *
+     * @return Icon widget or nullptr, during hibernation.
+     */
+    BitmapWidget* getStateIconWidget(VolumioState state);
+
+    /**
+     * Show the text. During hibernation it is kept in the state blob.
+     *
+     * @param[in] text  Text
+     */
+    void showText(const String& text);
 
     /**
      * Change Volumio player state.
@@ -362,9 +395,14 @@ private:
     bool startHttpRequest(void);
 
     /**
-     * Register callback function on response reception.
+     * Parse the server response.
+     * It runs in the HTTP client task context.
+     *
+     * @param[in] rsp   Server response
+     *
+     * @return If successful, it will return the JSON document otherwise nullptr.
      */
-    void initHttpClient(void);
+    static DynamicJsonDocument* parseResponse(const HttpResponse& rsp);
 
     /**
      * Handle a web response from the server.
@@ -382,11 +420,6 @@ private:
      * Load configuration from JSON file.
      */
     bool loadConfiguration();
-
-    /**
-     * Clear the task proxy queue.
-     */
-    void clearQueue();
 };
 
 /******************************************************************************
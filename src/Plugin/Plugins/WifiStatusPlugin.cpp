@@ -87,7 +87,9 @@ void WifiStatusPlugin::stop()
 
 void WifiStatusPlugin::active(YAGfx& gfx)
 {
-    gfx.fillScreen(ColorDef::BLACK);
+    UTIL_NOT_USED(gfx);
+
+    m_textCanvas.invalidate();
 
     /* Force update of the status information */
     m_timer.start(0U);
@@ -140,15 +142,19 @@ void WifiStatusPlugin::update(YAGfx& gfx)
             m_toggle = true;
         }
 
-        gfx.fillScreen(ColorDef::BLACK);
+        /* The alert is drawn over the signal strength bars, therefore the
+         * whole icon is repainted.
+         */
+        gfx.fillRect(0, 0, WIFI_ICON_WIDTH, WIFI_ICON_HEIGHT, ColorDef::BLACK);
         updateWifiStatus(gfx, quality);
         m_iconCanvas.update(gfx);
-        m_textCanvas.update(gfx);
 
         /* Restart period */
         m_timer.start(PERIOD);
     }
-    
+
+    (void)m_textCanvas.updateInvalidated(gfx);
+
     return;
 }
 
@@ -40,9 +40,13 @@
 #include <Display.h>
 #include <SensorDataProvider.h>
 #include <Wire.h>
+#include <PoolAllocator.h>
+#include <BaseGfxAllocator.hpp>
+#include <ListAllocator.hpp>
 
 #include "ButtonDrv.h"
 #include "DisplayMgr.h"
+#include "IconStore.h"
 #include "SysMsg.h"
 #include "Version.h"
 #include "MyWebServer.h"
@@ -104,6 +108,9 @@
  * Prototypes
  *****************************************************************************/
 
+static void* poolAllocate(size_t size);
+static void poolDeallocate(void* ptr);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -124,6 +131,21 @@ void InitState::entry(StateMachine& sm)
     /* Show as soon as possible the user on the serial console that the system is booting. */
     showStartupInfoOnSerial();
 
+    /* Create the memory pools, before the plugins, list elements and bitmaps are allocated.
+     * Without them everything is allocated from the heap.
+     */
+    if (false == PoolAllocator::getInstance().begin())
+    {
+        LOG_WARNING("Couldn't create memory pools.");
+    }
+
+    /* The list elements and the bitmap pixel buffers are served by the memory
+     * pools too. If the pools are not available, the pool allocator falls back
+     * to the heap.
+     */
+    ListAllocator::setFunctions(poolAllocate, poolDeallocate);
+    BaseGfxAllocator::setFunctions(poolAllocate, poolDeallocate);
+
     /* Initialize two-wire (I2C) */
     if (false == Wire.begin())
     {
@@ -159,6 +181,12 @@ void InitState::entry(StateMachine& sm)
         /* Initialize sensors */
         SensorDataProvider::getInstance().begin();
 
+        /* Map the icon partition, before the plugins load their icons. */
+        if (false == IconStore::getInstance().begin())
+        {
+            LOG_WARNING("Icon store not available, icons are loaded into the heap.");
+        }
+
         /* Prepare everything for the plugins. */
         PluginMgr::getInstance().begin();
 
@@ -446,7 +474,7 @@ void InitState::registerPlugins()
 {
     PluginMgr&  pluginMgr = PluginMgr::getInstance();
 
-    /* Register in alphabetic order. */
+    /* Register in alphabetic order for readability, the registry is sorted anyway. */
 
     pluginMgr.registerPlugin("BTCQuotePlugin", BTCQuotePlugin::create);
     pluginMgr.registerPlugin("CountdownPlugin", CountdownPlugin::create);
@@ -514,3 +542,27 @@ void InitState::welcome()
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Allocate memory from the memory pools.
+ *
+ * @param[in] size  Size in byte
+ *
+ * @return If successful, it will return the memory otherwise nullptr.
+ */
+static void* poolAllocate(size_t size)
+{
+    return PoolAllocator::getInstance().allocate(size);
+}
+
+/**
+ * Deallocate memory, which was allocated from the memory pools.
+ *
+ * @param[in] ptr   Memory, which to deallocate.
+ */
+static void poolDeallocate(void* ptr)
+{
+    PoolAllocator::getInstance().deallocate(ptr);
+
+    return;
+}
@@ -38,6 +38,7 @@
 #include "DisplayMgr.h"
 #include "Version.h"
 #include "PluginMgr.h"
+#include "PluginBatch.h"
 #include "WiFiUtil.h"
 #include "FileSystem.h"
 
@@ -69,6 +70,8 @@ static void handleFadeEffect(AsyncWebServerRequest* request);
 static void handleSlots(AsyncWebServerRequest* request);
 static void handlePluginInstall(AsyncWebServerRequest* request);
 static void handlePluginUninstall(AsyncWebServerRequest* request);
+static void handlePluginBatch(AsyncWebServerRequest* request);
+static bool addBatchOperation(PluginBatch& batch, const String& op, const String& value);
 static void handlePlugins(AsyncWebServerRequest* request);
 static void handleSensors(AsyncWebServerRequest* request);
 static void handleSettings(AsyncWebServerRequest* request);
@@ -110,6 +113,7 @@ void RestApi::init(AsyncWebServer& srv)
     (void)srv.on("/rest/api/v1/display/slots", handleSlots);
     (void)srv.on("/rest/api/v1/plugin/install", handlePluginInstall);
     (void)srv.on("/rest/api/v1/plugin/uninstall", handlePluginUninstall);
+    (void)srv.on("/rest/api/v1/plugin/batch", handlePluginBatch);
     (void)srv.on("/rest/api/v1/plugins", handlePlugins);
     (void)srv.on("/rest/api/v1/sensors", handleSensors);
     (void)srv.on("/rest/api/v1/settings", handleSettings);
@@ -581,6 +585,160 @@ static void handlePluginUninstall(AsyncWebServerRequest* request)
     return;
 }
 
+/**
+ * Install, uninstall and move several plugins at once. The operations are
+ * applied in the given order and the plugin installation is saved only once.
+ * POST \c "/api/v1/plugin/batch?install=<plugin-name>&uninstall=<slot-id>&move=<plugin-uid>:<slot-id>"
+ *
+ * @param[in] request   HTTP request
+ */
+static void handlePluginBatch(AsyncWebServerRequest* request)
+{
+    String              content;
+    const size_t        JSON_DOC_SIZE   = 1024U;
+    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
+    PluginBatch         batch;
+
+    if (nullptr == request)
+    {
+        return;
+    }
+
+    if (HTTP_POST != request->method())
+    {
+        JsonObject errorObj = jsonDoc.createNestedObject("error");
+
+        /* Prepare response */
+        jsonDoc["status"]   = "error";
+        errorObj["msg"]     = "HTTP method not supported.";
+        httpStatusCode      = HttpStatus::STATUS_CODE_NOT_FOUND;
+    }
+    else
+    {
+        size_t  idx         = 0U;
+        bool    isValid     = true;
+
+        /* Collect all operations first, so a invalid request doesn't change anything. */
+        while((request->params() > idx) && (true == isValid))
+        {
+            AsyncWebParameter* param = request->getParam(idx);
+
+            if (nullptr != param)
+            {
+                isValid = addBatchOperation(batch, param->name(), param->value());
+            }
+
+            ++idx;
+        }
+
+        if ((false == isValid) ||
+            (0U == batch.getCount()))
+        {
+            JsonObject errorObj = jsonDoc.createNestedObject("error");
+
+            /* Prepare response */
+            jsonDoc["status"]   = "error";
+            errorObj["msg"]     = "Invalid operations.";
+            httpStatusCode      = HttpStatus::STATUS_CODE_NOT_FOUND;
+        }
+        else if (false == batch.execute())
+        {
+            JsonObject errorObj = jsonDoc.createNestedObject("error");
+
+            /* Prepare response */
+            jsonDoc["status"]   = "error";
+            errorObj["msg"]     = batch.getError();
+            errorObj["index"]   = batch.getFailedIndex();
+            httpStatusCode      = HttpStatus::STATUS_CODE_METHOD_NOT_ALLOWED;
+        }
+        else
+        {
+            JsonObject  dataObj     = jsonDoc.createNestedObject("data");
+            JsonArray   installed   = dataObj.createNestedArray("installed");
+
+            for(idx = 0U; idx < batch.getCount(); ++idx)
+            {
+                if (true == batch.isInstall(idx))
+                {
+                    JsonObject pluginObj = installed.createNestedObject();
+
+                    pluginObj["slotId"] = batch.getSlotId(idx);
+                    pluginObj["uid"]    = batch.getUID(idx);
+                }
+            }
+
+            /* Prepare response */
+            jsonDoc["status"]   = "ok";
+            httpStatusCode      = HttpStatus::STATUS_CODE_OK;
+        }
+    }
+
+    if (true == jsonDoc.overflowed())
+    {
+        LOG_ERROR("JSON document has less memory available.");
+    }
+    else
+    {
+        LOG_INFO("JSON document size: %u", jsonDoc.memoryUsage());
+    }
+
+    (void)serializeJsonPretty(jsonDoc, content);
+    request->send(httpStatusCode, "application/json", content);
+
+    return;
+}
+
+/**
+ * Add a operation to the plugin batch.
+ *
+ * @param[in] batch Plugin batch
+ * @param[in] op    Operation: install, uninstall or move
+ * @param[in] value Operation parameter
+ *
+ * @return If the operation is valid, it will return true otherwise false.
+ */
+static bool addBatchOperation(PluginBatch& batch, const String& op, const String& value)
+{
+    bool isValid = false;
+
+    if (op == "install")
+    {
+        if (false == value.isEmpty())
+        {
+            isValid = batch.addInstall(value);
+        }
+    }
+    else if (op == "uninstall")
+    {
+        uint8_t slotId = DisplayMgr::SLOT_ID_INVALID;
+
+        if (true == Util::strToUInt8(value, slotId))
+        {
+            isValid = batch.addUninstall(slotId);
+        }
+    }
+    else if (op == "move")
+    {
+        int         sepIdx  = value.indexOf(':');
+        uint16_t    uid     = 0U;
+        uint8_t     slotId  = DisplayMgr::SLOT_ID_INVALID;
+
+        if ((0 < sepIdx) &&
+            (true == Util::strToUInt16(value.substring(0, sepIdx), uid)) &&
+            (true == Util::strToUInt8(value.substring(sepIdx + 1), slotId)))
+        {
+            isValid = batch.addMove(uid, slotId);
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    return isValid;
+}
+
 /**
  * List all available plugins.
  * GET \c "/api/v1/plugins"
@@ -1688,6 +1846,9 @@ static void uploadHandler(AsyncWebServerRequest *request, const String& filename
         LOG_INFO("File %s successful written.", filename.c_str());
 
         fd.close();
+
+        /* A plugin, which configuration was overwritten, shall reload it. */
+        PluginMgr::getInstance().notifyFileChanged(filename);
     }
     else if (true == isError)
     {
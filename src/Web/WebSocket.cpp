@@ -44,6 +44,7 @@
 #include "WsCmdIperf.h"
 #include "WsCmdLog.h"
 #include "WsCmdMove.h"
+#include "WsCmdBatch.h"
 #include "WsCmdPlugins.h"
 #include "WsCmdReset.h"
 #include "WsCmdSlotDuration.h"
@@ -100,6 +101,9 @@ static WsCmdLog             gWsCmdLog;
 /** Websocket move command */
 static WsCmdMove            gWsCmdMove;
 
+/** Websocket batch command */
+static WsCmdBatch           gWsCmdBatch;
+
 /** Websocket slot duration command */
 static WsCmdSlotDuration    gWsCmdSlotDuration;
 
@@ -127,6 +131,7 @@ static WsCmd*       gWsCommands[] =
     &gWsCmdBrightness,
     &gWsCmdLog,
     &gWsCmdMove,
+    &gWsCmdBatch,
     &gWsCmdSlotDuration,
     &gWsCmdIperf,
     &gWsCmdButton,
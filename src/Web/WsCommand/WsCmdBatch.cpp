@@ -0,0 +1,241 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Websocket command to install, uninstall and move several plugins at once.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WsCmdBatch.h"
+#include "DisplayMgr.h"
+
+#include <Logging.h>
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void WsCmdBatch::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
+{
+    if ((nullptr == server) ||
+        (nullptr == client))
+    {
+        return;
+    }
+
+    /* Any error happended? */
+    if ((true == m_isError) ||
+        (PAR_STATE_OP != m_parState) ||
+        (0U == m_batch.getCount()))
+    {
+        server->text(client->id(), "NACK;\"Parameter invalid.\"");
+    }
+    else
+    {
+        String  rsp;
+
+        if (false == m_batch.execute())
+        {
+            rsp  = "NACK;\"";
+            rsp += m_batch.getError();
+            rsp += "\"";
+        }
+        else
+        {
+            const char  DELIMITER   = ';';
+            uint8_t     idx         = 0U;
+
+            rsp = "ACK";
+
+            /* Slot id and UID of every installed plugin, in order of the operations. */
+            for(idx = 0U; idx < m_batch.getCount(); ++idx)
+            {
+                if (true == m_batch.isInstall(idx))
+                {
+                    rsp += DELIMITER;
+                    rsp += m_batch.getSlotId(idx);
+                    rsp += DELIMITER;
+                    rsp += m_batch.getUID(idx);
+                }
+            }
+        }
+
+        server->text(client->id(), rsp);
+    }
+
+    m_isError   = false;
+    m_parState  = PAR_STATE_OP;
+    m_batch.clear();
+
+    return;
+}
+
+void WsCmdBatch::setPar(const char* par)
+{
+    switch(m_parState)
+    {
+    case PAR_STATE_OP:
+        if (0 == strcmp(par, "INSTALL"))
+        {
+            m_parState = PAR_STATE_INSTALL_NAME;
+        }
+        else if (0 == strcmp(par, "UNINSTALL"))
+        {
+            m_parState = PAR_STATE_UNINSTALL_SLOT_ID;
+        }
+        else if (0 == strcmp(par, "MOVE"))
+        {
+            m_parState = PAR_STATE_MOVE_UID;
+        }
+        else
+        {
+            m_isError = true;
+        }
+        break;
+
+    case PAR_STATE_INSTALL_NAME:
+        /* The name of the plugin is enclosed in "". */
+        if (2U < strlen(par))
+        {
+            String pluginName = par;
+
+            /* Remove the enclosing "" */
+            pluginName = pluginName.substring(1, pluginName.length() - 1);
+
+            if (false == m_batch.addInstall(pluginName))
+            {
+                m_isError = true;
+            }
+        }
+        else
+        {
+            m_isError = true;
+        }
+
+        m_parState = PAR_STATE_OP;
+        break;
+
+    case PAR_STATE_UNINSTALL_SLOT_ID:
+        {
+            uint8_t slotId = DisplayMgr::SLOT_ID_INVALID;
+
+            if (false == Util::strToUInt8(String(par), slotId))
+            {
+                LOG_ERROR("Conversion failed: %s", par);
+                m_isError = true;
+            }
+            else if (false == m_batch.addUninstall(slotId))
+            {
+                m_isError = true;
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        m_parState = PAR_STATE_OP;
+        break;
+
+    case PAR_STATE_MOVE_UID:
+        if (false == Util::strToUInt16(String(par), m_uid))
+        {
+            LOG_ERROR("Conversion failed: %s", par);
+            m_isError = true;
+        }
+
+        m_parState = PAR_STATE_MOVE_SLOT_ID;
+        break;
+
+    case PAR_STATE_MOVE_SLOT_ID:
+        {
+            uint8_t slotId = DisplayMgr::SLOT_ID_INVALID;
+
+            if (false == Util::strToUInt8(String(par), slotId))
+            {
+                LOG_ERROR("Conversion failed: %s", par);
+                m_isError = true;
+            }
+            else if (false == m_batch.addMove(m_uid, slotId))
+            {
+                m_isError = true;
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        m_parState = PAR_STATE_OP;
+        break;
+
+    default:
+        m_isError = true;
+        break;
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,126 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Websocket command to install, uninstall and move several plugins at once.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup web
+ *
+ * @{
+ */
+
+#ifndef __WSCMDBATCH_H__
+#define __WSCMDBATCH_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WsCmd.h"
+#include "PluginBatch.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Websocket command to install, uninstall and move several plugins at once.
+ * The plugin installation is saved only once.
+ */
+class WsCmdBatch: public WsCmd
+{
+public:
+
+    /**
+     * Constructs the websocket command.
+     */
+    WsCmdBatch() :
+        WsCmd("BATCH"),
+        m_isError(false),
+        m_parState(PAR_STATE_OP),
+        m_uid(0U),
+        m_batch()
+    {
+    }
+
+    /**
+     * Destroys websocket command.
+     */
+    ~WsCmdBatch()
+    {
+    }
+
+    /**
+     * Execute command.
+     *
+     * @param[in] server    Websocket server
+     * @param[in] client    Websocket client
+     */
+    void execute(AsyncWebSocket* server, AsyncWebSocketClient* client) final;
+
+    /**
+     * Set command parameter. Call this for each parameter, until executing it.
+     *
+     * @param[in] par   Parameter string
+     */
+    void setPar(const char* par) final;
+
+private:
+
+    /** Expected parameter */
+    enum ParState
+    {
+        PAR_STATE_OP = 0,           /**< Operation: INSTALL, UNINSTALL or MOVE */
+        PAR_STATE_INSTALL_NAME,     /**< Name of the plugin, which to install */
+        PAR_STATE_UNINSTALL_SLOT_ID,/**< Id of the slot, where to uninstall the plugin */
+        PAR_STATE_MOVE_UID,         /**< UID of the plugin, which to move */
+        PAR_STATE_MOVE_SLOT_ID      /**< Id of the slot, where to move the plugin */
+    };
+
+    bool        m_isError;  /**< Any error happened during parameter reception? */
+    ParState    m_parState; /**< Expected parameter */
+    uint16_t    m_uid;      /**< UID of plugin, which to move */
+    PluginBatch m_batch;    /**< Received operations */
+
+    WsCmdBatch(const WsCmdBatch& cmd);
+    WsCmdBatch& operator=(const WsCmdBatch& cmd);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __WSCMDBATCH_H__ */
+
+/** @} */
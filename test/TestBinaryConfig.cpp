@@ -0,0 +1,178 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test binary configuration.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestBinaryConfig.h"
+
+#include <unity.h>
+#include <BinaryConfig.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test binary configuration.
+ */
+extern void testBinaryConfig()
+{
+    const size_t    BUFFER_SIZE = 64U;
+    uint8_t         buffer[BUFFER_SIZE];
+    BinaryConfig    cfg(buffer, BUFFER_SIZE);
+    size_t          size        = 0U;
+    uint8_t         u8          = 0U;
+    uint16_t        u16         = 0U;
+    uint32_t        u32         = 0U;
+    int32_t         i32         = 0;
+    bool            flag        = false;
+    char            str[8];
+    char            longStr[BinaryConfig::MAX_STRING_LEN + 2U];
+
+    /* Nothing in the buffer is not a valid configuration. */
+    memset(buffer, 0, sizeof(buffer));
+    TEST_ASSERT_FALSE(cfg.beginRead(0U));
+    TEST_ASSERT_FALSE(cfg.beginRead(BUFFER_SIZE));
+    TEST_ASSERT_FALSE(cfg.readUInt8(u8));
+
+    /* Write all kind of fields. */
+    cfg.beginWrite(3U);
+    cfg.writeUInt8(0xA5U);
+    cfg.writeUInt16(0x1234U);
+    cfg.writeUInt32(0xDEADBEEFUL);
+    cfg.writeInt32(-4711);
+    cfg.writeBool(true);
+    cfg.writeString("DAYS");
+    cfg.writeString(nullptr);
+    TEST_ASSERT_TRUE(cfg.endWrite());
+    TEST_ASSERT_TRUE(cfg.isValid());
+    TEST_ASSERT_EQUAL_UINT32(BinaryConfig::HEADER_SIZE + 1U + 2U + 4U + 4U + 1U + 5U + 1U, cfg.getSize());
+    size = cfg.getSize();
+
+    /* Read them back. */
+    TEST_ASSERT_TRUE(cfg.beginRead(size));
+    TEST_ASSERT_EQUAL_UINT8(3U, cfg.getSchemaVersion());
+    TEST_ASSERT_TRUE(cfg.readUInt8(u8));
+    TEST_ASSERT_EQUAL_UINT8(0xA5U, u8);
+    TEST_ASSERT_TRUE(cfg.readUInt16(u16));
+    TEST_ASSERT_EQUAL_UINT16(0x1234U, u16);
+    TEST_ASSERT_TRUE(cfg.readUInt32(u32));
+    TEST_ASSERT_EQUAL_UINT32(0xDEADBEEFUL, u32);
+    TEST_ASSERT_TRUE(cfg.readInt32(i32));
+    TEST_ASSERT_EQUAL_INT32(-4711, i32);
+    TEST_ASSERT_TRUE(cfg.readBool(flag));
+    TEST_ASSERT_TRUE(flag);
+
+    /* A too small string buffer fails, but the string can be read again. */
+    TEST_ASSERT_FALSE(cfg.readString(str, 4U));
+    TEST_ASSERT_TRUE(cfg.readString(str, sizeof(str)));
+    TEST_ASSERT_EQUAL_STRING("DAYS", str);
+    TEST_ASSERT_TRUE(cfg.readString(str, sizeof(str)));
+    TEST_ASSERT_EQUAL_STRING("", str);
+
+    /* Fields beyond the end, e.g. of a newer schema, keep the default. */
+    u8 = 42U;
+    TEST_ASSERT_FALSE(cfg.readUInt8(u8));
+    TEST_ASSERT_EQUAL_UINT8(42U, u8);
+    TEST_ASSERT_TRUE(cfg.isValid());
+
+    /* The size must match exactly. */
+    TEST_ASSERT_FALSE(cfg.beginRead(size - 1U));
+    TEST_ASSERT_FALSE(cfg.beginRead(size + 1U));
+
+    /* A corrupted payload is detected. */
+    buffer[BinaryConfig::HEADER_SIZE] ^= 0x01U;
+    TEST_ASSERT_FALSE(cfg.beginRead(size));
+    TEST_ASSERT_FALSE(cfg.isValid());
+    buffer[BinaryConfig::HEADER_SIZE] ^= 0x01U;
+    TEST_ASSERT_TRUE(cfg.beginRead(size));
+
+    /* A unknown format version is rejected. */
+    buffer[2U] = BinaryConfig::FORMAT_VERSION + 1U;
+    TEST_ASSERT_FALSE(cfg.beginRead(size));
+
+    /* Too long strings are rejected. */
+    memset(longStr, 'x', sizeof(longStr) - 1U);
+    longStr[sizeof(longStr) - 1U] = '\0';
+    cfg.beginWrite(1U);
+    cfg.writeString(longStr);
+    TEST_ASSERT_FALSE(cfg.isValid());
+    TEST_ASSERT_FALSE(cfg.endWrite());
+
+    /* Writing beyond the buffer is an error. */
+    cfg.beginWrite(1U);
+    cfg.writeString("12345678901234567890");
+    cfg.writeString("12345678901234567890");
+    TEST_ASSERT_TRUE(cfg.isValid());
+    cfg.writeString("12345678901234567890");
+    TEST_ASSERT_FALSE(cfg.isValid());
+    TEST_ASSERT_FALSE(cfg.endWrite());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -94,6 +94,13 @@ extern void testBitmapWidget()
     uint16_t        height          = 0U;
     Color*          displayBuffer   = nullptr;
 
+    /* Uncompressed packed image with 2x1 pixels in RGB565 format: red, blue */
+    const uint8_t   packedImg[]     =
+    {
+        0x50, 0x49, 0x4D, 0x47, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0xF8, 0x1F, 0x00
+    };
+
     /* Verify widget type name */
     TEST_ASSERT_EQUAL_STRING(BitmapWidget::WIDGET_TYPE, bitmapWidget.getType());
 
@@ -149,6 +156,20 @@ extern void testBitmapWidget()
         }
     }
 
+    /* Map packed image, which is preferred to the bitmap. */
+    TEST_ASSERT_TRUE(bitmapWidget.map(packedImg, sizeof(packedImg)));
+    TEST_ASSERT_EQUAL_UINT16(2U, bitmapWidget.get().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(1U, bitmapWidget.get().getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmapWidget.get().getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmapWidget.get().getColor(1, 0));
+
+    /* Truncated packed image can't be mapped. */
+    TEST_ASSERT_FALSE(bitmapWidget.map(packedImg, sizeof(packedImg) - 1U));
+
+    /* Setting a bitmap unmaps the packed image. */
+    bitmapWidget.set(bitmap);
+    TEST_ASSERT_EQUAL_UINT16(BITMAP_WIDTH, bitmapWidget.get().getWidth());
+
     return;
 }
 
@@ -0,0 +1,175 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test fixed-block memory pool.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestBlockPool.h"
+
+#include <unity.h>
+#include <string.h>
+#include <BlockPool.h>
+#include <PoolAllocator.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test fixed-block memory pool.
+ */
+extern void testBlockPool()
+{
+    const uint16_t              BLOCK_COUNT = 4U;
+    BlockPool                   pool;
+    void*                       blocks[BLOCK_COUNT];
+    uint16_t                    idx         = 0U;
+    uint8_t                     poolIdx     = 0U;
+    PoolAllocator&              allocator   = PoolAllocator::getInstance();
+    PoolAllocator::Statistics   stats;
+    void*                       small       = nullptr;
+    void*                       large       = nullptr;
+
+    /* Without blocks, nothing can be allocated. */
+    TEST_ASSERT_NULL(pool.allocate());
+    TEST_ASSERT_FALSE(pool.create(0U, BLOCK_COUNT));
+    TEST_ASSERT_FALSE(pool.create(16U, 0U));
+
+    /* The block size is aligned. */
+    TEST_ASSERT_TRUE(pool.create(3U, BLOCK_COUNT));
+    TEST_ASSERT_EQUAL_UINT32(BlockPool::ALIGNMENT, pool.getBlockSize());
+    TEST_ASSERT_TRUE(pool.create(13U, BLOCK_COUNT));
+    TEST_ASSERT_EQUAL_UINT32(16U, pool.getBlockSize());
+    TEST_ASSERT_EQUAL_UINT16(BLOCK_COUNT, pool.getBlockCount());
+    TEST_ASSERT_EQUAL_UINT16(0U, pool.getUsedCount());
+
+    /* Allocate all blocks, which don't overlap. */
+    for(idx = 0U; idx < BLOCK_COUNT; ++idx)
+    {
+        blocks[idx] = pool.allocate();
+        TEST_ASSERT_NOT_NULL(blocks[idx]);
+        TEST_ASSERT_TRUE(pool.isOwner(blocks[idx]));
+        TEST_ASSERT_EQUAL_UINT32(0U, reinterpret_cast<size_t>(blocks[idx]) % BlockPool::ALIGNMENT);
+        memset(blocks[idx], idx, pool.getBlockSize());
+    }
+
+    for(idx = 0U; idx < BLOCK_COUNT; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT8(idx, static_cast<uint8_t*>(blocks[idx])[pool.getBlockSize() - 1U]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(BLOCK_COUNT, pool.getUsedCount());
+    TEST_ASSERT_EQUAL_UINT16(BLOCK_COUNT, pool.getPeakCount());
+
+    /* The pool is exhausted. */
+    TEST_ASSERT_NULL(pool.allocate());
+    TEST_ASSERT_EQUAL_UINT32(1U, pool.getFailCount());
+
+    /* A deallocated block is reused, foreign memory is ignored. */
+    pool.deallocate(blocks[1U]);
+    pool.deallocate(nullptr);
+    pool.deallocate(&idx);
+    TEST_ASSERT_FALSE(pool.isOwner(&idx));
+    TEST_ASSERT_EQUAL_UINT16(BLOCK_COUNT - 1U, pool.getUsedCount());
+    TEST_ASSERT_EQUAL_PTR(blocks[1U], pool.allocate());
+    TEST_ASSERT_EQUAL_UINT16(BLOCK_COUNT, pool.getPeakCount());
+
+    for(idx = 0U; idx < BLOCK_COUNT; ++idx)
+    {
+        pool.deallocate(blocks[idx]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(0U, pool.getUsedCount());
+    pool.release();
+    TEST_ASSERT_EQUAL_UINT16(0U, pool.getBlockCount());
+    TEST_ASSERT_NULL(pool.allocate());
+
+    /* The pool allocator serves a request by the smallest size class, which fits. */
+    TEST_ASSERT_TRUE(allocator.begin());
+    TEST_ASSERT_TRUE(allocator.begin());
+    TEST_ASSERT_LESS_THAN(allocator.getPoolCount(), 1U);
+    TEST_ASSERT_FALSE(allocator.getStatistics(allocator.getPoolCount(), stats));
+
+    TEST_ASSERT_TRUE(allocator.getStatistics(0U, stats));
+    idx = stats.usedCount;
+    small = allocator.allocate(1U);
+    TEST_ASSERT_NOT_NULL(small);
+    TEST_ASSERT_TRUE(allocator.getStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT16(idx + 1U, stats.usedCount);
+    allocator.deallocate(small);
+    TEST_ASSERT_TRUE(allocator.getStatistics(0U, stats));
+    TEST_ASSERT_EQUAL_UINT16(idx, stats.usedCount);
+
+    /* Larger than the largest size class is served by the heap. */
+    poolIdx = allocator.getPoolCount() - 1U;
+    TEST_ASSERT_TRUE(allocator.getStatistics(poolIdx, stats));
+    large = allocator.allocate(stats.blockSize + 1U);
+    TEST_ASSERT_NOT_NULL(large);
+    TEST_ASSERT_EQUAL_UINT32(1U, allocator.getOversizeCount());
+    allocator.deallocate(large);
+    allocator.deallocate(nullptr);
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -108,10 +108,61 @@ extern void testBmpImgLoader()
      * (1, 0) green
      * (0, 1) red
      * (1, 1) white
-     * 32 bpp, bitfield (not supported)
+     * 32 bpp, bitfield
      * No color palette
      */
-    TEST_ASSERT_EQUAL(BmpImgLoader::RET_FILE_FORMAT_UNSUPPORTED, loader.load(localFileSystem, "./test/test32bpp.bmp", bitmap));
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test32bpp.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(1, 1));
+
+    /* Load test image:
+     * 3x2 pixels, top-down
+     * (0, 0) red,  (1, 0) green, (2, 0) blue
+     * (0, 1) blue, (1, 1) green, (2, 1) red
+     * 4 bpp, no compression
+     * Color palette with 3 colors
+     */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test4bpp.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(3, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(2, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(2, 1));
+
+    /* Load test images:
+     * 4x2 pixels
+     * (0, 0) white, (1, 0) white, (2, 0) white, (3, 0) red
+     * (0, 1) red,   (1, 1) white, (2, 1) red,   (3, 1) white
+     * RLE8 and RLE4 compressed, with encoded and absolute runs
+     * Color palette with 2 colors
+     */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test8bppRle8.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(4, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(2, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(3, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(3, 1));
+
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test4bppRle4.bmp", bitmap));
+    TEST_ASSERT_EQUAL_UINT16(4, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(2, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(3, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(3, 1));
+
+    /* File not found */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_FILE_NOT_FOUND, loader.load(localFileSystem, "./test/notExisting.bmp", bitmap));
     TEST_ASSERT_FALSE(bitmap.isAllocated());
     TEST_ASSERT_EQUAL_UINT16(0, bitmap.getWidth());
     TEST_ASSERT_EQUAL_UINT16(0, bitmap.getHeight());
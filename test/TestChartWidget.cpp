@@ -0,0 +1,283 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test chart widgets.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestChartWidget.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <SampleBuffer.h>
+#include <ChartWidget.h>
+#include <GaugeWidget.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test sample buffer.
+ */
+extern void testSampleBuffer()
+{
+    const uint16_t  CAPACITY    = 4U;
+    const float     SAMPLES[]   = { 5.0F, 3.0F, 8.0F, 1.0F, 9.0F, 2.0F, 2.0F, 2.0F, 2.0F };
+    const float     MIN[]       = { 5.0F, 3.0F, 3.0F, 1.0F, 1.0F, 1.0F, 1.0F, 2.0F, 2.0F };
+    const float     MAX[]       = { 5.0F, 5.0F, 8.0F, 8.0F, 9.0F, 9.0F, 9.0F, 9.0F, 2.0F };
+
+    SampleBuffer    buffer;
+    uint16_t        idx         = 0U;
+    uint32_t        random      = 12345U;
+
+    /* Without capacity, no sample is stored. */
+    buffer.add(1.0F);
+    TEST_ASSERT_EQUAL_UINT16(0U, buffer.getCount());
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, buffer.getMin());
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, buffer.getMax());
+
+    /* Fill the buffer, the oldest samples are overwritten. */
+    TEST_ASSERT_TRUE(buffer.create(CAPACITY));
+    TEST_ASSERT_EQUAL_UINT16(CAPACITY, buffer.getCapacity());
+
+    for(idx = 0U; idx < (sizeof(SAMPLES) / sizeof(SAMPLES[0])); ++idx)
+    {
+        buffer.add(SAMPLES[idx]);
+        TEST_ASSERT_EQUAL_FLOAT(SAMPLES[idx], buffer.getLatest());
+        TEST_ASSERT_EQUAL_FLOAT(MIN[idx], buffer.getMin());
+        TEST_ASSERT_EQUAL_FLOAT(MAX[idx], buffer.getMax());
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(CAPACITY, buffer.getCount());
+    TEST_ASSERT_EQUAL_FLOAT(2.0F, buffer.get(0U));
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, buffer.get(CAPACITY));
+
+    /* Compare the incremental min./max. with the ones over all samples. */
+    buffer.clear();
+    TEST_ASSERT_EQUAL_UINT16(0U, buffer.getCount());
+
+    for(idx = 0U; idx < 200U; ++idx)
+    {
+        float       min         = 0.0F;
+        float       max         = 0.0F;
+        uint16_t    sampleIdx   = 0U;
+
+        random = random * 1103515245U + 12345U;
+        buffer.add(static_cast<float>((random >> 16U) % 100U));
+
+        min = buffer.get(0U);
+        max = min;
+
+        for(sampleIdx = 1U; sampleIdx < buffer.getCount(); ++sampleIdx)
+        {
+            float value = buffer.get(sampleIdx);
+
+            min = (value < min) ? value : min;
+            max = (value > max) ? value : max;
+        }
+
+        TEST_ASSERT_EQUAL_FLOAT(min, buffer.getMin());
+        TEST_ASSERT_EQUAL_FLOAT(max, buffer.getMax());
+    }
+
+    /* Copy keeps the samples and the order. */
+    {
+        SampleBuffer copy(buffer);
+
+        TEST_ASSERT_EQUAL_UINT16(buffer.getCount(), copy.getCount());
+
+        for(idx = 0U; idx < buffer.getCount(); ++idx)
+        {
+            TEST_ASSERT_EQUAL_FLOAT(buffer.get(idx), copy.get(idx));
+        }
+
+        TEST_ASSERT_EQUAL_FLOAT(buffer.getMin(), copy.getMin());
+        TEST_ASSERT_EQUAL_FLOAT(buffer.getMax(), copy.getMax());
+    }
+
+    buffer.release();
+    TEST_ASSERT_EQUAL_UINT16(0U, buffer.getCapacity());
+    TEST_ASSERT_EQUAL_UINT16(0U, buffer.getCount());
+
+    return;
+}
+
+/**
+ * Test chart widget.
+ */
+extern void testChartWidget()
+{
+    const Color     COLOR   = 0x00FF00;
+
+    TestGfx         testGfx;
+    ChartWidget     chart;
+    uint16_t        idx     = 0U;
+
+    TEST_ASSERT_EQUAL_STRING(ChartWidget::WIDGET_TYPE, chart.getType());
+    TEST_ASSERT_TRUE(chart.setSize(4U, 4U));
+    chart.setColor(COLOR);
+
+    /* Without samples, nothing is drawn. */
+    testGfx.fill(0U);
+    chart.update(testGfx);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 4U, 4U, 0U));
+
+    /* Only 2 samples, which are shown on the right side. */
+    chart.addSample(10.0F);
+    chart.addSample(20.0F);
+    TEST_ASSERT_TRUE(chart.isDirty());
+    chart.update(testGfx);
+    TEST_ASSERT_FALSE(chart.isDirty());
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 2U, 4U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(2, 3, 1U, 1U, COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(2, 0, 1U, 3U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(3, 0, 1U, 4U, COLOR));
+
+    /* Bar chart, scaled to min. and max. sample */
+    chart.clear();
+
+    for(idx = 0U; idx < 6U; ++idx)
+    {
+        chart.addSample(static_cast<float>(idx));
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(4U, chart.getSamples().getCount());
+
+    testGfx.fill(0U);
+    chart.update(testGfx);
+
+    for(idx = 0U; idx < 4U; ++idx)
+    {
+        TEST_ASSERT_TRUE(testGfx.verify(idx, 0, 1U, 3U - idx, 0U));
+        TEST_ASSERT_TRUE(testGfx.verify(idx, 3 - idx, 1U, idx + 1U, COLOR));
+    }
+
+    /* Line chart */
+    chart.setStyle(ChartWidget::STYLE_LINE);
+    testGfx.fill(0U);
+    chart.update(testGfx);
+
+    for(idx = 0U; idx < 4U; ++idx)
+    {
+        TEST_ASSERT_TRUE(testGfx.verify(idx, 3 - idx, 1U, 1U, COLOR));
+    }
+
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 1U, 3U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(3, 1, 1U, 3U, 0U));
+
+    /* Fixed range, values outside are limited. */
+    chart.setRange(3.0F, 4.0F);
+    testGfx.fill(0U);
+    chart.update(testGfx);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 3, 2U, 1U, COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(2, 0, 2U, 1U, COLOR));
+
+    return;
+}
+
+/**
+ * Test gauge widget.
+ */
+extern void testGaugeWidget()
+{
+    const Color     COLOR               = 0x00FF00;
+    const Color     BACKGROUND_COLOR    = 0x000010;
+
+    TestGfx         testGfx;
+    GaugeWidget     gauge(10U, 1U);
+
+    TEST_ASSERT_EQUAL_STRING(GaugeWidget::WIDGET_TYPE, gauge.getType());
+    gauge.setColor(COLOR);
+    gauge.setBackgroundColor(BACKGROUND_COLOR);
+
+    /* Horizontal gauge */
+    gauge.setValue(50.0F);
+    TEST_ASSERT_EQUAL_FLOAT(50.0F, gauge.getValue());
+    gauge.update(testGfx);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 5U, 1U, COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(5, 0, 5U, 1U, BACKGROUND_COLOR));
+
+    /* Same value doesn't invalidate it. */
+    gauge.setValue(50.0F);
+    TEST_ASSERT_FALSE(gauge.isDirty());
+
+    /* Values outside the range are limited. */
+    gauge.setValue(150.0F);
+    TEST_ASSERT_TRUE(gauge.isDirty());
+    gauge.update(testGfx);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 10U, 1U, COLOR));
+
+    /* Vertical gauge is filled from bottom to top. */
+    gauge.setSize(1U, 4U);
+    gauge.setRange(-10.0F, 10.0F);
+    gauge.setValue(-5.0F);
+    gauge.update(testGfx);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 1U, 3U, BACKGROUND_COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 3, 1U, 1U, COLOR));
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
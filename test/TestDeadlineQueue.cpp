@@ -0,0 +1,203 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test deadline queue.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestDeadlineQueue.h"
+
+#include <unity.h>
+#include <DeadlineQueue.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test deadline queue.
+ */
+extern void testDeadlineQueue()
+{
+    const uint8_t   CAPACITY                = 8U;
+    DeadlineQueue   queue;
+    uint8_t         id                      = 0U;
+    uint32_t        deadline                = 0U;
+    bool            isScheduled[CAPACITY];
+    uint32_t        deadlines[CAPACITY];
+    uint16_t        idx                     = 0U;
+    uint32_t        random                  = 12345U;
+
+    /* Without capacity, nothing can be scheduled. */
+    TEST_ASSERT_FALSE(queue.schedule(0U, 100U));
+    TEST_ASSERT_FALSE(queue.peek(id, deadline));
+    TEST_ASSERT_FALSE(queue.isScheduled(0U));
+
+    TEST_ASSERT_TRUE(queue.create(CAPACITY));
+    TEST_ASSERT_EQUAL_UINT8(CAPACITY, queue.getCapacity());
+    TEST_ASSERT_EQUAL_UINT8(0U, queue.getCount());
+    TEST_ASSERT_FALSE(queue.schedule(CAPACITY, 100U));
+
+    /* The earliest deadline is always on top. */
+    TEST_ASSERT_TRUE(queue.schedule(3U, 300U));
+    TEST_ASSERT_TRUE(queue.schedule(1U, 100U));
+    TEST_ASSERT_TRUE(queue.schedule(2U, 200U));
+    TEST_ASSERT_EQUAL_UINT8(3U, queue.getCount());
+    TEST_ASSERT_TRUE(queue.peek(id, deadline));
+    TEST_ASSERT_EQUAL_UINT8(1U, id);
+    TEST_ASSERT_EQUAL_UINT32(100U, deadline);
+
+    /* Rescheduling replaces the deadline. */
+    TEST_ASSERT_TRUE(queue.schedule(1U, 400U));
+    TEST_ASSERT_EQUAL_UINT8(3U, queue.getCount());
+    TEST_ASSERT_TRUE(queue.peek(id, deadline));
+    TEST_ASSERT_EQUAL_UINT8(2U, id);
+    TEST_ASSERT_TRUE(queue.getDeadline(1U, deadline));
+    TEST_ASSERT_EQUAL_UINT32(400U, deadline);
+
+    TEST_ASSERT_TRUE(queue.schedule(3U, 50U));
+    TEST_ASSERT_TRUE(queue.peek(id, deadline));
+    TEST_ASSERT_EQUAL_UINT8(3U, id);
+
+    /* Removed ids are not scheduled anymore. */
+    queue.remove(3U);
+    TEST_ASSERT_FALSE(queue.isScheduled(3U));
+    TEST_ASSERT_FALSE(queue.getDeadline(3U, deadline));
+    TEST_ASSERT_EQUAL_UINT8(2U, queue.getCount());
+    TEST_ASSERT_TRUE(queue.peek(id, deadline));
+    TEST_ASSERT_EQUAL_UINT8(2U, id);
+
+    /* A deadline after the timestamp overflow is later. */
+    queue.remove(1U);
+    queue.remove(2U);
+    TEST_ASSERT_FALSE(queue.peek(id, deadline));
+    TEST_ASSERT_TRUE(queue.schedule(4U, 0x00000010U));
+    TEST_ASSERT_TRUE(queue.schedule(5U, 0xFFFFFFF0U));
+    TEST_ASSERT_TRUE(queue.peek(id, deadline));
+    TEST_ASSERT_EQUAL_UINT8(5U, id);
+    queue.remove(4U);
+    queue.remove(5U);
+
+    /* Compare with a linear search over random operations. */
+    for(id = 0U; id < CAPACITY; ++id)
+    {
+        isScheduled[id] = false;
+        deadlines[id]   = 0U;
+    }
+
+    for(idx = 0U; idx < 500U; ++idx)
+    {
+        uint8_t     expectedId  = CAPACITY;
+        uint8_t     count       = 0U;
+
+        random  = random * 1103515245U + 12345U;
+        id      = (random >> 16U) % CAPACITY;
+
+        if (0U == ((random >> 8U) % 4U))
+        {
+            queue.remove(id);
+            isScheduled[id] = false;
+        }
+        else
+        {
+            deadlines[id] = (random >> 4U) % 1000U;
+            TEST_ASSERT_TRUE(queue.schedule(id, deadlines[id]));
+            isScheduled[id] = true;
+        }
+
+        for(id = 0U; id < CAPACITY; ++id)
+        {
+            if (true == isScheduled[id])
+            {
+                ++count;
+
+                if ((CAPACITY == expectedId) ||
+                    (deadlines[expectedId] > deadlines[id]))
+                {
+                    expectedId = id;
+                }
+            }
+        }
+
+        TEST_ASSERT_EQUAL_UINT8(count, queue.getCount());
+
+        if (CAPACITY == expectedId)
+        {
+            TEST_ASSERT_FALSE(queue.peek(id, deadline));
+        }
+        else
+        {
+            TEST_ASSERT_TRUE(queue.peek(id, deadline));
+            TEST_ASSERT_EQUAL_UINT32(deadlines[expectedId], deadline);
+        }
+    }
+
+    queue.release();
+    TEST_ASSERT_EQUAL_UINT8(0U, queue.getCapacity());
+    TEST_ASSERT_FALSE(queue.peek(id, deadline));
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -53,10 +53,16 @@
  * Prototypes
  *****************************************************************************/
 
+static void* countingAllocate(size_t size);
+static void countingDeallocate(void* ptr);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
 
+/** Number of list elements, which are allocated by the list allocator. */
+static int32_t  gAllocatedElements  = 0;
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -229,9 +235,55 @@ extern void testDoublyLinkedList()
     TEST_ASSERT_TRUE(it.find(max));
     TEST_ASSERT_EQUAL(max, *it.current());
 
+    /* The list elements are allocated by the injected allocation functions. */
+    {
+        DLinkedList<uint32_t>   allocatorList;
+        uint32_t                element         = 1U;
+
+        ListAllocator::setFunctions(countingAllocate, countingDeallocate);
+        TEST_ASSERT_TRUE(allocatorList.append(element));
+        TEST_ASSERT_TRUE(allocatorList.append(element));
+        TEST_ASSERT_EQUAL_INT32(2, gAllocatedElements);
+        allocatorList.clear();
+        TEST_ASSERT_EQUAL_INT32(0, gAllocatedElements);
+        ListAllocator::setFunctions(nullptr, nullptr);
+    }
+
     return;
 }
 
 /******************************************************************************
  * Local Functions
- *****************************************************************************/
\ No newline at end of file
+ *****************************************************************************/
+
+/**
+ * Allocate memory from the heap and count the allocated list elements.
+ *
+ * @param[in] size  Size in byte
+ *
+ * @return If successful, it will return the memory otherwise nullptr.
+ */
+static void* countingAllocate(size_t size)
+{
+    void* ptr = ::operator new(size, std::nothrow);
+
+    if (nullptr != ptr)
+    {
+        ++gAllocatedElements;
+    }
+
+    return ptr;
+}
+
+/**
+ * Deallocate memory from the heap and count the allocated list elements.
+ *
+ * @param[in] ptr   Memory, which to deallocate.
+ */
+static void countingDeallocate(void* ptr)
+{
+    --gAllocatedElements;
+    ::operator delete(ptr);
+
+    return;
+}
\ No newline at end of file
@@ -0,0 +1,392 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test procedural effects.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestEffects.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <math.h>
+#include <FxMath.h>
+#include <XorShift.hpp>
+#include <ValueNoise.h>
+#include <PlasmaWidget.h>
+#include <NoiseFlowWidget.h>
+#include <StarfieldWidget.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint16_t countLitPixels(const TestGfx& gfx, int16_t posX, int16_t posY, uint16_t width, uint16_t height);
+static bool isEqual(const TestGfx& gfx, const uint32_t* frame);
+static void storeFrame(const TestGfx& gfx, uint32_t* frame);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test fixed-point effect math.
+ */
+extern void testFxMath()
+{
+    const double    PI_2        = 2.0 * 3.14159265358979;
+    const int32_t   TOLERANCE   = 32;
+    uint32_t        theta       = 0U;
+    int16_t         last        = -1;
+
+    /* 8-bit sine at the quadrant borders */
+    TEST_ASSERT_EQUAL_UINT8(128U, FxMath::sin8(0U));
+    TEST_ASSERT_EQUAL_UINT8(255U, FxMath::sin8(64U));
+    TEST_ASSERT_EQUAL_UINT8(128U, FxMath::sin8(128U));
+    TEST_ASSERT_EQUAL_UINT8(1U, FxMath::sin8(192U));
+    TEST_ASSERT_EQUAL_UINT8(255U, FxMath::cos8(0U));
+
+    /* 16-bit sine at the quadrant borders */
+    TEST_ASSERT_EQUAL_INT16(0, FxMath::sin16(0U));
+    TEST_ASSERT_EQUAL_INT16(32767, FxMath::sin16(16384U));
+    TEST_ASSERT_EQUAL_INT16(0, FxMath::sin16(32768U));
+    TEST_ASSERT_EQUAL_INT16(-32767, FxMath::sin16(49152U));
+    TEST_ASSERT_EQUAL_INT16(32767, FxMath::cos16(0U));
+
+    /* The interpolated 16-bit sine stays close to the real one and
+     * rises monotonic in the first quadrant.
+     */
+    for(theta = 0U; theta <= UINT16_MAX; theta += 37U)
+    {
+        int16_t value   = FxMath::sin16(theta);
+        int32_t real    = static_cast<int32_t>(lround(32767.0 * sin(PI_2 * theta / 65536.0)));
+
+        TEST_ASSERT_LESS_OR_EQUAL(TOLERANCE, abs(value - real));
+
+        if (16384U >= theta)
+        {
+            TEST_ASSERT_GREATER_THAN(last, value);
+            last = value;
+        }
+    }
+
+    /* Helper */
+    TEST_ASSERT_EQUAL_UINT8(127U, FxMath::scale8(255U, 128U));
+    TEST_ASSERT_EQUAL_UINT8(0U, FxMath::scale8(255U, 0U));
+    TEST_ASSERT_EQUAL_UINT8(100U, FxMath::lerp8(0U, 200U, 128U));
+    TEST_ASSERT_EQUAL_UINT8(100U, FxMath::lerp8(200U, 0U, 128U));
+    TEST_ASSERT_EQUAL_UINT8(0U, FxMath::ease8(0U));
+    TEST_ASSERT_EQUAL_UINT8(128U, FxMath::ease8(128U));
+    TEST_ASSERT_EQUAL_UINT8(255U, FxMath::ease8(255U));
+
+    return;
+}
+
+/**
+ * Test xorshift pseudo random number generator.
+ */
+extern void testXorShift()
+{
+    XorShift32  rng(1U);
+    XorShift32  rngZero(0U);
+    XorShift32  rngDefault;
+    uint16_t    idx         = 0U;
+
+    /* Known sequence of Marsaglia's xorshift32 with seed 1 */
+    TEST_ASSERT_EQUAL_UINT32(270369U, rng.next());
+    TEST_ASSERT_EQUAL_UINT32(67634689U, rng.next());
+
+    /* A zero seed would stop the generator, it is replaced by the default seed. */
+    TEST_ASSERT_EQUAL_UINT32(rngDefault.next(), rngZero.next());
+    TEST_ASSERT_NOT_EQUAL(0U, rngZero.next());
+
+    /* Numbers stay in range. */
+    for(idx = 0U; idx < 1000U; ++idx)
+    {
+        uint16_t value = rng.nextRange(10U);
+
+        TEST_ASSERT_LESS_THAN(10U, value);
+
+        value = rng.nextRange(5U, 8U);
+        TEST_ASSERT_GREATER_OR_EQUAL(5U, value);
+        TEST_ASSERT_LESS_THAN(8U, value);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(5U, rng.nextRange(5U, 5U));
+    TEST_ASSERT_EQUAL_UINT16(0U, rng.nextRange(0U));
+
+    return;
+}
+
+/**
+ * Test value noise.
+ */
+extern void testValueNoise()
+{
+    ValueNoise  noise(42U);
+    ValueNoise  otherNoise(43U);
+    uint32_t    x           = 0U;
+    uint8_t     last        = 0U;
+    uint16_t    differences = 0U;
+
+    /* Same position, same value. */
+    TEST_ASSERT_EQUAL_UINT8(noise.noise2(1000U, 2000U), noise.noise2(1000U, 2000U));
+
+    /* A z-coordinate without fraction slices the 2D field. */
+    TEST_ASSERT_EQUAL_UINT8(noise.noise2(1000U, 2000U), noise.noise3(1000U, 2000U, 0U));
+
+    /* The noise is smooth, neighbour positions differ only a little bit. */
+    last = noise.noise2(0U, 300U);
+
+    for(x = 1U; x < 4096U; ++x)
+    {
+        uint8_t value = noise.noise2(x, 300U);
+
+        TEST_ASSERT_LESS_OR_EQUAL(3, abs(static_cast<int16_t>(value) - last));
+        last = value;
+    }
+
+    last = noise.noise3(300U, 300U, 0U);
+
+    for(x = 1U; x < 4096U; ++x)
+    {
+        uint8_t value = noise.noise3(300U, 300U, x);
+
+        TEST_ASSERT_LESS_OR_EQUAL(3, abs(static_cast<int16_t>(value) - last));
+        last = value;
+    }
+
+    /* The seed selects a different field. */
+    for(x = 0U; x < 16U; ++x)
+    {
+        if (noise.noise2(x << 8U, 0U) != otherNoise.noise2(x << 8U, 0U))
+        {
+            ++differences;
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN(8U, differences);
+
+    return;
+}
+
+/**
+ * Test effect widgets.
+ */
+extern void testEffectWidgets()
+{
+    const uint16_t  WIDTH       = 16U;
+    const uint16_t  HEIGHT      = 4U;
+    const int16_t   POS_X       = 8;
+    const int16_t   POS_Y       = 2;
+    const Color     FILL_COLOR  = ColorDef::RED;
+
+    TestGfx         testGfx;
+    PlasmaWidget    plasma(WIDTH, HEIGHT);
+    NoiseFlowWidget noiseFlow(WIDTH, HEIGHT);
+    StarfieldWidget starfield(WIDTH, HEIGHT);
+    uint32_t        frame[TestGfx::WIDTH * TestGfx::HEIGHT];
+    uint8_t         idx         = 0U;
+
+    /* Plasma covers its whole area with colors and is animated. */
+    TEST_ASSERT_EQUAL_STRING(PlasmaWidget::WIDGET_TYPE, plasma.getType());
+    testGfx.fill(FILL_COLOR);
+    plasma.move(POS_X, POS_Y);
+    plasma.update(testGfx);
+    TEST_ASSERT_TRUE(plasma.isDirty());
+    TEST_ASSERT_EQUAL_UINT16(WIDTH * HEIGHT, countLitPixels(testGfx, POS_X, POS_Y, WIDTH, HEIGHT));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, POS_Y, FILL_COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(0, POS_Y, POS_X, HEIGHT, FILL_COLOR));
+
+    storeFrame(testGfx, frame);
+    plasma.update(testGfx);
+    TEST_ASSERT_FALSE(isEqual(testGfx, frame));
+
+    /* Without speed, the effect is frozen. */
+    plasma.setSpeed(0U);
+    plasma.update(testGfx);
+    storeFrame(testGfx, frame);
+    plasma.update(testGfx);
+    TEST_ASSERT_TRUE(isEqual(testGfx, frame));
+
+    /* A disabled effect is not animated. */
+    plasma.disable();
+    plasma.update(testGfx);
+    TEST_ASSERT_FALSE(plasma.isDirty());
+
+    /* Noise flow covers its whole area with colors and is animated. */
+    TEST_ASSERT_EQUAL_STRING(NoiseFlowWidget::WIDGET_TYPE, noiseFlow.getType());
+    testGfx.fill(FILL_COLOR);
+    noiseFlow.update(testGfx);
+    TEST_ASSERT_EQUAL_UINT16(WIDTH * HEIGHT, countLitPixels(testGfx, 0, 0, WIDTH, HEIGHT));
+    TEST_ASSERT_TRUE(testGfx.verify(WIDTH, 0, TestGfx::WIDTH - WIDTH, TestGfx::HEIGHT, FILL_COLOR));
+
+    storeFrame(testGfx, frame);
+
+    for(idx = 0U; idx < 16U; ++idx)
+    {
+        noiseFlow.update(testGfx);
+    }
+
+    TEST_ASSERT_FALSE(isEqual(testGfx, frame));
+
+    /* Starfield clears its area and shows at most one pixel per star. */
+    TEST_ASSERT_EQUAL_STRING(StarfieldWidget::WIDGET_TYPE, starfield.getType());
+    starfield.setStarCount(StarfieldWidget::MAX_STARS + 1U);
+    TEST_ASSERT_EQUAL_UINT8(StarfieldWidget::MAX_STARS, starfield.getStarCount());
+    starfield.setStarCount(8U);
+    starfield.setSeed(1U);
+    starfield.move(POS_X, POS_Y);
+    testGfx.fill(FILL_COLOR);
+
+    for(idx = 0U; idx < 64U; ++idx)
+    {
+        starfield.update(testGfx);
+        TEST_ASSERT_LESS_OR_EQUAL(8U, countLitPixels(testGfx, POS_X, POS_Y, WIDTH, HEIGHT));
+    }
+
+    TEST_ASSERT_GREATER_THAN(0U, countLitPixels(testGfx, POS_X, POS_Y, WIDTH, HEIGHT));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, POS_Y, FILL_COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(0, POS_Y, POS_X, HEIGHT, FILL_COLOR));
+    TEST_ASSERT_TRUE(testGfx.verify(POS_X + WIDTH, POS_Y, TestGfx::WIDTH - POS_X - WIDTH, HEIGHT, FILL_COLOR));
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Count the pixels in the given area, which are not black.
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] posX      Upper left corner (x-coordinate)
+ * @param[in] posY      Upper left corner (y-coordinate)
+ * @param[in] width     Width in pixel
+ * @param[in] height    Height in pixel
+ *
+ * @return Number of pixels, which are not black.
+ */
+static uint16_t countLitPixels(const TestGfx& gfx, int16_t posX, int16_t posY, uint16_t width, uint16_t height)
+{
+    uint16_t    count   = 0U;
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+
+    for(y = 0U; y < height; ++y)
+    {
+        for(x = 0U; x < width; ++x)
+        {
+            if (0U != static_cast<uint32_t>(gfx.getColor(posX + x, posY + y)))
+            {
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Compare the whole canvas with a stored frame.
+ *
+ * @param[in] gfx   Graphics interface
+ * @param[in] frame Stored frame
+ *
+ * @return If the canvas is equal to the frame, it will return true otherwise false.
+ */
+static bool isEqual(const TestGfx& gfx, const uint32_t* frame)
+{
+    bool        isEqual = true;
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+
+    for(y = 0U; y < TestGfx::HEIGHT; ++y)
+    {
+        for(x = 0U; x < TestGfx::WIDTH; ++x)
+        {
+            if (frame[x + y * TestGfx::WIDTH] != static_cast<uint32_t>(gfx.getColor(x, y)))
+            {
+                isEqual = false;
+            }
+        }
+    }
+
+    return isEqual;
+}
+
+/**
+ * Store the whole canvas as frame.
+ *
+ * @param[in]   gfx     Graphics interface
+ * @param[out]  frame   Frame buffer
+ */
+static void storeFrame(const TestGfx& gfx, uint32_t* frame)
+{
+    uint16_t    x   = 0U;
+    uint16_t    y   = 0U;
+
+    for(y = 0U; y < TestGfx::HEIGHT; ++y)
+    {
+        for(x = 0U; x < TestGfx::WIDTH; ++x)
+        {
+            frame[x + y * TestGfx::WIDTH] = gfx.getColor(x, y);
+        }
+    }
+}
@@ -34,6 +34,8 @@
  *****************************************************************************/
 #include "TestGfx.h"
 
+#include <YAGfxTracker.h>
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -81,6 +83,9 @@ extern void testGfx()
     int16_t     y       = 0;
     Color       color   = 0U;
     YAGfxStaticBitmap<TestGfx::WIDTH, TestGfx::HEIGHT>  bitmap;
+    YAGfxStaticBitmap<4U, 4U>                           canvas;
+    YAGfxTracker    tracker;
+    GfxRect         rect(2, 2, 4U, 4U);
 
     /* Verify screen size */
     TEST_ASSERT_EQUAL_UINT16(TestGfx::WIDTH, testGfx.getWidth());
@@ -176,6 +181,69 @@ extern void testGfx()
     testGfx.fillScreen(0U);
     TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, TestGfx::HEIGHT, 0U));
 
+    /* Test drawing a row of pixels. */
+    testGfx.drawRow(1, 1, &bitmap.getColor(0, 0), 2U);
+    TEST_ASSERT_EQUAL_UINT32(bitmap.getColor(0, 0), testGfx.getColor(1, 1));
+    TEST_ASSERT_EQUAL_UINT32(bitmap.getColor(1, 0), testGfx.getColor(2, 1));
+    TEST_ASSERT_TRUE(testGfx.verify(3, 1, TestGfx::WIDTH - 3U, 1U, 0U));
+
+    /* Clear screen */
+    testGfx.fillScreen(0U);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, TestGfx::HEIGHT, 0U));
+
+    /* Test drawing a row of pixels into a bitmap, which clips at both borders. */
+    canvas.fillScreen(0U);
+    canvas.drawRow(-1, 1, &bitmap.getColor(0, 0), 6U);
+    TEST_ASSERT_EQUAL_UINT32(bitmap.getColor(1, 0), canvas.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(bitmap.getColor(4, 0), canvas.getColor(3, 1));
+    TEST_ASSERT_EQUAL_UINT32(0U, canvas.getColor(0, 0));
+
+    /* Test rectangle operations. */
+    TEST_ASSERT_FALSE(rect.isEmpty());
+    TEST_ASSERT_TRUE(rect.contains(2, 2));
+    TEST_ASSERT_FALSE(rect.contains(6, 2));
+    TEST_ASSERT_TRUE(rect.isIntersecting(GfxRect(5, 5, 1U, 1U)));
+    TEST_ASSERT_FALSE(rect.isIntersecting(GfxRect(6, 0, 2U, 2U)));
+    rect.unite(GfxRect(0, 7, 1U, 1U));
+    TEST_ASSERT_EQUAL_INT16(0, rect.getX());
+    TEST_ASSERT_EQUAL_INT16(2, rect.getY());
+    TEST_ASSERT_EQUAL_UINT16(6U, rect.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(6U, rect.getHeight());
+    rect.intersect(GfxRect(-2, 4, 4U, 10U));
+    TEST_ASSERT_EQUAL_INT16(0, rect.getX());
+    TEST_ASSERT_EQUAL_INT16(4, rect.getY());
+    TEST_ASSERT_EQUAL_UINT16(2U, rect.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4U, rect.getHeight());
+    rect.intersect(GfxRect(10, 10, 1U, 1U));
+    TEST_ASSERT_TRUE(rect.isEmpty());
+
+    /* Test tracking the modified region. After the canvas is set, it is
+     * completely modified.
+     */
+    tracker.setGfx(canvas);
+    TEST_ASSERT_TRUE(tracker.isDirty());
+    TEST_ASSERT_EQUAL_UINT16(4U, tracker.getDirtyRect().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(4U, tracker.getDirtyRect().getHeight());
+    tracker.clearDirtyRect();
+    TEST_ASSERT_FALSE(tracker.isDirty());
+
+    tracker.drawPixel(3, 3, COLOR);
+    TEST_ASSERT_EQUAL_UINT32(COLOR, canvas.getColor(3, 3));
+    tracker.drawHLine(-2, 1, 3U, COLOR);
+    TEST_ASSERT_EQUAL_INT16(0, tracker.getDirtyRect().getX());
+    TEST_ASSERT_EQUAL_INT16(1, tracker.getDirtyRect().getY());
+    TEST_ASSERT_EQUAL_UINT16(4U, tracker.getDirtyRect().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(3U, tracker.getDirtyRect().getHeight());
+    tracker.clearDirtyRect();
+
+    /* Drawing outside the canvas doesn't modify anything. */
+    tracker.drawHLine(0, 4, 4U, COLOR);
+    TEST_ASSERT_FALSE(tracker.isDirty());
+
+    /* Clear screen */
+    testGfx.fillScreen(0U);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, TestGfx::HEIGHT, 0U));
+
     return;
 }
 
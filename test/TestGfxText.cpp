@@ -59,6 +59,14 @@
  * Local Variables
  *****************************************************************************/
 
+/** Plus sign (3 x 3), one time 1 bit per pixel encoded and one time run length encoded. */
+static const uint8_t    gPlusBitmap[]       = { 0x5D, 0x00 };
+static const uint8_t    gPlusRle[]          = { 0x11, 0x13, 0x11, 0x10 };
+static const GFXglyph   gPlusGlyph[]        = { { 0, 3, 3, 4, 0, -3 } };
+static const UnicodeRange gPlusRange[]      = { { 0x2B, 0x2B, 0 } };
+static const UnicodeFont  gPlusFontBitmap   = { gPlusBitmap, gPlusGlyph, gPlusRange, 1U, 4U, UNICODE_FONT_ENCODING_BITMAP };
+static const UnicodeFont  gPlusFontRle      = { gPlusRle, gPlusGlyph, gPlusRange, 1U, 4U, UNICODE_FONT_ENCODING_RLE };
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -85,6 +93,8 @@ extern void testGfxText()
     const Color COLOR       = 0x1234;
     uint16_t    width       = 0U;
     uint16_t    height      = 0U;
+    Utf8Decoder utf8Decoder;
+    uint32_t    codePoint   = 0U;
     int16_t     cursorPosX  = 0;
     int16_t     cursorPosY  = 0;
 
@@ -113,6 +123,59 @@ extern void testGfxText()
     testGfxText.setFont(&TomThumb);
     TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "Test", width, height));
 
+    /* UTF-8 encoded characters shall be measured like a single character. */
+    TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "a", width, height));
+    TEST_ASSERT_EQUAL_UINT16(4U, width);
+    TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "\xC3\xA4", width, height));
+    TEST_ASSERT_EQUAL_UINT16(4U, width);
+    TEST_ASSERT_EQUAL_UINT16(6U, height);
+
+    /* Code point in a sparse range (euro sign). */
+    TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "\xE2\x82\xAC", width, height));
+    TEST_ASSERT_EQUAL_UINT16(4U, width);
+
+    /* Code point, which is not covered by the font. */
+    TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "\xE2\x98\x83", width, height));
+    TEST_ASSERT_EQUAL_UINT16(0U, width);
+
+    /* A ISO 8859-1 character, which looks like a UTF-8 lead byte, is followed by ASCII.
+     * Both shall be decoded.
+     */
+    TEST_ASSERT_FALSE(utf8Decoder.decode('\xDF', codePoint));
+    TEST_ASSERT_TRUE(utf8Decoder.isPending());
+    TEST_ASSERT_TRUE(utf8Decoder.decode('e', codePoint));
+    TEST_ASSERT_EQUAL_UINT32(0xDFU, codePoint);
+    TEST_ASSERT_TRUE(utf8Decoder.next(codePoint));
+    TEST_ASSERT_EQUAL_UINT32('e', codePoint);
+    TEST_ASSERT_FALSE(utf8Decoder.next(codePoint));
+    TEST_ASSERT_FALSE(utf8Decoder.isPending());
+
+    /* "Grüße" in ISO 8859-1 shall be measured like the UTF-8 encoded one. */
+    TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "Gr\xC3\xBC\xC3\x9F" "e", width, height));
+    TEST_ASSERT_EQUAL_UINT16(20U, width);
+    TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(testGfx.getWidth(), testGfx.getHeight(), "Gr\xFC\xDF" "e", width, height));
+    TEST_ASSERT_EQUAL_UINT16(20U, width);
+
+    /* Bitmap and run length encoded glyphs shall look the same. */
+    testGfxText.setFont(&gPlusFontBitmap);
+    testGfxText.setTextCursorPos(0, 3);
+    testGfxText.drawChar(testGfx, '+');
+    testGfxText.setFont(&gPlusFontRle);
+    testGfxText.setTextCursorPos(4, 3);
+    testGfxText.drawChar(testGfx, '+');
+    TEST_ASSERT_EQUAL_INT16(8, testGfxText.getTextCursorPosX());
+
+    for(cursorPosX = 0; cursorPosX < 3; ++cursorPosX)
+    {
+        for(cursorPosY = 0; cursorPosY < 3; ++cursorPosY)
+        {
+            Color expected = ((1 == cursorPosX) || (1 == cursorPosY)) ? COLOR : Color(0U);
+
+            TEST_ASSERT_TRUE(expected == testGfx.getColor(cursorPosX, cursorPosY));
+            TEST_ASSERT_TRUE(expected == testGfx.getColor(4 + cursorPosX, cursorPosY));
+        }
+    }
+
     return;
 }
 
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test GIF widget.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestGifWidget.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <FS.h>
+#include <GifWidget.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test GIF widget.
+ */
+extern void testGifWidget()
+{
+    TestGfx     testGfx;
+    GifWidget   gifWidget;
+    GifDecoder  decoder;
+    FS          localFileSystem;
+    uint32_t    delay           = 0U;
+    uint8_t     idx             = 0U;
+
+    /* Test image: 8x8 pixels, 4 colors (black, red, green, blue)
+     * Frame 1: Full size, interlaced, delay 100 ms
+     * Frame 2: 2x2 pixels at (1, 2), transparent pixel at (1, 2), restore background, delay 200 ms
+     * Frame 3: 1x1 pixel at (0, 0), local color palette (yellow), no delay
+     */
+    const uint32_t  frame1[8U][8U] =
+    {
+        { 0x000000, 0xff0000, 0x00ff00, 0x0000ff, 0x000000, 0xff0000, 0x00ff00, 0x0000ff },
+        { 0xff0000, 0x00ff00, 0x0000ff, 0x000000, 0xff0000, 0x00ff00, 0x0000ff, 0x000000 },
+        { 0x00ff00, 0x0000ff, 0x000000, 0xff0000, 0x00ff00, 0x0000ff, 0x000000, 0xff0000 },
+        { 0x0000ff, 0x000000, 0xff0000, 0x00ff00, 0x0000ff, 0x000000, 0xff0000, 0x00ff00 },
+        { 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0x00ff00, 0x00ff00 },
+        { 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0x00ff00, 0x00ff00 },
+        { 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0x00ff00, 0x00ff00 },
+        { 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0xff0000, 0x00ff00, 0x00ff00 }
+    };
+
+    /* Verify widget type name */
+    TEST_ASSERT_EQUAL_STRING(GifWidget::WIDGET_TYPE, gifWidget.getType());
+
+    /* Not existing file */
+    TEST_ASSERT_EQUAL(GifDecoder::RET_FILE_NOT_FOUND, decoder.open(localFileSystem, "./test/notExisting.gif"));
+    TEST_ASSERT_FALSE(decoder.isOpen());
+
+    /* No GIF image */
+    TEST_ASSERT_EQUAL(GifDecoder::RET_FILE_FORMAT_UNSUPPORTED, decoder.open(localFileSystem, "./test/test24bpp.bmp"));
+    TEST_ASSERT_FALSE(decoder.isOpen());
+
+    TEST_ASSERT_EQUAL(GifDecoder::RET_OK, decoder.open(localFileSystem, "./test/testAnim.gif"));
+    TEST_ASSERT_TRUE(decoder.isOpen());
+    TEST_ASSERT_EQUAL_UINT16(8U, decoder.getCanvas().getWidth());
+    TEST_ASSERT_EQUAL_UINT16(8U, decoder.getCanvas().getHeight());
+
+    /* Play the animation twice to verify the restart with the first frame. */
+    for(idx = 0U; idx < 2U; ++idx)
+    {
+        int16_t x = 0;
+        int16_t y = 0;
+
+        /* Frame 1 */
+        TEST_ASSERT_EQUAL(GifDecoder::RET_OK, decoder.nextFrame(delay));
+        TEST_ASSERT_EQUAL_UINT32(100U, delay);
+
+        for(y = 0; y < 8; ++y)
+        {
+            for(x = 0; x < 8; ++x)
+            {
+                TEST_ASSERT_EQUAL_UINT32(frame1[y][x], decoder.getCanvas().getColor(x, y));
+            }
+        }
+
+        /* Frame 2 */
+        TEST_ASSERT_EQUAL(GifDecoder::RET_OK, decoder.nextFrame(delay));
+        TEST_ASSERT_EQUAL_UINT32(200U, delay);
+        TEST_ASSERT_EQUAL_UINT32(0x0000ff, decoder.getCanvas().getColor(1, 2));
+        TEST_ASSERT_EQUAL_UINT32(0xff0000, decoder.getCanvas().getColor(2, 2));
+        TEST_ASSERT_EQUAL_UINT32(0xff0000, decoder.getCanvas().getColor(1, 3));
+        TEST_ASSERT_EQUAL_UINT32(0xff0000, decoder.getCanvas().getColor(2, 3));
+        TEST_ASSERT_EQUAL_UINT32(0x000000, decoder.getCanvas().getColor(0, 0));
+
+        /* Frame 3, the area of frame 2 is restored to background. */
+        TEST_ASSERT_EQUAL(GifDecoder::RET_OK, decoder.nextFrame(delay));
+        TEST_ASSERT_EQUAL_UINT32(GifDecoder::DEFAULT_DELAY, delay);
+        TEST_ASSERT_EQUAL_UINT32(0xffff00, decoder.getCanvas().getColor(0, 0));
+        TEST_ASSERT_EQUAL_UINT32(0x000000, decoder.getCanvas().getColor(1, 2));
+        TEST_ASSERT_EQUAL_UINT32(0x000000, decoder.getCanvas().getColor(2, 3));
+        TEST_ASSERT_EQUAL_UINT32(0x00ff00, decoder.getCanvas().getColor(3, 3));
+    }
+
+    decoder.close();
+    TEST_ASSERT_FALSE(decoder.isOpen());
+
+    /* Widget shows the first frame immediately after loading. */
+    TEST_ASSERT_TRUE(gifWidget.isEmpty());
+    TEST_ASSERT_FALSE(gifWidget.load(localFileSystem, "./test/notExisting.gif"));
+    TEST_ASSERT_TRUE(gifWidget.isEmpty());
+    TEST_ASSERT_TRUE(gifWidget.load(localFileSystem, "./test/testAnim.gif"));
+    TEST_ASSERT_FALSE(gifWidget.isEmpty());
+
+    testGfx.fill(ColorDef::BLACK);
+    gifWidget.update(testGfx);
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, testGfx.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, testGfx.getColor(1, 2));
+
+    gifWidget.clear();
+    TEST_ASSERT_TRUE(gifWidget.isEmpty());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,330 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test hash table.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestHashTable.h"
+
+#include <unity.h>
+#include <HashTable.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Test entry. A key may occur several times, the value distinguishes them.
+ */
+struct TestEntry
+{
+    uint16_t    key;    /**< Key, 0 marks a empty entry. */
+    uint16_t    value;  /**< Value */
+
+    /**
+     * Initializes a empty entry.
+     */
+    TestEntry() :
+        key(0U),
+        value(0U)
+    {
+    }
+};
+
+/**
+ * Test entry traits. The hash is weak on purpose, to force collisions.
+ */
+struct TestEntryTraits
+{
+    /**
+     * Is the entry empty?
+     *
+     * @param[in] entry Entry
+     *
+     * @return If empty, it will return true otherwise false.
+     */
+    static bool isEmpty(const TestEntry& entry)
+    {
+        return (0U == entry.key);
+    }
+
+    /**
+     * Get the hash of the entry.
+     *
+     * @param[in] entry Entry
+     *
+     * @return Hash
+     */
+    static uint32_t getHash(const TestEntry& entry)
+    {
+        return hash(entry.key);
+    }
+
+    /**
+     * Get the hash of a key.
+     *
+     * @param[in] key   Key
+     *
+     * @return Hash
+     */
+    static uint32_t hash(uint16_t key)
+    {
+        return key % 3U;
+    }
+
+    /**
+     * Does the entry belong to the key?
+     *
+     * @param[in] entry Entry
+     * @param[in] key   Key
+     *
+     * @return If it matches, it will return true otherwise false.
+     */
+    static bool isMatch(const TestEntry& entry, uint16_t key)
+    {
+        return (key == entry.key);
+    }
+
+    /**
+     * Is the entry equal to the other one?
+     *
+     * @param[in] entry Entry
+     * @param[in] other Other entry
+     *
+     * @return If equal, it will return true otherwise false.
+     */
+    static bool isMatch(const TestEntry& entry, const TestEntry& other)
+    {
+        return ((other.key == entry.key) &&
+                (other.value == entry.value));
+    }
+};
+
+/** Hash table type, which is tested. */
+typedef HashTable<TestEntry, TestEntryTraits> TestHashTable;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static TestEntry makeEntry(uint16_t key, uint16_t value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test hash table.
+ */
+extern void testHashTable()
+{
+    const uint16_t      KEY_CNT     = 12U;
+    const uint16_t      VALUE_CNT   = 3U;
+    TestHashTable       table;
+    bool                isAdded[KEY_CNT][VALUE_CNT];
+    uint16_t            count       = 0U;
+    uint16_t            key         = 0U;
+    uint16_t            value       = 0U;
+    uint16_t            idx         = 0U;
+    uint16_t            step        = 0U;
+    uint32_t            random      = 4711U;
+    const TestEntry*    entry       = nullptr;
+
+    /* Without slots, nothing can be added. */
+    TEST_ASSERT_FALSE(table.add(makeEntry(1U, 1U)));
+    TEST_ASSERT_FALSE(table.put(1U, makeEntry(1U, 1U)));
+    TEST_ASSERT_NULL(table.find(TestEntryTraits::hash(1U), 1U));
+    TEST_ASSERT_FALSE(table.remove(TestEntryTraits::hash(1U), 1U));
+    TEST_ASSERT_FALSE(table.create(0U));
+
+    /* The number of slots is rounded up to a power of 2. */
+    TEST_ASSERT_TRUE(table.create(3U));
+    TEST_ASSERT_EQUAL_UINT16(4U, table.getSlotCount());
+
+    /* One slot is always kept empty. */
+    TEST_ASSERT_TRUE(table.put(1U, makeEntry(1U, 10U)));
+    TEST_ASSERT_TRUE(table.put(2U, makeEntry(2U, 20U)));
+    TEST_ASSERT_TRUE(table.put(1U, makeEntry(1U, 11U)));
+    TEST_ASSERT_TRUE(table.add(makeEntry(4U, 40U)));
+    TEST_ASSERT_FALSE(table.add(makeEntry(5U, 50U)));
+    TEST_ASSERT_FALSE(table.put(5U, makeEntry(5U, 50U)));
+    TEST_ASSERT_EQUAL_UINT16(3U, table.getCount());
+
+    entry = table.find(TestEntryTraits::hash(1U), 1U);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_UINT16(11U, entry->value);
+
+    /* Removing the head of a probe sequence keeps the rest reachable. */
+    TEST_ASSERT_TRUE(table.remove(TestEntryTraits::hash(1U), 1U));
+    TEST_ASSERT_NULL(table.find(TestEntryTraits::hash(1U), 1U));
+    TEST_ASSERT_NOT_NULL(table.find(TestEntryTraits::hash(4U), 4U));
+    TEST_ASSERT_NOT_NULL(table.find(TestEntryTraits::hash(2U), 2U));
+
+    /* Grow keeps the entries. */
+    TEST_ASSERT_TRUE(table.reserve(20U));
+    TEST_ASSERT_EQUAL_UINT16(32U, table.getSlotCount());
+    TEST_ASSERT_EQUAL_UINT16(2U, table.getCount());
+    TEST_ASSERT_NOT_NULL(table.find(TestEntryTraits::hash(4U), 4U));
+    TEST_ASSERT_NOT_NULL(table.find(TestEntryTraits::hash(2U), 2U));
+
+    /* A copy is independent. */
+    {
+        TestHashTable copy(table);
+
+        table.clear();
+        TEST_ASSERT_EQUAL_UINT16(0U, table.getCount());
+        TEST_ASSERT_EQUAL_UINT16(2U, copy.getCount());
+        TEST_ASSERT_NOT_NULL(copy.find(TestEntryTraits::hash(4U), 4U));
+    }
+
+    /* Compare with a model over random operations. Several entries with
+     * the same key are allowed and the weak hash results in long probe
+     * sequences.
+     */
+    for(key = 0U; key < KEY_CNT; ++key)
+    {
+        for(value = 0U; value < VALUE_CNT; ++value)
+        {
+            isAdded[key][value] = false;
+        }
+    }
+
+    for(step = 0U; step < 2000U; ++step)
+    {
+        random  = random * 1103515245U + 12345U;
+        key     = (random >> 16U) % KEY_CNT;
+        value   = (random >> 8U) % VALUE_CNT;
+
+        if (0U == ((random >> 4U) % 2U))
+        {
+            TEST_ASSERT_EQUAL(isAdded[key][value], table.remove(TestEntryTraits::hash(key + 1U), makeEntry(key + 1U, value)));
+
+            if (true == isAdded[key][value])
+            {
+                isAdded[key][value] = false;
+                --count;
+            }
+        }
+        else if (false == isAdded[key][value])
+        {
+            TEST_ASSERT_TRUE(table.reserve(count + 1U));
+            TEST_ASSERT_TRUE(table.add(makeEntry(key + 1U, value)));
+
+            isAdded[key][value] = true;
+            ++count;
+        }
+        else
+        {
+            ;
+        }
+
+        TEST_ASSERT_EQUAL_UINT16(count, table.getCount());
+
+        for(key = 0U; key < KEY_CNT; ++key)
+        {
+            bool isKeyAdded = false;
+
+            for(value = 0U; value < VALUE_CNT; ++value)
+            {
+                TEST_ASSERT_EQUAL(isAdded[key][value], nullptr != table.find(TestEntryTraits::hash(key + 1U), makeEntry(key + 1U, value)));
+
+                isKeyAdded = (true == isKeyAdded) || (true == isAdded[key][value]);
+            }
+
+            TEST_ASSERT_EQUAL(isKeyAdded, nullptr != table.find(TestEntryTraits::hash(key + 1U), static_cast<uint16_t>(key + 1U)));
+        }
+    }
+
+    /* Walk through all entries. */
+    value = 0U;
+
+    for(idx = 0U; idx < table.getSlotCount(); ++idx)
+    {
+        if (nullptr != table.getSlot(idx))
+        {
+            ++value;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(count, value);
+
+    table.release();
+    TEST_ASSERT_EQUAL_UINT16(0U, table.getSlotCount());
+    TEST_ASSERT_EQUAL_UINT16(0U, table.getCount());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Make a entry.
+ *
+ * @param[in] key   Key
+ * @param[in] value Value
+ *
+ * @return Entry
+ */
+static TestEntry makeEntry(uint16_t key, uint16_t value)
+{
+    TestEntry entry;
+
+    entry.key   = key;
+    entry.value = value;
+
+    return entry;
+}
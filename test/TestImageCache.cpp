@@ -0,0 +1,158 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test image cache.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestImageCache.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <FS.h>
+#include <ImageCache.h>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test image cache.
+ */
+extern void testImageCache()
+{
+    ImageCache&     cache           = ImageCache::getInstance();
+    FS              localFileSystem;
+    SharedBitmap    bitmap1;
+    SharedBitmap    bitmap2;
+    size_t          image1Size      = 2U * 2U * sizeof(Color);  /* test24bpp.bmp */
+    size_t          image2Size      = 3U * 2U * sizeof(Color);  /* test4bpp.bmp */
+
+    /* Start with a empty cache. */
+    cache.setBudget(0U);
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getSize());
+    cache.setBudget(image1Size + image2Size);
+
+    /* Empty shared bitmap */
+    TEST_ASSERT_TRUE(bitmap1.isEmpty());
+    TEST_ASSERT_EQUAL_UINT16(0U, bitmap1.get().getWidth());
+
+    /* Not existing file */
+    TEST_ASSERT_EQUAL(ImageCache::RET_FILE_NOT_FOUND, cache.load(localFileSystem, "./test/notExisting.bmp", bitmap1));
+    TEST_ASSERT_TRUE(bitmap1.isEmpty());
+
+    /* Loading the same image twice, shares it. */
+    TEST_ASSERT_EQUAL(ImageCache::RET_OK, cache.load(localFileSystem, "./test/test24bpp.bmp", bitmap1));
+    TEST_ASSERT_EQUAL(ImageCache::RET_OK, cache.load(localFileSystem, "./test/test24bpp.bmp", bitmap2));
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getCount());
+    TEST_ASSERT_EQUAL_UINT32(image1Size, cache.getSize());
+    TEST_ASSERT_EQUAL_PTR(&bitmap1.get(), &bitmap2.get());
+    TEST_ASSERT_EQUAL_UINT16(2U, bitmap1.get().getWidth());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap1.get().getColor(0, 0));
+
+    /* Copy shares it too. */
+    {
+        SharedBitmap bitmap3(bitmap1);
+
+        TEST_ASSERT_EQUAL_PTR(&bitmap1.get(), &bitmap3.get());
+    }
+
+    /* Unreferenced image stays in the cache within the budget. */
+    bitmap1.release();
+    bitmap2.release();
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getCount());
+
+    /* Least recently used image is removed if the budget is exceeded. */
+    TEST_ASSERT_EQUAL(ImageCache::RET_OK, cache.load(localFileSystem, "./test/test4bpp.bmp", bitmap1));
+    TEST_ASSERT_EQUAL_UINT32(2U, cache.getCount());
+    cache.setBudget(image2Size);
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getCount());
+    TEST_ASSERT_EQUAL_UINT32(image2Size, cache.getSize());
+
+    /* Referenced image is never removed. */
+    cache.setBudget(0U);
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getCount());
+    TEST_ASSERT_EQUAL_UINT16(3U, bitmap1.get().getWidth());
+
+    /* Invalidated image is loaded again, but the old one is kept until released. */
+    cache.invalidate("./test/test4bpp.bmp");
+    TEST_ASSERT_EQUAL(ImageCache::RET_OK, cache.load(localFileSystem, "./test/test4bpp.bmp", bitmap2));
+    TEST_ASSERT_EQUAL_UINT32(2U, cache.getCount());
+    TEST_ASSERT_NOT_EQUAL(&bitmap1.get(), &bitmap2.get());
+
+    bitmap1.release();
+    TEST_ASSERT_EQUAL_UINT32(1U, cache.getCount());
+
+    bitmap2.release();
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, cache.getSize());
+
+    cache.setBudget(ImageCache::DEFAULT_BUDGET);
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
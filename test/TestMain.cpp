@@ -43,13 +43,28 @@
 #include "TestLampWidget.h"
 #include "TestBitmapWidget.h"
 #include "TestTextWidget.h"
+#include "TestTextBoxWidget.h"
+#include "TestGifWidget.h"
 #include "TestColor.h"
 #include "TestStateMachine.h"
 #include "TestSimpleTimer.h"
+#include "TestDeadlineQueue.h"
+#include "TestWeightedRoundRobin.h"
+#include "TestUidIndex.h"
+#include "TestHashTable.h"
+#include "TestStateBlob.h"
+#include "TestBlockPool.h"
+#include "TestBinaryConfig.h"
 #include "TestProgressBar.h"
 #include "TestLogging.h"
 #include "TestUtil.h"
 #include "TestBmpImgLoader.h"
+#include "TestPackedImgLoader.h"
+#include "TestWidgetLayout.h"
+#include "TestChartWidget.h"
+#include "TestEffects.h"
+#include "TestImageCache.h"
+#include "TestSpriteSheet.h"
 
 /******************************************************************************
  * Macros
@@ -89,14 +104,36 @@ int main(int argc, char **argv)
     RUN_TEST(testGfxText);
     RUN_TEST(testWidget);
     RUN_TEST(testWidgetGroup);
+    RUN_TEST(testWidgetGroupIndex);
+    RUN_TEST(testWidgetGroupInvalidation);
     RUN_TEST(testLampWidget);
     RUN_TEST(testBmpImgLoader);
+    RUN_TEST(testPackedImgLoader);
+    RUN_TEST(testImageCache);
+    RUN_TEST(testSpriteSheet);
     RUN_TEST(testBitmapWidget);
     RUN_TEST(testTextWidget);
+    RUN_TEST(testTextBoxWidget);
+    RUN_TEST(testGifWidget);
+    RUN_TEST(testWidgetLayout);
     RUN_TEST(testColor);
     RUN_TEST(testStateMachine);
     RUN_TEST(testSimpleTimer);
+    RUN_TEST(testDeadlineQueue);
+    RUN_TEST(testWeightedRoundRobin);
+    RUN_TEST(testUidIndex);
+    RUN_TEST(testHashTable);
+    RUN_TEST(testStateBlob);
+    RUN_TEST(testBlockPool);
+    RUN_TEST(testBinaryConfig);
     RUN_TEST(testProgressBar);
+    RUN_TEST(testSampleBuffer);
+    RUN_TEST(testChartWidget);
+    RUN_TEST(testGaugeWidget);
+    RUN_TEST(testFxMath);
+    RUN_TEST(testXorShift);
+    RUN_TEST(testValueNoise);
+    RUN_TEST(testEffectWidgets);
     RUN_TEST(testLogging);
     RUN_TEST(testUtil);
 
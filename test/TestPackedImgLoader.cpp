@@ -0,0 +1,270 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test packed image loader.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestPackedImgLoader.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <FS.h>
+#include <BmpImgLoader.h>
+#include <PackedImgLoader.h>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void writeFile(FS& fs, const char* fileName, const uint8_t* data, size_t size);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Packed image: 2x2 pixels, RGB565, no compression
+ * (0, 0) blue
+ * (1, 0) green
+ * (0, 1) red
+ * (1, 1) white
+ */
+static const uint8_t    gPackedImgRgb565[] =
+{
+    0x50, 0x49, 0x4D, 0x47,     /* Signature */
+    0x02, 0x00, 0x02, 0x00,     /* Width, height */
+    PACKED_IMG_FORMAT_RGB565,   /* Format */
+    0x00,                       /* Flags */
+    0x00, 0x00,                 /* Palette size */
+    0x08, 0x00, 0x00, 0x00,     /* Data size */
+    0x1F, 0x00, 0xE0, 0x07,
+    0x00, 0xF8, 0xFF, 0xFF
+};
+
+/**
+ * Packed image: 3x1 pixels, color palette, no compression
+ * (0, 0) red
+ * (1, 0) green
+ * (2, 0) red
+ */
+static const uint8_t    gPackedImgPalette[] =
+{
+    0x50, 0x49, 0x4D, 0x47,     /* Signature */
+    0x03, 0x00, 0x01, 0x00,     /* Width, height */
+    PACKED_IMG_FORMAT_PALETTE8, /* Format */
+    0x00,                       /* Flags */
+    0x02, 0x00,                 /* Palette size */
+    0x03, 0x00, 0x00, 0x00,     /* Data size */
+    0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0x01, 0x00
+};
+
+/**
+ * Packed image: 3x1 pixels, color palette, run length encoded
+ * All pixels are red.
+ */
+static const uint8_t    gPackedImgRle[] =
+{
+    0x50, 0x49, 0x4D, 0x47,     /* Signature */
+    0x03, 0x00, 0x01, 0x00,     /* Width, height */
+    PACKED_IMG_FORMAT_PALETTE8, /* Format */
+    PACKED_IMG_FLAG_RLE,        /* Flags */
+    0x01, 0x00,                 /* Palette size */
+    0x02, 0x00, 0x00, 0x00,     /* Data size */
+    0xFF, 0x00, 0x00,
+    0x03, 0x00
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test packed image loader.
+ */
+extern void testPackedImgLoader()
+{
+    PackedImgLoader     loader;
+    BmpImgLoader        bmpLoader;
+    YAGfxDynamicBitmap  bitmap;
+    YAGfxDynamicBitmap  packedBitmap;
+    YAGfxMappedBitmap   mappedBitmap;
+    FS                  localFileSystem;
+    const char*         testFileName    = "./test/testConvert.pim";
+    int16_t             x               = 0;
+    int16_t             y               = 0;
+
+    /* Convert a bitmap image to a packed image and compare both. */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, bmpLoader.load(localFileSystem, "./test/test24bpp.bmp", bitmap));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.convert(localFileSystem, "./test/test24bpp.bmp", testFileName));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_EQUAL_UINT16(bitmap.getWidth(), packedBitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(bitmap.getHeight(), packedBitmap.getHeight());
+
+    for(y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for(x = 0; x < bitmap.getWidth(); ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(bitmap.getColor(x, y), packedBitmap.getColor(x, y));
+        }
+    }
+
+    /* Same with run length encoded image of a single color. */
+    bitmap.fillScreen(0x123456);
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.save(localFileSystem, testFileName, bitmap));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_EQUAL_UINT32(0x123456, packedBitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x123456, packedBitmap.getColor(1, 1));
+    TEST_ASSERT_TRUE(localFileSystem.remove(testFileName));
+
+    /* File not found */
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_FILE_NOT_FOUND, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_FALSE(packedBitmap.isAllocated());
+
+    /* Not a packed image */
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_FILE_FORMAT_UNSUPPORTED, loader.load(localFileSystem, "./test/test24bpp.bmp", packedBitmap));
+
+    /* Load RGB565 image */
+    writeFile(localFileSystem, testFileName, gPackedImgRgb565, sizeof(gPackedImgRgb565));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_EQUAL_UINT16(2, packedBitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, packedBitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, packedBitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, packedBitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, packedBitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, packedBitmap.getColor(1, 1));
+
+    /* Load image with color palette */
+    writeFile(localFileSystem, testFileName, gPackedImgPalette, sizeof(gPackedImgPalette));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_EQUAL_UINT16(3, packedBitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(1, packedBitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, packedBitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, packedBitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, packedBitmap.getColor(2, 0));
+
+    /* Load run length encoded image */
+    writeFile(localFileSystem, testFileName, gPackedImgRle, sizeof(gPackedImgRle));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_EQUAL_UINT16(3, packedBitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, packedBitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, packedBitmap.getColor(2, 0));
+
+    /* Truncated image */
+    writeFile(localFileSystem, testFileName, gPackedImgPalette, sizeof(gPackedImgPalette) - 1U);
+    TEST_ASSERT_NOT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_TRUE(localFileSystem.remove(testFileName));
+
+    /* Map RGB565 image */
+    TEST_ASSERT_FALSE(mappedBitmap.isMapped());
+    TEST_ASSERT_TRUE(mappedBitmap.map(gPackedImgRgb565, sizeof(gPackedImgRgb565)));
+    TEST_ASSERT_TRUE(mappedBitmap.isMapped());
+    TEST_ASSERT_EQUAL_UINT16(2, mappedBitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, mappedBitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, mappedBitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, mappedBitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, mappedBitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, mappedBitmap.getColor(1, 1));
+
+    /* Map image with color palette */
+    TEST_ASSERT_TRUE(mappedBitmap.map(gPackedImgPalette, sizeof(gPackedImgPalette)));
+    TEST_ASSERT_EQUAL_UINT16(3, mappedBitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(1, mappedBitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, mappedBitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, mappedBitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, mappedBitmap.getColor(2, 0));
+
+    /* Truncated image can not be mapped. */
+    TEST_ASSERT_FALSE(mappedBitmap.map(gPackedImgPalette, sizeof(gPackedImgPalette) - 1U));
+    TEST_ASSERT_FALSE(mappedBitmap.isMapped());
+
+    /* Run length encoded image can not be mapped. */
+    TEST_ASSERT_FALSE(mappedBitmap.map(gPackedImgRle, sizeof(gPackedImgRle)));
+    TEST_ASSERT_FALSE(mappedBitmap.isMapped());
+
+    /* A image, which shall be mapped, is saved without run length encoding. */
+    bitmap.fillScreen(0x123456);
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.save(localFileSystem, testFileName, bitmap, false));
+    TEST_ASSERT_EQUAL(PackedImgLoader::RET_OK, loader.load(localFileSystem, testFileName, packedBitmap));
+    TEST_ASSERT_EQUAL_UINT32(0x123456, packedBitmap.getColor(1, 1));
+    TEST_ASSERT_TRUE(localFileSystem.remove(testFileName));
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Write data to a file. An already existing file will be overwritten.
+ *
+ * @param[in] fs        File system
+ * @param[in] fileName  Name of the file
+ * @param[in] data      Data
+ * @param[in] size      Data size in byte
+ */
+static void writeFile(FS& fs, const char* fileName, const uint8_t* data, size_t size)
+{
+    File fd = fs.open(fileName, FILE_WRITE);
+
+    TEST_ASSERT_TRUE(fd);
+    TEST_ASSERT_EQUAL(size, fd.write(data, size));
+    fd.close();
+
+    return;
+}
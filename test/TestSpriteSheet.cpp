@@ -0,0 +1,191 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test sprite sheet.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestSpriteSheet.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <FS.h>
+#include <SpriteSheet.h>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test sprite sheet.
+ */
+extern void testSpriteSheet()
+{
+    SpriteSheet         spriteSheet;
+    FS                  localFileSystem;
+    TestGfx             testGfx;
+    YAGfxDynamicBitmap  canvas;
+
+    /* Empty sprite sheet */
+    TEST_ASSERT_TRUE(spriteSheet.isEmpty());
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getFrameCount());
+
+    /* Frame bigger than the texture */
+    TEST_ASSERT_FALSE(spriteSheet.loadTexture(localFileSystem, "./test/test24bpp.bmp", 3U, 1U));
+    TEST_ASSERT_TRUE(spriteSheet.isEmpty());
+
+    /* Texture test24bpp.bmp with 1x1 frames:
+     * Frame 0: blue
+     * Frame 1: green
+     * Frame 2: red
+     * Frame 3: white
+     */
+    TEST_ASSERT_TRUE(spriteSheet.loadTexture(localFileSystem, "./test/test24bpp.bmp", 1U, 1U, 0U, 10U));
+    TEST_ASSERT_FALSE(spriteSheet.isEmpty());
+    TEST_ASSERT_EQUAL_UINT8(4U, spriteSheet.getFrameCount());
+    TEST_ASSERT_EQUAL_UINT16(1U, spriteSheet.getFrameWidth());
+    TEST_ASSERT_EQUAL_UINT16(1U, spriteSheet.getFrameHeight());
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getCurrentFrame());
+
+    testGfx.fill(0U);
+    spriteSheet.drawFrame(testGfx, 5, 2);
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, testGfx.getColor(5, 2));
+    TEST_ASSERT_EQUAL_UINT32(0U, testGfx.getColor(6, 2));
+
+    /* The first update only takes the reference time. With 10 fps every
+     * 100 ms the next frame is selected.
+     */
+    spriteSheet.update(1000U);
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getCurrentFrame());
+    spriteSheet.update(1099U);
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getCurrentFrame());
+    spriteSheet.update(1100U);
+    TEST_ASSERT_EQUAL_UINT8(1U, spriteSheet.getCurrentFrame());
+
+    /* Frames are skipped, if updates are rare. */
+    spriteSheet.update(1350U);
+    TEST_ASSERT_EQUAL_UINT8(3U, spriteSheet.getCurrentFrame());
+    spriteSheet.drawFrame(testGfx, 5, 2);
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, testGfx.getColor(5, 2));
+
+    /* The remaining time of the last update is considered. */
+    spriteSheet.update(1400U);
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getCurrentFrame());
+
+    /* Long time without update */
+    spriteSheet.update(1400U + 4001U * 100U);
+    TEST_ASSERT_EQUAL_UINT8(1U, spriteSheet.getCurrentFrame());
+
+    /* Copy */
+    {
+        SpriteSheet copy(spriteSheet);
+
+        TEST_ASSERT_EQUAL_UINT8(4U, copy.getFrameCount());
+        TEST_ASSERT_EQUAL_UINT8(1U, copy.getCurrentFrame());
+        copy.drawFrame(testGfx, 0, 0);
+        TEST_ASSERT_EQUAL_UINT32(0x00ff00, testGfx.getColor(0, 0));
+    }
+
+    /* Animation runs only once. */
+    spriteSheet.repeatInfinite(false);
+    spriteSheet.reset();
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getCurrentFrame());
+    spriteSheet.update(0U);
+    spriteSheet.update(10000U);
+    TEST_ASSERT_EQUAL_UINT8(3U, spriteSheet.getCurrentFrame());
+
+    /* Animation runs backwards. */
+    spriteSheet.repeatInfinite(true);
+    spriteSheet.setForward(false);
+    spriteSheet.reset();
+    TEST_ASSERT_EQUAL_UINT8(3U, spriteSheet.getCurrentFrame());
+    spriteSheet.update(0U);
+    spriteSheet.update(100U);
+    TEST_ASSERT_EQUAL_UINT8(2U, spriteSheet.getCurrentFrame());
+    spriteSheet.update(400U);
+    TEST_ASSERT_EQUAL_UINT8(3U, spriteSheet.getCurrentFrame());
+
+    /* Texture with 2x1 frames, frame 0: blue, green. Clipped at both sides. */
+    spriteSheet.setForward(true);
+    TEST_ASSERT_TRUE(spriteSheet.loadTexture(localFileSystem, "./test/test24bpp.bmp", 2U, 1U, 0U, 10U));
+    TEST_ASSERT_EQUAL_UINT8(2U, spriteSheet.getFrameCount());
+    TEST_ASSERT_TRUE(canvas.create(3U, 1U));
+    canvas.fillScreen(0U);
+    spriteSheet.drawFrame(canvas, -1, 0);
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, canvas.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0U, canvas.getColor(1, 0));
+    spriteSheet.drawFrame(canvas, 2, 0);
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, canvas.getColor(2, 0));
+
+    /* Number of frames is limited by the texture size. */
+    TEST_ASSERT_TRUE(spriteSheet.loadTexture(localFileSystem, "./test/test24bpp.bmp", 1U, 1U, 10U, 10U));
+    TEST_ASSERT_EQUAL_UINT8(4U, spriteSheet.getFrameCount());
+
+    spriteSheet.release();
+    TEST_ASSERT_TRUE(spriteSheet.isEmpty());
+    TEST_ASSERT_EQUAL_UINT8(0U, spriteSheet.getFrameCount());
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
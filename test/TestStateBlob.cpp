@@ -0,0 +1,138 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test state blob.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestStateBlob.h"
+
+#include <unity.h>
+#include <StateBlob.h>
+#include <BinaryConfig.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test state blob.
+ */
+extern void testStateBlob()
+{
+    const uint8_t   SCHEMA_VERSION  = 1U;
+    StateBlob       blob;
+    uint8_t         buffer[32U];
+    BinaryConfig    writer(buffer, sizeof(buffer));
+    uint16_t        value           = 0U;
+    char            str[8U];
+
+    /* A new blob is empty. */
+    TEST_ASSERT_TRUE(blob.isEmpty());
+    TEST_ASSERT_NULL(blob.getData());
+    TEST_ASSERT_EQUAL_UINT32(0U, blob.getSize());
+    TEST_ASSERT_NULL(blob.allocate(0U));
+
+    /* Store a state with the exact size. */
+    writer.beginWrite(SCHEMA_VERSION);
+    writer.writeUInt16(4711U);
+    writer.writeString("text");
+    TEST_ASSERT_TRUE(writer.endWrite());
+    TEST_ASSERT_TRUE(blob.store(writer));
+    TEST_ASSERT_FALSE(blob.isEmpty());
+    TEST_ASSERT_EQUAL_UINT32(writer.getSize(), blob.getSize());
+
+    /* The temporary buffer is not necessary anymore. */
+    memset(buffer, 0, sizeof(buffer));
+
+    /* Read the state back from the blob. */
+    {
+        BinaryConfig reader(blob.getData(), blob.getSize());
+
+        TEST_ASSERT_TRUE(reader.beginRead(blob.getSize()));
+        TEST_ASSERT_EQUAL_UINT8(SCHEMA_VERSION, reader.getSchemaVersion());
+        TEST_ASSERT_TRUE(reader.readUInt16(value));
+        TEST_ASSERT_EQUAL_UINT16(4711U, value);
+        TEST_ASSERT_TRUE(reader.readString(str, sizeof(str)));
+        TEST_ASSERT_EQUAL_STRING("text", str);
+    }
+
+    /* Store a string. */
+    TEST_ASSERT_TRUE(blob.storeString("BTC"));
+    TEST_ASSERT_EQUAL_UINT32(4U, blob.getSize());
+    TEST_ASSERT_EQUAL_STRING("BTC", blob.getString());
+
+    /* A raw blob. */
+    TEST_ASSERT_NOT_NULL(blob.allocate(3U));
+    TEST_ASSERT_EQUAL_UINT32(3U, blob.getSize());
+
+    blob.release();
+    TEST_ASSERT_TRUE(blob.isEmpty());
+    TEST_ASSERT_EQUAL_UINT32(0U, blob.getSize());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,186 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test text box widget.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestTextBoxWidget.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <TextBoxWidget.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static bool isAnyPixelSet(TestGfx& gfx, int16_t posX, int16_t posY, uint16_t width, uint16_t height);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test text box widget.
+ */
+extern void testTextBoxWidget()
+{
+    TestGfx         testGfx;
+    TextBoxWidget   textBoxWidget(12U, 8U);
+    String          line;
+
+    /* Verify widget type name */
+    TEST_ASSERT_EQUAL_STRING(TextBoxWidget::WIDGET_TYPE, textBoxWidget.getType());
+
+    /* Verify default values */
+    TEST_ASSERT_EQUAL_UINT16(12U, textBoxWidget.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(8U, textBoxWidget.getHeight());
+    TEST_ASSERT_EQUAL_UINT16(0U, textBoxWidget.getLineCount());
+    TEST_ASSERT_EQUAL_UINT16(0U, textBoxWidget.getPageCount());
+    TEST_ASSERT_EQUAL_UINT16(1U, textBoxWidget.getLinesPerPage());
+    TEST_ASSERT_EQUAL(TextBoxWidget::MODE_PAGE, textBoxWidget.getMode());
+
+    /* Break on word boundaries */
+    textBoxWidget.setText("ab cd ef");
+    TEST_ASSERT_EQUAL_UINT16(3U, textBoxWidget.getLineCount());
+    TEST_ASSERT_EQUAL_UINT16(3U, textBoxWidget.getPageCount());
+    TEST_ASSERT_TRUE(textBoxWidget.getLine(0U, line));
+    TEST_ASSERT_EQUAL_STRING("ab", line.c_str());
+    TEST_ASSERT_TRUE(textBoxWidget.getLine(1U, line));
+    TEST_ASSERT_EQUAL_STRING("cd", line.c_str());
+    TEST_ASSERT_TRUE(textBoxWidget.getLine(2U, line));
+    TEST_ASSERT_EQUAL_STRING("ef", line.c_str());
+    TEST_ASSERT_FALSE(textBoxWidget.getLine(3U, line));
+
+    /* A word, which is wider than the box, is broken at the border. */
+    textBoxWidget.setText("abcdefgh");
+    TEST_ASSERT_EQUAL_UINT16(3U, textBoxWidget.getLineCount());
+    TEST_ASSERT_TRUE(textBoxWidget.getLine(0U, line));
+    TEST_ASSERT_EQUAL_STRING("abc", line.c_str());
+    TEST_ASSERT_TRUE(textBoxWidget.getLine(2U, line));
+    TEST_ASSERT_EQUAL_STRING("gh", line.c_str());
+
+    /* Newline forces a line break. */
+    textBoxWidget.setText("a\nb");
+    TEST_ASSERT_EQUAL_UINT16(2U, textBoxWidget.getLineCount());
+    TEST_ASSERT_TRUE(textBoxWidget.getLine(1U, line));
+    TEST_ASSERT_EQUAL_STRING("b", line.c_str());
+
+    /* More lines per page, if the box is higher. */
+    textBoxWidget.setText("ab cd ef");
+    textBoxWidget.setSize(12U, 12U);
+    TEST_ASSERT_EQUAL_UINT16(2U, textBoxWidget.getLinesPerPage());
+    TEST_ASSERT_EQUAL_UINT16(2U, textBoxWidget.getPageCount());
+
+    /* Drawing is clipped to the box. */
+    textBoxWidget.setSize(12U, 8U);
+    textBoxWidget.update(testGfx);
+    TEST_ASSERT_EQUAL_UINT16(0U, textBoxWidget.getPage());
+    TEST_ASSERT_TRUE(isAnyPixelSet(testGfx, 0, 0, 12, 8));
+    TEST_ASSERT_TRUE(testGfx.verify(12, 0, TestGfx::WIDTH - 12, TestGfx::HEIGHT, 0U));
+
+    /* Page duration and scroll speed */
+    TEST_ASSERT_FALSE(textBoxWidget.setPageDuration(0U));
+    TEST_ASSERT_TRUE(textBoxWidget.setPageDuration(1000U));
+    TEST_ASSERT_EQUAL_UINT32(1000U, textBoxWidget.getPageDuration());
+    TEST_ASSERT_FALSE(textBoxWidget.setScrollSpeed(0U));
+    TEST_ASSERT_TRUE(textBoxWidget.setScrollSpeed(20U));
+    TEST_ASSERT_EQUAL_UINT16(20U, textBoxWidget.getScrollSpeed());
+
+    textBoxWidget.setMode(TextBoxWidget::MODE_SCROLL);
+    TEST_ASSERT_EQUAL(TextBoxWidget::MODE_SCROLL, textBoxWidget.getMode());
+    TEST_ASSERT_EQUAL_UINT32(0U, textBoxWidget.getCycleCount());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Check whether any pixel in the given area is not black.
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] posX      Upper left corner (x-coordinate)
+ * @param[in] posY      Upper left corner (y-coordinate)
+ * @param[in] width     Area width in pixel
+ * @param[in] height    Area height in pixel
+ *
+ * @return If any pixel is set, it will return true otherwise false.
+ */
+static bool isAnyPixelSet(TestGfx& gfx, int16_t posX, int16_t posY, uint16_t width, uint16_t height)
+{
+    bool        isSet   = false;
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+
+    for(y = 0U; (y < height) && (false == isSet); ++y)
+    {
+        for(x = 0U; (x < width) && (false == isSet); ++x)
+        {
+            if (0U != static_cast<uint32_t>(gfx.getColor(posX + x, posY + y)))
+            {
+                isSet = true;
+            }
+        }
+    }
+
+    return isSet;
+}
@@ -37,6 +37,9 @@
 
 #include <unity.h>
 #include <TextWidget.h>
+#include <TextLayoutCache.h>
+#include <WidgetGroup.h>
+#include <Arduino.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -84,6 +87,16 @@ extern void testTextWidget()
     String      testStr     = "test";
     const Color TEXT_COLOR  = 0x123456;
     const char* WIDGET_NAME = "textWidgetName";
+    bool        isScrollingEnabled  = false;
+    uint32_t    scrollingCnt        = 0U;
+    WidgetGroup canvas;
+    TextWidget  scrollWidget;
+    YAGfxText               gfxText;
+    TextLayoutCache         layoutCache;
+    TextLayoutCache::Key    cacheKey;
+    TextLayoutCache::Key    collisionKey;
+    uint16_t                boxWidth    = 0U;
+    uint16_t                boxHeight   = 0U;
 
     /* Verify widget type name */
     TEST_ASSERT_EQUAL_STRING(TextWidget::WIDGET_TYPE, textWidget.getType());
@@ -121,13 +134,15 @@ extern void testTextWidget()
     TEST_ASSERT_EQUAL_UINT32(TEXT_COLOR, textWidget.getTextColor());
 
     /* Check for default font */
-    TEST_ASSERT_NOT_NULL(textWidget.getFont().getGfxFont());
-    TEST_ASSERT_EQUAL_PTR(TextWidget::DEFAULT_FONT, textWidget.getFont().getGfxFont());
+    TEST_ASSERT_TRUE(textWidget.getFont().isAvailable());
+    TEST_ASSERT_EQUAL_PTR(TextWidget::DEFAULT_FONT.getGfxFont(), textWidget.getFont().getGfxFont());
+    TEST_ASSERT_EQUAL_PTR(TextWidget::DEFAULT_FONT.getUnicodeFont(), textWidget.getFont().getUnicodeFont());
 
     /* Font shall be used for drawing */
     textWidget.update(testGfx);
-    TEST_ASSERT_NOT_NULL(textWidget.getFont().getGfxFont());
-    TEST_ASSERT_EQUAL_PTR(TextWidget::DEFAULT_FONT, textWidget.getFont().getGfxFont());
+    TEST_ASSERT_TRUE(textWidget.getFont().isAvailable());
+    TEST_ASSERT_EQUAL_PTR(TextWidget::DEFAULT_FONT.getGfxFont(), textWidget.getFont().getGfxFont());
+    TEST_ASSERT_EQUAL_PTR(TextWidget::DEFAULT_FONT.getUnicodeFont(), textWidget.getFont().getUnicodeFont());
 
     /* Set text with format tag and get text without format tag back. */
     textWidget.setFormatStr("\\#FF00FFHello World!");
@@ -145,6 +160,91 @@ extern void testTextWidget()
     textWidget.setFormatStr("\\#FF00FYeah!");
     TEST_ASSERT_EQUAL_STRING("#FF00FYeah!", textWidget.getStr().c_str());
 
+    /* Setting the same text again shall not cause a update. */
+    textWidget.setFormatStr("Hi");
+    textWidget.update(testGfx);
+    TEST_ASSERT_TRUE(textWidget.getScrollInfo(isScrollingEnabled, scrollingCnt));
+    textWidget.setFormatStr("Hi");
+    TEST_ASSERT_TRUE(textWidget.getScrollInfo(isScrollingEnabled, scrollingCnt));
+
+    /* A different text shall cause a update. */
+    textWidget.setFormatStr("Yo");
+    TEST_ASSERT_FALSE(textWidget.getScrollInfo(isScrollingEnabled, scrollingCnt));
+    textWidget.update(testGfx);
+    TEST_ASSERT_TRUE(textWidget.getScrollInfo(isScrollingEnabled, scrollingCnt));
+    TEST_ASSERT_FALSE(isScrollingEnabled);
+
+    /* Scroll speed */
+    TEST_ASSERT_EQUAL_UINT16(0U, textWidget.getScrollSpeed());
+    TEST_ASSERT_TRUE(textWidget.setScrollSpeed(TextWidget::MAX_SCROLL_SPEED));
+    TEST_ASSERT_EQUAL_UINT16(TextWidget::MAX_SCROLL_SPEED, textWidget.getScrollSpeed());
+    TEST_ASSERT_FALSE(textWidget.setScrollSpeed(TextWidget::MAX_SCROLL_SPEED + 1U));
+    TEST_ASSERT_EQUAL_UINT16(TextWidget::MAX_SCROLL_SPEED, textWidget.getScrollSpeed());
+    TEST_ASSERT_TRUE(textWidget.setScrollSpeed(0U));
+    TEST_ASSERT_EQUAL_UINT16(0U, textWidget.getScrollSpeed());
+
+    /* The scroll movement is derived from the elapsed time. Start with a
+     * static text, which will scroll out, because the next text is too long.
+     */
+    canvas.setPosAndSize(0, 0, testGfx.getWidth(), testGfx.getHeight());
+    TEST_ASSERT_TRUE(canvas.addWidget(scrollWidget));
+    freezeMillis(1000UL);
+    scrollWidget.setFormatStr("Hi all");
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(0, scrollWidget.getScrollOffset());
+    scrollWidget.setFormatStr("Hello World, hello!");
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(0, scrollWidget.getScrollOffset());
+
+    /* 10 pixel/s for 100 ms: 1 pixel */
+    TEST_ASSERT_TRUE(scrollWidget.setScrollSpeed(10U));
+    freezeMillis(1100UL);
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(-1, scrollWidget.getScrollOffset());
+
+    /* No time elapsed, no movement. */
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(-1, scrollWidget.getScrollOffset());
+
+    /* 15 pixel/s for 100 ms: 1.5 pixel, the half pixel is carried over. */
+    TEST_ASSERT_TRUE(scrollWidget.setScrollSpeed(15U));
+    freezeMillis(1200UL);
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(-2, scrollWidget.getScrollOffset());
+    freezeMillis(1300UL);
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(-4, scrollWidget.getScrollOffset());
+
+    /* 20 pixel/s for 1000 ms, but the elapsed time is limited to 250 ms: 5 pixel */
+    TEST_ASSERT_TRUE(scrollWidget.setScrollSpeed(20U));
+    freezeMillis(2300UL);
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(-9, scrollWidget.getScrollOffset());
+
+    /* Default speed is derived from the scroll pause: 160 ms / 80 ms: 2 pixel */
+    TEST_ASSERT_TRUE(scrollWidget.setScrollSpeed(0U));
+    TEST_ASSERT_TRUE(TextWidget::setScrollPause(80U));
+    freezeMillis(2460UL);
+    canvas.update(testGfx);
+    TEST_ASSERT_EQUAL_INT16(-11, scrollWidget.getScrollOffset());
+
+    unfreezeMillis();
+
+    /* The layout cache shall not mix up texts with the same hash. */
+    gfxText.setFont(TextWidget::DEFAULT_FONT);
+    cacheKey = TextLayoutCache::calcKey(gfxText, testGfx.getWidth(), "Hi");
+    TEST_ASSERT_FALSE(layoutCache.find(cacheKey, boxWidth, boxHeight));
+    layoutCache.add(cacheKey, 12U, 8U);
+    TEST_ASSERT_TRUE(layoutCache.find(cacheKey, boxWidth, boxHeight));
+    TEST_ASSERT_EQUAL_UINT16(12U, boxWidth);
+    TEST_ASSERT_EQUAL_UINT16(8U, boxHeight);
+    collisionKey            = cacheKey;
+    collisionKey.textLength = 3U;
+    TEST_ASSERT_FALSE(layoutCache.find(collisionKey, boxWidth, boxHeight));
+    collisionKey            = cacheKey;
+    collisionKey.isWrapped  = true;
+    TEST_ASSERT_FALSE(layoutCache.find(collisionKey, boxWidth, boxHeight));
+
     return;
 }
 
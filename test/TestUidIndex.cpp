@@ -0,0 +1,191 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test unique id index.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestUidIndex.h"
+
+#include <unity.h>
+#include <UidIndex.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test unique id index.
+ */
+extern void testUidIndex()
+{
+    const uint8_t   CAPACITY        = 8U;
+    const uint8_t   POOL_SIZE       = 16U;
+    UidIndex        uidIndex;
+    uint16_t        pool[POOL_SIZE];
+    uint8_t         indices[POOL_SIZE];
+    uint8_t         count           = 0U;
+    uint8_t         idx             = 0U;
+    uint16_t        step            = 0U;
+    uint32_t        random          = 4711U;
+
+    /* Without capacity, nothing can be added. */
+    TEST_ASSERT_FALSE(uidIndex.insert(1U, 0U));
+    TEST_ASSERT_EQUAL_UINT8(UidIndex::INVALID_INDEX, uidIndex.find(1U));
+    TEST_ASSERT_FALSE(uidIndex.create(0U));
+
+    TEST_ASSERT_TRUE(uidIndex.create(CAPACITY));
+    TEST_ASSERT_EQUAL_UINT8(CAPACITY, uidIndex.getCapacity());
+    TEST_ASSERT_EQUAL_UINT8(0U, uidIndex.getCount());
+
+    /* Insert, update and remove. */
+    TEST_ASSERT_FALSE(uidIndex.insert(1U, UidIndex::INVALID_INDEX));
+    TEST_ASSERT_TRUE(uidIndex.insert(1000U, 3U));
+    TEST_ASSERT_TRUE(uidIndex.insert(0U, 4U));
+    TEST_ASSERT_EQUAL_UINT8(2U, uidIndex.getCount());
+    TEST_ASSERT_EQUAL_UINT8(3U, uidIndex.find(1000U));
+    TEST_ASSERT_EQUAL_UINT8(4U, uidIndex.find(0U));
+    TEST_ASSERT_EQUAL_UINT8(UidIndex::INVALID_INDEX, uidIndex.find(1001U));
+
+    TEST_ASSERT_TRUE(uidIndex.insert(1000U, 5U));
+    TEST_ASSERT_EQUAL_UINT8(2U, uidIndex.getCount());
+    TEST_ASSERT_EQUAL_UINT8(5U, uidIndex.find(1000U));
+
+    uidIndex.remove(1000U);
+    uidIndex.remove(1000U);
+    TEST_ASSERT_EQUAL_UINT8(1U, uidIndex.getCount());
+    TEST_ASSERT_EQUAL_UINT8(UidIndex::INVALID_INDEX, uidIndex.find(1000U));
+    TEST_ASSERT_EQUAL_UINT8(4U, uidIndex.find(0U));
+
+    /* The capacity is the limit. */
+    uidIndex.clear();
+    TEST_ASSERT_EQUAL_UINT8(0U, uidIndex.getCount());
+
+    for(idx = 0U; idx < CAPACITY; ++idx)
+    {
+        TEST_ASSERT_TRUE(uidIndex.insert(idx * 100U, idx));
+    }
+
+    TEST_ASSERT_FALSE(uidIndex.insert(UINT16_MAX, 0U));
+    TEST_ASSERT_TRUE(uidIndex.insert(0U, 7U));
+    uidIndex.clear();
+
+    /* Compare with a linear search over random operations. The unique ids
+     * are clustered, to force collisions.
+     */
+    for(idx = 0U; idx < POOL_SIZE; ++idx)
+    {
+        pool[idx]       = ((idx % 4U) * 16384U) + (idx / 4U);
+        indices[idx]    = UidIndex::INVALID_INDEX;
+    }
+
+    for(step = 0U; step < 1000U; ++step)
+    {
+        random  = random * 1103515245U + 12345U;
+        idx     = (random >> 16U) % POOL_SIZE;
+
+        if (0U == ((random >> 8U) % 3U))
+        {
+            uidIndex.remove(pool[idx]);
+
+            if (UidIndex::INVALID_INDEX != indices[idx])
+            {
+                indices[idx] = UidIndex::INVALID_INDEX;
+                --count;
+            }
+        }
+        else
+        {
+            uint8_t index           = (random >> 4U) % CAPACITY;
+            bool    isExpectedOk    = (UidIndex::INVALID_INDEX != indices[idx]) || (CAPACITY > count);
+
+            TEST_ASSERT_EQUAL(isExpectedOk, uidIndex.insert(pool[idx], index));
+
+            if (true == isExpectedOk)
+            {
+                if (UidIndex::INVALID_INDEX == indices[idx])
+                {
+                    ++count;
+                }
+
+                indices[idx] = index;
+            }
+        }
+
+        TEST_ASSERT_EQUAL_UINT8(count, uidIndex.getCount());
+
+        for(idx = 0U; idx < POOL_SIZE; ++idx)
+        {
+            TEST_ASSERT_EQUAL_UINT8(indices[idx], uidIndex.find(pool[idx]));
+        }
+    }
+
+    uidIndex.release();
+    TEST_ASSERT_EQUAL_UINT8(0U, uidIndex.getCapacity());
+    TEST_ASSERT_EQUAL_UINT8(UidIndex::INVALID_INDEX, uidIndex.find(0U));
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -207,6 +207,13 @@ extern void testUtil(void)
     hexStr = "0y5";
     TEST_ASSERT_EQUAL_UINT32(0U, Util::hexToUInt32(hexStr));
 
+    /* FNV-1a hash */
+    TEST_ASSERT_EQUAL_UINT32(0x811c9dc5U, Util::hashFnv1aStr(""));
+    TEST_ASSERT_EQUAL_UINT32(0xe40c292cU, Util::hashFnv1aStr("a"));
+    TEST_ASSERT_EQUAL_UINT32(0xbf9cf968U, Util::hashFnv1aStr("foobar"));
+    TEST_ASSERT_EQUAL_UINT32(0xbf9cf968U, Util::hashFnv1aStr("bar", Util::hashFnv1aStr("foo")));
+    TEST_ASSERT_EQUAL_UINT32(0xbf9cf968U, Util::hashFnv1a("foobar", 6U));
+
     return;
 }
 
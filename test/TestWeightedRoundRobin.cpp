@@ -0,0 +1,159 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test weighted round robin.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestWeightedRoundRobin.h"
+
+#include <unity.h>
+#include <WeightedRoundRobin.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test weighted round robin.
+ */
+extern void testWeightedRoundRobin()
+{
+    WeightedRoundRobin  rr;
+    const uint8_t       EXPECTED[]  = { 0U, 1U, 0U, 2U, 0U, 1U, 0U };
+    uint8_t             index       = WeightedRoundRobin::INVALID_INDEX;
+    uint8_t             count       = 0U;
+
+    /* Without indices, nothing can be selected. */
+    TEST_ASSERT_EQUAL_UINT8(0U, rr.getCount());
+    TEST_ASSERT_EQUAL_UINT8(WeightedRoundRobin::INVALID_INDEX, rr.peek(WeightedRoundRobin::INVALID_INDEX));
+    TEST_ASSERT_FALSE(rr.create(0U));
+    TEST_ASSERT_TRUE(rr.create(4U));
+    TEST_ASSERT_EQUAL_UINT8(4U, rr.getCount());
+
+    /* All weights are 0 after creation. */
+    TEST_ASSERT_EQUAL_UINT8(0U, rr.getWeight(0U));
+    TEST_ASSERT_EQUAL_UINT8(WeightedRoundRobin::INVALID_INDEX, rr.peek(0U));
+
+    /* Equal weights result in a plain round robin, index 2 is skipped. */
+    rr.setWeight(0U, 1U);
+    rr.setWeight(1U, 1U);
+    rr.setWeight(3U, 1U);
+    TEST_ASSERT_EQUAL_UINT8(1U, rr.getWeight(3U));
+    TEST_ASSERT_EQUAL_UINT8(0U, rr.getWeight(4U));
+
+    index = rr.peek(WeightedRoundRobin::INVALID_INDEX);
+    TEST_ASSERT_EQUAL_UINT8(0U, index);
+
+    for(count = 0U; count < 8U; ++count)
+    {
+        const uint8_t ORDER[] = { 0U, 1U, 3U };
+
+        index = rr.peek(index);
+        TEST_ASSERT_EQUAL_UINT8(ORDER[(count + 1U) % 3U], index);
+
+        /* Peek doesn't change the rotation. */
+        TEST_ASSERT_EQUAL_UINT8(index, rr.peek((0U == index) ? 3U : (index - 1U)));
+
+        rr.commit(index);
+    }
+
+    /* Weighted rotation is spread: 4:2:1 */
+    TEST_ASSERT_TRUE(rr.create(3U));
+    rr.setWeight(0U, 4U);
+    rr.setWeight(1U, 2U);
+    rr.setWeight(2U, 1U);
+
+    index = WeightedRoundRobin::INVALID_INDEX;
+
+    for(count = 0U; count < (2U * sizeof(EXPECTED)); ++count)
+    {
+        index = rr.peek(index);
+        TEST_ASSERT_EQUAL_UINT8(EXPECTED[count % sizeof(EXPECTED)], index);
+        rr.commit(index);
+    }
+
+    /* A index without weight is never selected, even with a commit. */
+    rr.setWeight(0U, 0U);
+    rr.commit(0U);
+
+    for(count = 0U; count < 6U; ++count)
+    {
+        index = rr.peek(index);
+        TEST_ASSERT_NOT_EQUAL(0U, index);
+        rr.commit(index);
+    }
+
+    /* Nothing to select anymore. */
+    rr.setWeight(1U, 0U);
+    rr.setWeight(2U, 0U);
+    TEST_ASSERT_EQUAL_UINT8(WeightedRoundRobin::INVALID_INDEX, rr.peek(index));
+
+    rr.release();
+    TEST_ASSERT_EQUAL_UINT8(0U, rr.getCount());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -38,6 +38,7 @@
 
 #include <unity.h>
 #include <WidgetGroup.h>
+#include <LampWidget.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -58,6 +59,8 @@
 template < typename T >
 static T getMin(const T value1, const T value2);
 
+static String getIndexTestName(uint16_t idx);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -184,6 +187,154 @@ extern void testWidgetGroup()
     return;
 }
 
+/**
+ * Widget group tests, which find widgets via the name index.
+ */
+extern void testWidgetGroupIndex()
+{
+    const uint16_t  WIDGET_CNT  = 40U;
+
+    WidgetGroup     rootGroup(8U, 8U, 0, 0);
+    WidgetGroup     subGroup(8U, 8U, 0, 0);
+    TestWidget      widgets[WIDGET_CNT];
+    TestWidget      otherWidget;
+    WidgetNames&    names       = WidgetNames::getInstance();
+    uint16_t        nameId      = WidgetNames::INVALID_ID;
+    uint16_t        idx         = 0U;
+
+    /* Interning the same name twice results in the same id. */
+    nameId = names.intern("indexTest");
+    TEST_ASSERT_NOT_EQUAL(WidgetNames::INVALID_ID, nameId);
+    TEST_ASSERT_EQUAL_UINT16(nameId, names.intern("indexTest"));
+    TEST_ASSERT_EQUAL_UINT16(nameId, names.getId("indexTest"));
+    TEST_ASSERT_EQUAL_UINT16(WidgetNames::INVALID_ID, names.intern(""));
+    TEST_ASSERT_EQUAL_UINT16(WidgetNames::INVALID_ID, names.getId("indexTestUnknown"));
+
+    /* Widgets in a sub group, which is added afterwards to the root group. */
+    TEST_ASSERT_TRUE(rootGroup.addWidget(otherWidget));
+
+    for(idx = 0U; idx < WIDGET_CNT; ++idx)
+    {
+        widgets[idx].setName(getIndexTestName(idx));
+        TEST_ASSERT_TRUE(subGroup.addWidget(widgets[idx]));
+    }
+
+    TEST_ASSERT_TRUE(rootGroup.addWidget(subGroup));
+
+    for(idx = 0U; idx < WIDGET_CNT; ++idx)
+    {
+        TEST_ASSERT_EQUAL_PTR(&widgets[idx], rootGroup.find(getIndexTestName(idx)));
+        TEST_ASSERT_EQUAL_PTR(&widgets[idx], rootGroup.find(widgets[idx].getNameId()));
+        TEST_ASSERT_EQUAL_PTR(&widgets[idx], subGroup.find(widgets[idx].getNameId()));
+    }
+
+    /* A renamed widget is only found with its new name. */
+    widgets[3].setName("indexTest");
+    TEST_ASSERT_NULL(rootGroup.find(getIndexTestName(3U)));
+    TEST_ASSERT_EQUAL_PTR(&widgets[3], rootGroup.find(nameId));
+
+    /* A widget, which is named after it was added, is found. */
+    otherWidget.setName("indexTestOther");
+    TEST_ASSERT_EQUAL_PTR(&otherWidget, rootGroup.find("indexTestOther"));
+
+    /* Removed widgets are not found anymore, all others still are. */
+    for(idx = 0U; idx < WIDGET_CNT; idx += 2U)
+    {
+        TEST_ASSERT_TRUE(subGroup.removeWidget(widgets[idx]));
+    }
+
+    for(idx = 0U; idx < WIDGET_CNT; ++idx)
+    {
+        Widget* expected = (0U == (idx % 2U)) ? nullptr : &widgets[idx];
+
+        TEST_ASSERT_EQUAL_PTR(expected, rootGroup.find(widgets[idx].getNameId()));
+        TEST_ASSERT_EQUAL_PTR(expected, subGroup.find(widgets[idx].getNameId()));
+    }
+
+    /* Renaming a removed widget has no effect to the group. */
+    widgets[0].setName(getIndexTestName(1U));
+    TEST_ASSERT_EQUAL_PTR(&widgets[1], rootGroup.find(getIndexTestName(1U)));
+
+    /* Removing the sub group removes its widgets from the root group index. */
+    TEST_ASSERT_TRUE(rootGroup.removeWidget(subGroup));
+    TEST_ASSERT_NULL(rootGroup.find(getIndexTestName(1U)));
+    TEST_ASSERT_EQUAL_PTR(&widgets[1], subGroup.find(getIndexTestName(1U)));
+    TEST_ASSERT_EQUAL_PTR(&otherWidget, rootGroup.find("indexTestOther"));
+
+    return;
+}
+
+/**
+ * Widget group tests, which only repaint invalidated regions.
+ */
+extern void testWidgetGroupInvalidation()
+{
+    const uint16_t  CANVAS_WIDTH    = 8;
+    const uint16_t  CANVAS_HEIGHT   = 8;
+    const Color     GARBAGE_COLOR   = 0x111111;
+    const Color     COLOR_OFF       = 0x000010;
+    const Color     COLOR_ON        = 0x001000;
+
+    TestGfx     testGfx;
+    WidgetGroup testWGroup(CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0);
+    LampWidget  lamp1(false, COLOR_OFF, COLOR_ON, 4U);
+    LampWidget  lamp2(false, COLOR_OFF, COLOR_ON, 4U);
+
+    lamp2.move(0, 2);
+    TEST_ASSERT_TRUE(testWGroup.addWidget(lamp1));
+    TEST_ASSERT_TRUE(testWGroup.addWidget(lamp2));
+
+    /* The first update paints the whole group and clears its background. */
+    testGfx.fill(GARBAGE_COLOR);
+    TEST_ASSERT_TRUE(testWGroup.isDirty());
+    TEST_ASSERT_TRUE(testWGroup.updateInvalidated(testGfx));
+    TEST_ASSERT_FALSE(testWGroup.isDirty());
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 4U, 1U, COLOR_OFF));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 2, 4U, 1U, COLOR_OFF));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 1, CANVAS_WIDTH, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(4, 0, CANVAS_WIDTH - 4U, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 3, CANVAS_WIDTH, CANVAS_HEIGHT - 3U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(CANVAS_WIDTH, 0, 1U, 1U, GARBAGE_COLOR));
+
+    /* Nothing changed, nothing to paint. */
+    testGfx.setCallCounterDrawPixel(0);
+    TEST_ASSERT_FALSE(testWGroup.updateInvalidated(testGfx));
+    TEST_ASSERT_EQUAL_UINT32(0, testGfx.getCallCounterDrawPixel());
+
+    /* Only the changed lamp is cleared and painted again. */
+    lamp1.setOnState(true);
+    TEST_ASSERT_TRUE(testWGroup.isDirty());
+    TEST_ASSERT_TRUE(testWGroup.updateInvalidated(testGfx));
+    TEST_ASSERT_EQUAL_UINT32(2U * 4U, testGfx.getCallCounterDrawPixel());
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 4U, 1U, COLOR_ON));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 2, 4U, 1U, COLOR_OFF));
+
+    /* Moving a lamp clears its old region too. The other lamp overlaps the
+     * dirty region and is painted again.
+     */
+    lamp1.move(0, 4);
+    TEST_ASSERT_TRUE(testWGroup.updateInvalidated(testGfx));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 4U, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 2, 4U, 1U, COLOR_OFF));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 4, 4U, 1U, COLOR_ON));
+
+    /* A disabled lamp is removed. */
+    lamp1.disable();
+    TEST_ASSERT_TRUE(testWGroup.updateInvalidated(testGfx));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 4, 4U, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 2, 4U, 1U, COLOR_OFF));
+
+    /* A complete update paints everything and leaves the group clean. */
+    testGfx.fill(0U);
+    lamp1.enable();
+    testWGroup.update(testGfx);
+    TEST_ASSERT_FALSE(testWGroup.isDirty());
+    TEST_ASSERT_TRUE(testGfx.verify(0, 4, 4U, 1U, COLOR_ON));
+    TEST_ASSERT_FALSE(testWGroup.updateInvalidated(testGfx));
+
+    return;
+}
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
@@ -206,3 +357,19 @@ static T getMin(const T value1, const T value2)
 
     return value2;
 }
+
+/**
+ * Get a unique widget name for the index test.
+ *
+ * @param[in] idx   Widget index, max. 50
+ *
+ * @return Widget name
+ */
+static String getIndexTestName(uint16_t idx)
+{
+    String name = "w";
+
+    name += static_cast<char>('A' + idx);
+
+    return name;
+}
@@ -61,6 +61,16 @@
  */
 extern void testWidgetGroup();
 
+/**
+ * Widget group tests, which find widgets via the name index.
+ */
+extern void testWidgetGroupIndex();
+
+/**
+ * Widget group tests, which only repaint invalidated regions.
+ */
+extern void testWidgetGroupInvalidation();
+
 #endif  /* __TEST_WIDGET_GROUP_H__ */
 
 /** @} */
\ No newline at end of file
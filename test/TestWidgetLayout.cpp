@@ -0,0 +1,246 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Test widget layout.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestWidgetLayout.h"
+#include "TestGfx.h"
+
+#include <unity.h>
+#include <FS.h>
+#include <WidgetLayout.h>
+#include <LampWidget.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static bool writeFile(FS& fs, const char* fileName, const uint8_t* data, size_t size);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Compiled layout:
+ * - Group at (2, 0) with 4x4 pixels
+ *   - Lamp "layoutLamp" at (1, 1) with 6 pixels width, which is clipped by the group.
+ * - Lamp at (0, 5) with 2 pixels width
+ * - Text "layoutText" at (8, 0) with 16x8 pixels
+ */
+static const uint8_t    gLayout[] =
+{
+    'W', 'L', 'Y', 0x01, 0x04,              /* Header: magic, version, number of nodes */
+
+    0x00, 0xFF,                             /* Group on root level */
+    0x02, 0x00, 0x00, 0x00,                 /* x, y */
+    0x04, 0x00, 0x04, 0x00,                 /* Width, height */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     /* Colors */
+    0x00, 0x00, 0x00,                       /* Option, name length, value length */
+
+    0x03, 0x00,                             /* Lamp in the group */
+    0x01, 0x00, 0x01, 0x00,                 /* x, y */
+    0x06, 0x00, 0x01, 0x00,                 /* Width, height */
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,     /* Color on, color off */
+    0x01, 0x0A, 0x00,                       /* On, name length, value length */
+    'l', 'a', 'y', 'o', 'u', 't', 'L', 'a', 'm', 'p',
+
+    0x03, 0xFF,                             /* Lamp on root level */
+    0x00, 0x00, 0x05, 0x00,                 /* x, y */
+    0x02, 0x00, 0x01, 0x00,                 /* Width, height */
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,     /* Color on, color off */
+    0x00, 0x00, 0x00,                       /* Off, name length, value length */
+
+    0x02, 0xFF,                             /* Text on root level */
+    0x08, 0x00, 0x00, 0x00,                 /* x, y */
+    0x10, 0x00, 0x08, 0x00,                 /* Width, height */
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,     /* Text color */
+    0x00, 0x0A, 0x00,                       /* Option, name length, value length */
+    'l', 'a', 'y', 'o', 'u', 't', 'T', 'e', 'x', 't'
+};
+
+/**
+ * Invalid layout, because the parent is stored after its child.
+ */
+static const uint8_t    gLayoutInvalidParent[] =
+{
+    'W', 'L', 'Y', 0x01, 0x02,              /* Header: magic, version, number of nodes */
+
+    0x03, 0x01,                             /* Lamp in the group */
+    0x00, 0x00, 0x00, 0x00,                 /* x, y */
+    0x02, 0x00, 0x01, 0x00,                 /* Width, height */
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,     /* Color on, color off */
+    0x00, 0x00, 0x00,                       /* Option, name length, value length */
+
+    0x00, 0xFF,                             /* Group on root level */
+    0x00, 0x00, 0x00, 0x00,                 /* x, y */
+    0x04, 0x00, 0x04, 0x00,                 /* Width, height */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     /* Colors */
+    0x00, 0x00, 0x00                        /* Option, name length, value length */
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Test widget layout.
+ */
+extern void testWidgetLayout()
+{
+    const Color     COLOR_ON        = 0x00FF00;
+    const Color     COLOR_OFF       = 0x0000FF;
+    const char*     testFileName    = "./test/testLayout.wly";
+
+    FS              localFileSystem;
+    TestGfx         testGfx;
+    WidgetLayout    layout;
+    LampWidget*     lamp            = nullptr;
+
+    /* File not found */
+    TEST_ASSERT_FALSE(layout.load(localFileSystem, testFileName));
+    TEST_ASSERT_EQUAL_UINT8(0U, layout.getWidgetCount());
+
+    /* Not a layout file */
+    TEST_ASSERT_FALSE(layout.load(localFileSystem, "./test/test24bpp.bmp"));
+
+    /* The parent must be stored before its children. */
+    TEST_ASSERT_TRUE(writeFile(localFileSystem, testFileName, gLayoutInvalidParent, sizeof(gLayoutInvalidParent)));
+    TEST_ASSERT_FALSE(layout.load(localFileSystem, testFileName));
+    TEST_ASSERT_EQUAL_UINT8(0U, layout.getWidgetCount());
+
+    /* Truncated layout */
+    TEST_ASSERT_TRUE(writeFile(localFileSystem, testFileName, gLayout, sizeof(gLayout) - 1U));
+    TEST_ASSERT_FALSE(layout.load(localFileSystem, testFileName));
+    TEST_ASSERT_EQUAL_UINT8(0U, layout.getWidgetCount());
+
+    /* Valid layout, the group is not instantiated. */
+    TEST_ASSERT_TRUE(writeFile(localFileSystem, testFileName, gLayout, sizeof(gLayout)));
+    TEST_ASSERT_TRUE(layout.load(localFileSystem, testFileName));
+    TEST_ASSERT_TRUE(localFileSystem.remove(testFileName));
+    TEST_ASSERT_EQUAL_UINT8(3U, layout.getWidgetCount());
+    TEST_ASSERT_NULL(layout.getWidget(3U));
+
+    /* Find widgets by name. */
+    TEST_ASSERT_EQUAL_PTR(layout.getWidget(0U), layout.find("layoutLamp"));
+    TEST_ASSERT_EQUAL_PTR(layout.getWidget(2U), layout.find("layoutText"));
+    TEST_ASSERT_EQUAL_PTR(layout.getWidget(2U), layout.find(WidgetNames::getInstance().getId("layoutText")));
+    TEST_ASSERT_NULL(layout.find("layoutUnknown"));
+    TEST_ASSERT_EQUAL_STRING(LampWidget::WIDGET_TYPE, layout.getWidget(0U)->getType());
+
+    /* The lamp in the group is clipped by the group. */
+    testGfx.fill(0U);
+    TEST_ASSERT_TRUE(layout.isDirty());
+    layout.update(testGfx);
+    TEST_ASSERT_FALSE(layout.isDirty());
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, 32U, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 1, 3U, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(3, 1, 3U, 1U, COLOR_ON));
+    TEST_ASSERT_TRUE(testGfx.verify(6, 1, 26U, 1U, 0U));
+    TEST_ASSERT_TRUE(testGfx.verify(0, 5, 2U, 1U, COLOR_OFF));
+    TEST_ASSERT_TRUE(testGfx.verify(2, 5, 30U, 1U, 0U));
+
+    /* Widgets are configured via the layout. */
+    lamp = static_cast<LampWidget*>(layout.find("layoutLamp"));
+    lamp->setOnState(false);
+    TEST_ASSERT_TRUE(layout.isDirty());
+    layout.update(testGfx);
+    TEST_ASSERT_TRUE(testGfx.verify(3, 1, 3U, 1U, COLOR_OFF));
+
+    /* Invalidation forces a repaint of all widgets. */
+    TEST_ASSERT_FALSE(layout.isDirty());
+    layout.invalidate();
+    TEST_ASSERT_TRUE(layout.isDirty());
+
+    /* Destroy all widgets. */
+    layout.clear();
+    TEST_ASSERT_EQUAL_UINT8(0U, layout.getWidgetCount());
+    TEST_ASSERT_NULL(layout.find("layoutLamp"));
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Write data to a file.
+ *
+ * @param[in] fs        Filesystem
+ * @param[in] fileName  Name of the file
+ * @param[in] data      Data
+ * @param[in] size      Data size in byte
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool writeFile(FS& fs, const char* fileName, const uint8_t* data, size_t size)
+{
+    bool isSuccessful   = false;
+    File fd             = fs.open(fileName, "w");
+
+    if (true == fd)
+    {
+        if (size == fd.write(data, size))
+        {
+            isSuccessful = true;
+        }
+
+        fd.close();
+    }
+
+    return isSuccessful;
+}